@@ -1,34 +1,213 @@
 // vis_stream/cpp_backend/include/vis_primitives.h
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace Vis {
 
 class IObserver;
 class Observable;
+class EditScope;
+
+// 图元的具体类型，构造时确定。服务端按它做一次 switch 分派，
+// 不必逐个尝试 dynamic_cast
+enum class ObjectType : uint8_t {
+  POINT_2D,
+  POSE_2D,
+  CIRCLE,
+  BOX_2D,
+  LINE_2D,
+  TRAJECTORY_2D,
+  POLYGON,
+  POINT_3D,
+  POSE_3D,
+  BALL,
+  BOX_3D,
+  LINE_3D,
+  POINT_CLOUD_3D,
+  BOX_3D_ARRAY,
+  CIRCLE_ARRAY,
+  POSE_2D_ARRAY,
+  TRIANGLE_MESH_3D,
+  OCCUPANCY_GRID
+};
+
 class IObserver {
  public:
   virtual ~IObserver() = default;
   virtual void on_update(Observable* subject) = 0;
+  // EditScope 结束时把本线程攒下的图元一次交给观察者，默认逐个调用 on_update
+  virtual void on_update_batch(Observable* const* subjects, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      on_update(subjects[i]);
+    }
+  }
+  // 被观察对象析构时回调；此时派生类部分已析构，只能访问 Observable 自身成员
+  virtual void on_release(Observable* subject) { (void)subject; }
 };
 class Observable {
  public:
-  virtual ~Observable() = default;
-  void set_observer(IObserver* observer) { m_observer = observer; }
+  explicit Observable(ObjectType type) : m_type(type) {}
+  // 拷贝出的对象是一个新图元，不继承原对象的观察者和脏字段
+  Observable(const Observable& other)
+      : m_type(other.m_type), m_observer(nullptr) {}
+  Observable& operator=(const Observable&) { return *this; }
+  virtual ~Observable();
+  // token 由观察者分配，用于在回调中直接定位对象，免去按地址查表
+  void set_observer(IObserver* observer, uint32_t token = 0) {
+    m_observer = observer;
+    m_observer_token = observer ? token : 0;
+  }
+  uint32_t observer_token() const { return m_observer_token; }
+  ObjectType type() const { return m_type; }
+
+  // 单个图元的批量修改：Edit 存活期间 setter 只记录脏字段，
+  // 析构时若有修改则通知一次。可嵌套，只能在修改该图元的线程中使用
+  class Edit {
+   public:
+    explicit Edit(Observable& subject) : m_subject(subject) {
+      ++m_subject.m_edit_depth;
+    }
+    ~Edit() {
+      if (--m_subject.m_edit_depth == 0 && m_subject.m_edit_pending) {
+        m_subject.m_edit_pending = false;
+        m_subject.dispatch_update();
+      }
+    }
+    Edit(const Edit&) = delete;
+    Edit& operator=(const Edit&) = delete;
+
+   private:
+    Observable& m_subject;
+  };
+  // auto edit = box->edit(); 之后的 set_* 合并为一次通知
+  Edit edit() { return Edit(*this); }
+
+  // 取走自上次调用以来被修改过的字段（各图元类的 k*Field 位）并清零。
+  // 服务端发出更新时调用，据此只发送变化的字段
+  uint32_t take_dirty_fields() {
+    return m_dirty_fields.exchange(0, std::memory_order_relaxed);
+  }
 
  protected:
-  void notify_update() {
-    if (m_observer) {
-      m_observer->on_update(this);
+  static constexpr uint32_t kAllFields = ~0u;
+
+  // fields 为本次修改的字段；不细分字段的图元总是整体标脏
+  void notify_update(uint32_t fields = kAllFields) {
+    m_dirty_fields.fetch_or(fields, std::memory_order_relaxed);
+    if (!m_observer) return;
+    if (m_edit_depth > 0) {
+      m_edit_pending = true;
+      return;
     }
+    dispatch_update();
   }
 
  private:
+  friend class EditScope;
+
+  // 通知观察者；本线程处于 EditScope 中时只登记，留到作用域结束
+  void dispatch_update();
+
+  const ObjectType m_type;
+  // 用户线程写入、刷新线程取走，用原子操作避免两边同时修改时丢位
+  std::atomic<uint32_t> m_dirty_fields{kAllFields};
   IObserver* m_observer = nullptr;
+  uint32_t m_observer_token = 0;
+  int m_edit_depth = 0;         // 嵌套的 Edit 层数
+  bool m_edit_pending = false;  // Edit 期间有过修改
+  bool m_scope_pending = false;  // 已登记在本线程 EditScope 的待通知列表中
 };
 
+// 线程级批量修改：作用域内本线程修改的图元只登记一次，不立即通知；
+// 最外层作用域结束时按观察者分组一次交出，服务端整批只加一次锁。
+// 作用域内析构的图元会从待通知列表中移除，因此作用域内登记过的图元
+// 不能由其他线程析构。
+//
+//   {
+//     Vis::EditScope scope;
+//     for (auto& box : boxes) box->set_center(...);
+//   }  // 这里统一标脏
+class EditScope {
+ public:
+  EditScope() { ++state().depth; }
+  ~EditScope();
+  EditScope(const EditScope&) = delete;
+  EditScope& operator=(const EditScope&) = delete;
+
+ private:
+  friend class Observable;
+
+  struct State {
+    int depth = 0;
+    std::vector<Observable*> pending;
+  };
+  static State& state() {
+    static thread_local State s;
+    return s;
+  }
+};
+
+inline Observable::~Observable() {
+  if (m_scope_pending) {
+    auto& pending = EditScope::state().pending;
+    pending.erase(std::remove(pending.begin(), pending.end(), this),
+                  pending.end());
+  }
+  if (m_observer) {
+    m_observer->on_release(this);
+  }
+}
+
+inline void Observable::dispatch_update() {
+  if (!m_observer) return;
+  EditScope::State& scope = EditScope::state();
+  if (scope.depth > 0) {
+    if (!m_scope_pending) {
+      m_scope_pending = true;
+      scope.pending.push_back(this);
+    }
+    return;
+  }
+  m_observer->on_update(this);
+}
+
+inline EditScope::~EditScope() {
+  State& s = state();
+  if (--s.depth > 0 || s.pending.empty()) return;
+  // 先换出：观察者回调中若再次修改图元，会按普通路径立即通知
+  std::vector<Observable*> pending;
+  pending.swap(s.pending);
+  for (Observable* subject : pending) {
+    subject->m_scope_pending = false;
+  }
+  // 按观察者分组，通常只有一个
+  auto begin = pending.begin();
+  while (begin != pending.end()) {
+    IObserver* observer = (*begin)->m_observer;
+    auto end = std::stable_partition(
+        begin, pending.end(),
+        [observer](Observable* o) { return o->m_observer == observer; });
+    if (observer) {
+      observer->on_update_batch(&*begin, static_cast<size_t>(end - begin));
+    }
+    begin = end;
+  }
+  // 留下容量给下一个作用域
+  if (s.pending.empty()) {
+    pending.clear();
+    s.pending.swap(pending);
+  }
+}
+
 // --- 基础数据结构 ---
 struct Vec2 {
   float x = 0.f;
@@ -45,11 +224,18 @@ struct Quaternion {
   float y = 0.f;
   float z = 0.f;
 };
+// 点云的逐点颜色，每通道 1 字节
+struct ColorRGB8 {
+  uint8_t r = 255;
+  uint8_t g = 255;
+  uint8_t b = 255;
+};
 
 // --- 2D 几何体类 ---
 
 class Point2D : public Observable {
  public:
+  static constexpr ObjectType kType = ObjectType::POINT_2D;
   static std::shared_ptr<Point2D> create(Vec2 pos = {}) {
     return std::shared_ptr<Point2D>(new Point2D(pos));
   }
@@ -60,81 +246,95 @@ class Point2D : public Observable {
   Vec2 get_position() const { return m_pos; }
 
  private:
-  Point2D(Vec2 pos) : m_pos(pos) {}
+  Point2D(Vec2 pos) : Observable(kType), m_pos(pos) {}
   Vec2 m_pos;
 };
 
 class Pose2D : public Observable {
  public:
-  Pose2D() : m_pos({}), m_theta(0.f) {}
+  static constexpr ObjectType kType = ObjectType::POSE_2D;
+  // 各 setter 标脏的字段位，见 Observable::take_dirty_fields
+  static constexpr uint32_t kPositionField = 1u << 0;
+  static constexpr uint32_t kAngleField = 1u << 1;
+  Pose2D() : Observable(kType), m_pos({}), m_theta(0.f) {}
   static std::shared_ptr<Pose2D> create(Vec2 pos = {}, float theta = 0.f) {
     return std::shared_ptr<Pose2D>(new Pose2D(pos, theta));
   }
   void set_position(Vec2 pos) {
     m_pos = pos;
-    notify_update();
+    notify_update(kPositionField);
   }
   void set_angle(float theta) {
     m_theta = theta;
-    notify_update();
+    notify_update(kAngleField);
   }
   void set_pose(Vec2 pos, float theta) {
     m_pos = pos;
     m_theta = theta;
-    notify_update();
+    notify_update(kPositionField | kAngleField);
   }
   Vec2 get_position() const { return m_pos; }
   float get_angle() const { return m_theta; }
 
  private:
-  Pose2D(Vec2 pos, float theta) : m_pos(pos), m_theta(theta) {}
+  Pose2D(Vec2 pos, float theta)
+      : Observable(kType), m_pos(pos), m_theta(theta) {}
   Vec2 m_pos;
   float m_theta;
 };
 
 class Circle : public Observable {
  public:
+  static constexpr ObjectType kType = ObjectType::CIRCLE;
+  static constexpr uint32_t kCenterField = 1u << 0;
+  static constexpr uint32_t kRadiusField = 1u << 1;
   static std::shared_ptr<Circle> create(Vec2 center = {}, float radius = 1.f) {
     return std::shared_ptr<Circle>(new Circle(center, radius));
   }
   void set_center(Vec2 center) {
     m_center = center;
-    notify_update();
+    notify_update(kCenterField);
   }
   void set_radius(float radius) {
     m_radius = radius;
-    notify_update();
+    notify_update(kRadiusField);
   }
   Vec2 get_center() const { return m_center; }
   float get_radius() const { return m_radius; }
 
  private:
-  Circle(Vec2 center, float radius) : m_center(center), m_radius(radius) {}
+  Circle(Vec2 center, float radius)
+      : Observable(kType), m_center(center), m_radius(radius) {}
   Vec2 m_center;
   float m_radius;
 };
 
 class Box2D : public Observable {
  public:
+  static constexpr ObjectType kType = ObjectType::BOX_2D;
+  static constexpr uint32_t kCenterField = 1u << 0;
+  static constexpr uint32_t kWidthField = 1u << 1;
+  static constexpr uint32_t kLengthFrontField = 1u << 2;
+  static constexpr uint32_t kLengthRearField = 1u << 3;
   static std::shared_ptr<Box2D> create(Pose2D center = {}, float width = 1.f,
                                        float len_f = 1.f, float len_r = 1.f) {
     return std::shared_ptr<Box2D>(new Box2D(center, width, len_f, len_r));
   }
   void set_center(Pose2D center) {
     m_center = center;
-    notify_update();
+    notify_update(kCenterField);
   }
   void set_width(float width) {
     m_width = width;
-    notify_update();
+    notify_update(kWidthField);
   }
   void set_length_front(float len) {
     m_length_front = len;
-    notify_update();
+    notify_update(kLengthFrontField);
   }
   void set_length_rear(float len) {
     m_length_rear = len;
-    notify_update();
+    notify_update(kLengthRearField);
   }
   Pose2D get_center() const { return m_center; }
   float get_width() const { return m_width; }
@@ -143,7 +343,8 @@ class Box2D : public Observable {
 
  private:
   Box2D(Pose2D center, float width, float len_f, float len_r)
-      : m_center(center),
+      : Observable(kType),
+        m_center(center),
         m_width(width),
         m_length_front(len_f),
         m_length_rear(len_r) {}
@@ -153,11 +354,13 @@ class Box2D : public Observable {
 
 class Line2D : public Observable {
  public:
+  static constexpr ObjectType kType = ObjectType::LINE_2D;
   static std::shared_ptr<Line2D> create(const std::vector<Vec2>& points = {}) {
     return std::shared_ptr<Line2D>(new Line2D(points));
   }
   void set_points(const std::vector<Vec2>& points) {
     m_points = points;
+    ++m_revision;
     notify_update();
   }
   void add_point(Vec2 p) {
@@ -166,23 +369,30 @@ class Line2D : public Observable {
   }
   void clear() {
     m_points.clear();
+    ++m_revision;
     notify_update();
   }
   const std::vector<Vec2>& get_points() const { return m_points; }
+  // 替换或清空时递增，add_point 不变：服务端据此判断两次发送之间是否只有追加
+  uint32_t revision() const { return m_revision; }
 
  private:
-  Line2D(const std::vector<Vec2>& points) : m_points(points) {}
+  Line2D(const std::vector<Vec2>& points)
+      : Observable(kType), m_points(points) {}
   std::vector<Vec2> m_points;
+  uint32_t m_revision = 0;
 };
 
 class Trajectory2D : public Observable {
  public:
+  static constexpr ObjectType kType = ObjectType::TRAJECTORY_2D;
   static std::shared_ptr<Trajectory2D> create(
       const std::vector<Box2D>& poses = {}) {
     return std::shared_ptr<Trajectory2D>(new Trajectory2D(poses));
   }
   void set_poses(const std::vector<Box2D>& poses) {
     m_poses = poses;
+    ++m_revision;
     notify_update();
   }
   void add_pose(const Box2D& pose) {
@@ -191,17 +401,23 @@ class Trajectory2D : public Observable {
   }
   void clear() {
     m_poses.clear();
+    ++m_revision;
     notify_update();
   }
   const std::vector<Box2D>& get_poses() const { return m_poses; }
+  // 同 Line2D::revision
+  uint32_t revision() const { return m_revision; }
 
  private:
-  Trajectory2D(const std::vector<Box2D>& poses) : m_poses(poses) {}
+  Trajectory2D(const std::vector<Box2D>& poses)
+      : Observable(kType), m_poses(poses) {}
   std::vector<Box2D> m_poses;
+  uint32_t m_revision = 0;
 };
 
 class Polygon : public Observable {
  public:
+  static constexpr ObjectType kType = ObjectType::POLYGON;
   static std::shared_ptr<Polygon> create(
       const std::vector<Vec2>& vertices = {}) {
     return std::shared_ptr<Polygon>(new Polygon(vertices));
@@ -221,7 +437,8 @@ class Polygon : public Observable {
   const std::vector<Vec2>& get_vertices() const { return m_vertices; }
 
  private:
-  Polygon(const std::vector<Vec2>& vertices) : m_vertices(vertices) {}
+  Polygon(const std::vector<Vec2>& vertices)
+      : Observable(kType), m_vertices(vertices) {}
   std::vector<Vec2> m_vertices;
 };
 
@@ -229,6 +446,7 @@ class Polygon : public Observable {
 
 class Point3D : public Observable {
  public:
+  static constexpr ObjectType kType = ObjectType::POINT_3D;
   static std::shared_ptr<Point3D> create(Vec3 pos = {}) {
     return std::shared_ptr<Point3D>(new Point3D(pos));
   }
@@ -239,93 +457,110 @@ class Point3D : public Observable {
   Vec3 get_position() const { return m_pos; }
 
  private:
-  Point3D(Vec3 pos) : m_pos(pos) {}
+  Point3D(Vec3 pos) : Observable(kType), m_pos(pos) {}
   Vec3 m_pos;
 };
 
 class Pose3D : public Observable {
  public:
-  Pose3D() : m_pos({}), m_orientation({}) {}
+  static constexpr ObjectType kType = ObjectType::POSE_3D;
+  static constexpr uint32_t kPositionField = 1u << 0;
+  static constexpr uint32_t kOrientationField = 1u << 1;
+  Pose3D() : Observable(kType), m_pos({}), m_orientation({}) {}
   static std::shared_ptr<Pose3D> create(Vec3 pos = {}, Quaternion quat = {}) {
     return std::shared_ptr<Pose3D>(new Pose3D(pos, quat));
   }
   void set_position(Vec3 pos) {
     m_pos = pos;
-    notify_update();
+    notify_update(kPositionField);
   }
   void set_orientation(Quaternion quat) {
     m_orientation = quat;
-    notify_update();
+    notify_update(kOrientationField);
   }
   void set_pose(Vec3 pos, Quaternion quat) {
     m_pos = pos;
     m_orientation = quat;
-    notify_update();
+    notify_update(kPositionField | kOrientationField);
   }
   Vec3 get_position() const { return m_pos; }
   Quaternion get_orientation() const { return m_orientation; }
 
  private:
-  Pose3D(Vec3 pos, Quaternion quat) : m_pos(pos), m_orientation(quat) {}
+  Pose3D(Vec3 pos, Quaternion quat)
+      : Observable(kType), m_pos(pos), m_orientation(quat) {}
   Vec3 m_pos;
   Quaternion m_orientation;
 };
 
 class Ball : public Observable {
  public:
+  static constexpr ObjectType kType = ObjectType::BALL;
+  static constexpr uint32_t kCenterField = 1u << 0;
+  static constexpr uint32_t kRadiusField = 1u << 1;
   static std::shared_ptr<Ball> create(Vec3 center = {}, float radius = 1.f) {
     return std::shared_ptr<Ball>(new Ball(center, radius));
   }
   void set_center(Vec3 center) {
     m_center = center;
-    notify_update();
+    notify_update(kCenterField);
   }
   void set_radius(float radius) {
     m_radius = radius;
-    notify_update();
+    notify_update(kRadiusField);
   }
   Vec3 get_center() const { return m_center; }
   float get_radius() const { return m_radius; }
 
  private:
-  Ball(Vec3 center, float radius) : m_center(center), m_radius(radius) {}
+  Ball(Vec3 center, float radius)
+      : Observable(kType), m_center(center), m_radius(radius) {}
   Vec3 m_center;
   float m_radius;
 };
 
 class Box3D : public Observable {
  public:
+  static constexpr ObjectType kType = ObjectType::BOX_3D;
+  static constexpr uint32_t kCenterField = 1u << 0;
+  static constexpr uint32_t kLengthsField = 1u << 1;
   static std::shared_ptr<Box3D> create(Pose3D center = {}, float x = 1.f,
                                        float y = 1.f, float z = 1.f) {
     return std::shared_ptr<Box3D>(new Box3D(center, x, y, z));
   }
   void set_center(Pose3D center) {
     m_center = center;
-    notify_update();
+    notify_update(kCenterField);
   }
   void set_lengths(float x, float y, float z) {
     m_x_len = x;
     m_y_len = y;
     m_z_len = z;
-    notify_update();
+    notify_update(kLengthsField);
   }
   Pose3D get_center() const { return m_center; }
   Vec3 get_lengths() const { return {m_x_len, m_y_len, m_z_len}; }
 
  private:
   Box3D(Pose3D center, float x, float y, float z)
-      : m_center(center), m_x_len(x), m_y_len(y), m_z_len(z) {}
+      : Observable(kType),
+        m_center(center),
+        m_x_len(x),
+        m_y_len(y),
+        m_z_len(z) {}
   Pose3D m_center;
   float m_x_len, m_y_len, m_z_len;
 };
 
 class Line3D : public Observable {
  public:
+  static constexpr ObjectType kType = ObjectType::LINE_3D;
   static std::shared_ptr<Line3D> create(const std::vector<Vec3>& points = {}) {
     return std::shared_ptr<Line3D>(new Line3D(points));
   }
   void set_points(const std::vector<Vec3>& points) {
     m_points = points;
+    ++m_revision;
     notify_update();
   }
   void add_point(Vec3 p) {
@@ -334,13 +569,440 @@ class Line3D : public Observable {
   }
   void clear() {
     m_points.clear();
+    ++m_revision;
     notify_update();
   }
   const std::vector<Vec3>& get_points() const { return m_points; }
+  // 同 Line2D::revision
+  uint32_t revision() const { return m_revision; }
 
  private:
-  Line3D(const std::vector<Vec3>& points) : m_points(points) {}
+  Line3D(const std::vector<Vec3>& points)
+      : Observable(kType), m_points(points) {}
   std::vector<Vec3> m_points;
+  uint32_t m_revision = 0;
+};
+
+// 大规模点云（如一帧 LiDAR 数据），整体作为一个图元。点坐标连续存放，
+// 可选逐点强度或颜色（二者至多其一）。每次 set_points 替换整帧，
+// 服务端按大小分块发送，客户端写入同一个缓冲区。
+// 数据量大，setter 按值接收，调用方可 std::move 传入避免拷贝
+class PointCloud3D : public Observable {
+ public:
+  static constexpr ObjectType kType = ObjectType::POINT_CLOUD_3D;
+  static std::shared_ptr<PointCloud3D> create(std::vector<Vec3> points = {}) {
+    return std::shared_ptr<PointCloud3D>(new PointCloud3D(std::move(points)));
+  }
+  void set_points(std::vector<Vec3> points) {
+    m_points = std::move(points);
+    m_intensities.clear();
+    m_colors.clear();
+    notify_update();
+  }
+  // intensities 与 points 一一对应，客户端按强度着色
+  void set_points(std::vector<Vec3> points, std::vector<float> intensities) {
+    m_points = std::move(points);
+    m_intensities = std::move(intensities);
+    m_colors.clear();
+    notify_update();
+  }
+  void set_points(std::vector<Vec3> points, std::vector<ColorRGB8> colors) {
+    m_points = std::move(points);
+    m_intensities.clear();
+    m_colors = std::move(colors);
+    notify_update();
+  }
+  void clear() { set_points({}); }
+  // 体素降采样：size > 0 时服务端发送前每个边长为 size 的立方体只保留
+  // 第一个落入的点，本地数据不变。0 表示不降采样
+  void set_voxel_size(float size) {
+    m_voxel_size = size;
+    notify_update();
+  }
+  const std::vector<Vec3>& get_points() const { return m_points; }
+  const std::vector<float>& get_intensities() const { return m_intensities; }
+  const std::vector<ColorRGB8>& get_colors() const { return m_colors; }
+  float get_voxel_size() const { return m_voxel_size; }
+
+ private:
+  PointCloud3D(std::vector<Vec3> points)
+      : Observable(kType), m_points(std::move(points)) {}
+  std::vector<Vec3> m_points;
+  std::vector<float> m_intensities;
+  std::vector<ColorRGB8> m_colors;
+  float m_voxel_size = 0.f;
+};
+
+// 实例数组的元素：各自只是几个紧密排列的 float，整段写入消息
+struct Box3DInstance {
+  Vec3 center;
+  Quaternion orientation;
+  Vec3 lengths{1.f, 1.f, 1.f};
+};
+struct CircleInstance {
+  Vec2 center;
+  float radius = 1.f;
+};
+struct Pose2DInstance {
+  Vec2 position;
+  float theta = 0.f;
+};
+
+// 同类图元的集合：成千上万个障碍物框、标记圆只占一个图元和一份材质，
+// 客户端用一个 InstancedMesh 绘制。可以整体替换，也可以按下标区间修改，
+// 区间修改只发送改过的那几段
+template <typename T, ObjectType Type>
+class InstanceArray : public Observable {
+ public:
+  static constexpr ObjectType kType = Type;
+  static std::shared_ptr<InstanceArray> create(std::vector<T> items = {}) {
+    return std::shared_ptr<InstanceArray>(new InstanceArray(std::move(items)));
+  }
+  // 拷贝出的是新图元，首次发送时整体发出
+  InstanceArray(const InstanceArray& other)
+      : Observable(other), m_items(other.m_items) {}
+
+  void set(std::vector<T> items) {
+    m_items = std::move(items);
+    mark_dirty(0, kWhole);
+    notify_update();
+  }
+  // 覆盖 [start, start + count) 的实例，超出当前长度时先补足；
+  // start 越过末尾时中间补出的默认实例也一并发送
+  void set_range(size_t start, const T* items, size_t count) {
+    if (count == 0) return;
+    size_t begin = std::min(start, m_items.size());
+    if (m_items.size() < start + count) m_items.resize(start + count);
+    std::copy(items, items + count, m_items.begin() + start);
+    mark_dirty(static_cast<uint32_t>(begin),
+               static_cast<uint32_t>(start + count));
+    notify_update();
+  }
+  void set_range(size_t start, const std::vector<T>& items) {
+    set_range(start, items.data(), items.size());
+  }
+  void set_item(size_t index, const T& item) { set_range(index, &item, 1); }
+  void push_back(const T& item) { set_range(m_items.size(), &item, 1); }
+  // 变长时新增的实例取默认值，变短时整体重发
+  void resize(size_t count) {
+    size_t old = m_items.size();
+    if (count == old) return;
+    m_items.resize(count);
+    if (count > old) {
+      mark_dirty(static_cast<uint32_t>(old), static_cast<uint32_t>(count));
+    } else {
+      mark_dirty(0, kWhole);
+    }
+    notify_update();
+  }
+  void clear() { set({}); }
+
+  const std::vector<T>& get_items() const { return m_items; }
+  size_t size() const { return m_items.size(); }
+
+  // 取走自上次调用以来被修改的下标区间 [begin, end) 并清空；
+  // end 为 kWhole 表示需要整体发送，begin >= end 表示没有修改
+  static constexpr uint32_t kWhole = ~0u;
+  std::pair<uint32_t, uint32_t> take_dirty_range() {
+    uint64_t range = m_dirty_range.exchange(kClean, std::memory_order_relaxed);
+    return {static_cast<uint32_t>(range >> 32), static_cast<uint32_t>(range)};
+  }
+
+ private:
+  // 起点放高 32 位、终点放低 32 位，一次原子操作同时取走两端
+  static constexpr uint64_t kClean = uint64_t{kWhole} << 32;
+
+  explicit InstanceArray(std::vector<T> items)
+      : Observable(kType), m_items(std::move(items)) {}
+
+  void mark_dirty(uint32_t begin, uint32_t end) {
+    uint64_t range = m_dirty_range.load(std::memory_order_relaxed);
+    uint64_t merged;
+    do {
+      uint32_t old_begin = static_cast<uint32_t>(range >> 32);
+      uint32_t old_end = static_cast<uint32_t>(range);
+      merged = (uint64_t{std::min(old_begin, begin)} << 32) |
+               std::max(old_end, end);
+    } while (!m_dirty_range.compare_exchange_weak(range, merged,
+                                                  std::memory_order_relaxed));
+  }
+
+  std::vector<T> m_items;
+  std::atomic<uint64_t> m_dirty_range{kWhole};  // 初始为 [0, kWhole)
+};
+
+using Box3DArray = InstanceArray<Box3DInstance, ObjectType::BOX_3D_ARRAY>;
+using CircleArray = InstanceArray<CircleInstance, ObjectType::CIRCLE_ARRAY>;
+using Pose2DArray = InstanceArray<Pose2DInstance, ObjectType::POSE_2D_ARRAY>;
+
+// 三角网格的顶点与索引（每三个下标一个三角形），创建后不可修改，
+// 可由多个 TriangleMesh3D 共用。构造时算出内容哈希，服务端据此在每个窗口内
+// 对内容相同的网格去重，只下发一次
+class TriangleMeshData {
+ public:
+  static std::shared_ptr<const TriangleMeshData> create(
+      std::vector<Vec3> vertices, std::vector<uint32_t> indices) {
+    return std::shared_ptr<const TriangleMeshData>(
+        new TriangleMeshData(std::move(vertices), std::move(indices)));
+  }
+  const std::vector<Vec3>& vertices() const { return m_vertices; }
+  const std::vector<uint32_t>& indices() const { return m_indices; }
+  uint64_t hash() const { return m_hash; }
+  // 哈希相同时用来排除碰撞
+  bool same_content(const TriangleMeshData& other) const {
+    return m_hash == other.m_hash &&
+           m_vertices.size() == other.m_vertices.size() &&
+           m_indices == other.m_indices &&
+           (m_vertices.empty() ||
+            std::memcmp(m_vertices.data(), other.m_vertices.data(),
+                        m_vertices.size() * sizeof(Vec3)) == 0);
+  }
+
+ private:
+  TriangleMeshData(std::vector<Vec3> vertices, std::vector<uint32_t> indices)
+      : m_vertices(std::move(vertices)), m_indices(std::move(indices)) {
+    uint64_t h = hash_bytes(m_vertices.data(), m_vertices.size() * sizeof(Vec3),
+                            m_vertices.size());
+    m_hash = hash_bytes(m_indices.data(), m_indices.size() * sizeof(uint32_t), h);
+  }
+  // 每次吃 8 字节的乘法-异或哈希，只用于去重，不考虑刻意构造的碰撞
+  static uint64_t hash_bytes(const void* data, size_t size, uint64_t seed) {
+    const auto* p = static_cast<const unsigned char*>(data);
+    uint64_t h = (seed + size) * 0x9E3779B97F4A7C15ull;
+    auto mix = [&h](uint64_t w) {
+      w *= 0xBF58476D1CE4E5B9ull;
+      w ^= w >> 31;
+      h = (h ^ w) * 0x94D049BB133111EBull;
+      h ^= h >> 29;
+    };
+    for (; size >= 8; p += 8, size -= 8) {
+      uint64_t w;
+      std::memcpy(&w, p, 8);
+      mix(w);
+    }
+    if (size > 0) {
+      uint64_t w = 0;
+      std::memcpy(&w, p, size);
+      mix(w ^ (uint64_t{size} << 56));
+    }
+    return h;
+  }
+  std::vector<Vec3> m_vertices;
+  std::vector<uint32_t> m_indices;
+  uint64_t m_hash = 0;
+};
+
+// 三角网格的一个实例：引用一份 TriangleMeshData，加上自己的位姿。
+// 大量实例共用同一网格时只有位姿随更新发送
+class TriangleMesh3D : public Observable {
+ public:
+  static constexpr ObjectType kType = ObjectType::TRIANGLE_MESH_3D;
+  static constexpr uint32_t kMeshField = 1u << 0;
+  static constexpr uint32_t kPoseField = 1u << 1;
+  static std::shared_ptr<TriangleMesh3D> create(
+      std::shared_ptr<const TriangleMeshData> mesh, Pose3D pose = {}) {
+    return std::shared_ptr<TriangleMesh3D>(
+        new TriangleMesh3D(std::move(mesh), pose));
+  }
+  static std::shared_ptr<TriangleMesh3D> create(std::vector<Vec3> vertices,
+                                                std::vector<uint32_t> indices,
+                                                Pose3D pose = {}) {
+    return create(
+        TriangleMeshData::create(std::move(vertices), std::move(indices)),
+        pose);
+  }
+  void set_mesh(std::shared_ptr<const TriangleMeshData> mesh) {
+    m_mesh = std::move(mesh);
+    notify_update(kMeshField);
+  }
+  void set_pose(Pose3D pose) {
+    m_pose = pose;
+    notify_update(kPoseField);
+  }
+  const std::shared_ptr<const TriangleMeshData>& get_mesh() const {
+    return m_mesh;
+  }
+  Pose3D get_pose() const { return m_pose; }
+
+ private:
+  TriangleMesh3D(std::shared_ptr<const TriangleMeshData> mesh, Pose3D pose)
+      : Observable(kType), m_mesh(std::move(mesh)), m_pose(pose) {}
+  std::shared_ptr<const TriangleMeshData> m_mesh;
+  Pose3D m_pose;
+};
+
+// 栅格格子的存储类型
+enum class GridCellType : uint8_t { UINT8, FLOAT32 };
+
+// 栅格图层（占据栅格、代价地图等）：width x height 个格子按行存放，
+// 格子 (x, y) 的左下角在 origin + (x, y) * resolution。修改按 kTileSize 见方的
+// 瓦片记录，刷新时只发送改过的瓦片；尺寸或格子类型变化时整体重发。
+// 客户端把 [value_min, value_max] 内的值映射为材质颜色由透明到不透明，
+// 默认 [0, 100] 即 ROS 占据栅格的取值
+class OccupancyGrid : public Observable {
+ public:
+  static constexpr ObjectType kType = ObjectType::OCCUPANCY_GRID;
+  static constexpr uint32_t kTileSize = 256;
+  static constexpr uint32_t kLayoutField = 1u << 0;  // 尺寸、格子类型
+  static constexpr uint32_t kHeaderField = 1u << 1;  // 原点、分辨率、取值范围
+  static constexpr uint32_t kCellsField = 1u << 2;
+
+  static std::shared_ptr<OccupancyGrid> create(
+      uint32_t width, uint32_t height, float resolution, Vec2 origin = {},
+      GridCellType type = GridCellType::UINT8) {
+    return std::shared_ptr<OccupancyGrid>(
+        new OccupancyGrid(width, height, resolution, origin, type));
+  }
+  // 拷贝出的是新图元，首次发送时整体发出
+  OccupancyGrid(const OccupancyGrid& other)
+      : Observable(other),
+        m_width(other.m_width),
+        m_height(other.m_height),
+        m_type(other.m_type),
+        m_resolution(other.m_resolution),
+        m_origin(other.m_origin),
+        m_value_min(other.m_value_min),
+        m_value_max(other.m_value_max),
+        m_cells(other.m_cells),
+        m_dirty_tiles(tile_words()) {}
+
+  // 改变尺寸或格子类型，全部格子清零
+  void reset(uint32_t width, uint32_t height, GridCellType type) {
+    m_width = width;
+    m_height = height;
+    m_type = type;
+    m_cells.assign(size_t{width} * height * cell_bytes(), 0);
+    std::vector<std::atomic<uint64_t>>(tile_words()).swap(m_dirty_tiles);
+    notify_update(kLayoutField | kCellsField);
+  }
+  void set_origin(Vec2 origin) {
+    m_origin = origin;
+    notify_update(kHeaderField);
+  }
+  void set_resolution(float resolution) {
+    m_resolution = resolution;
+    notify_update(kHeaderField);
+  }
+  void set_value_range(float value_min, float value_max) {
+    m_value_min = value_min;
+    m_value_max = value_max;
+    notify_update(kHeaderField);
+  }
+  // UINT8 格子按四舍五入截断到 [0, 255]
+  void set_cell(uint32_t x, uint32_t y, float value) {
+    if (x >= m_width || y >= m_height) return;
+    store(size_t{y} * m_width + x, value);
+    mark_tiles(x, y, x + 1, y + 1);
+  }
+  // 写入左下角为 (x, y) 的 w x h 矩形，values 按行存放，超出栅格的部分忽略。
+  // values 的类型须与格子类型一致
+  void set_cells(uint32_t x, uint32_t y, uint32_t w, uint32_t h,
+                 const uint8_t* values) {
+    if (m_type == GridCellType::UINT8) copy_block(x, y, w, h, values);
+  }
+  void set_cells(uint32_t x, uint32_t y, uint32_t w, uint32_t h,
+                 const float* values) {
+    if (m_type == GridCellType::FLOAT32) copy_block(x, y, w, h, values);
+  }
+  void fill(float value) {
+    size_t count = size_t{m_width} * m_height;
+    for (size_t i = 0; i < count; ++i) store(i, value);
+    mark_tiles(0, 0, m_width, m_height);
+  }
+
+  uint32_t width() const { return m_width; }
+  uint32_t height() const { return m_height; }
+  GridCellType cell_type() const { return m_type; }
+  size_t cell_bytes() const {
+    return m_type == GridCellType::UINT8 ? sizeof(uint8_t) : sizeof(float);
+  }
+  float resolution() const { return m_resolution; }
+  Vec2 origin() const { return m_origin; }
+  float value_min() const { return m_value_min; }
+  float value_max() const { return m_value_max; }
+  float get_cell(uint32_t x, uint32_t y) const {
+    size_t i = size_t{y} * m_width + x;
+    if (m_type == GridCellType::UINT8) return m_cells[i];
+    float value;
+    std::memcpy(&value, &m_cells[i * sizeof(float)], sizeof(float));
+    return value;
+  }
+  // 全部格子的原始字节，按行存放；FLOAT32 为本机字节序
+  const uint8_t* cells() const { return m_cells.data(); }
+
+  uint32_t tiles_x() const { return (m_width + kTileSize - 1) / kTileSize; }
+  uint32_t tiles_y() const { return (m_height + kTileSize - 1) / kTileSize; }
+  // 取走自上次调用以来改过的瓦片，下标为 ty * tiles_x() + tx，按升序追加到 tiles
+  void take_dirty_tiles(std::vector<uint32_t>* tiles) {
+    for (size_t w = 0; w < m_dirty_tiles.size(); ++w) {
+      uint64_t bits = m_dirty_tiles[w].exchange(0, std::memory_order_relaxed);
+      while (bits != 0) {
+        int bit = __builtin_ctzll(bits);
+        tiles->push_back(static_cast<uint32_t>(w * 64 + bit));
+        bits &= bits - 1;
+      }
+    }
+  }
+
+ private:
+  OccupancyGrid(uint32_t width, uint32_t height, float resolution, Vec2 origin,
+                GridCellType type)
+      : Observable(kType),
+        m_width(width),
+        m_height(height),
+        m_type(type),
+        m_resolution(resolution),
+        m_origin(origin),
+        m_cells(size_t{width} * height * cell_bytes(), 0),
+        m_dirty_tiles(tile_words()) {}
+
+  size_t tile_words() const {
+    return (size_t{tiles_x()} * tiles_y() + 63) / 64;
+  }
+  void store(size_t index, float value) {
+    if (m_type == GridCellType::UINT8) {
+      value = std::min(std::max(value, 0.f), 255.f);
+      m_cells[index] = static_cast<uint8_t>(value + 0.5f);
+    } else {
+      std::memcpy(&m_cells[index * sizeof(float)], &value, sizeof(float));
+    }
+  }
+  template <typename Cell>
+  void copy_block(uint32_t x, uint32_t y, uint32_t w, uint32_t h,
+                  const Cell* values) {
+    if (x >= m_width || y >= m_height) return;
+    uint32_t cols = std::min(w, m_width - x);
+    uint32_t rows = std::min(h, m_height - y);
+    for (uint32_t row = 0; row < rows; ++row) {
+      std::memcpy(&m_cells[((size_t{y} + row) * m_width + x) * sizeof(Cell)],
+                  values + size_t{row} * w, cols * sizeof(Cell));
+    }
+    mark_tiles(x, y, x + cols, y + rows);
+  }
+  // 标记覆盖格子 [x0, x1) x [y0, y1) 的瓦片
+  void mark_tiles(uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1) {
+    if (x0 >= x1 || y0 >= y1) return;
+    uint32_t stride = tiles_x();
+    for (uint32_t ty = y0 / kTileSize; ty <= (y1 - 1) / kTileSize; ++ty) {
+      for (uint32_t tx = x0 / kTileSize; tx <= (x1 - 1) / kTileSize; ++tx) {
+        size_t tile = size_t{ty} * stride + tx;
+        m_dirty_tiles[tile / 64].fetch_or(uint64_t{1} << (tile % 64),
+                                          std::memory_order_relaxed);
+      }
+    }
+    notify_update(kCellsField);
+  }
+
+  uint32_t m_width;
+  uint32_t m_height;
+  GridCellType m_type;
+  float m_resolution;
+  Vec2 m_origin;
+  float m_value_min = 0.f;
+  float m_value_max = 100.f;
+  std::vector<uint8_t> m_cells;
+  // 每个瓦片一位；用户线程置位、刷新线程取走
+  std::vector<std::atomic<uint64_t>> m_dirty_tiles;
 };
 
 // --- 新增：颜色结构 ---
@@ -10,10 +10,45 @@
 // 前向声明
 namespace Vis {
 class Observable;
-}
-namespace visualization {
-class Material;
-}  // namespace visualization
+
+// 发送队列已满时的处理策略。无论哪种策略，添加/删除图元和窗口命令都不会被丢弃，
+// 只有纯几何更新会被丢弃或合并；无法丢弃或合并时退化为 BLOCK。
+enum class SendOverflowPolicy {
+  BLOCK,        // 调用线程等待发送线程腾出空间
+  DROP_OLDEST,  // 丢弃队列中最早的纯几何更新（含增量命令的除外）；
+                // 此策略下不发送按字段的部分更新
+  COALESCE      // 合并到队尾同一窗口的几何更新中，同一图元只保留最新状态
+};
+
+// 发送队列运行状态
+struct SendQueueStats {
+  size_t depth = 0;           // 当前排队的消息数
+  size_t capacity = 0;        // 队列容量
+  size_t high_watermark = 0;  // 历史最大排队数
+  uint64_t enqueued = 0;      // 累计入队消息数
+  uint64_t sent = 0;          // 累计由发送线程取出的消息数
+  uint64_t blocked = 0;       // 因队列满而等待的入队次数
+  uint64_t dropped = 0;       // DROP_OLDEST 丢弃的消息数
+  uint64_t coalesced = 0;     // COALESCE 合并掉的消息数
+  size_t lagging_clients = 0;  // 缓冲超过高水位、几何更新被推迟的客户端数
+  uint64_t superseded = 0;     // 推迟期间被同一图元新状态覆盖掉的几何更新数
+  uint64_t compressed = 0;               // 压缩后发送的帧数
+  uint64_t compressed_input_bytes = 0;   // 这些帧压缩前的负载字节数
+  uint64_t compressed_output_bytes = 0;  // 这些帧压缩后的负载字节数
+  uint64_t recorded_bytes = 0;  // 当前录制已写入磁盘的字节数（含各分段）
+  SendOverflowPolicy policy = SendOverflowPolicy::BLOCK;
+};
+
+// 窗口坐标量化（可选）：Line2D / Polygon 的顶点按 step 取整为定点数，
+// 以相邻顶点的差值（zigzag varint）发送，客户端再还原。
+// 还原误差每个坐标不超过 step / 2，不随顶点数累积（另有客户端 float32 存储的舍入）。
+// 可表示的范围为 origin ± step * 2^30（step = 1 cm 时约 ±10000 km），超出部分被截断。
+// 其余图元（点、位姿、圆等）仍以 float 发送。
+struct Quantization {
+  float step = 0.f;  // 量化步长（世界单位），<= 0 表示不量化
+  Vec2 origin;       // 量化原点，取场景中心附近可缩短首点的编码
+};
+}  // namespace Vis
 
 /**
  * @brief 可视化服务器主类 (单例模式)
@@ -33,15 +68,118 @@ class VisualizationServer {
   void run();
   void stop();
   std::vector<std::string> get_connected_windows();
+  // 支持多个客户端同时连接，每条消息只序列化一次后发给全部客户端
   bool is_connected() const;
+  size_t get_client_count() const;
   void set_auto_update_policy(bool enabled, int threshold = 50,
                               int interval_ms = 33);
+  // 序列化和网络发送在独立的发送线程中进行，API 调用只负责生成快照并入队
+  void set_send_queue_policy(Vis::SendOverflowPolicy policy,
+                             size_t capacity = 4096);
+  Vis::SendQueueStats get_send_queue_stats() const;
+  // 单个客户端待写出的字节数超过高水位后，发给它的纯几何更新按图元只保留最新状态，
+  // 降到一半以下时再发出；添加、删除和窗口命令不受影响。0 表示不限制
+  void set_client_buffer_limit(size_t high_water_bytes = 8 * 1024 * 1024);
+  // WebSocket permessage-deflate 压缩，默认开启。只对握手时提出压缩的客户端
+  // （浏览器均会提出）生效，不小于 min_bytes 的消息按 level（1-9）压缩后发送，
+  // 更小的消息（位姿更新等）不压缩。关闭后新连接不再协商压缩，
+  // 已协商的连接也改发原文
+  void set_compression(bool enabled, size_t min_bytes = 1024, int level = 1);
+  // 把之后广播的每条消息原样追加写入 <path_prefix>-NNNN.visrec，
+  // 先写入当前场景的快照，因此录制文件可以独立回放。写盘在后台线程进行；
+  // 单个文件超过 rotate_bytes 后换下一个文件。没有客户端时也照常录制。
+  // 已在录制或无法创建文件时返回 false
+  bool start_recording(const std::string& path_prefix,
+                       size_t rotate_bytes = size_t{1} << 30);
+  // 写完已入队的消息后关闭文件
+  void stop_recording();
   // --- 可视化对象管理 API ---
   void add(std::shared_ptr<Vis::Observable> obj, const std::string& window_name,
            const Vis::MaterialProps& material, bool is_3d);
   void add(const Vis::Observable& obj, const std::string& window_name,
            const Vis::MaterialProps& material, bool is_3d);
 
+  // --- 修改样式 ---
+  // 只向客户端发送新材质，不重发几何，客户端就地修改颜色、线宽等参数。
+  // obj 须是以 shared_ptr 添加的动态图元；材质与当前相同时不发送。
+  // 窗口材质表按引用计数管理，不再有图元使用的材质随之释放，
+  // 按数据逐帧改色时材质表只保留当前在用的材质
+  void set_material(const Vis::Observable& obj,
+                    const Vis::MaterialProps& material);
+  void set_material(const std::shared_ptr<Vis::Observable>& obj,
+                    const Vis::MaterialProps& material);
+
+  // --- 批量添加 ---
+  // begin_batch() 与 end_batch() 之间的 add、set_material 不再逐个发送，
+  // 而是按窗口合并成少量有大小上限的消息，在最外层 end_batch() 时发出；可嵌套。
+  // 期间若有其他命令（刷新、删除等）需要发送，已攒下的命令会先行发出。
+  void begin_batch();
+  void end_batch();
+
+  // 作用域内的 add 合并发送
+  class BatchScope {
+   public:
+    explicit BatchScope(VisualizationServer& server) : m_server(server) {
+      m_server.begin_batch();
+    }
+    ~BatchScope() { m_server.end_batch(); }
+    BatchScope(const BatchScope&) = delete;
+    BatchScope& operator=(const BatchScope&) = delete;
+
+   private:
+    VisualizationServer& m_server;
+  };
+
+  // 逐个 add 容器中的图元并合并发送。元素为 shared_ptr 时作为动态图元，
+  // 为图元对象本身时作为静态图元（拷贝一份），与 add 的两个重载一致
+  template <typename Range>
+  void add_batch(const Range& objects, const std::string& window_name,
+                 const Vis::MaterialProps& material, bool is_3d) {
+    BatchScope batch(*this);
+    for (const auto& obj : objects) {
+      add(obj, window_name, material, is_3d);
+    }
+  }
+
+  // 把容器中的图元（shared_ptr）都改成同一材质，合并发送
+  template <typename Range>
+  void set_material_batch(const Range& objects,
+                          const Vis::MaterialProps& material) {
+    BatchScope batch(*this);
+    for (const auto& obj : objects) {
+      set_material(obj, material);
+    }
+  }
+
+  // --- 帧事务 ---
+  // 一个仿真步的修改常分散在多次自动刷新或多个窗口的 drawnow 中，客户端可能
+  // 显示出半帧（如车辆框已移动而轨迹还没跟上）。begin_frame() 与 end_frame()
+  // 之间对所有窗口的修改属于同一帧：广播的消息都带上帧号，客户端暂存到
+  // end_frame() 发出的帧提交后一起应用。
+  // 帧内不做阈值和定时刷新，drawnow 也推迟到 end_frame()，届时各窗口的
+  // 脏图元和攒下的添加命令一并发出，每个窗口只占少量消息。
+  // sim_time 为这一帧的仿真时间（秒），随帧提交发给客户端。
+  // 落后的客户端（见 set_client_buffer_limit）的帧提交随积压的几何更新一起
+  // 推迟，追上后收到的仍是完整的帧，中间的帧被合并掉。
+  // 返回帧号；可嵌套，内层沿用外层的帧号和仿真时间
+  uint64_t begin_frame(double sim_time = 0.0);
+  void end_frame();
+
+  // 作用域内的修改属于同一帧
+  class FrameScope {
+   public:
+    explicit FrameScope(VisualizationServer& server, double sim_time = 0.0)
+        : m_server(server) {
+      m_server.begin_frame(sim_time);
+    }
+    ~FrameScope() { m_server.end_frame(); }
+    FrameScope(const FrameScope&) = delete;
+    FrameScope& operator=(const FrameScope&) = delete;
+
+   private:
+    VisualizationServer& m_server;
+  };
+
   void clear_static(const std::string& window_name, bool is_3d);
   void clear_dynamic(const std::string& window_name, bool is_3d);
   void clear(const std::string& window_name, bool is_3d);
@@ -51,7 +189,8 @@ class VisualizationServer {
 
   // --- 窗口控制 API ---
   // create_window 返回 bool，且 window_name 成为必需参数
-  bool create_window(const std::string& window_name, const bool& is_3d = false);
+  bool create_window(const std::string& window_name, const bool& is_3d = false,
+                     const Vis::Quantization& quantization = {});
 
   // remove_window
   bool remove_window(const std::string& window_name, const bool& is_3d = false);
@@ -79,7 +218,6 @@ class VisualizationServer {
   ~VisualizationServer();
   VisualizationServer(VisualizationServer&&) noexcept;
   VisualizationServer& operator=(VisualizationServer&&) noexcept;
-  visualization::Material convert_material(const Vis::MaterialProps& props);
   // 前向声明实现类
   class ServerImpl;
   std::unique_ptr<ServerImpl> m_impl;
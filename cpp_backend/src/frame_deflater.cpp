@@ -0,0 +1,95 @@
+#include "frame_deflater.h"
+
+namespace {
+
+std::string trim(const std::string& s) {
+  size_t begin = s.find_first_not_of(" \t");
+  if (begin == std::string::npos) return std::string();
+  size_t end = s.find_last_not_of(" \t");
+  return s.substr(begin, end - begin + 1);
+}
+
+// 一个提议形如 "permessage-deflate; client_max_window_bits"
+bool acceptable_offer(const std::string& offer) {
+  size_t pos = offer.find(';');
+  if (trim(offer.substr(0, pos)) != "permessage-deflate") return false;
+  while (pos != std::string::npos) {
+    size_t next = offer.find(';', pos + 1);
+    std::string param = trim(offer.substr(pos + 1, next - pos - 1));
+    std::string name = trim(param.substr(0, param.find('=')));
+    // client_max_window_bits 只约束客户端发来的数据，客户端从不发送，可以忽略；
+    // 服务端每条消息都用默认的 15 位窗口，不能接受 server_max_window_bits
+    if (name != "client_max_window_bits" &&
+        name != "server_no_context_takeover" &&
+        name != "client_no_context_takeover") {
+      return false;
+    }
+    pos = next;
+  }
+  return true;
+}
+
+}  // namespace
+
+FrameDeflater::~FrameDeflater() {
+  if (m_initialized) deflateEnd(&m_stream);
+}
+
+bool FrameDeflater::offered(const std::string& extensions_header) {
+  size_t begin = 0;
+  while (begin <= extensions_header.size()) {
+    size_t end = extensions_header.find(',', begin);
+    if (end == std::string::npos) end = extensions_header.size();
+    if (acceptable_offer(extensions_header.substr(begin, end - begin))) {
+      return true;
+    }
+    begin = end + 1;
+  }
+  return false;
+}
+
+const char* FrameDeflater::response_header() {
+  return "permessage-deflate; server_no_context_takeover; "
+         "client_no_context_takeover";
+}
+
+bool FrameDeflater::compress(const uint8_t* data, size_t size, int level,
+                             std::string* out) {
+  if (!reset(level)) return false;
+
+  // Z_SYNC_FLUSH 以空的非最终块结尾，输出比原文多出的部分不会超过 deflateBound
+  out->resize(deflateBound(&m_stream, size) + 8);
+  m_stream.next_in = const_cast<Bytef*>(data);
+  m_stream.avail_in = static_cast<uInt>(size);
+  m_stream.next_out = reinterpret_cast<Bytef*>(&(*out)[0]);
+  m_stream.avail_out = static_cast<uInt>(out->size());
+  int result = deflate(&m_stream, Z_SYNC_FLUSH);
+  if (result != Z_OK || m_stream.avail_in != 0 || m_stream.avail_out == 0) {
+    return false;
+  }
+
+  size_t written = out->size() - m_stream.avail_out;
+  if (written < 4) return false;
+  out->resize(written - 4);  // 去掉 0x00 0x00 0xff 0xff
+  return out->size() < size;
+}
+
+// 每条消息独立压缩：复位流即丢弃上一条消息的上下文
+bool FrameDeflater::reset(int level) {
+  if (m_initialized && level == m_level) {
+    return deflateReset(&m_stream) == Z_OK;
+  }
+  if (m_initialized) {
+    deflateEnd(&m_stream);
+    m_initialized = false;
+  }
+  m_stream = z_stream{};
+  // 负的窗口位数表示不带 zlib 头尾的原始 deflate 流
+  if (deflateInit2(&m_stream, level, Z_DEFLATED, -MAX_WBITS, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK) {
+    return false;
+  }
+  m_initialized = true;
+  m_level = level;
+  return true;
+}
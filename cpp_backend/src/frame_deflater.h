@@ -0,0 +1,39 @@
+// cpp_backend/src/frame_deflater.h
+#pragma once
+
+#include <zlib.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// WebSocket permessage-deflate（RFC 7692）的服务端实现。
+// websocketpp 的扩展要在发送时逐连接压缩，而广播帧是序列化一次、
+// 自行写好帧头后共享给所有连接的，所以这里自己完成协商和压缩：
+// 协商时要求双方都不保留上下文（no_context_takeover），每条消息独立压缩，
+// 同一条消息的压缩结果可以发给所有协商了压缩的客户端。
+// 客户端从不发送数据帧，不需要解压。浏览器会自动解压，JS 端无需改动。
+class FrameDeflater {
+ public:
+  FrameDeflater() = default;
+  ~FrameDeflater();
+  FrameDeflater(const FrameDeflater&) = delete;
+  FrameDeflater& operator=(const FrameDeflater&) = delete;
+
+  // 客户端的 Sec-WebSocket-Extensions 请求头中有可接受的 permessage-deflate
+  // 提议时返回 true。带 server_max_window_bits 或未知参数的提议不接受
+  static bool offered(const std::string& extensions_header);
+  // 接受提议时回复的 Sec-WebSocket-Extensions
+  static const char* response_header();
+
+  // 把 data 压缩为一条消息的负载写入 out（不含 RFC 7692 要求去掉的
+  // 0x00 0x00 0xff 0xff 结尾）。压缩后不比原文小时返回 false，应按原文发送
+  bool compress(const uint8_t* data, size_t size, int level, std::string* out);
+
+ private:
+  bool reset(int level);
+
+  z_stream m_stream{};
+  bool m_initialized = false;
+  int m_level = 0;
+};
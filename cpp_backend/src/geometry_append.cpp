@@ -0,0 +1,382 @@
+#include "geometry_append.h"
+
+#include <string>
+#include <type_traits>
+
+namespace {
+
+using google::protobuf::Descriptor;
+using google::protobuf::FieldDescriptor;
+using google::protobuf::Message;
+using google::protobuf::Reflection;
+using PoseList = google::protobuf::RepeatedPtrField<visualization::Box2D>;
+using DeltaList = google::protobuf::RepeatedField<int32_t>;
+
+constexpr size_t kXyStride = 2 * sizeof(float);
+constexpr size_t kXyzStride = 3 * sizeof(float);
+
+// 保留 dst 的前 start 个点，其后换成 tail；dst 不足 start 个点时无法拼接
+bool splice_points(size_t start, const std::string& tail, size_t stride,
+                   std::string* dst) {
+  if (dst->size() / stride < start) return false;
+  dst->resize(start * stride);
+  dst->append(tail);
+  return true;
+}
+
+// 量化后的顶点是差分编码，每段数组的第一个点相对原点。接到 dst 的前 start
+// 个点之后时，tail 的首点要改写成相对第 start - 1 个点的差值
+void splice_deltas(size_t start, const DeltaList& tail, DeltaList* dst) {
+  dst->Truncate(static_cast<int>(2 * start));
+  int32_t x = 0;
+  int32_t y = 0;
+  for (int i = 0; i < dst->size(); i += 2) {
+    x += dst->Get(i);
+    y += dst->Get(i + 1);
+  }
+  dst->Reserve(dst->size() + tail.size());
+  for (int i = 0; i < tail.size(); ++i) {
+    int32_t value = tail.Get(i);
+    if (i == 0) value -= x;
+    if (i == 1) value -= y;
+    dst->AddAlreadyReserved(value);
+  }
+}
+
+// 二维顶点可能是 float（xy）也可能已量化（dxy），同一窗口内两者不会混用；
+// 只有其中之一非空，都为空表示没有点
+bool splice_xy(size_t start, const std::string& xy, const DeltaList& dxy,
+               std::string* dst_xy, DeltaList* dst_dxy) {
+  size_t count = dst_xy->size() / kXyStride + dst_dxy->size() / 2;
+  if (count < start) return false;
+  if (start == 0) {
+    *dst_xy = xy;
+    *dst_dxy = dxy;
+    return true;
+  }
+  if (dst_dxy->empty()) {
+    if (!dxy.empty()) return false;
+    return splice_points(start, xy, kXyStride, dst_xy);
+  }
+  if (!xy.empty()) return false;
+  splice_deltas(start, dxy, dst_dxy);
+  return true;
+}
+
+bool splice_poses(size_t start, const PoseList& tail, PoseList* dst) {
+  size_t size = static_cast<size_t>(dst->size());
+  if (size < start) return false;
+  dst->DeleteSubrange(static_cast<int>(start), static_cast<int>(size - start));
+  for (const auto& pose : tail) {
+    *dst->Add() = pose;
+  }
+  return true;
+}
+
+// 两条追加命令相接：src 的起点须落在 dst 覆盖的范围内。
+// src 起点更靠前时它本身已包含 dst 的全部内容，由调用方直接覆盖
+bool splice_points(const visualization::AppendPoints& src,
+                   visualization::AppendPoints* dst) {
+  if (src.has_xyz() != dst->has_xyz() || src.start() < dst->start()) {
+    return false;
+  }
+  size_t offset = src.start() - dst->start();
+  if (src.has_xyz()) {
+    return splice_points(offset, src.xyz(), kXyzStride, dst->mutable_xyz());
+  }
+  if (src.has_xy() || dst->has_xy()) {
+    if (!src.dxy().empty() || !dst->dxy().empty()) return false;
+    return splice_points(offset, src.xy(), kXyStride, dst->mutable_xy());
+  }
+  // 量化后的追加只有 dxy，oneof 未设置
+  if (static_cast<size_t>(dst->dxy_size()) / 2 < offset) return false;
+  splice_deltas(offset, src.dxy(), dst->mutable_dxy());
+  return true;
+}
+
+bool splice_poses(const visualization::AppendPoses& src,
+                  visualization::AppendPoses* dst) {
+  if (src.start() < dst->start()) return false;
+  return splice_poses(src.start() - dst->start(), src.poses(),
+                      dst->mutable_poses());
+}
+
+// 部分更新（field_mask 非 0）并入同一图元的旧命令：只覆盖 src 带的字段。
+// dst 是完整状态时合并后仍是完整状态，否则两者的 field_mask 取并集。
+// 几何消息的字段种类很少，按字段号用反射拷贝，不必为每种图元各写一份
+template <typename UpdateGeometry>
+bool merge_fields(const UpdateGeometry& src, UpdateGeometry* dst) {
+  const Reflection* reflection = UpdateGeometry::GetReflection();
+  const auto* oneof =
+      UpdateGeometry::descriptor()->FindOneofByName("geometry_data");
+  const FieldDescriptor* field = reflection->GetOneofFieldDescriptor(src, oneof);
+  if (!field || field != reflection->GetOneofFieldDescriptor(*dst, oneof)) {
+    return false;
+  }
+  const Message& from = reflection->GetMessage(src, field);
+  Message* to = reflection->MutableMessage(dst, field);
+  const Reflection* geometry = from.GetReflection();
+  const Descriptor* type = from.GetDescriptor();
+  uint32_t mask = src.field_mask();
+  // 只按字段整体覆盖单值字段；带重复字段时先判断，避免改了一半再放弃
+  for (int i = 0; i < type->field_count(); ++i) {
+    const FieldDescriptor* f = type->field(i);
+    if (f->number() < 32 && (mask & (1u << f->number())) && f->is_repeated()) {
+      return false;
+    }
+  }
+  for (int i = 0; i < type->field_count(); ++i) {
+    const FieldDescriptor* f = type->field(i);
+    if (f->number() >= 32 || !(mask & (1u << f->number()))) continue;
+    switch (f->cpp_type()) {
+      case FieldDescriptor::CPPTYPE_FLOAT:
+        geometry->SetFloat(to, f, geometry->GetFloat(from, f));
+        break;
+      case FieldDescriptor::CPPTYPE_DOUBLE:
+        geometry->SetDouble(to, f, geometry->GetDouble(from, f));
+        break;
+      case FieldDescriptor::CPPTYPE_INT32:
+        geometry->SetInt32(to, f, geometry->GetInt32(from, f));
+        break;
+      case FieldDescriptor::CPPTYPE_INT64:
+        geometry->SetInt64(to, f, geometry->GetInt64(from, f));
+        break;
+      case FieldDescriptor::CPPTYPE_UINT32:
+        // 例如 TriangleMesh3D 只换网格时的 mesh_id
+        geometry->SetUInt32(to, f, geometry->GetUInt32(from, f));
+        break;
+      case FieldDescriptor::CPPTYPE_UINT64:
+        geometry->SetUInt64(to, f, geometry->GetUInt64(from, f));
+        break;
+      case FieldDescriptor::CPPTYPE_BOOL:
+        geometry->SetBool(to, f, geometry->GetBool(from, f));
+        break;
+      case FieldDescriptor::CPPTYPE_ENUM:
+        geometry->SetEnumValue(to, f, geometry->GetEnumValue(from, f));
+        break;
+      case FieldDescriptor::CPPTYPE_STRING:
+        geometry->SetString(to, f, geometry->GetString(from, f));
+        break;
+      case FieldDescriptor::CPPTYPE_MESSAGE:
+        geometry->MutableMessage(to, f)->CopyFrom(geometry->GetMessage(from, f));
+        break;
+    }
+  }
+  if (dst->field_mask() != 0) {
+    dst->set_field_mask(dst->field_mask() | mask);
+  }
+  return true;
+}
+
+// 点云的后续分块接在同一帧已有的块之后；不相邻或不是同一帧时无法拼接
+bool splice_point_cloud(const visualization::PointCloud3D& src,
+                        visualization::PointCloud3D* dst) {
+  if (dst->total() != src.total() ||
+      dst->start() + dst->xyz().size() / kXyzStride != src.start() ||
+      dst->intensity().empty() != src.intensity().empty() ||
+      dst->rgb().empty() != src.rgb().empty()) {
+    return false;
+  }
+  dst->mutable_xyz()->append(src.xyz());
+  dst->mutable_intensity()->append(src.intensity());
+  dst->mutable_rgb()->append(src.rgb());
+  return true;
+}
+
+// 点云只是一帧中的一块（后续分块，或被截断后只剩第一块的整帧命令）
+bool is_point_cloud_chunk(const visualization::PointCloud3D& cloud) {
+  return cloud.start() > 0 || cloud.xyz().size() / kXyzStride < cloud.total();
+}
+
+// 实例数组的区间更新：starts 为空的是整个数组
+bool is_instance_ranges(const visualization::InstanceArray& array) {
+  return array.starts_size() > 0;
+}
+
+// 几何更新里的实例数组字段；不是实例数组时返回 nullptr
+template <typename UpdateGeometry>
+const visualization::InstanceArray* instance_array(const UpdateGeometry& cmd) {
+  using Case = typename UpdateGeometry::GeometryDataCase;
+  switch (cmd.geometry_data_case()) {
+    case Case::kCircleArray:
+      return &cmd.circle_array();
+    case Case::kPose2DArray:
+      return &cmd.pose_2d_array();
+    default:
+      break;
+  }
+  if constexpr (std::is_same_v<UpdateGeometry,
+                               visualization::Update3DObjectGeometry>) {
+    if (cmd.has_box_3d_array()) return &cmd.box_3d_array();
+  }
+  return nullptr;
+}
+
+template <typename UpdateGeometry>
+visualization::InstanceArray* mutable_instance_array(UpdateGeometry* cmd) {
+  return const_cast<visualization::InstanceArray*>(instance_array(*cmd));
+}
+
+// 把 src 的几段并入 dst。dst 是整个数组时原地覆盖，合并后仍是整个数组；
+// 否则把 src 的几段接在 dst 之后，客户端按顺序写入时后写的覆盖先写的
+bool splice_instances(const visualization::InstanceArray& src,
+                      visualization::InstanceArray* dst) {
+  size_t src_count = 0;
+  for (uint32_t count : src.counts()) src_count += count;
+  if (src_count == 0) return true;
+  size_t stride = src.values().size() / src_count;
+  if (is_instance_ranges(*dst)) {
+    dst->mutable_starts()->MergeFrom(src.starts());
+    dst->mutable_counts()->MergeFrom(src.counts());
+    dst->mutable_values()->append(src.values());
+  } else {
+    // 区间更新只会让数组变长，变短时服务端整体重发
+    std::string* values = dst->mutable_values();
+    if (values->size() < src.total() * stride) {
+      values->resize(src.total() * stride);
+    }
+    size_t offset = 0;
+    for (int i = 0; i < src.starts_size(); ++i) {
+      size_t bytes = src.counts(i) * stride;
+      values->replace(src.starts(i) * stride, bytes, src.values(), offset,
+                      bytes);
+      offset += bytes;
+    }
+  }
+  dst->set_total(src.total());
+  return true;
+}
+
+// 把 src 的瓦片并入 dst：同一位置的块原地替换，其余接在后面；头部取 src 的。
+// 部分更新不改变尺寸，瓦片划分相同，dst 是整个栅格时合并后仍是整个栅格
+bool splice_tiles(const visualization::OccupancyGrid& src,
+                  visualization::OccupancyGrid* dst) {
+  if (src.width() != dst->width() || src.height() != dst->height() ||
+      src.cell_type() != dst->cell_type()) {
+    return false;
+  }
+  for (const auto& tile : src.tiles()) {
+    visualization::GridTile* same = nullptr;
+    for (auto& queued : *dst->mutable_tiles()) {
+      if (queued.x() == tile.x() && queued.y() == tile.y()) {
+        same = &queued;
+        break;
+      }
+    }
+    if (same) {
+      same->set_cells(tile.cells());
+    } else {
+      *dst->add_tiles() = tile;
+    }
+  }
+  dst->set_resolution(src.resolution());
+  *dst->mutable_origin() = src.origin();
+  dst->set_value_min(src.value_min());
+  dst->set_value_max(src.value_max());
+  return true;
+}
+
+template <typename UpdateGeometry>
+bool append_update(const UpdateGeometry& src, UpdateGeometry* dst) {
+  if (src.field_mask() != 0) {
+    return merge_fields(src, dst);
+  }
+  if (const auto* ranges = instance_array(src);
+      ranges && is_instance_ranges(*ranges)) {
+    return src.geometry_data_case() == dst->geometry_data_case() &&
+           splice_instances(*ranges, mutable_instance_array(dst));
+  }
+  if (src.has_occupancy_grid() && src.occupancy_grid().partial()) {
+    return dst->has_occupancy_grid() &&
+           splice_tiles(src.occupancy_grid(), dst->mutable_occupancy_grid());
+  }
+  if constexpr (std::is_same_v<UpdateGeometry,
+                               visualization::Update3DObjectGeometry>) {
+    // start 为 0 的分块是新的一帧，照常覆盖
+    if (src.has_point_cloud_3d() && src.point_cloud_3d().start() > 0) {
+      return dst->has_point_cloud_3d() &&
+             splice_point_cloud(src.point_cloud_3d(),
+                                dst->mutable_point_cloud_3d());
+    }
+  }
+  if (src.has_append_points()) {
+    const auto& append = src.append_points();
+    if (dst->has_append_points()) {
+      return splice_points(append, dst->mutable_append_points());
+    }
+    if (dst->has_line_2d()) {
+      auto* line = dst->mutable_line_2d();
+      return !append.has_xyz() &&
+             splice_xy(append.start(), append.xy(), append.dxy(),
+                       line->mutable_xy(), line->mutable_dxy());
+    }
+    if constexpr (std::is_same_v<UpdateGeometry,
+                                 visualization::Update3DObjectGeometry>) {
+      if (dst->has_line_3d()) {
+        return append.has_xyz() &&
+               splice_points(append.start(), append.xyz(), kXyzStride,
+                             dst->mutable_line_3d()->mutable_xyz());
+      }
+    }
+    return false;
+  }
+  if (src.has_append_poses()) {
+    const auto& append = src.append_poses();
+    if (dst->has_append_poses()) {
+      return splice_poses(append, dst->mutable_append_poses());
+    }
+    if (dst->has_trajectory_2d()) {
+      return splice_poses(append.start(), append.poses(),
+                          dst->mutable_trajectory_2d()->mutable_poses());
+    }
+  }
+  return false;
+}
+
+template <typename SceneUpdate>
+bool has_incremental(const SceneUpdate& update) {
+  for (const auto& cmd : update.commands()) {
+    if (!cmd.has_update_object_geometry()) continue;
+    const auto& geometry = cmd.update_object_geometry();
+    if (geometry.has_append_points() || geometry.has_append_poses() ||
+        geometry.field_mask() != 0) {
+      return true;
+    }
+    if (const auto* ranges = instance_array(geometry);
+        ranges && is_instance_ranges(*ranges)) {
+      return true;
+    }
+    if (geometry.has_occupancy_grid() && geometry.occupancy_grid().partial()) {
+      return true;
+    }
+    if constexpr (std::is_same_v<SceneUpdate, visualization::Scene3DUpdate>) {
+      if (geometry.has_point_cloud_3d() &&
+          is_point_cloud_chunk(geometry.point_cloud_3d())) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+bool append_geometry_update(const visualization::Update2DObjectGeometry& src,
+                            visualization::Update2DObjectGeometry* dst) {
+  return append_update(src, dst);
+}
+
+bool append_geometry_update(const visualization::Update3DObjectGeometry& src,
+                            visualization::Update3DObjectGeometry* dst) {
+  return append_update(src, dst);
+}
+
+bool has_incremental_commands(const visualization::VisMessage& message) {
+  if (message.has_scene_2d_update()) {
+    return has_incremental(message.scene_2d_update());
+  }
+  if (message.has_scene_3d_update()) {
+    return has_incremental(message.scene_3d_update());
+  }
+  return false;
+}
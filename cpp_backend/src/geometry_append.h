@@ -0,0 +1,23 @@
+// cpp_backend/src/geometry_append.h
+#pragma once
+
+#include "visualization.pb.h"
+
+// 增量追加命令（AppendPoints / AppendPoses）只描述折线或轨迹的尾部，
+// 部分更新（field_mask 非 0）只带变化的字段，点云的分块只带一帧中的一段，
+// 实例数组的区间更新只带改过的几段实例，栅格的部分更新只带改过的瓦片，
+// 合并几何更新时都不能像其他命令那样直接用新状态覆盖旧状态，否则旧命令里的
+// 那段尾部、其余字段、前面的分块、其他实例或瓦片就丢了。
+// 这里把它们并入同一图元的旧命令。
+
+// 把 src 并入同一图元的旧命令 dst。src 是追加命令且 dst 的数据覆盖到了
+// src.start 时原地拼接，src 是部分更新时把它的字段写进 dst，并返回 true；
+// 返回 false 时调用方照旧用 src 覆盖 dst
+bool append_geometry_update(const visualization::Update2DObjectGeometry& src,
+                            visualization::Update2DObjectGeometry* dst);
+bool append_geometry_update(const visualization::Update3DObjectGeometry& src,
+                            visualization::Update3DObjectGeometry* dst);
+
+// 消息中是否含有追加命令、部分更新、点云分块、实例区间或栅格瓦片。这类消息丢弃后，
+// 之后的增量命令无法补齐客户端缺失的部分
+bool has_incremental_commands(const visualization::VisMessage& message);
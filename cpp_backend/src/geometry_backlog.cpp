@@ -0,0 +1,114 @@
+#include "geometry_backlog.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "geometry_append.h"
+
+namespace {
+
+// 把 src 中的几何更新拷贝进 dst：同一图元用新状态覆盖旧状态，其余追加。
+// 增量追加和部分更新并入旧命令，旧状态没有被丢弃，不计入覆盖数
+template <typename SceneUpdate>
+size_t merge_geometry_updates(const SceneUpdate& src, SceneUpdate* dst,
+                              std::unordered_map<uint32_t, int>& index_by_id) {
+  size_t superseded = 0;
+  for (const auto& cmd : src.commands()) {
+    auto [it, inserted] = index_by_id.emplace(
+        cmd.update_object_geometry().id(), dst->commands_size());
+    if (inserted) {
+      *dst->add_commands() = cmd;
+    } else {
+      auto* pending = dst->mutable_commands(it->second);
+      if (!append_geometry_update(cmd.update_object_geometry(),
+                                  pending->mutable_update_object_geometry())) {
+        *pending = cmd;
+        ++superseded;
+      }
+    }
+  }
+  return superseded;
+}
+
+}  // namespace
+
+size_t GeometryBacklog::merge(const visualization::VisMessage& message) {
+  PendingWindow* pending = nullptr;
+  size_t superseded = 0;
+  if (message.has_scene_2d_update()) {
+    const auto& update = message.scene_2d_update();
+    pending = &pending_for(update.window_id(), false);
+    superseded = merge_geometry_updates(
+        update, pending->message->mutable_scene_2d_update(),
+        pending->index_by_id);
+  } else if (message.has_scene_3d_update()) {
+    const auto& update = message.scene_3d_update();
+    pending = &pending_for(update.window_id(), true);
+    superseded = merge_geometry_updates(
+        update, pending->message->mutable_scene_3d_update(),
+        pending->index_by_id);
+  }
+  if (pending && message.frame_id() != 0) {
+    pending->frame_id = message.frame_id();
+    m_frame_id = message.frame_id();
+  }
+  return superseded;
+}
+
+bool GeometryBacklog::defer_commit(const visualization::VisMessage& commit) {
+  for (const PendingWindow& pending : m_windows) {
+    if (pending.frame_id == 0) continue;
+    m_commit = std::make_unique<visualization::VisMessage>(commit);
+    return true;
+  }
+  // 帧内更新都已随结构性命令发出，照常提交即可，旧的推迟提交也随之作废
+  m_commit.reset();
+  return false;
+}
+
+GeometryBacklog::MessagePtr GeometryBacklog::take(
+    const std::string& window_id) {
+  for (size_t i = 0; i < m_windows.size(); ++i) {
+    if (m_windows[i].window_id != window_id) continue;
+    MessagePtr message = std::move(m_windows[i].message);
+    message->set_frame_id(m_windows[i].frame_id);
+    m_windows[i] = std::move(m_windows.back());
+    m_windows.pop_back();
+    return message;
+  }
+  return nullptr;
+}
+
+void GeometryBacklog::take_all(std::vector<MessagePtr>& out) {
+  uint64_t frame_id = 0;
+  for (const PendingWindow& pending : m_windows) {
+    frame_id = std::max(frame_id, pending.frame_id);
+  }
+  for (PendingWindow& pending : m_windows) {
+    pending.message->set_frame_id(frame_id);
+    out.push_back(std::move(pending.message));
+  }
+  m_windows.clear();
+  if (m_commit && m_commit->frame_commit().frame_id() >= m_frame_id) {
+    out.push_back(std::move(m_commit));
+  }
+  m_commit.reset();
+  m_frame_id = 0;
+}
+
+GeometryBacklog::PendingWindow& GeometryBacklog::pending_for(
+    const std::string& window_id, bool is_3d) {
+  for (PendingWindow& pending : m_windows) {
+    if (pending.window_id == window_id) return pending;
+  }
+
+  PendingWindow& pending = m_windows.emplace_back();
+  pending.window_id = window_id;
+  pending.message = std::make_unique<visualization::VisMessage>();
+  if (is_3d) {
+    pending.message->mutable_scene_3d_update()->set_window_id(window_id);
+  } else {
+    pending.message->mutable_scene_2d_update()->set_window_id(window_id);
+  }
+  return pending;
+}
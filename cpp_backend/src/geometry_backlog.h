@@ -0,0 +1,54 @@
+// cpp_backend/src/geometry_backlog.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "visualization.pb.h"
+
+// 慢客户端落后期间推迟发送的几何更新。每个窗口攒成一条消息，
+// 同一图元只保留最新状态（latest-value-wins），客户端追上后再发出。
+// 只在发送线程中使用。
+// 消息分配在堆上而不是 Arena 上：覆盖旧状态时 Arena 不会回收被替换的子消息，
+// 慢客户端落后越久占用越大；堆上的旧子消息会随覆盖立即释放。
+// 帧内的更新并入后不再是完整的一帧：积压中有帧内更新时，帧提交也推迟到
+// 取出时，取出的消息重新打上帧号并跟在它们之后发出，客户端仍按整帧应用。
+class GeometryBacklog {
+ public:
+  using MessagePtr = std::unique_ptr<visualization::VisMessage>;
+
+  bool empty() const { return m_windows.empty(); }
+
+  // 并入一条纯几何更新消息。消息由多个客户端共享，这里只拷贝不修改；
+  // 返回被覆盖掉的旧状态数
+  size_t merge(const visualization::VisMessage& message);
+
+  // 积压中有帧内更新时收下帧提交（只保留最新的一条），返回 true；
+  // 否则返回 false，由调用方照常发出
+  bool defer_commit(const visualization::VisMessage& commit);
+
+  // 取出某个窗口积压的消息，带帧内更新时打上帧号；没有积压时返回空指针
+  MessagePtr take(const std::string& window_id);
+
+  // 按窗口依次取出全部积压消息。有帧内更新时全部打上最新的帧号，
+  // 其后是推迟的帧提交；该帧尚未结束时不附提交，等它自己的提交到来
+  void take_all(std::vector<MessagePtr>& out);
+
+ private:
+  struct PendingWindow {
+    std::string window_id;
+    MessagePtr message;
+    std::unordered_map<uint32_t, int> index_by_id;  // 图元 id -> 命令下标
+    uint64_t frame_id = 0;  // 并入的最新帧内更新的帧号，没有时为 0
+  };
+
+  PendingWindow& pending_for(const std::string& window_id, bool is_3d);
+
+  std::vector<PendingWindow> m_windows;  // 窗口数很少，线性查找
+  uint64_t m_frame_id = 0;  // 上次 take_all 以来并入的最新帧号
+  MessagePtr m_commit;      // 推迟的帧提交
+};
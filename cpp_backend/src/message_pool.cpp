@@ -0,0 +1,73 @@
+#include "message_pool.h"
+
+namespace {
+
+constexpr size_t kDefaultBlockSize = 8 * 1024;
+// 首块上限：超出部分仍由 Arena 按需向堆申请，避免偶发的大消息长期占住内存
+constexpr size_t kMaxBlockSize = 4 * 1024 * 1024;
+constexpr size_t kMaxPooledArenas = 32;
+
+size_t round_up_pow2(size_t n) {
+  size_t size = kDefaultBlockSize;
+  while (size < n && size < kMaxBlockSize) size <<= 1;
+  return size;
+}
+
+}  // namespace
+
+MessageArena::MessageArena(size_t initial_block_size) {
+  rebuild(initial_block_size);
+}
+
+void MessageArena::reset() {
+  uint64_t allocated = m_arena->SpaceAllocated();
+  if (allocated > m_block_size && m_block_size < kMaxBlockSize) {
+    rebuild(round_up_pow2(allocated));
+  } else {
+    m_arena->Reset();
+  }
+}
+
+void MessageArena::rebuild(size_t block_size) {
+  m_arena.reset();  // 先析构 Arena，它可能仍在使用旧的首块
+  m_block.reset(new char[block_size]);
+  m_block_size = block_size;
+
+  google::protobuf::ArenaOptions options;
+  options.initial_block = m_block.get();
+  options.initial_block_size = m_block_size;
+  m_arena.emplace(options);
+}
+
+void MessagePool::Recycler::operator()(MessageArena* arena) const {
+  pool->recycle(arena);
+}
+
+// Arena 的首块归属于调用 Reset（或构造）的线程，其他线程在其上分配时会另起新块。
+// 因此归还时不做处理，留到取出它的线程上再 Reset
+MessagePool::ArenaPtr MessagePool::acquire() {
+  std::unique_ptr<MessageArena> arena;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_free.empty()) {
+      arena = std::move(m_free.back());
+      m_free.pop_back();
+    } else {
+      m_free.reserve(kMaxPooledArenas);
+    }
+  }
+  if (arena) {
+    arena->reset();
+  } else {
+    arena = std::make_unique<MessageArena>(kDefaultBlockSize);
+  }
+  return ArenaPtr(arena.release(), Recycler{this});
+}
+
+void MessagePool::recycle(MessageArena* arena) {
+  std::unique_ptr<MessageArena> owned(arena);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_free.size() < kMaxPooledArenas) {
+    m_free.push_back(std::move(owned));
+  }
+}
@@ -0,0 +1,54 @@
+// cpp_backend/src/message_pool.h
+#pragma once
+
+#include <google/protobuf/arena.h>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+// 可复用的 protobuf Arena。首块内存由自己持有并在 Reset 后保留；
+// 一轮用量超过首块时按用量扩大首块，稳态下构建消息不再向堆申请内存。
+class MessageArena {
+ public:
+  explicit MessageArena(size_t initial_block_size);
+  MessageArena(const MessageArena&) = delete;
+  MessageArena& operator=(const MessageArena&) = delete;
+
+  google::protobuf::Arena* get() { return &*m_arena; }
+
+  // 析构 Arena 上的全部消息，回到空状态
+  void reset();
+
+ private:
+  void rebuild(size_t block_size);
+
+  std::unique_ptr<char[]> m_block;
+  size_t m_block_size = 0;
+  std::optional<google::protobuf::Arena> m_arena;
+};
+
+// Arena 对象池：API 线程取出 Arena 构建消息，发送线程写完后随句柄析构自动归还，
+// 下次取出时再 Reset。池本身必须比所有借出的句柄活得久。
+class MessagePool {
+ public:
+  struct Recycler {
+    MessagePool* pool = nullptr;
+    void operator()(MessageArena* arena) const;
+  };
+  using ArenaPtr = std::unique_ptr<MessageArena, Recycler>;
+
+  MessagePool() = default;
+  MessagePool(const MessagePool&) = delete;
+  MessagePool& operator=(const MessagePool&) = delete;
+
+  ArenaPtr acquire();
+
+ private:
+  void recycle(MessageArena* arena);
+
+  std::mutex m_mutex;
+  std::vector<std::unique_ptr<MessageArena>> m_free;
+};
@@ -0,0 +1,174 @@
+#include "point_cloud.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+namespace {
+
+constexpr size_t kXyzBytes = 3 * sizeof(float);
+constexpr size_t kIntensityBytes = sizeof(float);
+constexpr size_t kRgbBytes = 3;
+
+// 把 float 以小端字节序写到 dst
+void store_floats(const float* src, size_t count, char* dst) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t bits;
+    std::memcpy(&bits, &src[i], sizeof(bits));
+    bits = __builtin_bswap32(bits);
+    std::memcpy(dst + i * sizeof(bits), &bits, sizeof(bits));
+  }
+#else
+  std::memcpy(dst, src, count * sizeof(float));
+#endif
+}
+
+// 按 kept 中的下标（为空时取全部 count 个）挑出逐点数据，每点 stride 字节
+template <typename T, typename Write>
+void gather(const std::vector<T>& values, const std::vector<uint32_t>* kept,
+            size_t stride, std::string* out, Write write) {
+  size_t count = kept ? kept->size() : values.size();
+  out->resize(count * stride);
+  char* dst = &(*out)[0];
+  if (!kept) {
+    write(values.data(), count, dst);
+    return;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    write(&values[(*kept)[i]], 1, dst + i * stride);
+  }
+}
+
+// 体素坐标打包成 64 位键：每轴 21 位，超出范围的按位截断（相距很远的体素
+// 偶尔合并，只影响降采样的精度）。超出 int64 的坐标（含乘积溢出为无穷的）
+// 先截到 ±2^62，否则转换是未定义行为
+uint64_t voxel_key(const Vis::Vec3& p, float inverse) {
+  auto axis = [inverse](float v) {
+    constexpr float kLimit = 0x1p62f;
+    float cell = std::clamp(std::floor(v * inverse), -kLimit, kLimit);
+    return static_cast<uint64_t>(static_cast<int64_t>(cell)) & 0x1fffff;
+  };
+  return axis(p.x) | (axis(p.y) << 21) | (axis(p.z) << 42);
+}
+
+}  // namespace
+
+void voxel_downsample(const std::vector<Vis::Vec3>& points, float voxel,
+                      std::vector<uint32_t>* kept) {
+  kept->clear();
+  // 开放寻址的哈希集合，容量取不小于 2 倍点数的 2 的幂。
+  // 一帧百万点时比 std::unordered_set 快一个数量级，且不逐个分配节点
+  constexpr uint64_t kEmpty = ~0ull;
+  size_t capacity = 16;
+  while (capacity < points.size() * 2) capacity <<= 1;
+  thread_local std::vector<uint64_t> table;
+  table.assign(capacity, kEmpty);
+  const size_t mask = capacity - 1;
+  const float inverse = 1.f / voxel;
+
+  // 表远大于缓存，每次探查几乎都是一次缓存缺失。按批先算出各点的槽位并预取，
+  // 再依次插入，让多次缺失重叠
+  constexpr size_t kBatch = 16;
+  uint64_t keys[kBatch];
+  size_t slots[kBatch];
+  uint32_t indices[kBatch];
+  for (size_t begin = 0; begin < points.size(); begin += kBatch) {
+    size_t end = std::min(points.size(), begin + kBatch);
+    size_t n = 0;
+    for (size_t i = begin; i < end; ++i) {
+      const Vis::Vec3& p = points[i];
+      if (!std::isfinite(p.x) || !std::isfinite(p.y) || !std::isfinite(p.z)) {
+        continue;
+      }
+      keys[n] = voxel_key(p, inverse);
+      slots[n] = static_cast<size_t>((keys[n] * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+      indices[n] = static_cast<uint32_t>(i);
+      __builtin_prefetch(&table[slots[n]]);
+      ++n;
+    }
+    for (size_t k = 0; k < n; ++k) {
+      size_t slot = slots[k];
+      while (table[slot] != kEmpty && table[slot] != keys[k]) {
+        slot = (slot + 1) & mask;
+      }
+      if (table[slot] == keys[k]) continue;
+      table[slot] = keys[k];
+      kept->push_back(indices[k]);
+    }
+  }
+}
+
+void encode_point_cloud(const Vis::PointCloud3D& in,
+                        visualization::PointCloud3D* out) {
+  const auto& points = in.get_points();
+  thread_local std::vector<uint32_t> kept;
+  const std::vector<uint32_t>* selection = nullptr;
+  if (in.get_voxel_size() > 0.f) {
+    voxel_downsample(points, in.get_voxel_size(), &kept);
+    selection = &kept;
+  }
+
+  auto write_floats = [](const auto* src, size_t count, char* dst) {
+    store_floats(reinterpret_cast<const float*>(src),
+                 count * sizeof(*src) / sizeof(float), dst);
+  };
+  gather(points, selection, kXyzBytes, out->mutable_xyz(), write_floats);
+  // 强度或颜色与点数不一致时视为没有，避免客户端越界
+  if (!in.get_intensities().empty() &&
+      in.get_intensities().size() == points.size()) {
+    gather(in.get_intensities(), selection, kIntensityBytes,
+           out->mutable_intensity(), write_floats);
+  } else if (!in.get_colors().empty() &&
+             in.get_colors().size() == points.size()) {
+    static_assert(sizeof(Vis::ColorRGB8) == kRgbBytes,
+                  "ColorRGB8 必须紧密排列，才能整段写入 rgb");
+    gather(in.get_colors(), selection, kRgbBytes, out->mutable_rgb(),
+           [](const Vis::ColorRGB8* src, size_t count, char* dst) {
+             std::memcpy(dst, src, count * kRgbBytes);
+           });
+  }
+  out->set_start(0);
+  out->set_total(static_cast<uint32_t>(point_cloud_size(*out)));
+}
+
+size_t point_cloud_size(const visualization::PointCloud3D& cloud) {
+  return cloud.xyz().size() / kXyzBytes;
+}
+
+size_t point_cloud_chunk_points(const visualization::PointCloud3D& cloud,
+                                size_t max_bytes) {
+  size_t stride = kXyzBytes;
+  if (!cloud.intensity().empty()) stride += kIntensityBytes;
+  if (!cloud.rgb().empty()) stride += kRgbBytes;
+  size_t points = max_bytes / stride;
+  return points > 0 ? points : 1;
+}
+
+void copy_point_cloud_range(const visualization::PointCloud3D& src,
+                            size_t start, size_t count,
+                            visualization::PointCloud3D* out) {
+  out->set_start(static_cast<uint32_t>(src.start() + start));
+  out->set_total(src.total());
+  out->set_xyz(src.xyz().substr(start * kXyzBytes, count * kXyzBytes));
+  if (!src.intensity().empty()) {
+    out->set_intensity(src.intensity().substr(start * kIntensityBytes,
+                                              count * kIntensityBytes));
+  }
+  if (!src.rgb().empty()) {
+    out->set_rgb(src.rgb().substr(start * kRgbBytes, count * kRgbBytes));
+  }
+}
+
+void truncate_point_cloud(visualization::PointCloud3D* cloud, size_t count) {
+  if (cloud->xyz().size() > count * kXyzBytes) {
+    cloud->mutable_xyz()->resize(count * kXyzBytes);
+  }
+  if (cloud->intensity().size() > count * kIntensityBytes) {
+    cloud->mutable_intensity()->resize(count * kIntensityBytes);
+  }
+  if (cloud->rgb().size() > count * kRgbBytes) {
+    cloud->mutable_rgb()->resize(count * kRgbBytes);
+  }
+}
@@ -0,0 +1,39 @@
+// cpp_backend/src/point_cloud.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "vis_primitives.h"
+#include "visualization.pb.h"
+
+// 点云的编码与分块。整帧先写进一条 PointCloud3D（start = 0），
+// 发送前再由服务端按 kPointCloudChunkBytes 切成若干块，每块一条消息。
+
+// 单块点云的字节数上限，与批量添加消息的上限相同
+constexpr size_t kPointCloudChunkBytes = 256 * 1024;
+
+// 写入整帧点云；设置了体素大小时先降采样，total 为降采样后的点数
+void encode_point_cloud(const Vis::PointCloud3D& in,
+                        visualization::PointCloud3D* out);
+
+// 体素降采样：每个边长为 voxel 的立方体只保留第一个落入的点，
+// 按原顺序把保留点的下标写入 kept。非有限坐标的点直接丢弃
+void voxel_downsample(const std::vector<Vis::Vec3>& points, float voxel,
+                      std::vector<uint32_t>* kept);
+
+// cloud 中的点数，以 xyz 为准
+size_t point_cloud_size(const visualization::PointCloud3D& cloud);
+
+// 每块最多容纳的点数，取决于是否带强度或颜色
+size_t point_cloud_chunk_points(const visualization::PointCloud3D& cloud,
+                                size_t max_bytes);
+
+// 把 src 中 [start, start + count) 的点拷贝为一块，start 为整帧中的下标
+void copy_point_cloud_range(const visualization::PointCloud3D& src,
+                            size_t start, size_t count,
+                            visualization::PointCloud3D* out);
+
+// 只保留前 count 个点
+void truncate_point_cloud(visualization::PointCloud3D* cloud, size_t count);
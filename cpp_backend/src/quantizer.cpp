@@ -0,0 +1,93 @@
+#include "quantizer.h"
+
+#include <cmath>
+#include <cstring>
+
+Quantizer::Quantizer(const Vis::Quantization& params)
+    : m_step(params.step > 0.f ? params.step : 0.f),
+      m_origin(params.origin) {}
+
+void Quantizer::apply(visualization::Add2DObject* cmd) const {
+  apply_vertices(cmd);
+}
+
+void Quantizer::apply(visualization::Add3DObject* cmd) const {
+  apply_vertices(cmd);
+}
+
+void Quantizer::apply(visualization::Update2DObjectGeometry* cmd) const {
+  apply_vertices(cmd);
+  if (enabled() && cmd->has_append_points()) {
+    apply_append(cmd->mutable_append_points());
+  }
+}
+
+void Quantizer::apply(visualization::Update3DObjectGeometry* cmd) const {
+  apply_vertices(cmd);
+  if (enabled() && cmd->has_append_points()) {
+    apply_append(cmd->mutable_append_points());
+  }
+}
+
+void Quantizer::to_proto(visualization::Quantization* out) const {
+  out->set_step(m_step);
+  out->mutable_origin()->set_x(m_origin.x);
+  out->mutable_origin()->set_y(m_origin.y);
+}
+
+template <typename Command>
+void Quantizer::apply_vertices(Command* cmd) const {
+  if (!enabled()) return;
+  if (cmd->has_line_2d()) {
+    auto* line = cmd->mutable_line_2d();
+    encode(line->mutable_xy(), line->mutable_dxy());
+  } else if (cmd->has_polygon()) {
+    auto* polygon = cmd->mutable_polygon();
+    encode(polygon->mutable_xy(), polygon->mutable_dxy());
+  }
+}
+
+// Line3D 的追加带 xyz，不量化
+void Quantizer::apply_append(visualization::AppendPoints* append) const {
+  if (!append->has_xy()) return;
+  encode(append->mutable_xy(), append->mutable_dxy());
+  append->clear_xy();
+}
+
+void Quantizer::encode(std::string* xy,
+                       google::protobuf::RepeatedField<int32_t>* dxy) const {
+  size_t count = xy->size() / sizeof(float);
+  dxy->Clear();
+  dxy->Reserve(static_cast<int>(count));
+  int32_t prev_x = 0;
+  int32_t prev_y = 0;
+  for (size_t i = 0; i + 1 < count; i += 2) {
+    float v[2];
+    std::memcpy(v, xy->data() + i * sizeof(float), sizeof(v));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    for (float& f : v) {
+      uint32_t bits;
+      std::memcpy(&bits, &f, sizeof(bits));
+      bits = __builtin_bswap32(bits);
+      std::memcpy(&f, &bits, sizeof(bits));
+    }
+#endif
+    int32_t qx = quantize(v[0], m_origin.x);
+    int32_t qy = quantize(v[1], m_origin.y);
+    dxy->AddAlreadyReserved(qx - prev_x);
+    dxy->AddAlreadyReserved(qy - prev_y);
+    prev_x = qx;
+    prev_y = qy;
+  }
+  xy->clear();
+}
+
+// 四舍五入到最近的定点值，误差不超过 step / 2；超出范围的截断，
+// 非法值（NaN 等）按 0 处理，与客户端对 float 顶点的处理一致
+int32_t Quantizer::quantize(float value, float origin) const {
+  double v = std::isfinite(value) ? value : 0.0;
+  double q = std::nearbyint((v - origin) / m_step);
+  if (q > kMaxValue) return kMaxValue;
+  if (q < -kMaxValue) return -kMaxValue;
+  return static_cast<int32_t>(q);
+}
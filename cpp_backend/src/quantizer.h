@@ -0,0 +1,43 @@
+// cpp_backend/src/quantizer.h
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "vis_stream.h"
+#include "visualization.pb.h"
+
+// 窗口级坐标量化（见 Vis::Quantization）。图元照常按 float 写入命令后，
+// 再由 apply 把其中的二维顶点数组（Line2D / Polygon / AppendPoints 的 xy）
+// 就地改写为定点差分编码 dxy。未开启量化时 apply 不做任何事。
+class Quantizer {
+ public:
+  // 定点坐标的绝对值上限。取 2^30 - 1，相邻两点的差值也不会超出 int32
+  static constexpr int32_t kMaxValue = (1 << 30) - 1;
+
+  Quantizer() = default;
+  explicit Quantizer(const Vis::Quantization& params);
+
+  bool enabled() const { return m_step > 0; }
+
+  void apply(visualization::Add2DObject* cmd) const;
+  void apply(visualization::Add3DObject* cmd) const;
+  void apply(visualization::Update2DObjectGeometry* cmd) const;
+  void apply(visualization::Update3DObjectGeometry* cmd) const;
+
+  // 写入 CreateWindow，客户端据此还原
+  void to_proto(visualization::Quantization* out) const;
+
+ private:
+  template <typename Command>
+  void apply_vertices(Command* cmd) const;
+  void apply_append(visualization::AppendPoints* append) const;
+
+  // 把 xy 中的 float 顶点改写为 dxy，并清空 xy
+  void encode(std::string* xy,
+              google::protobuf::RepeatedField<int32_t>* dxy) const;
+  int32_t quantize(float value, float origin) const;
+
+  float m_step = 0.f;
+  Vis::Vec2 m_origin;
+};
@@ -0,0 +1,253 @@
+#include "send_queue.h"
+
+#include <unordered_map>
+#include <utility>
+
+#include "geometry_append.h"
+
+namespace {
+
+template <typename SceneUpdate>
+bool all_geometry_updates(const SceneUpdate& update) {
+  if (update.commands_size() == 0) return false;
+  for (const auto& cmd : update.commands()) {
+    if (!cmd.has_update_object_geometry()) return false;
+  }
+  return true;
+}
+
+bool is_geometry_only(const visualization::VisMessage& msg) {
+  if (msg.has_scene_2d_update()) {
+    return all_geometry_updates(msg.scene_2d_update());
+  }
+  if (msg.has_scene_3d_update()) {
+    return all_geometry_updates(msg.scene_3d_update());
+  }
+  return false;
+}
+
+// 是否发往同一接收方
+bool same_receiver(const OutgoingMessage& a, const OutgoingMessage& b) {
+  return a.target == b.target && !a.connection.owner_before(b.connection) &&
+         !b.connection.owner_before(a.connection);
+}
+
+// 是否属于同一窗口
+bool same_window(const OutgoingMessage& a, const OutgoingMessage& b) {
+  if (a.message->has_scene_2d_update() && b.message->has_scene_2d_update()) {
+    return a.message->scene_2d_update().window_id() ==
+           b.message->scene_2d_update().window_id();
+  }
+  if (a.message->has_scene_3d_update() && b.message->has_scene_3d_update()) {
+    return a.message->scene_3d_update().window_id() ==
+           b.message->scene_3d_update().window_id();
+  }
+  return false;
+}
+
+// item 的内容能否前移越过 queued。同一窗口的消息无论发给谁都不能越过，
+// 控制项和帧提交也不能越过，见 SendQueue 的顺序保证
+bool may_overtake(const OutgoingMessage& queued, const OutgoingMessage& item) {
+  return queued.message && !queued.message->has_frame_commit() &&
+         !same_window(queued, item);
+}
+
+// item 能否并入 queued：同一窗口、同一接收方、都是纯几何更新且属于同一帧
+bool can_merge(const OutgoingMessage& queued, const OutgoingMessage& item) {
+  return queued.message && queued.geometry_only && same_window(queued, item) &&
+         same_receiver(queued, item) &&
+         queued.message->frame_id() == item.message->frame_id();
+}
+
+// 把 src 中的几何更新并入 dst：同一图元用新状态覆盖旧状态（增量追加和部分
+// 更新则并入旧命令），其余追加
+template <typename SceneUpdate>
+void merge_geometry_updates(SceneUpdate* dst, SceneUpdate* src) {
+  std::unordered_map<uint32_t, int> index_by_id;
+  index_by_id.reserve(dst->commands_size());
+  for (int i = 0; i < dst->commands_size(); ++i) {
+    index_by_id[dst->commands(i).update_object_geometry().id()] = i;
+  }
+  for (auto& cmd : *src->mutable_commands()) {
+    auto it = index_by_id.find(cmd.update_object_geometry().id());
+    if (it != index_by_id.end()) {
+      auto* queued = dst->mutable_commands(it->second);
+      if (!append_geometry_update(cmd.update_object_geometry(),
+                                  queued->mutable_update_object_geometry())) {
+        *queued = std::move(cmd);
+      }
+    } else {
+      index_by_id.emplace(cmd.update_object_geometry().id(),
+                          dst->commands_size());
+      *dst->add_commands() = std::move(cmd);
+    }
+  }
+}
+
+}  // namespace
+
+SendQueue::SendQueue(size_t capacity, Vis::SendOverflowPolicy policy) {
+  m_stats.capacity = capacity > 0 ? capacity : 1;
+  m_stats.policy = policy;
+  m_ring.resize(m_stats.capacity);
+}
+
+void SendQueue::set_policy(Vis::SendOverflowPolicy policy, size_t capacity) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_stats.policy = policy;
+  m_stats.capacity = capacity > 0 ? capacity : 1;
+  resize_ring_locked(m_stats.capacity);
+  m_not_full.notify_all();
+}
+
+bool SendQueue::push(OutgoingMessage&& item) {
+  item.geometry_only = item.message && is_geometry_only(*item.message);
+  item.droppable =
+      item.geometry_only && !has_incremental_commands(*item.message);
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (m_closed) return false;
+
+  if (is_full_locked()) {
+    // 先按策略腾出空间，做不到时退化为等待发送线程
+    if (m_stats.policy == Vis::SendOverflowPolicy::COALESCE &&
+        coalesce_locked(item)) {
+      return true;
+    }
+    bool made_room = m_stats.policy == Vis::SendOverflowPolicy::DROP_OLDEST &&
+                     drop_oldest_locked();
+    if (!made_room) {
+      ++m_stats.blocked;
+      m_not_full.wait(lock, [this] { return m_closed || !is_full_locked(); });
+      if (m_closed) return false;
+    }
+  }
+
+  ++m_size;
+  if (item.message) ++m_stats.enqueued;
+  at_locked(m_size - 1) = std::move(item);
+  if (m_size > m_stats.high_watermark) {
+    m_stats.high_watermark = m_size;
+  }
+  lock.unlock();
+  m_not_empty.notify_one();
+  return true;
+}
+
+bool SendQueue::pop(OutgoingMessage& item) {
+  item = OutgoingMessage();  // 在锁外归还上一条消息的 Arena
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_not_empty.wait(lock, [this] { return m_closed || m_size > 0; });
+  if (m_size == 0) return false;
+
+  take_front_locked(item);
+  lock.unlock();
+  m_not_full.notify_one();
+  return true;
+}
+
+SendQueue::PopResult SendQueue::pop_for(OutgoingMessage& item,
+                                        std::chrono::milliseconds timeout) {
+  item = OutgoingMessage();  // 在锁外归还上一条消息的 Arena
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_not_empty.wait_for(lock, timeout,
+                       [this] { return m_closed || m_size > 0; });
+  if (m_size == 0) return m_closed ? PopResult::CLOSED : PopResult::TIMEOUT;
+
+  take_front_locked(item);
+  lock.unlock();
+  m_not_full.notify_one();
+  return PopResult::ITEM;
+}
+
+void SendQueue::close() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_closed = true;
+  }
+  m_not_empty.notify_all();
+  m_not_full.notify_all();
+}
+
+void SendQueue::reopen() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  while (m_size > 0) erase_locked(m_size - 1);
+  m_head = 0;
+  m_closed = false;
+}
+
+Vis::SendQueueStats SendQueue::stats() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  Vis::SendQueueStats stats = m_stats;
+  stats.depth = m_size;
+  return stats;
+}
+
+void SendQueue::take_front_locked(OutgoingMessage& item) {
+  item = std::move(at_locked(0));
+  m_head = (m_head + 1) % m_ring.size();
+  --m_size;
+  if (item.message) ++m_stats.sent;
+}
+
+void SendQueue::resize_ring_locked(size_t capacity) {
+  // 容量缩小时保留已入队的消息，多出的部分随出队自然消化
+  size_t slots = capacity > m_size ? capacity : m_size;
+  if (slots == m_ring.size()) return;
+  std::vector<OutgoingMessage> ring(slots);
+  for (size_t i = 0; i < m_size; ++i) {
+    ring[i] = std::move(at_locked(i));
+  }
+  m_ring.swap(ring);
+  m_head = 0;
+}
+
+// 移除第 i 条消息，其后的消息依次前移以保持顺序
+void SendQueue::erase_locked(size_t i) {
+  for (; i + 1 < m_size; ++i) {
+    at_locked(i) = std::move(at_locked(i + 1));
+  }
+  at_locked(m_size - 1) = OutgoingMessage();
+  --m_size;
+}
+
+bool SendQueue::drop_oldest_locked() {
+  for (size_t i = 0; i < m_size; ++i) {
+    if (at_locked(i).droppable) {
+      erase_locked(i);
+      ++m_stats.dropped;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool SendQueue::coalesce_locked(OutgoingMessage& item) {
+  if (!item.geometry_only) return false;
+
+  // 合并把 item 的内容前移到 queued 的位置，因此只能并入同一窗口的最近一条
+  // 消息，且途经的每一条都必须允许越过：不能越过该窗口的添加/删除命令或发给
+  // 别的接收方的消息（如新客户端的重放分块，否则新客户端会先收到较新的几何、
+  // 再收到较旧的快照），不能越过客户端加入/离开的控制项，否则接收方集合会变；
+  // 帧事务的更新不能越过帧提交，也不能并入别的帧或帧外的消息
+  for (size_t i = m_size; i-- > 0;) {
+    OutgoingMessage& queued = at_locked(i);
+    if (!can_merge(queued, item)) {
+      if (may_overtake(queued, item)) continue;
+      return false;
+    }
+
+    if (item.message->has_scene_2d_update()) {
+      merge_geometry_updates(queued.message->mutable_scene_2d_update(),
+                             item.message->mutable_scene_2d_update());
+    } else {
+      merge_geometry_updates(queued.message->mutable_scene_3d_update(),
+                             item.message->mutable_scene_3d_update());
+    }
+    ++m_stats.coalesced;
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,90 @@
+// cpp_backend/src/send_queue.h
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "message_pool.h"
+#include "vis_stream.h"
+#include "visualization.pb.h"
+
+class SessionRecorder;
+
+// 队列项的接收方。客户端的加入和离开也作为控制项经过队列，
+// 发送线程据此维护广播列表，保证每条广播只发给入队时已在线的客户端。
+// 录制的开始和结束同理，录下的恰好是其间入队的广播
+enum class SendTarget {
+  ALL_CLIENTS,        // 广播，录制中也写入录制文件
+  ONE_CLIENT,         // 只发给 connection，如新客户端的场景重放
+  RECORDER,           // 只写入录制文件，如开始录制时的场景快照
+  CLIENT_JOINED,      // 控制项：connection 加入广播列表，不带消息
+  CLIENT_LEFT,        // 控制项：connection 离开广播列表，不带消息
+  RECORDING_STARTED,  // 控制项：之后的广播写入 recorder，不带消息
+  RECORDING_STOPPED   // 控制项：停止录制并关闭文件，不带消息
+};
+
+// 待发送的消息快照
+struct OutgoingMessage {
+  MessagePool::ArenaPtr arena;  // 消息所在的 Arena，随本结构析构归还对象池
+  visualization::VisMessage* message = nullptr;  // 分配在 arena 上
+  SendTarget target = SendTarget::ALL_CLIENTS;
+  std::weak_ptr<void> connection;  // 目标连接（websocketpp::connection_hdl）
+  bool geometry_only = false;      // 只包含几何更新，允许被合并
+  bool droppable = false;  // 允许被丢弃：纯几何更新，且不含增量命令
+  std::shared_ptr<SessionRecorder> recorder;  // 仅 RECORDING_STARTED 使用
+};
+
+// 有界发送队列：API 线程入队消息快照，发送线程出队后序列化并写入连接。
+// 队列满时按 Vis::SendOverflowPolicy 处理，结构性命令、增量命令和控制项永不丢弃。
+// 统计数据只计入带消息的项。
+// 存储为预分配的环形缓冲区，稳态下入队出队不申请内存。
+//
+// 顺序保证：同一窗口的消息按入队顺序到达每个接收方，无论各自发给谁。
+// 丢弃只移除消息、不改变其余消息的先后；合并是唯一把内容前移的操作，
+// 只在这一保证下进行（见 coalesce_locked）。服务端在锁外分块构造新客户端的
+// 重放、与实时更新交错入队，依赖的正是这一点
+class SendQueue {
+ public:
+  explicit SendQueue(
+      size_t capacity = 4096,
+      Vis::SendOverflowPolicy policy = Vis::SendOverflowPolicy::BLOCK);
+
+  void set_policy(Vis::SendOverflowPolicy policy, size_t capacity);
+
+  // 入队；队列已关闭时丢弃并返回 false
+  bool push(OutgoingMessage&& item);
+  // 阻塞直到取到消息；队列关闭且为空时返回 false
+  bool pop(OutgoingMessage& item);
+
+  enum class PopResult { ITEM, TIMEOUT, CLOSED };
+  // 与 pop 相同，但最多等待 timeout
+  PopResult pop_for(OutgoingMessage& item, std::chrono::milliseconds timeout);
+
+  void close();   // 唤醒所有等待者，之后的 push 均失败
+  void reopen();  // 清空残留消息并重新接受入队
+
+  Vis::SendQueueStats stats() const;
+
+ private:
+  bool is_full_locked() const { return m_size >= m_stats.capacity; }
+  OutgoingMessage& at_locked(size_t i) {
+    return m_ring[(m_head + i) % m_ring.size()];
+  }
+  void take_front_locked(OutgoingMessage& item);
+  void resize_ring_locked(size_t capacity);
+  void erase_locked(size_t i);
+  bool drop_oldest_locked();
+  bool coalesce_locked(OutgoingMessage& item);
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_not_empty;
+  std::condition_variable m_not_full;
+  std::vector<OutgoingMessage> m_ring;
+  size_t m_head = 0;  // 队首在 m_ring 中的下标
+  size_t m_size = 0;
+  Vis::SendQueueStats m_stats;
+  bool m_closed = false;
+};
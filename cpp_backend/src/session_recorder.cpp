@@ -0,0 +1,148 @@
+#include "session_recorder.h"
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+namespace {
+
+void put_le(uint64_t value, size_t bytes, uint8_t* out) {
+  for (size_t i = 0; i < bytes; ++i) {
+    out[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+}  // namespace
+
+std::string recording_file_path(const std::string& prefix, size_t index) {
+  char suffix[32];
+  std::snprintf(suffix, sizeof(suffix), "-%04zu.visrec", index);
+  return prefix + suffix;
+}
+
+SessionRecorder::~SessionRecorder() { close(); }
+
+bool SessionRecorder::open(const std::string& prefix, size_t rotate_bytes) {
+  m_prefix = prefix;
+  m_rotate_bytes = rotate_bytes;
+  m_file_index = 0;
+  if (!open_file()) return false;
+  m_file_bytes = sizeof(kRecordingMagic);
+  m_writer = std::thread([this]() { write_loop(); });
+  return true;
+}
+
+uint8_t* SessionRecorder::reserve(int64_t timestamp_us, size_t size) {
+  size_t frame_bytes = kRecordingFrameHeaderBytes + size;
+  // 在帧边界处换文件；单帧超过上限时独占一个文件
+  if (m_rotate_bytes > 0 && m_file_bytes > sizeof(kRecordingMagic) &&
+      m_file_bytes + frame_bytes > m_rotate_bytes) {
+    m_current.rotate_after = true;
+    submit_current();
+    m_file_bytes = sizeof(kRecordingMagic);
+  }
+  if (m_current.size + frame_bytes > m_current.capacity) {
+    if (m_current.size > 0) submit_current();
+    // 超过一块的大帧单独分配
+    if (frame_bytes > m_current.capacity) {
+      m_current.capacity = std::max(frame_bytes, kBufferBytes);
+      m_current.data.reset(new uint8_t[m_current.capacity]);
+    }
+  }
+  m_file_bytes += frame_bytes;
+
+  uint8_t* header = m_current.data.get() + m_current.size;
+  m_current.size += frame_bytes;
+  put_le(size, 4, header);
+  put_le(static_cast<uint64_t>(timestamp_us), 8, header + 4);
+  return header + kRecordingFrameHeaderBytes;
+}
+
+void SessionRecorder::submit_current() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_space.wait(lock, [this]() {
+    return m_full.size() < kMaxQueuedBuffers || m_failed;
+  });
+  if (m_failed) {
+    m_current.size = 0;
+    m_current.rotate_after = false;
+    return;
+  }
+  Buffer next;
+  if (!m_spare.empty()) {
+    next = std::move(m_spare.back());
+    m_spare.pop_back();
+  }
+  m_full.push_back(std::exchange(m_current, std::move(next)));
+  m_ready.notify_one();
+}
+
+void SessionRecorder::close() {
+  if (!m_writer.joinable()) return;
+  if (m_current.size > 0) submit_current();
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_closing = true;
+  }
+  m_ready.notify_one();
+  m_writer.join();
+  if (m_file) {
+    std::fclose(m_file);
+    m_file = nullptr;
+  }
+}
+
+void SessionRecorder::write_loop() {
+  while (true) {
+    Buffer buffer;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_ready.wait(lock, [this]() { return !m_full.empty() || m_closing; });
+      if (m_full.empty()) return;
+      buffer = std::move(m_full.front());
+      m_full.pop_front();
+    }
+    m_space.notify_one();
+
+    if (!m_failed) {
+      size_t written = std::fwrite(buffer.data.get(), 1, buffer.size, m_file);
+      m_bytes_written += written;
+      if (written != buffer.size ||
+          (buffer.rotate_after && !open_file())) {
+        std::cerr << "❌ 错误：写入录制文件失败，之后的消息不再录制。"
+                  << std::endl;
+        m_failed = true;
+        m_space.notify_one();
+      }
+    }
+
+    // 单独分配的大帧不留作备用
+    if (buffer.capacity > kBufferBytes) continue;
+    buffer.size = 0;
+    buffer.rotate_after = false;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_spare.push_back(std::move(buffer));
+  }
+}
+
+// 关闭当前文件（如有），打开下一个并写入魔数
+bool SessionRecorder::open_file() {
+  if (m_file) {
+    std::fclose(m_file);
+    ++m_file_index;
+  }
+  std::string path = recording_file_path(m_prefix, m_file_index);
+  m_file = std::fopen(path.c_str(), "wb");
+  if (!m_file) {
+    std::cerr << "❌ 错误：无法创建录制文件 " << path << std::endl;
+    return false;
+  }
+  // 写入已按块缓冲，关掉 stdio 自己的缓冲，避免多一次拷贝
+  std::setvbuf(m_file, nullptr, _IONBF, 0);
+  if (std::fwrite(kRecordingMagic, 1, sizeof(kRecordingMagic), m_file) !=
+      sizeof(kRecordingMagic)) {
+    return false;
+  }
+  m_bytes_written += sizeof(kRecordingMagic);
+  return true;
+}
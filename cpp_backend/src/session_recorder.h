@@ -0,0 +1,83 @@
+// cpp_backend/src/session_recorder.h
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 录制文件格式（录制与回放共用）：
+//   文件头为 8 字节魔数 kRecordingMagic，之后逐帧排列
+//   [uint32 负载长度][int64 时间戳，Unix 时间的微秒数][负载：序列化的 VisMessage]
+// 整数均为小端。单个文件超过大小上限后在帧边界处换下一个文件，
+// 文件名为 <prefix>-0000.visrec、<prefix>-0001.visrec……
+constexpr char kRecordingMagic[8] = {'V', 'I', 'S', 'R', 'E', 'C', '1', '\n'};
+constexpr size_t kRecordingFrameHeaderBytes = 12;
+
+// 第 index 个录制文件的路径
+std::string recording_file_path(const std::string& prefix, size_t index);
+
+// 追加写入录制文件。帧先拷贝进内存缓冲区，攒满一块后交给写线程，
+// 调用方只付出一次 memcpy（或直接序列化进缓冲区）。
+// 写线程跟不上时最多排队 kMaxQueuedBuffers 块，再多则 reserve 阻塞等待，
+// 不丢帧；写入失败后丢弃之后的全部数据。
+// reserve 只能由一个线程调用（服务端的发送线程）
+class SessionRecorder {
+ public:
+  SessionRecorder() = default;
+  ~SessionRecorder();
+  SessionRecorder(const SessionRecorder&) = delete;
+  SessionRecorder& operator=(const SessionRecorder&) = delete;
+
+  // 创建第一个文件并启动写线程，失败时返回 false。rotate_bytes 为 0 表示不分文件
+  bool open(const std::string& prefix, size_t rotate_bytes);
+  // 追加一帧的帧头，返回供调用方写入 size 字节负载的位置，
+  // 下次调用 reserve 或 close 之前有效
+  uint8_t* reserve(int64_t timestamp_us, size_t size);
+  // 交出剩余数据，等写线程写完后关闭文件
+  void close();
+
+  uint64_t bytes_written() const { return m_bytes_written; }
+
+ private:
+  // 不用 std::string / std::vector：扩容时的清零对大块数据是一笔白花的开销
+  struct Buffer {
+    std::unique_ptr<uint8_t[]> data;
+    size_t capacity = 0;
+    size_t size = 0;
+    bool rotate_after = false;  // 写完这块后换下一个文件
+  };
+
+  void submit_current();
+  void write_loop();
+  bool open_file();
+
+  static constexpr size_t kBufferBytes = 4 * 1024 * 1024;
+  static constexpr size_t kMaxQueuedBuffers = 32;
+
+  std::string m_prefix;
+  size_t m_rotate_bytes = 0;
+  size_t m_file_bytes = 0;  // 当前文件已分配的字节数，含未写出的缓冲
+  Buffer m_current;         // 仅调用 reserve 的线程访问
+
+  std::mutex m_mutex;
+  std::condition_variable m_ready;  // 有待写的缓冲或要关闭
+  std::condition_variable m_space;  // 排队的缓冲减少
+  std::deque<Buffer> m_full;
+  std::vector<Buffer> m_spare;  // 写完的缓冲，循环使用
+  bool m_closing = false;
+  std::thread m_writer;
+
+  // 以下仅写线程访问（open 时写线程尚未启动）
+  std::FILE* m_file = nullptr;
+  size_t m_file_index = 0;
+  std::atomic<bool> m_failed{false};
+  std::atomic<uint64_t> m_bytes_written{0};
+};
@@ -0,0 +1,106 @@
+// cpp_backend/src/slot_map.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <utility>
+#include <vector>
+
+// 带代数（generation）的槽位表：以 32 位句柄索引元素，增删查均为 O(1)。
+// 句柄低 kIndexBits 位是槽位下标，高位是该槽位的代数；槽位被复用时代数加一，
+// 因此过期句柄不会误命中新元素（代数回绕前有效）。空闲槽位按先进先出复用，
+// 尽量拉长同一槽位两次复用之间的间隔。
+// 槽位 0 保留不用，句柄 0 恒为无效值，与 proto 中 uint32 的默认值一致。
+template <typename T>
+class SlotMap {
+ public:
+  using Handle = uint32_t;
+
+  static constexpr uint32_t kIndexBits = 22;  // 最多约 400 万个槽位
+  static constexpr uint32_t kIndexMask = (1u << kIndexBits) - 1;
+  static constexpr uint32_t kGenerationMask = (1u << (32 - kIndexBits)) - 1;
+  static constexpr Handle kInvalidHandle = 0;
+
+  SlotMap() { m_slots.emplace_back(); }
+
+  // 插入元素并返回句柄；槽位耗尽时返回 kInvalidHandle
+  template <typename... Args>
+  Handle emplace(Args&&... args) {
+    uint32_t index;
+    if (!m_free.empty()) {
+      index = m_free.front();
+      m_free.pop_front();
+    } else {
+      if (m_slots.size() > kIndexMask) return kInvalidHandle;
+      index = static_cast<uint32_t>(m_slots.size());
+      m_slots.emplace_back();
+    }
+    Slot& slot = m_slots[index];
+    slot.value.emplace(std::forward<Args>(args)...);
+    ++m_size;
+    return make_handle(index, slot.generation);
+  }
+
+  T* get(Handle handle) {
+    Slot* slot = find_slot(handle);
+    return slot ? &*slot->value : nullptr;
+  }
+  const T* get(Handle handle) const {
+    return const_cast<SlotMap*>(this)->get(handle);
+  }
+
+  bool contains(Handle handle) const { return get(handle) != nullptr; }
+
+  bool erase(Handle handle) {
+    Slot* slot = find_slot(handle);
+    if (!slot) return false;
+    slot->value.reset();
+    slot->generation = (slot->generation + 1) & kGenerationMask;
+    m_free.push_back(handle & kIndexMask);
+    --m_size;
+    return true;
+  }
+
+  // 按槽位顺序遍历所有存活元素：f(Handle, T&)
+  template <typename F>
+  void for_each(F&& f) {
+    for (uint32_t i = 1; i < m_slots.size(); ++i) {
+      Slot& slot = m_slots[i];
+      if (slot.value) f(make_handle(i, slot.generation), *slot.value);
+    }
+  }
+
+  void clear() {
+    for (uint32_t i = 1; i < m_slots.size(); ++i) {
+      if (m_slots[i].value) erase(make_handle(i, m_slots[i].generation));
+    }
+  }
+
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+ private:
+  struct Slot {
+    uint32_t generation = 0;
+    std::optional<T> value;
+  };
+
+  static Handle make_handle(uint32_t index, uint32_t generation) {
+    return (generation << kIndexBits) | index;
+  }
+
+  Slot* find_slot(Handle handle) {
+    uint32_t index = handle & kIndexMask;
+    if (index == 0 || index >= m_slots.size()) return nullptr;
+    Slot& slot = m_slots[index];
+    if (!slot.value || slot.generation != (handle >> kIndexBits)) {
+      return nullptr;
+    }
+    return &slot;
+  }
+
+  std::vector<Slot> m_slots;
+  std::deque<uint32_t> m_free;
+  size_t m_size = 0;
+};
@@ -1,18 +1,31 @@
 // vis_stream/cpp_backend/src/visualization_server.cpp
+#include <algorithm>
 #include <atomic>
 #include <boost/asio/steady_timer.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
-#include <boost/uuid/uuid_io.hpp>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <map>
 #include <mutex>
 #include <set>
 #include <stdexcept>
 #include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <websocketpp/config/asio_no_tls.hpp>
 #include <websocketpp/server.hpp>
 
+#include "frame_deflater.h"
+#include "geometry_backlog.h"
+#include "message_pool.h"
+#include "point_cloud.h"
+#include "quantizer.h"
+#include "send_queue.h"
+#include "session_recorder.h"
+#include "slot_map.h"
 #include "typed_window.h"
 #include "vis_primitives.h"
 #include "vis_stream.h"
@@ -23,6 +36,29 @@
 
 // Helper function to convert Vis types to Proto types
 namespace {
+static_assert(sizeof(Vis::Vec2) == 2 * sizeof(float) &&
+                  sizeof(Vis::Vec3) == 3 * sizeof(float),
+              "Vec2/Vec3 必须是紧密排列的 float，才能整段写入顶点数组");
+static_assert(sizeof(Vis::Box3DInstance) == 10 * sizeof(float) &&
+                  sizeof(Vis::CircleInstance) == 3 * sizeof(float) &&
+                  sizeof(Vis::Pose2DInstance) == 3 * sizeof(float),
+              "实例数组的元素必须是紧密排列的 float，才能整段写入 values");
+
+// 把连续存放的 float 以小端字节序写入 bytes 字段
+void assign_floats(const float* data, size_t count, std::string* out) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  out->resize(count * sizeof(float));
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t bits;
+    std::memcpy(&bits, &data[i], sizeof(bits));
+    bits = __builtin_bswap32(bits);
+    std::memcpy(&(*out)[i * sizeof(bits)], &bits, sizeof(bits));
+  }
+#else
+  out->assign(reinterpret_cast<const char*>(data), count * sizeof(float));
+#endif
+}
+
 // 所有的 to_proto 辅助函数...
 void to_proto(const Vis::Vec2& in, visualization::Vec2* out) {
   out->set_x(in.x);
@@ -60,6 +96,167 @@ void to_proto(const Vis::Pose3D& in, visualization::Pose3D* out) {
   to_proto(in.get_orientation(), out->mutable_quaternion());
 }
 
+void to_proto_header(const Vis::OccupancyGrid& in,
+                     visualization::OccupancyGrid* out) {
+  out->set_width(in.width());
+  out->set_height(in.height());
+  out->set_cell_type(in.cell_type() == Vis::GridCellType::UINT8
+                         ? visualization::OccupancyGrid::UINT8
+                         : visualization::OccupancyGrid::FLOAT32);
+  out->set_resolution(in.resolution());
+  to_proto(in.origin(), out->mutable_origin());
+  out->set_value_min(in.value_min());
+  out->set_value_max(in.value_max());
+}
+
+// 栅格的第 tile 个瓦片（ty * tiles_x + tx），逐行拷出
+void to_proto(const Vis::OccupancyGrid& in, uint32_t tile,
+              visualization::GridTile* out) {
+  constexpr uint32_t kTile = Vis::OccupancyGrid::kTileSize;
+  uint32_t x = tile % in.tiles_x() * kTile;
+  uint32_t y = tile / in.tiles_x() * kTile;
+  uint32_t w = std::min(kTile, in.width() - x);
+  uint32_t h = std::min(kTile, in.height() - y);
+  out->set_x(x);
+  out->set_y(y);
+  out->set_width(w);
+  out->set_height(h);
+  size_t cell = in.cell_bytes();
+  size_t row_bytes = w * cell;
+  std::string* cells = out->mutable_cells();
+  cells->resize(row_bytes * h);
+  for (uint32_t row = 0; row < h; ++row) {
+    std::memcpy(&(*cells)[row * row_bytes],
+                in.cells() + ((size_t{y} + row) * in.width() + x) * cell,
+                row_bytes);
+  }
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  if (cell == sizeof(float)) {
+    for (size_t i = 0; i < cells->size(); i += sizeof(uint32_t)) {
+      uint32_t bits;
+      std::memcpy(&bits, &(*cells)[i], sizeof(bits));
+      bits = __builtin_bswap32(bits);
+      std::memcpy(&(*cells)[i], &bits, sizeof(bits));
+    }
+  }
+#endif
+}
+
+void to_proto(const Vis::OccupancyGrid& in,
+              visualization::OccupancyGrid* out) {
+  to_proto_header(in, out);
+  uint32_t tiles = in.tiles_x() * in.tiles_y();
+  for (uint32_t tile = 0; tile < tiles; ++tile) {
+    to_proto(in, tile, out->add_tiles());
+  }
+}
+
+// mesh_id 按窗口分配，由 ServerImpl 在写好几何后填入
+void to_proto(const Vis::TriangleMesh3D& in,
+              visualization::TriangleMesh3D* out) {
+  to_proto(in.get_pose(), out->mutable_pose());
+}
+
+void to_proto(uint32_t mesh_id, const Vis::TriangleMeshData& in,
+              visualization::DefineMesh* out) {
+  out->set_mesh_id(mesh_id);
+  const auto& vertices = in.vertices();
+  assign_floats(reinterpret_cast<const float*>(vertices.data()),
+                vertices.size() * 3, out->mutable_xyz());
+  // 下标与 float 同为 4 字节，按同样的字节序写入
+  const auto& indices = in.indices();
+  assign_floats(reinterpret_cast<const float*>(indices.data()), indices.size(),
+                out->mutable_indices());
+}
+
+void to_proto(const Vis::ColorRGBA& in, visualization::ColorRGBA* out) {
+  out->set_r(in.r);
+  out->set_g(in.g);
+  out->set_b(in.b);
+  out->set_a(in.a);
+}
+
+void to_proto(const Vis::MaterialProps& in, visualization::Material* out) {
+  to_proto(in.color, out->mutable_color());
+  to_proto(in.fill_color, out->mutable_fill_color());
+  out->set_point_size(in.point_size);
+  out->set_line_width(in.line_width);
+  out->set_legend(in.legend);
+  out->set_filled(in.filled);
+  // 转换点形状
+  switch (in.point_shape) {
+    case Vis::MaterialProps::PointShape::SQUARE:
+      out->set_point_shape(visualization::Material::SQUARE);
+      break;
+    case Vis::MaterialProps::PointShape::CIRCLE:
+      out->set_point_shape(visualization::Material::CIRCLE);
+      break;
+    case Vis::MaterialProps::PointShape::CROSS:
+      out->set_point_shape(visualization::Material::CROSS);
+      break;
+    case Vis::MaterialProps::PointShape::DIAMOND:
+      out->set_point_shape(visualization::Material::DIAMOND);
+      break;
+    default:
+      out->set_point_shape(visualization::Material::CIRCLE);
+  }
+
+  // 转换线型
+  switch (in.line_style) {
+    case Vis::MaterialProps::LineStyle::SOLID:
+      out->set_line_style(visualization::Material::SOLID);
+      break;
+    case Vis::MaterialProps::LineStyle::DASHED:
+      out->set_line_style(visualization::Material::DASHED);
+      break;
+    case Vis::MaterialProps::LineStyle::DOTTED:
+      out->set_line_style(visualization::Material::DOTTED);
+      break;
+    default:
+      out->set_line_style(visualization::Material::SOLID);
+  }
+
+  out->set_legend_on(in.legend_on);
+}
+
+void to_proto(uint32_t material_id, const Vis::MaterialProps& in,
+              visualization::DefineMaterial* out) {
+  out->set_material_id(material_id);
+  to_proto(in, out->mutable_material());
+}
+
+bool same_color(const Vis::ColorRGBA& a, const Vis::ColorRGBA& b) {
+  return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+// 材质按全部字段去重
+bool same_material(const Vis::MaterialProps& a, const Vis::MaterialProps& b) {
+  return same_color(a.color, b.color) &&
+         same_color(a.fill_color, b.fill_color) &&
+         a.point_size == b.point_size && a.line_width == b.line_width &&
+         a.filled == b.filled && a.legend_on == b.legend_on &&
+         a.line_style == b.line_style && a.point_shape == b.point_shape &&
+         a.legend == b.legend;
+}
+
+uint64_t hash_material(const Vis::MaterialProps& m) {
+  const float values[] = {m.color.r,      m.color.g,      m.color.b,
+                          m.color.a,      m.fill_color.r, m.fill_color.g,
+                          m.fill_color.b, m.fill_color.a, m.point_size,
+                          m.line_width};
+  uint64_t h = std::hash<std::string>()(m.legend);
+  for (float v : values) {
+    uint32_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    h = (h ^ bits) * 0x100000001b3ULL;
+  }
+  h ^= static_cast<uint64_t>(m.filled) |
+       static_cast<uint64_t>(m.legend_on) << 1 |
+       static_cast<uint64_t>(m.line_style) << 2 |
+       static_cast<uint64_t>(m.point_shape) << 4;
+  return h * 0x100000001b3ULL;
+}
+
 void to_proto(const Vis::Circle& in, visualization::Circle* out) {
   to_proto(in.get_center(), out->mutable_center());
   out->set_radius(in.get_radius());
@@ -73,9 +270,9 @@ void to_proto(const Vis::Box2D& in, visualization::Box2D* out) {
 }
 
 void to_proto(const Vis::Line2D& in, visualization::Line2D* out) {
-  for (const auto& pt : in.get_points()) {
-    to_proto(pt, out->add_points()->mutable_position());
-  }
+  const auto& points = in.get_points();
+  assign_floats(reinterpret_cast<const float*>(points.data()),
+                points.size() * 2, out->mutable_xy());
 }
 
 void to_proto(const Vis::Trajectory2D& in, visualization::Trajectory2D* out) {
@@ -85,9 +282,9 @@ void to_proto(const Vis::Trajectory2D& in, visualization::Trajectory2D* out) {
 }
 
 void to_proto(const Vis::Polygon& in, visualization::Polygon* out) {
-  for (const auto& vtx : in.get_vertices()) {
-    to_proto(vtx, out->add_vertices()->mutable_position());
-  }
+  const auto& vertices = in.get_vertices();
+  assign_floats(reinterpret_cast<const float*>(vertices.data()),
+                vertices.size() * 2, out->mutable_xy());
 }
 
 void to_proto(const Vis::Ball& in, visualization::Ball* out) {
@@ -103,39 +300,444 @@ void to_proto(const Vis::Box3D& in, visualization::Box3D* out) {
   out->set_z_length(len.z);
 }
 void to_proto(const Vis::Line3D& in, visualization::Line3D* out) {
-  for (const auto& pt : in.get_points()) {
-    to_proto(pt, out->add_points()->mutable_position());
+  const auto& points = in.get_points();
+  assign_floats(reinterpret_cast<const float*>(points.data()),
+                points.size() * 3, out->mutable_xyz());
+}
+
+// 实例数组的 [begin, end) 段；整个数组时不写 starts/counts
+template <typename T, Vis::ObjectType Type>
+void to_proto(const Vis::InstanceArray<T, Type>& in, size_t begin, size_t end,
+              visualization::InstanceArray* out) {
+  const auto& items = in.get_items();
+  out->set_total(static_cast<uint32_t>(items.size()));
+  if (begin > 0 || end < items.size()) {
+    out->add_starts(static_cast<uint32_t>(begin));
+    out->add_counts(static_cast<uint32_t>(end - begin));
   }
+  assign_floats(reinterpret_cast<const float*>(items.data() + begin),
+                (end - begin) * sizeof(T) / sizeof(float),
+                out->mutable_values());
+}
+template <typename T, Vis::ObjectType Type>
+void to_proto(const Vis::InstanceArray<T, Type>& in,
+              visualization::InstanceArray* out) {
+  to_proto(in, 0, in.size(), out);
+}
+
+// 增量追加：只写入下标 start 之后的新点（位姿）
+void to_append_proto(const Vis::Line2D& in, size_t start,
+                     visualization::AppendPoints* out) {
+  const auto& points = in.get_points();
+  out->set_start(static_cast<uint32_t>(start));
+  assign_floats(reinterpret_cast<const float*>(points.data() + start),
+                (points.size() - start) * 2, out->mutable_xy());
+}
+
+void to_append_proto(const Vis::Line3D& in, size_t start,
+                     visualization::AppendPoints* out) {
+  const auto& points = in.get_points();
+  out->set_start(static_cast<uint32_t>(start));
+  assign_floats(reinterpret_cast<const float*>(points.data() + start),
+                (points.size() - start) * 3, out->mutable_xyz());
+}
+
+void to_append_proto(const Vis::Trajectory2D& in, size_t start,
+                     visualization::AppendPoses* out) {
+  const auto& poses = in.get_poses();
+  out->set_start(static_cast<uint32_t>(start));
+  for (size_t i = start; i < poses.size(); ++i) {
+    to_proto(poses[i], out->add_poses());
+  }
+}
+
+// 可增量追加的图元（折线、轨迹）的当前版本和长度；其他图元返回 false
+bool appendable_state(const Vis::Observable& obj, uint32_t* revision,
+                      size_t* count) {
+  switch (obj.type()) {
+    case Vis::ObjectType::LINE_2D: {
+      const auto& line = static_cast<const Vis::Line2D&>(obj);
+      *revision = line.revision();
+      *count = line.get_points().size();
+      return true;
+    }
+    case Vis::ObjectType::LINE_3D: {
+      const auto& line = static_cast<const Vis::Line3D&>(obj);
+      *revision = line.revision();
+      *count = line.get_points().size();
+      return true;
+    }
+    case Vis::ObjectType::TRAJECTORY_2D: {
+      const auto& trajectory = static_cast<const Vis::Trajectory2D&>(obj);
+      *revision = trajectory.revision();
+      *count = trajectory.get_poses().size();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+// 实例数组取走被修改的下标区间，其他图元返回 false
+bool take_dirty_range(Vis::Observable& obj,
+                      std::pair<uint32_t, uint32_t>* range) {
+  switch (obj.type()) {
+    case Vis::ObjectType::BOX_3D_ARRAY:
+      *range = static_cast<Vis::Box3DArray&>(obj).take_dirty_range();
+      return true;
+    case Vis::ObjectType::CIRCLE_ARRAY:
+      *range = static_cast<Vis::CircleArray&>(obj).take_dirty_range();
+      return true;
+    case Vis::ObjectType::POSE_2D_ARRAY:
+      *range = static_cast<Vis::Pose2DArray&>(obj).take_dirty_range();
+      return true;
+    default:
+      return false;
+  }
+}
+
+// 栅格把改过的瓦片追加到 tiles，其他图元返回 false
+bool take_dirty_tiles(Vis::Observable& obj, std::vector<uint32_t>* tiles) {
+  if (obj.type() != Vis::ObjectType::OCCUPANCY_GRID) return false;
+  static_cast<Vis::OccupancyGrid&>(obj).take_dirty_tiles(tiles);
+  return true;
+}
+
+// 消息所属的窗口 id
+const std::string& window_id_of(const visualization::VisMessage& message) {
+  static const std::string kNoWindow;
+  if (message.has_scene_2d_update()) {
+    return message.scene_2d_update().window_id();
+  }
+  if (message.has_scene_3d_update()) {
+    return message.scene_3d_update().window_id();
+  }
+  return kNoWindow;
+}
+
+visualization::ObjectLayer to_layer(bool is_static) {
+  return is_static ? visualization::LAYER_STATIC : visualization::LAYER_DYNAMIC;
+}
+
+// 随机窗口 id："w" + 14 位十六进制。不超过 15 个字符，
+// 能放进 std::string 的内联缓冲区，在 Arena 上构建消息时不会触发堆分配
+std::string make_window_id() {
+  static const char kHex[] = "0123456789abcdef";
+  boost::uuids::uuid uuid = boost::uuids::random_generator()();
+  std::string id(1, 'w');
+  for (size_t i = 0; i < 7; ++i) {
+    id += kHex[uuid.data[i] >> 4];
+    id += kHex[uuid.data[i] & 0x0f];
+  }
+  return id;
+}
+
+// 按 type() 把 obj 转为具体图元类型后调用 f，各类型的返回值类型须相同
+template <typename F>
+decltype(auto) visit(const Vis::Observable& obj, F&& f) {
+  switch (obj.type()) {
+    case Vis::ObjectType::POINT_2D:
+      return f(static_cast<const Vis::Point2D&>(obj));
+    case Vis::ObjectType::POSE_2D:
+      return f(static_cast<const Vis::Pose2D&>(obj));
+    case Vis::ObjectType::CIRCLE:
+      return f(static_cast<const Vis::Circle&>(obj));
+    case Vis::ObjectType::BOX_2D:
+      return f(static_cast<const Vis::Box2D&>(obj));
+    case Vis::ObjectType::LINE_2D:
+      return f(static_cast<const Vis::Line2D&>(obj));
+    case Vis::ObjectType::TRAJECTORY_2D:
+      return f(static_cast<const Vis::Trajectory2D&>(obj));
+    case Vis::ObjectType::POLYGON:
+      return f(static_cast<const Vis::Polygon&>(obj));
+    case Vis::ObjectType::POINT_3D:
+      return f(static_cast<const Vis::Point3D&>(obj));
+    case Vis::ObjectType::POSE_3D:
+      return f(static_cast<const Vis::Pose3D&>(obj));
+    case Vis::ObjectType::BALL:
+      return f(static_cast<const Vis::Ball&>(obj));
+    case Vis::ObjectType::BOX_3D:
+      return f(static_cast<const Vis::Box3D&>(obj));
+    case Vis::ObjectType::POINT_CLOUD_3D:
+      return f(static_cast<const Vis::PointCloud3D&>(obj));
+    case Vis::ObjectType::BOX_3D_ARRAY:
+      return f(static_cast<const Vis::Box3DArray&>(obj));
+    case Vis::ObjectType::CIRCLE_ARRAY:
+      return f(static_cast<const Vis::CircleArray&>(obj));
+    case Vis::ObjectType::POSE_2D_ARRAY:
+      return f(static_cast<const Vis::Pose2DArray&>(obj));
+    case Vis::ObjectType::TRIANGLE_MESH_3D:
+      return f(static_cast<const Vis::TriangleMesh3D&>(obj));
+    case Vis::ObjectType::OCCUPANCY_GRID:
+      return f(static_cast<const Vis::OccupancyGrid&>(obj));
+    case Vis::ObjectType::LINE_3D:
+      break;
+  }
+  return f(static_cast<const Vis::Line3D&>(obj));
 }
 
 // Helper to clone Observable objects
 std::shared_ptr<Vis::Observable> clone_to_shared(const Vis::Observable& obj) {
-  if (auto p = dynamic_cast<const Vis::Point2D*>(&obj)) {
-    return std::make_shared<Vis::Point2D>(*p);
-  } else if (auto p = dynamic_cast<const Vis::Pose2D*>(&obj)) {
-    return std::make_shared<Vis::Pose2D>(*p);
-  } else if (auto p = dynamic_cast<const Vis::Circle*>(&obj)) {
-    return std::make_shared<Vis::Circle>(*p);
-  } else if (auto p = dynamic_cast<const Vis::Box2D*>(&obj)) {
-    return std::make_shared<Vis::Box2D>(*p);
-  } else if (auto p = dynamic_cast<const Vis::Line2D*>(&obj)) {
-    return std::make_shared<Vis::Line2D>(*p);
-  } else if (auto p = dynamic_cast<const Vis::Trajectory2D*>(&obj)) {
-    return std::make_shared<Vis::Trajectory2D>(*p);
-  } else if (auto p = dynamic_cast<const Vis::Polygon*>(&obj)) {
-    return std::make_shared<Vis::Polygon>(*p);
-  } else if (auto p = dynamic_cast<const Vis::Point3D*>(&obj)) {
-    return std::make_shared<Vis::Point3D>(*p);
-  } else if (auto p = dynamic_cast<const Vis::Pose3D*>(&obj)) {
-    return std::make_shared<Vis::Pose3D>(*p);
-  } else if (auto p = dynamic_cast<const Vis::Ball*>(&obj)) {
-    return std::make_shared<Vis::Ball>(*p);
-  } else if (auto p = dynamic_cast<const Vis::Box3D*>(&obj)) {
-    return std::make_shared<Vis::Box3D>(*p);
-  } else if (auto p = dynamic_cast<const Vis::Line3D*>(&obj)) {
-    return std::make_shared<Vis::Line3D>(*p);
-  }
-  return nullptr;
+  return visit(obj, [](const auto& p) -> std::shared_ptr<Vis::Observable> {
+    return std::make_shared<std::decay_t<decltype(p)>>(p);
+  });
+}
+
+template <typename Command>
+constexpr bool kIs3DCommand =
+    std::is_same_v<Command, visualization::Add3DObject> ||
+    std::is_same_v<Command, visualization::Update3DObjectGeometry>;
+
+// 把图元写入命令中对应的几何字段。添加和更新命令的字段同名，
+// 2D 窗口的命令没有 3D 图元的字段，此时返回 false
+template <typename Command>
+bool set_geometry(const Vis::Point2D& in, Command* cmd) {
+  to_proto(in, cmd->mutable_point_2d());
+  return true;
+}
+template <typename Command>
+bool set_geometry(const Vis::Pose2D& in, Command* cmd) {
+  to_proto(in, cmd->mutable_pose_2d());
+  return true;
+}
+template <typename Command>
+bool set_geometry(const Vis::Circle& in, Command* cmd) {
+  to_proto(in, cmd->mutable_circle());
+  return true;
+}
+template <typename Command>
+bool set_geometry(const Vis::Box2D& in, Command* cmd) {
+  to_proto(in, cmd->mutable_box_2d());
+  return true;
+}
+template <typename Command>
+bool set_geometry(const Vis::Line2D& in, Command* cmd) {
+  to_proto(in, cmd->mutable_line_2d());
+  return true;
+}
+template <typename Command>
+bool set_geometry(const Vis::Trajectory2D& in, Command* cmd) {
+  to_proto(in, cmd->mutable_trajectory_2d());
+  return true;
+}
+template <typename Command>
+bool set_geometry(const Vis::Polygon& in, Command* cmd) {
+  to_proto(in, cmd->mutable_polygon());
+  return true;
+}
+template <typename Command>
+bool set_geometry(const Vis::Point3D& in, Command* cmd) {
+  if constexpr (kIs3DCommand<Command>) {
+    to_proto(in, cmd->mutable_point_3d());
+    return true;
+  }
+  return false;
+}
+template <typename Command>
+bool set_geometry(const Vis::Pose3D& in, Command* cmd) {
+  if constexpr (kIs3DCommand<Command>) {
+    to_proto(in, cmd->mutable_pose_3d());
+    return true;
+  }
+  return false;
+}
+template <typename Command>
+bool set_geometry(const Vis::Ball& in, Command* cmd) {
+  if constexpr (kIs3DCommand<Command>) {
+    to_proto(in, cmd->mutable_ball());
+    return true;
+  }
+  return false;
+}
+template <typename Command>
+bool set_geometry(const Vis::Box3D& in, Command* cmd) {
+  if constexpr (kIs3DCommand<Command>) {
+    to_proto(in, cmd->mutable_box_3d());
+    return true;
+  }
+  return false;
+}
+template <typename Command>
+bool set_geometry(const Vis::Line3D& in, Command* cmd) {
+  if constexpr (kIs3DCommand<Command>) {
+    to_proto(in, cmd->mutable_line_3d());
+    return true;
+  }
+  return false;
+}
+template <typename Command>
+bool set_geometry(const Vis::Box3DArray& in, Command* cmd) {
+  if constexpr (kIs3DCommand<Command>) {
+    to_proto(in, cmd->mutable_box_3d_array());
+    return true;
+  }
+  return false;
+}
+template <typename Command>
+bool set_geometry(const Vis::CircleArray& in, Command* cmd) {
+  to_proto(in, cmd->mutable_circle_array());
+  return true;
+}
+template <typename Command>
+bool set_geometry(const Vis::Pose2DArray& in, Command* cmd) {
+  to_proto(in, cmd->mutable_pose_2d_array());
+  return true;
+}
+template <typename Command>
+bool set_geometry(const Vis::OccupancyGrid& in, Command* cmd) {
+  to_proto(in, cmd->mutable_occupancy_grid());
+  return true;
+}
+template <typename Command>
+bool set_geometry(const Vis::PointCloud3D& in, Command* cmd) {
+  if constexpr (kIs3DCommand<Command>) {
+    encode_point_cloud(in, cmd->mutable_point_cloud_3d());
+    return true;
+  }
+  return false;
+}
+template <typename Command>
+bool set_geometry(const Vis::TriangleMesh3D& in, Command* cmd) {
+  if constexpr (kIs3DCommand<Command>) {
+    to_proto(in, cmd->mutable_triangle_mesh_3d());
+    return true;
+  }
+  return false;
+}
+
+constexpr uint32_t field_bit(int field_number) { return 1u << field_number; }
+
+// 部分更新：只把 fields（图元的 k*Field 位）中的字段写入更新命令，返回命令的
+// field_mask。字段全变了、没有记录或图元不细分字段时返回 0，由调用方整体写入
+template <typename T, typename Command>
+uint32_t set_dirty_fields(const T&, uint32_t, Command*) {
+  return 0;
+}
+template <typename Command>
+uint32_t set_dirty_fields(const Vis::Pose2D& in, uint32_t fields,
+                          Command* cmd) {
+  constexpr uint32_t kAll =
+      Vis::Pose2D::kPositionField | Vis::Pose2D::kAngleField;
+  if ((fields & kAll) == 0 || (fields & kAll) == kAll) return 0;
+  auto* out = cmd->mutable_pose_2d();
+  if (fields & Vis::Pose2D::kPositionField) {
+    to_proto(in.get_position(), out->mutable_position());
+    return field_bit(visualization::Pose2D::kPositionFieldNumber);
+  }
+  out->set_theta(in.get_angle());
+  return field_bit(visualization::Pose2D::kThetaFieldNumber);
+}
+template <typename Command>
+uint32_t set_dirty_fields(const Vis::Circle& in, uint32_t fields,
+                          Command* cmd) {
+  constexpr uint32_t kAll =
+      Vis::Circle::kCenterField | Vis::Circle::kRadiusField;
+  if ((fields & kAll) == 0 || (fields & kAll) == kAll) return 0;
+  auto* out = cmd->mutable_circle();
+  if (fields & Vis::Circle::kCenterField) {
+    to_proto(in.get_center(), out->mutable_center());
+    return field_bit(visualization::Circle::kCenterFieldNumber);
+  }
+  out->set_radius(in.get_radius());
+  return field_bit(visualization::Circle::kRadiusFieldNumber);
+}
+template <typename Command>
+uint32_t set_dirty_fields(const Vis::Box2D& in, uint32_t fields,
+                          Command* cmd) {
+  constexpr uint32_t kAll =
+      Vis::Box2D::kCenterField | Vis::Box2D::kWidthField |
+      Vis::Box2D::kLengthFrontField | Vis::Box2D::kLengthRearField;
+  if ((fields & kAll) == 0 || (fields & kAll) == kAll) return 0;
+  auto* out = cmd->mutable_box_2d();
+  uint32_t mask = 0;
+  if (fields & Vis::Box2D::kCenterField) {
+    to_proto(in.get_center(), out->mutable_center());
+    mask |= field_bit(visualization::Box2D::kCenterFieldNumber);
+  }
+  if (fields & Vis::Box2D::kWidthField) {
+    out->set_width(in.get_width());
+    mask |= field_bit(visualization::Box2D::kWidthFieldNumber);
+  }
+  if (fields & Vis::Box2D::kLengthFrontField) {
+    out->set_length_front(in.get_length_front());
+    mask |= field_bit(visualization::Box2D::kLengthFrontFieldNumber);
+  }
+  if (fields & Vis::Box2D::kLengthRearField) {
+    out->set_length_rear(in.get_length_rear());
+    mask |= field_bit(visualization::Box2D::kLengthRearFieldNumber);
+  }
+  return mask;
+}
+template <typename Command>
+uint32_t set_dirty_fields(const Vis::Pose3D& in, uint32_t fields,
+                          Command* cmd) {
+  if constexpr (kIs3DCommand<Command>) {
+    constexpr uint32_t kAll =
+        Vis::Pose3D::kPositionField | Vis::Pose3D::kOrientationField;
+    if ((fields & kAll) == 0 || (fields & kAll) == kAll) return 0;
+    auto* out = cmd->mutable_pose_3d();
+    if (fields & Vis::Pose3D::kPositionField) {
+      to_proto(in.get_position(), out->mutable_position()->mutable_position());
+      return field_bit(visualization::Pose3D::kPositionFieldNumber);
+    }
+    to_proto(in.get_orientation(), out->mutable_quaternion());
+    return field_bit(visualization::Pose3D::kQuaternionFieldNumber);
+  }
+  return 0;
+}
+template <typename Command>
+uint32_t set_dirty_fields(const Vis::Ball& in, uint32_t fields, Command* cmd) {
+  if constexpr (kIs3DCommand<Command>) {
+    constexpr uint32_t kAll = Vis::Ball::kCenterField | Vis::Ball::kRadiusField;
+    if ((fields & kAll) == 0 || (fields & kAll) == kAll) return 0;
+    auto* out = cmd->mutable_ball();
+    if (fields & Vis::Ball::kCenterField) {
+      to_proto(in.get_center(), out->mutable_center()->mutable_position());
+      return field_bit(visualization::Ball::kCenterFieldNumber);
+    }
+    out->set_radius(in.get_radius());
+    return field_bit(visualization::Ball::kRadiusFieldNumber);
+  }
+  return 0;
+}
+template <typename Command>
+uint32_t set_dirty_fields(const Vis::Box3D& in, uint32_t fields,
+                          Command* cmd) {
+  if constexpr (kIs3DCommand<Command>) {
+    constexpr uint32_t kAll =
+        Vis::Box3D::kCenterField | Vis::Box3D::kLengthsField;
+    if ((fields & kAll) == 0 || (fields & kAll) == kAll) return 0;
+    auto* out = cmd->mutable_box_3d();
+    if (fields & Vis::Box3D::kCenterField) {
+      to_proto(in.get_center(), out->mutable_center());
+      return field_bit(visualization::Box3D::kCenterFieldNumber);
+    }
+    auto len = in.get_lengths();
+    out->set_x_length(len.x);
+    out->set_y_length(len.y);
+    out->set_z_length(len.z);
+    return field_bit(visualization::Box3D::kXLengthFieldNumber) |
+           field_bit(visualization::Box3D::kYLengthFieldNumber) |
+           field_bit(visualization::Box3D::kZLengthFieldNumber);
+  }
+  return 0;
+}
+template <typename Command>
+uint32_t set_dirty_fields(const Vis::TriangleMesh3D& in, uint32_t fields,
+                          Command* cmd) {
+  if constexpr (kIs3DCommand<Command>) {
+    constexpr uint32_t kAll =
+        Vis::TriangleMesh3D::kMeshField | Vis::TriangleMesh3D::kPoseField;
+    if ((fields & kAll) == 0 || (fields & kAll) == kAll) return 0;
+    auto* out = cmd->mutable_triangle_mesh_3d();
+    if (fields & Vis::TriangleMesh3D::kPoseField) {
+      to_proto(in.get_pose(), out->mutable_pose());
+      return field_bit(visualization::TriangleMesh3D::kPoseFieldNumber);
+    }
+    // 只换了网格：mesh_id 同样由调用方填入
+    return field_bit(visualization::TriangleMesh3D::kMeshIdFieldNumber);
+  }
+  return 0;
 }
 
 }  // namespace
@@ -145,16 +747,24 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
  public:
   using server = websocketpp::server<websocketpp::config::asio>;
   using connection_hdl = websocketpp::connection_hdl;
+  using message_ptr = server::message_ptr;
   using steady_timer = boost::asio::steady_timer;
 
+  struct WindowInfo;
+
   struct TrackedObject {
-    std::string id;                                   // 图元的UUID
     std::weak_ptr<Vis::Observable> dynamic_obj_ptr;   // 用于动态元素
     std::shared_ptr<Vis::Observable> static_obj_ptr;  // 用于静态元素
     bool is_3d;
-    std::string window_uuid;  // 所在窗口的UUID
-    visualization::Material material;
+    WindowInfo* window;   // 所在窗口，窗口删除前会先清空其中的图元
+    size_t window_pos;    // 在 window->objects 中的下标，用于 O(1) 移除
+    uint32_t material_id = 0;  // 窗口材质表中的 id
     bool is_static;  // 新增：标识是否为静态元素
+    bool is_dirty = false;  // 是否已在 window->dirty_objects 中
+    // 折线/轨迹最近一次发出时的版本和长度，下次刷新据此只发新增的尾部
+    uint32_t sent_revision = 0;
+    size_t sent_count = 0;
+    uint32_t mesh_id = 0;  // 三角网格实例引用的窗口网格，0 表示没有
 
     // 统一的获取对象方法
     std::shared_ptr<Vis::Observable> get_object() const {
@@ -174,10 +784,60 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
     }
   };
 
+  using ObjectHandle = SlotMap<TrackedObject>::Handle;
+
+  // 连接建立时的场景快照：只记录窗口及其图元句柄
+  struct ReplayWindow {
+    std::string uuid;
+    bool is_3d;
+    Quantizer quantizer;
+    std::vector<ObjectHandle> objects;
+  };
+  struct ReplayState {
+    connection_hdl connection;  // 重放的目标连接
+    std::vector<ReplayWindow> windows;
+    size_t window_index = 0;  // 下一块从这里继续
+    size_t object_index = 0;
+  };
+
+  // 窗口内已下发的一份网格，refs 为引用它的图元数，归零时通知客户端释放
+  struct MeshEntry {
+    uint32_t id;
+    std::shared_ptr<const Vis::TriangleMeshData> data;
+    size_t refs;
+  };
+
+  // 窗口内的一种材质，refs 为引用它的图元数，归零时通知客户端释放
+  struct MaterialEntry {
+    Vis::MaterialProps props;
+    uint64_t hash;
+    size_t refs;
+  };
+
   struct WindowInfo {
     std::string uuid;
     bool is_3d;
     std::string display_name;
+    Quantizer quantizer;  // 创建时确定，之后不再改变
+    std::vector<ObjectHandle> objects;  // 窗口内的全部图元
+    // 待刷新的图元；已删除图元的句柄可能残留，刷新时按句柄校验后跳过
+    std::vector<ObjectHandle> dirty_objects;
+    // cleanup_expired_objects 中暂存的本轮待删除句柄
+    std::vector<ObjectHandle> pending_deletes;
+    // 批量期间攒下的 AddObject / UpdateObjectProperties 命令及其估算大小
+    OutgoingMessage pending_adds;
+    size_t pending_bytes = 0;
+    // 按内容哈希分桶的网格；同一桶中有多个说明哈希碰撞
+    std::unordered_map<uint64_t, std::vector<MeshEntry>> meshes;
+    std::unordered_map<uint32_t, uint64_t> mesh_hashes;  // mesh_id -> 哈希
+    uint32_t next_mesh_id = 0;
+    std::vector<uint32_t> released_meshes;  // 待通知客户端释放的 mesh_id
+    // 去重后的材质，按内容哈希分桶；material_id 不重复使用
+    std::unordered_map<uint32_t, MaterialEntry> materials;
+    std::unordered_map<uint64_t, std::vector<uint32_t>> material_ids;
+    uint32_t next_material_id = 0;
+    std::vector<uint32_t> new_materials;       // 还没向客户端定义的 material_id
+    std::vector<uint32_t> released_materials;  // 待通知客户端释放的 material_id
   };
 
   ServerImpl(uint16_t port)
@@ -194,10 +854,28 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
         std::bind(&ServerImpl::on_open, this, std::placeholders::_1));
     m_server.set_close_handler(
         std::bind(&ServerImpl::on_close, this, std::placeholders::_1));
+    m_server.set_validate_handler(
+        std::bind(&ServerImpl::on_validate, this, std::placeholders::_1));
     m_timer = std::make_unique<steady_timer>(m_server.get_io_service());
   }
 
+  ~ServerImpl() override {
+    // 服务端可能先于用户持有的图元销毁，解除观察关系以免析构时回调悬空指针
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_objects.for_each([](ObjectHandle, TrackedObject& tracked) {
+      if (auto obj = tracked.get_object()) {
+        obj->set_observer(nullptr);
+      }
+    });
+    m_send_queue.close();
+    if (m_send_thread.joinable()) {
+      m_send_thread.join();
+    }
+  }
+
   void run() {
+    m_send_queue.reopen();
+    m_send_thread = std::thread([this]() { send_loop(); });
     m_thread = std::thread([this]() {
       m_server.listen(m_port);
       m_server.start_accept();
@@ -213,66 +891,265 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
     m_server.get_io_service().post([this]() { m_timer->cancel(); });
     if (!m_server.stopped()) {
       m_server.stop_listening();
-      if (m_has_connection) {
+      std::vector<connection_hdl> clients;
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        clients.assign(m_clients.begin(), m_clients.end());
+      }
+      for (const connection_hdl& hdl : clients) {
         websocketpp::lib::error_code ec;
-        m_server.close(m_current_connection,
-                       websocketpp::close::status::going_away, "", ec);
+        m_server.close(hdl, websocketpp::close::status::going_away, "", ec);
       }
       m_server.stop();
     }
     if (m_thread.joinable()) {
       m_thread.join();
     }
+    m_send_queue.close();
+    if (m_send_thread.joinable()) {
+      m_send_thread.join();
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_recorder.reset();
   }
   bool is_connected() const {
     std::lock_guard<std::mutex> lock(m_mutex);
-    return m_has_connection;
+    return !m_clients.empty();
   }
-  template <typename T>
-  void send_update(const T& update) {
-    if (!m_has_connection) {
-      std::cout << "❌ 没有活跃连接，无法发送更新" << std::endl;
-      return;
+  size_t get_client_count() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_clients.size();
+  }
+  // 是否有人接收广播：录制文件也算一个接收方
+  bool has_clients() const { return !m_clients.empty() || m_recorder; }
+  // 从对象池取一块 Arena，并在其上原地构建一条空的 VisMessage
+  OutgoingMessage make_message() {
+    OutgoingMessage item;
+    item.arena = m_message_pool.acquire();
+    item.message = google::protobuf::Arena::CreateMessage<
+        visualization::VisMessage>(item.arena->get());
+    return item;
+  }
+
+  template <typename SceneUpdateType>
+  static SceneUpdateType& mutable_scene_update(
+      visualization::VisMessage& message) {
+    if constexpr (std::is_same_v<SceneUpdateType,
+                                 visualization::Scene3DUpdate>) {
+      return *message.mutable_scene_3d_update();
+    } else {
+      return *message.mutable_scene_2d_update();
     }
+  }
 
-    // std::cout << "🔄 准备发送更新，窗口ID: " << update.window_id() << ",
-    // 类型: "
-    //           << (std::is_same_v<T, visualization::Scene3DUpdate> ? "3D" :
-    //           "2D")
-    //           << std::endl;
+  // 只负责把消息快照交给发送队列广播，序列化和网络写入由发送线程完成。
+  // 调用方需持有 m_mutex，入队顺序即各客户端收到的顺序
+  void send_update(OutgoingMessage item) {
+    // 没有客户端时静默丢弃：场景状态保存在服务端，连接建立后会整体重放
+    if (!has_clients()) return;
 
-    visualization::VisMessage vis_msg;
+    // 先发出攒着的添加命令，保证后续命令（更新、删除等）不会越过它们
+    if (m_batch_depth > 0) {
+      send_all_pending_adds();
+    }
+    enqueue(std::move(item));
+  }
 
-    if constexpr (std::is_same_v<T, visualization::Scene3DUpdate>) {
-      vis_msg.mutable_scene_3d_update()->CopyFrom(update);
-      // std::cout << "📦 3D更新命令数量: " << update.commands_size() <<
-      // std::endl;
-    } else if constexpr (std::is_same_v<T, visualization::Scene2DUpdate>) {
-      vis_msg.mutable_scene_2d_update()->CopyFrom(update);
-      // std::cout << "📦 2D更新命令数量: " << update.commands_size() <<
-      // std::endl;
-    } else {
-      std::cout << "❌ 未知的更新类型" << std::endl;
+  void enqueue(OutgoingMessage item) {
+    item.target = SendTarget::ALL_CLIENTS;
+    if (m_frame_id != 0) item.message->set_frame_id(m_frame_id);
+    push_chunked(std::move(item));
+  }
+
+  // 只发给一个客户端，用于新连接的场景重放
+  void send_to(const connection_hdl& hdl, OutgoingMessage item) {
+    item.target = SendTarget::ONE_CLIENT;
+    item.connection = hdl;
+    push_chunked(std::move(item));
+  }
+
+  // 只写入录制文件，用于开始录制时的场景快照
+  void record_only(OutgoingMessage item) {
+    item.target = SendTarget::RECORDER;
+    push_chunked(std::move(item));
+  }
+
+  // 大点云不整帧发送：消息里只留第一块，其余各块作为带 start 偏移的几何
+  // 更新紧随其后入队。客户端边收边写入同一个缓冲区，单条消息不会长时间
+  // 占住连接，合并更新时也只需拼接相邻的块
+  void push_chunked(OutgoingMessage item) {
+    if (!item.message->has_scene_3d_update()) {
+      m_send_queue.push(std::move(item));
       return;
     }
+    const auto& scene = item.message->scene_3d_update();
+    std::vector<OutgoingMessage> chunks;
+    auto split = [&](uint32_t object_id,
+                     visualization::PointCloud3D* cloud) {
+      size_t count = point_cloud_size(*cloud);
+      size_t per_chunk = point_cloud_chunk_points(*cloud, kPointCloudChunkBytes);
+      if (count <= per_chunk) return;
+      for (size_t start = per_chunk; start < count; start += per_chunk) {
+        OutgoingMessage chunk = make_message();
+        chunk.target = item.target;
+        chunk.connection = item.connection;
+        chunk.message->set_frame_id(item.message->frame_id());
+        auto* update = chunk.message->mutable_scene_3d_update();
+        update->set_window_id(scene.window_id());
+        auto* cmd = update->add_commands()->mutable_update_object_geometry();
+        cmd->set_id(object_id);
+        copy_point_cloud_range(*cloud, start,
+                               std::min(per_chunk, count - start),
+                               cmd->mutable_point_cloud_3d());
+        chunks.push_back(std::move(chunk));
+      }
+      truncate_point_cloud(cloud, per_chunk);
+    };
+    auto* commands = item.message->mutable_scene_3d_update()->mutable_commands();
+    for (auto& command : *commands) {
+      if (command.has_add_object() &&
+          command.add_object().has_point_cloud_3d()) {
+        auto* add = command.mutable_add_object();
+        split(add->id(), add->mutable_point_cloud_3d());
+      } else if (command.has_update_object_geometry() &&
+                 command.update_object_geometry().has_point_cloud_3d()) {
+        auto* update = command.mutable_update_object_geometry();
+        split(update->id(), update->mutable_point_cloud_3d());
+      }
+    }
+    m_send_queue.push(std::move(item));
+    for (auto& chunk : chunks) {
+      m_send_queue.push(std::move(chunk));
+    }
+  }
 
-    std::string serialized_msg;
-    vis_msg.SerializeToString(&serialized_msg);
+  // 批量添加可以嵌套，最外层结束时发出所有窗口攒下的命令
+  void begin_batch() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_batch_depth;
+  }
 
-    // std::cout << "📤 发送消息大小: " << serialized_msg.size() << " 字节"
-    //           << std::endl;
+  void end_batch() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_batch_depth == 0) return;
+    if (--m_batch_depth == 0) {
+      send_all_pending_adds();
+    }
+  }
 
-    try {
-      m_server.send(m_current_connection, serialized_msg,
-                    websocketpp::frame::opcode::binary);
-      // std::cout << "✅ 消息发送成功" << std::endl;
-    } catch (const std::exception& e) {
-      std::cerr << "❌ 发送失败: " << e.what() << std::endl;
+  // 帧内兼作批量添加；帧号在最外层 begin_frame 时分配
+  uint64_t begin_frame(double sim_time) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_batch_depth;
+    if (m_frame_depth++ == 0) {
+      m_frame_id = ++m_last_frame_id;
+      m_frame_sim_time = sim_time;
     }
+    return m_frame_id;
+  }
+
+  // 最外层结束时逐个窗口发出攒下的添加和脏图元的更新，最后是帧提交
+  void end_frame() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_frame_depth == 0) return;
+    --m_batch_depth;
+    if (--m_frame_depth > 0) return;
+
+    cleanup_expired_objects();
+    for (auto& [window_uuid, window] : m_windows) {
+      send_pending_adds(window);
+      if (window.is_3d) {
+        flush_dirty_set_3d_unlocked(window);
+      } else {
+        flush_dirty_set_2d_unlocked(window);
+      }
+    }
+    if (has_clients()) {
+      OutgoingMessage commit = make_message();
+      auto* frame = commit.message->mutable_frame_commit();
+      frame->set_frame_id(m_frame_id);
+      frame->set_sim_time(m_frame_sim_time);
+      enqueue(std::move(commit));
+    }
+    m_frame_id = 0;
+  }
+
+  void set_send_queue_policy(Vis::SendOverflowPolicy policy, size_t capacity) {
+    // 被丢弃的消息里的字段无法由之后的部分更新补齐，DROP_OLDEST 下总是整体发送
+    m_partial_updates = policy != Vis::SendOverflowPolicy::DROP_OLDEST;
+    m_send_queue.set_policy(policy, capacity);
+  }
+
+  Vis::SendQueueStats get_send_queue_stats() const {
+    Vis::SendQueueStats stats = m_send_queue.stats();
+    stats.lagging_clients = m_lagging_clients;
+    stats.superseded = m_superseded;
+    stats.compressed = m_compressed;
+    stats.compressed_input_bytes = m_compressed_input_bytes;
+    stats.compressed_output_bytes = m_compressed_output_bytes;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_recorder) stats.recorded_bytes = m_recorder->bytes_written();
+    return stats;
+  }
+
+  void set_client_buffer_limit(size_t high_water_bytes) {
+    m_client_high_water = high_water_bytes;
+  }
+
+  void set_compression(bool enabled, size_t min_bytes, int level) {
+    m_compression_enabled = enabled;
+    m_compress_min_bytes = min_bytes;
+    m_compress_level = std::clamp(level, 1, 9);
+  }
+
+  bool start_recording(const std::string& path_prefix, size_t rotate_bytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_recorder) {
+      std::cerr << "❌ 错误：已在录制中，请先调用 stop_recording()。"
+                << std::endl;
+      return false;
+    }
+    auto recorder = std::make_shared<SessionRecorder>();
+    if (!recorder->open(path_prefix, rotate_bytes)) return false;
+
+    // 与新客户端连接时相同：先发出攒着的添加命令，再写入整个场景。
+    // 快照在持锁期间一次入队，之后的广播都排在它后面
+    send_all_pending_adds();
+    m_recorder = recorder;
+    OutgoingMessage started;
+    started.target = SendTarget::RECORDING_STARTED;
+    started.recorder = std::move(recorder);
+    m_send_queue.push(std::move(started));
+    for (auto& [window_uuid, window_info] : m_windows) {
+      record_only(make_window_create_message(window_info));
+      if (!window_info.materials.empty() || !window_info.meshes.empty()) {
+        record_only(make_definitions(window_info));
+      }
+      ReplayWindow window{window_uuid, window_info.is_3d,
+                          window_info.quantizer, window_info.objects};
+      for (size_t i = 0; i < window.objects.size();) {
+        i = send_existing_objects(SendTarget::RECORDER, connection_hdl(),
+                                  window, i);
+      }
+    }
+    std::cout << "✅ 开始录制: " << recording_file_path(path_prefix, 0)
+              << std::endl;
+    return true;
+  }
+
+  void stop_recording() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_recorder) return;
+    m_recorder.reset();
+    OutgoingMessage stopped;
+    stopped.target = SendTarget::RECORDING_STOPPED;
+    m_send_queue.push(std::move(stopped));
+    // 客户端都已断开时，攒着的添加命令不再有人接收
+    if (m_clients.empty()) discard_pending_adds();
   }
 
   void add(std::shared_ptr<Vis::Observable> obj, const std::string& name,
-           const visualization::Material& material, bool is_3d) {
+           const Vis::MaterialProps& material, bool is_3d) {
     if (!obj) return;
 
     // 1. 根据名称查找窗口的UUID
@@ -290,7 +1167,7 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
 
   // (const Vis::Observable& 版本)
   void add(const Vis::Observable& obj, const std::string& name,
-           const visualization::Material& material, bool is_3d) {
+           const Vis::MaterialProps& material, bool is_3d) {
     std::string window_uuid = get_uuid_for_name(name, is_3d);
     if (window_uuid.empty()) {
       std::cerr << "❌ 错误：在名为 '" << name
@@ -308,7 +1185,7 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
 
   void add_internal(std::shared_ptr<Vis::Observable> obj,
                     const std::string& window_uuid,
-                    const visualization::Material& material, bool is_3d,
+                    const Vis::MaterialProps& material, bool is_3d,
                     bool is_static) {
     if (!obj) return;
     std::lock_guard<std::mutex> lock(m_mutex);
@@ -317,51 +1194,133 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
       cleanup_expired_objects();
     }
 
-    // 获取窗口名称
-    std::string window_name = "";
     auto window_it = m_windows.find(window_uuid);
-    if (window_it != m_windows.end()) {
-      window_name = window_it->second.display_name;
-    }
-    std::string object_id = "obj_" + std::to_string(m_next_object_id++);
+    if (window_it == m_windows.end()) return;
+    WindowInfo& window = window_it->second;
+    const std::string& window_name = window.display_name;
 
     TrackedObject tracked;
-    tracked.id = object_id;
     tracked.is_3d = is_3d;
-    tracked.window_uuid = window_uuid;  //
-    tracked.material = material;
+    tracked.window = &window;
+    tracked.window_pos = window.objects.size();
+    uint32_t material_id = acquire_material(window, material);
+    tracked.material_id = material_id;
     tracked.is_static = is_static;
+    appendable_state(*obj, &tracked.sent_revision, &tracked.sent_count);
+    obj->take_dirty_fields();  // 添加命令带完整几何，之前的修改无需再发
+    std::pair<uint32_t, uint32_t> range;
+    take_dirty_range(*obj, &range);
+    m_dirty_tiles.clear();
+    take_dirty_tiles(*obj, &m_dirty_tiles);
     if (is_static) {
       tracked.static_obj_ptr = obj;     // 静态元素：永久持有
       tracked.dynamic_obj_ptr.reset();  // 清空动态指针
     } else {
       tracked.dynamic_obj_ptr = obj;   // 动态元素：使用 weak_ptr
       tracked.static_obj_ptr.reset();  // 清空静态指针
-      obj->set_observer(this);         // 只有动态元素需要观察者
     }
-    m_tracked_objects[object_id] = tracked;
-    m_object_ptr_to_id[obj.get()] = object_id;
-    m_window_objects[window_uuid].insert(object_id);  //
+    ObjectHandle object_id = m_objects.emplace(std::move(tracked));
+    if (object_id == SlotMap<TrackedObject>::kInvalidHandle) {
+      std::cerr << "❌ 错误：图元数量超出上限，添加失败。" << std::endl;
+      release_material(window, material_id);
+      return;
+    }
+    if (!is_static) {
+      obj->set_observer(this, object_id);  // 只有动态元素需要观察者
+    }
+    window.objects.push_back(object_id);
+
+    if (m_batch_depth > 0) {
+      if (has_clients()) {
+        append_pending_add(window, object_id, material_id, obj, is_static);
+      } else {
+        bind_mesh(object_id, *obj, nullptr);
+      }
+      return;
+    }
 
     if (is_3d) {
-      visualization::Scene3DUpdate scene_update;
+      OutgoingMessage item = make_message();
+      auto& scene_update = *item.message->mutable_scene_3d_update();
       scene_update.set_window_id(window_uuid);
       scene_update.set_window_name(window_name);
+      define_new_materials(window, &scene_update);
+      uint32_t mesh_id = bind_mesh(object_id, *obj, &scene_update);
       auto* cmd = scene_update.add_commands()->mutable_add_object();  //
       cmd->set_id(object_id);
-      cmd->mutable_material()->CopyFrom(material);
-      populate_3d_geometry(obj, cmd);  //
-      send_update(scene_update);
+      cmd->set_layer(to_layer(is_static));
+      cmd->set_material_id(material_id);
+      populate_geometry(*obj, cmd);  //
+      set_mesh_id(mesh_id, cmd);
+      window.quantizer.apply(cmd);
+      send_update(std::move(item));
     } else {
-      visualization::Scene2DUpdate scene_update;
+      OutgoingMessage item = make_message();
+      auto& scene_update = *item.message->mutable_scene_2d_update();
       scene_update.set_window_id(window_uuid);
       scene_update.set_window_name(window_name);
+      define_new_materials(window, &scene_update);
       auto* cmd = scene_update.add_commands()->mutable_add_object();  //
       cmd->set_id(object_id);
-      cmd->mutable_material()->CopyFrom(material);
-      populate_2d_geometry(obj, cmd);  //
-      send_update(scene_update);
+      cmd->set_layer(to_layer(is_static));
+      cmd->set_material_id(material_id);
+      populate_geometry(*obj, cmd);  //
+      window.quantizer.apply(cmd);
+      send_update(std::move(item));
+    }
+  }
+
+  // 只改材质：记下新的 material_id，向客户端发 UpdateObjectProperties。
+  // 静态图元是添加时的拷贝，没有观察者，无法由用户对象找到
+  void set_material(const Vis::Observable& obj,
+                    const Vis::MaterialProps& material) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ObjectHandle object_id = obj.observer_token();
+    TrackedObject* tracked = m_objects.get(object_id);
+    if (!tracked || tracked->get_object().get() != &obj) {
+      std::cerr << "❌ 错误：设置材质失败，图元未以动态方式添加或已被移除。"
+                << std::endl;
+      return;
+    }
+    WindowInfo& window = *tracked->window;
+    // 先加新引用再放旧引用，材质没变时不会被误释放
+    uint32_t material_id = acquire_material(window, material);
+    uint32_t old_material_id = tracked->material_id;
+    tracked->material_id = material_id;
+    release_material(window, old_material_id);
+    if (material_id == old_material_id) return;
+    // 新连接重放时按 tracked 中的材质添加，并重新定义现有的全部材质
+    if (!has_clients()) {
+      window.new_materials.clear();
+      window.released_materials.clear();
+      return;
+    }
+
+    if (m_batch_depth > 0) {
+      append_pending_properties(window, object_id, material_id);
+      return;
+    }
+    OutgoingMessage item = make_message();
+    if (window.is_3d) {
+      auto& scene_update = *item.message->mutable_scene_3d_update();
+      scene_update.set_window_id(window.uuid);
+      define_new_materials(window, &scene_update);
+      auto* cmd =
+          scene_update.add_commands()->mutable_update_object_properties();
+      cmd->set_id(object_id);
+      cmd->set_material_id(material_id);
+      append_released_materials(window, &scene_update);
+    } else {
+      auto& scene_update = *item.message->mutable_scene_2d_update();
+      scene_update.set_window_id(window.uuid);
+      define_new_materials(window, &scene_update);
+      auto* cmd =
+          scene_update.add_commands()->mutable_update_object_properties();
+      cmd->set_id(object_id);
+      cmd->set_material_id(material_id);
+      append_released_materials(window, &scene_update);
     }
+    send_update(std::move(item));
   }
 
   void clear_static(const std::string& window_name, bool is_3d) {
@@ -378,18 +1337,11 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
       return;
     }
 
-    auto it = m_window_objects.find(window_uuid);  // 使用UUID查找
-    if (it == m_window_objects.end()) {
-      // std::cout << "❌ 清除静态对象失败：窗口 '" << window_name
-      //           << "' 中没有对象" << std::endl;
-      return;
-    }
-
-    std::vector<std::string> to_remove;
-    for (const auto& object_id : it->second) {
-      auto tracked_it = m_tracked_objects.find(object_id);
-      if (tracked_it != m_tracked_objects.end() &&
-          tracked_it->second.is_static) {
+    WindowInfo& window = m_windows[window_uuid];
+    std::vector<ObjectHandle> to_remove;
+    for (ObjectHandle object_id : window.objects) {
+      const TrackedObject* tracked = m_objects.get(object_id);
+      if (tracked && tracked->is_static) {
         to_remove.push_back(object_id);
       }
     }
@@ -397,9 +1349,14 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
     // std::cout << "🗑️ 清除静态对象：找到 " << to_remove.size() << "
     // 个过期对象"
     //           << std::endl;
-    for (const auto& id : to_remove) {
+    for (ObjectHandle id : to_remove) {
       remove_object_internal(id);
     }
+    if (!to_remove.empty()) {
+      send_clear_window(window, visualization::ClearWindow::STATIC);
+      send_released_meshes(window);
+      send_released_materials(window);
+    }
   }
 
   void clear_dynamic(const std::string& window_name, bool is_3d) {
@@ -416,21 +1373,14 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
       return;
     }
 
-    auto it = m_window_objects.find(window_uuid);
-    if (it == m_window_objects.end()) {
-      // std::cout << "❌ 找不到窗口UUID对应的对象集合: " << window_uuid
-      //           << std::endl;
-      return;
-    }
-
+    WindowInfo& window = m_windows[window_uuid];
     // std::cout << "📊 窗口 " << window_name
-    //           << " 中的对象数量: " << it->second.size() << std::endl;
+    //           << " 中的对象数量: " << window.objects.size() << std::endl;
 
-    std::vector<std::string> to_remove;
-    for (const auto& object_id : it->second) {
-      auto tracked_it = m_tracked_objects.find(object_id);
-      if (tracked_it != m_tracked_objects.end() &&
-          !tracked_it->second.is_static) {
+    std::vector<ObjectHandle> to_remove;
+    for (ObjectHandle object_id : window.objects) {
+      const TrackedObject* tracked = m_objects.get(object_id);
+      if (tracked && !tracked->is_static) {
         to_remove.push_back(object_id);
       }
     }
@@ -438,9 +1388,14 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
     // std::cout << "🔨 准备删除 " << to_remove.size() << " 个对象" <<
     // std::endl;
 
-    for (const auto& id : to_remove) {
+    for (ObjectHandle id : to_remove) {
       remove_object_internal(id);
     }
+    if (!to_remove.empty()) {
+      send_clear_window(window, visualization::ClearWindow::DYNAMIC);
+      send_released_meshes(window);
+      send_released_materials(window);
+    }
 
     // std::cout << "✅ 动态对象清除完成" << std::endl;
   }
@@ -457,35 +1412,50 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
     }
 
     clear_unlocked(window_uuid);  // 传入UUID而不是名称
+    send_clear_window(m_windows[window_uuid], visualization::ClearWindow::ALL);
+    send_released_meshes(m_windows[window_uuid]);
+    send_released_materials(m_windows[window_uuid]);
+  }
+
+  void on_release(Vis::Observable* subject) override {
+    // 析构可能发生在任意线程，甚至发生在持有 m_mutex 的代码路径中
+    // （例如临时 lock() 出的 shared_ptr 成为最后一个引用），
+    // 因此这里只记录句柄，由持锁路径统一回收
+    std::lock_guard<std::mutex> lock(m_release_mutex);
+    m_released_objects.push_back(subject->observer_token());
   }
 
   void on_update(Vis::Observable* subject) override {
     std::lock_guard<std::mutex> lock(m_mutex);
     cleanup_expired_objects();
+    mark_dirty_unlocked(subject->observer_token());
+  }
 
-    auto it = m_object_ptr_to_id.find(subject);
-    if (it == m_object_ptr_to_id.end()) return;
-
-    const std::string& object_id = it->second;
-    auto tracked_it = m_tracked_objects.find(object_id);
-    if (tracked_it == m_tracked_objects.end()) return;
-
-    const auto& tracked = tracked_it->second;
-    if (!tracked.is_valid()) return;
+  // EditScope 结束时整批标脏，只加一次锁、做一次过期回收
+  void on_update_batch(Vis::Observable* const* subjects,
+                       size_t count) override {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    cleanup_expired_objects();
+    for (size_t i = 0; i < count; ++i) {
+      mark_dirty_unlocked(subjects[i]->observer_token());
+    }
+  }
 
-    if (tracked.is_3d) {
-      m_dirty_objects_3d[tracked.window_uuid].insert(object_id);
-      if (m_auto_update_enabled &&
-          m_dirty_objects_3d[tracked.window_uuid].size() >=
-              static_cast<size_t>(m_update_threshold)) {
-        flush_dirty_set_3d_unlocked(tracked.window_uuid);
-      }
-    } else {
-      m_dirty_objects_2d[tracked.window_uuid].insert(object_id);
-      if (m_auto_update_enabled &&
-          m_dirty_objects_2d[tracked.window_uuid].size() >=
-              static_cast<size_t>(m_update_threshold)) {
-        flush_dirty_set_2d_unlocked(tracked.window_uuid);
+  void mark_dirty_unlocked(ObjectHandle object_id) {
+    TrackedObject* tracked = m_objects.get(object_id);
+    if (!tracked || !tracked->is_valid()) return;
+    if (tracked->is_dirty) return;
+
+    tracked->is_dirty = true;
+    WindowInfo& window = *tracked->window;
+    window.dirty_objects.push_back(object_id);
+    if (m_auto_update_enabled && m_frame_depth == 0 &&
+        window.dirty_objects.size() >=
+            static_cast<size_t>(m_update_threshold)) {
+      if (window.is_3d) {
+        flush_dirty_set_3d_unlocked(window);
+      } else {
+        flush_dirty_set_2d_unlocked(window);
       }
     }
   }
@@ -499,10 +1469,12 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
       std::cerr << "❌ 错误：找不到名为 '" << name << "' 的窗口" << std::endl;
       return;
     }
+    // 帧内的刷新由 end_frame 统一进行，客户端反正要等到提交才显示
+    if (m_frame_depth > 0) return;
     if (is_3d) {
-      flush_dirty_set_3d_unlocked(window_uuid);
+      flush_dirty_set_3d_unlocked(m_windows[window_uuid]);
     } else {
-      flush_dirty_set_2d_unlocked(window_uuid);
+      flush_dirty_set_2d_unlocked(m_windows[window_uuid]);
     }
   }
 
@@ -524,7 +1496,7 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
   std::vector<std::string> get_connected_windows() {
     std::lock_guard<std::mutex> lock(m_mutex);
     std::vector<std::string> ids;
-    if (m_has_connection) {
+    if (has_clients()) {
       // 返回所有窗口名称
       for (const auto& [name, _] : m_windows) {
         ids.push_back(name);
@@ -533,7 +1505,8 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
     return ids;
   }
 
-  bool create_window(const std::string& name, bool is_3d) {
+  bool create_window(const std::string& name, bool is_3d,
+                     const Vis::Quantization& quantization) {
     std::lock_guard<std::mutex> lock(m_mutex);
     if (name.empty()) {
       std::cerr << "❌ 错误：窗口名称不能为空。" << std::endl;
@@ -544,16 +1517,22 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
       std::cerr << "❌ 错误：已存在名为 '" << name << "' 的窗口。" << std::endl;
       return false;
     }
-    // 创建UUID和窗口信息
-    boost::uuids::uuid uuid = boost::uuids::random_generator()();
-    std::string window_uuid = to_string(uuid);
+    // 创建窗口 id 和窗口信息
+    std::string window_uuid;
+    do {
+      window_uuid = make_window_id();
+    } while (m_windows.count(window_uuid));
 
     // 存储双向映射关系
     m_window_name_to_uuid[name] = window_uuid;
-    m_windows[window_uuid] = WindowInfo{window_uuid, is_3d, name};
+    WindowInfo& window = m_windows[window_uuid];
+    window.uuid = window_uuid;
+    window.is_3d = is_3d;
+    window.display_name = name;
+    window.quantizer = Quantizer(quantization);
 
-    if (m_has_connection) {
-      send_window_create_command(window_uuid, name, is_3d);
+    if (has_clients()) {
+      send_window_create_command(window);
     }
 
     // std::cout << "✅ 成功创建窗口: UUID=" << window_uuid << ", 名称=" << name
@@ -595,15 +1574,17 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
 
     // 向前端发送SetTitle命令
     if (is_3d) {
-      visualization::Scene3DUpdate u;
+      OutgoingMessage item = make_message();
+      auto& u = *item.message->mutable_scene_3d_update();
       u.set_window_id(uuid);
       u.add_commands()->mutable_set_title()->set_title(new_name);
-      send_update(u);
+      send_update(std::move(item));
     } else {
-      visualization::Scene2DUpdate u;
+      OutgoingMessage item = make_message();
+      auto& u = *item.message->mutable_scene_2d_update();
       u.set_window_id(uuid);
       u.add_commands()->mutable_set_title()->set_title(new_name);
-      send_update(u);
+      send_update(std::move(item));
     }
 
     return true;
@@ -627,18 +1608,14 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
       return false;
     }
 
-    // 1. 先清理本地数据
+    // 1. 先清理本地数据（同时清空脏对象列表）
     clear_unlocked(uuid);
 
-    // 2. 清理脏对象集合
-    m_dirty_objects_2d.erase(uuid);
-    m_dirty_objects_3d.erase(uuid);
-
-    // 3. 移除窗口映射
+    // 2. 移除窗口映射
     m_windows.erase(uuid);
     m_window_name_to_uuid.erase(it);
 
-    // 4. 最后发送删除命令到前端
+    // 3. 最后发送删除命令到前端
     send_window_delete_command(uuid, is_3d);
 
     // std::cout << "🗑️ 删除窗口: 名称=" << name << ", UUID=" << uuid <<
@@ -649,7 +1626,7 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
    * 发送窗口删除命令到前端
    */
   void send_window_delete_command(const std::string& window_uuid, bool is_3d) {
-    if (!m_has_connection) return;
+    if (!has_clients()) return;
 
     std::string window_name = "";
     auto window_it = m_windows.find(window_uuid);
@@ -658,19 +1635,21 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
     }
 
     if (is_3d) {
-      visualization::Scene3DUpdate scene_update;
+      OutgoingMessage item = make_message();
+      auto& scene_update = *item.message->mutable_scene_3d_update();
       scene_update.set_window_id(window_uuid);
       scene_update.set_window_name(window_name);
       auto* cmd = scene_update.add_commands()->mutable_delete_window();
       cmd->set_window_id(window_uuid);
-      send_update(scene_update);
+      send_update(std::move(item));
     } else {
-      visualization::Scene2DUpdate scene_update;
+      OutgoingMessage item = make_message();
+      auto& scene_update = *item.message->mutable_scene_2d_update();
       scene_update.set_window_id(window_uuid);
       scene_update.set_window_name(window_name);
       auto* cmd = scene_update.add_commands()->mutable_delete_window();
       cmd->set_window_id(window_uuid);
-      send_update(scene_update);
+      send_update(std::move(item));
     }
 
     // std::cout << "📤 发送窗口删除命令: UUID=" << window_uuid
@@ -679,13 +1658,15 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
   template <typename CommandType, typename SceneUpdateType>
   void send_window_command(const std::string& window_name, bool is_3d,
                            std::function<void(CommandType*)> cmd_filler) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     std::string window_id = get_window_id_for_name(window_name, is_3d);
     if (window_id.empty()) return;
 
-    SceneUpdateType u;
+    OutgoingMessage item = make_message();
+    auto& u = mutable_scene_update<SceneUpdateType>(*item.message);
     u.set_window_id(window_id);
     cmd_filler(u.add_commands());
-    send_update(u);
+    send_update(std::move(item));
   }
 
   std::vector<std::string> get_window_names(const bool& is_3d) {
@@ -707,7 +1688,7 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
 
   size_t get_observables_number() const {
     std::lock_guard<std::mutex> lock(m_mutex);
-    return m_tracked_objects.size();
+    return m_objects.size();
   }
 
  private:
@@ -716,20 +1697,52 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
   uint16_t m_port;
   std::thread m_thread;
   mutable std::mutex m_mutex;
-  std::atomic<uint64_t> m_next_object_id{1};
-
-  // 单连接模式
-  connection_hdl m_current_connection;
-  bool m_has_connection = false;
-
-  std::unordered_map<std::string, TrackedObject> m_tracked_objects;
-  std::unordered_map<Vis::Observable*, std::string> m_object_ptr_to_id;
-  std::unordered_map<std::string, std::unordered_set<std::string>>
-      m_window_objects;
-  std::unordered_map<std::string, std::unordered_set<std::string>>
-      m_dirty_objects_2d;
-  std::unordered_map<std::string, std::unordered_set<std::string>>
-      m_dirty_objects_3d;
+
+  // 已析构的动态图元句柄，由 on_release 写入，持 m_mutex 时批量回收
+  std::mutex m_release_mutex;
+  std::vector<ObjectHandle> m_released_objects;
+  std::vector<ObjectHandle> m_releasing_objects;  // 受 m_mutex 保护
+  std::vector<uint32_t> m_dirty_tiles;  // 栅格改过的瓦片，受 m_mutex 保护
+
+  // 已连接的客户端，广播消息发给入队时在此集合中的全部客户端
+  std::set<connection_hdl, std::owner_less<connection_hdl>> m_clients;
+
+  int m_batch_depth = 0;  // begin_batch 的嵌套层数，打开的帧也各算一层
+  int m_frame_depth = 0;  // begin_frame 的嵌套层数
+  uint64_t m_frame_id = 0;  // 打开的帧的帧号，没有打开的帧时为 0
+  uint64_t m_last_frame_id = 0;
+  double m_frame_sim_time = 0.0;
+
+  static constexpr size_t kMaxPooledFrames = 64;
+  static constexpr std::chrono::milliseconds kBackpressurePollInterval{10};
+  // 单条批量添加消息的大小上限，避免一帧过大拖慢客户端解码
+  static constexpr size_t kMaxBatchMessageBytes = 256 * 1024;
+  // 重放时每块的大小上限，也决定了每块持有 m_mutex 的时长
+  static constexpr size_t kReplayChunkBytes = 64 * 1024;
+
+  // 发送线程：从队列取出消息快照，序列化后写入目标连接。
+  // 对象池需比队列中的消息活得久，因此声明在队列之前
+  MessagePool m_message_pool;
+  SendQueue m_send_queue;
+  std::thread m_send_thread;
+  // 单个客户端在 websocketpp 中缓冲的字节数上限，0 表示不限制
+  std::atomic<size_t> m_client_high_water{8 * 1024 * 1024};
+  std::atomic<size_t> m_lagging_clients{0};  // 仅发送线程修改
+  std::atomic<uint64_t> m_superseded{0};
+  std::atomic<bool> m_partial_updates{true};  // 是否允许按字段发送部分更新
+  // permessage-deflate：只对协商了压缩的客户端、且不小于阈值的消息压缩
+  std::atomic<bool> m_compression_enabled{true};
+  std::atomic<size_t> m_compress_min_bytes{1024};
+  std::atomic<int> m_compress_level{1};
+  FrameDeflater m_deflater;  // 仅发送线程访问
+  std::atomic<uint64_t> m_compressed{0};
+  std::atomic<uint64_t> m_compressed_input_bytes{0};
+  std::atomic<uint64_t> m_compressed_output_bytes{0};
+  // 录制中的文件，受 m_mutex 保护；发送线程另持一份引用负责写入
+  std::shared_ptr<SessionRecorder> m_recorder;
+
+  // 图元注册表：句柄即协议中的对象 id
+  SlotMap<TrackedObject> m_objects;
   // 窗口名称到UUID的映射（2D和3D统一管理）
   std::unordered_map<std::string, std::string> m_window_name_to_uuid;
   std::unordered_map<std::string, WindowInfo> m_windows;
@@ -754,193 +1767,542 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
   void clear_unlocked(const std::string& window_uuid) {
     // std::cout << "清空窗口 " << window_uuid << " 中的对象" << std::endl;
     // 安全检查：如果窗口已不存在，跳过清理
-    if (m_windows.find(window_uuid) == m_windows.end()) {
+    auto window_it = m_windows.find(window_uuid);
+    if (window_it == m_windows.end()) {
       // std::cout << "⚠️ 窗口 " << window_uuid << " 已不存在，跳过清空"
       //           << std::endl;
       return;
     }
     cleanup_expired_objects();
 
-    auto it = m_window_objects.find(window_uuid);
-    if (it == m_window_objects.end()) {
-      // std::cout << "窗口UUID '" << window_uuid
-      //           << "' 中没有对象" << std::endl;
-      return;
-    }
-
-    std::vector<std::string> to_remove(it->second.begin(), it->second.end());
-    // std::cout << "🗑️ 清除所有对象：找到 " << to_remove.size() << " 个对象"
-    //           << std::endl;
-
-    for (const auto& id : to_remove) {
-      remove_object_internal(id);
+    // 整个窗口清空，无需逐个维护 window.objects；前端由调用方统一通知
+    WindowInfo& window = window_it->second;
+    for (ObjectHandle object_id : window.objects) {
+      if (TrackedObject* tracked = m_objects.get(object_id)) {
+        forget_object(object_id, *tracked);
+      }
     }
 
     // 清理窗口对象集合
-    m_window_objects.erase(window_uuid);
+    window.objects.clear();
+    window.dirty_objects.clear();
+    // 网格随之全部释放；删除窗口时客户端整体销毁，不必再通知
+    for (const auto& [mesh_id, hash] : window.mesh_hashes) {
+      window.released_meshes.push_back(mesh_id);
+    }
+    window.meshes.clear();
+    window.mesh_hashes.clear();
+    // 材质同理；还没定义过的不必通知
+    for (const auto& [material_id, entry] : window.materials) {
+      if (std::find(window.new_materials.begin(), window.new_materials.end(),
+                    material_id) == window.new_materials.end()) {
+        window.released_materials.push_back(material_id);
+      }
+    }
+    window.materials.clear();
+    window.material_ids.clear();
+    window.new_materials.clear();
     // std::cout << "✅ 窗口 '" << window_uuid << "' 的所有对象已清除"
     //           << std::endl;
   }
 
+  // 增量回收：只处理自上次调用以来析构的对象，开销与场景规模无关。
+  // 同一窗口内本轮回收的对象合并成一条 DeleteObjects 发送
   void cleanup_expired_objects() {
-    // std::cout << "删除过期对象 " << std::endl;
-    std::vector<std::string> expired_ids;
-
-    for (const auto& [object_id, tracked] : m_tracked_objects) {
-      // 只清理动态元素，静态元素不参与自动清理
-      if (!tracked.is_static && !tracked.is_valid()) {
-        expired_ids.push_back(object_id);
+    {
+      std::lock_guard<std::mutex> release_lock(m_release_mutex);
+      if (m_released_objects.empty()) return;
+      m_releasing_objects.swap(m_released_objects);
+    }
+
+    std::vector<WindowInfo*> touched_windows;
+    for (ObjectHandle object_id : m_releasing_objects) {
+      const TrackedObject* tracked = m_objects.get(object_id);
+      // 只清理动态元素，静态元素不参与自动清理；句柄失配说明已被移除
+      if (!tracked || tracked->is_static || tracked->is_valid()) continue;
+      WindowInfo* window = tracked->window;
+      if (window->pending_deletes.empty()) {
+        touched_windows.push_back(window);
       }
+      window->pending_deletes.push_back(object_id);
+      remove_object_internal(object_id);
     }
+    m_releasing_objects.clear();
 
-    for (const auto& id : expired_ids) {
-      remove_object_internal(id);
+    for (WindowInfo* window : touched_windows) {
+      send_delete_objects(*window, window->pending_deletes);
+      window->pending_deletes.clear();
+      send_released_meshes(*window);
+      send_released_materials(*window);
     }
   }
 
-  void remove_object_internal(const std::string& object_id) {
+  // 只做服务端登记的清理，删除命令由调用方按窗口合并后发送
+  void remove_object_internal(ObjectHandle object_id) {
     // std::cout << "删除对象: " << object_id << std::endl;
-    auto it = m_tracked_objects.find(object_id);
-    if (it == m_tracked_objects.end()) return;
+    TrackedObject* tracked_ptr = m_objects.get(object_id);
+    if (!tracked_ptr) return;
+
+    const auto& tracked = *tracked_ptr;
 
-    const auto& tracked = it->second;
+    // 清理窗口对象集合：与末尾元素交换后弹出；
+    // dirty_objects 中残留的句柄在刷新时会因句柄失效而被跳过
+    WindowInfo& window = *tracked.window;
+    ObjectHandle moved = window.objects.back();
+    window.objects[tracked.window_pos] = moved;
+    window.objects.pop_back();
+    if (moved != object_id) {
+      m_objects.get(moved)->window_pos = tracked.window_pos;
+    }
+    release_mesh(window, tracked.mesh_id);
+    release_material(window, tracked.material_id);
+
+    forget_object(object_id, *tracked_ptr);
+  }
 
+  // 解除观察关系并释放句柄
+  void forget_object(ObjectHandle object_id, const TrackedObject& tracked) {
     // 根据元素类型进行不同的清理
     if (tracked.is_static) {
       // 静态元素：直接清理 shared_ptr
       if (tracked.static_obj_ptr) {
         tracked.static_obj_ptr->set_observer(nullptr);
-        m_object_ptr_to_id.erase(tracked.static_obj_ptr.get());
       }
     } else {
       // 动态元素：清理 weak_ptr 和观察者
       if (auto obj = tracked.dynamic_obj_ptr.lock()) {
         obj->set_observer(nullptr);
-        m_object_ptr_to_id.erase(obj.get());
       }
     }
+    m_objects.erase(object_id);
+  }
 
-    // 清理窗口对象集合
-    m_window_objects[tracked.window_uuid].erase(object_id);
+  void send_delete_objects(const WindowInfo& window,
+                           const std::vector<ObjectHandle>& object_ids) {
+    if (!has_clients() || object_ids.empty()) return;
 
-    if (tracked.is_3d) {
-      m_dirty_objects_3d[tracked.window_uuid].erase(object_id);
+    OutgoingMessage item = make_message();
+    if (window.is_3d) {
+      auto& u = *item.message->mutable_scene_3d_update();
+      u.set_window_id(window.uuid);
+      auto* ids = u.add_commands()->mutable_delete_objects()->mutable_ids();
+      ids->Add(object_ids.begin(), object_ids.end());
     } else {
-      m_dirty_objects_2d[tracked.window_uuid].erase(object_id);
+      auto& u = *item.message->mutable_scene_2d_update();
+      u.set_window_id(window.uuid);
+      auto* ids = u.add_commands()->mutable_delete_objects()->mutable_ids();
+      ids->Add(object_ids.begin(), object_ids.end());
     }
+    send_update(std::move(item));
+  }
 
-    // 获取窗口名称用于发送消息
-    std::string window_name = "";
-    auto window_it = m_windows.find(tracked.window_uuid);
-    if (window_it != m_windows.end()) {
-      window_name = window_it->second.display_name;
-    }
-    // 发送删除命令到前端
-    if (tracked.is_3d) {
-      visualization::Scene3DUpdate u;
-      u.set_window_id(tracked.window_uuid);  // 直接使用窗口UUID
-      u.set_window_name(window_name);
-      u.add_commands()->mutable_delete_object()->set_id(object_id);
-      send_update(u);
-      // std::cout << "📤 发送3D删除命令 - 窗口: " << window_name
-      //           << ", 对象: " << object_id << std::endl;
+  void send_clear_window(const WindowInfo& window,
+                         visualization::ClearWindow::Scope scope) {
+    if (!has_clients()) return;
+
+    OutgoingMessage item = make_message();
+    if (window.is_3d) {
+      auto& u = *item.message->mutable_scene_3d_update();
+      u.set_window_id(window.uuid);
+      u.add_commands()->mutable_clear_window()->set_scope(scope);
     } else {
-      visualization::Scene2DUpdate u;
-      u.set_window_id(tracked.window_uuid);  // 直接使用窗口UUID
-      u.set_window_name(window_name);
-      u.add_commands()->mutable_delete_object()->set_id(object_id);
-      send_update(u);
-      // std::cout << "📤 发送2D删除命令 - 窗口: " << window_name
-      //           << ", 对象: " << object_id << std::endl;
+      auto& u = *item.message->mutable_scene_2d_update();
+      u.set_window_id(window.uuid);
+      u.add_commands()->mutable_clear_window()->set_scope(scope);
     }
+    send_update(std::move(item));
+  }
 
-    m_tracked_objects.erase(it);
+  // 三角网格实例改为引用其当前网格并返回 mesh_id，其他图元返回 0。
+  // 窗口中还没有这份网格时分配新 id，并向 defines（可为空）追加 DefineMesh；
+  // 先加新引用再放旧引用，网格没变时不会被误释放
+  uint32_t bind_mesh(ObjectHandle object_id, const Vis::Observable& obj,
+                     visualization::Scene3DUpdate* defines) {
+    if (obj.type() != Vis::ObjectType::TRIANGLE_MESH_3D) return 0;
+    TrackedObject* tracked = m_objects.get(object_id);
+    if (!tracked || !tracked->window->is_3d) return 0;
+    WindowInfo& window = *tracked->window;
+    const auto& mesh = static_cast<const Vis::TriangleMesh3D&>(obj).get_mesh();
+    uint32_t mesh_id = mesh ? acquire_mesh(window, mesh, defines) : 0;
+    release_mesh(window, tracked->mesh_id);
+    tracked->mesh_id = mesh_id;
+    return mesh_id;
   }
 
-  void flush_dirty_set_2d_unlocked(const std::string& window_uuid) {
-    auto& dirty_set = m_dirty_objects_2d[window_uuid];
-    if (dirty_set.empty()) return;
+  uint32_t acquire_mesh(WindowInfo& window,
+                        const std::shared_ptr<const Vis::TriangleMeshData>& mesh,
+                        visualization::Scene3DUpdate* defines) {
+    auto& bucket = window.meshes[mesh->hash()];
+    for (MeshEntry& entry : bucket) {
+      if (entry.data == mesh || entry.data->same_content(*mesh)) {
+        ++entry.refs;
+        return entry.id;
+      }
+    }
+    uint32_t mesh_id = ++window.next_mesh_id;
+    bucket.push_back({mesh_id, mesh, 1});
+    window.mesh_hashes.emplace(mesh_id, mesh->hash());
+    if (defines) {
+      to_proto(mesh_id, *mesh, defines->add_commands()->mutable_define_mesh());
+    }
+    return mesh_id;
+  }
 
-    std::string window_name = "";
-    auto window_it = m_windows.find(window_uuid);
-    if (window_it != m_windows.end()) {
-      window_name = window_it->second.display_name;
+  // 引用归零的网格记入 released_meshes，由 send_released_meshes 通知客户端
+  void release_mesh(WindowInfo& window, uint32_t mesh_id) {
+    if (mesh_id == 0) return;
+    auto hash_it = window.mesh_hashes.find(mesh_id);
+    if (hash_it == window.mesh_hashes.end()) return;
+    auto bucket_it = window.meshes.find(hash_it->second);
+    auto& bucket = bucket_it->second;
+    for (auto it = bucket.begin(); it != bucket.end(); ++it) {
+      if (it->id != mesh_id) continue;
+      if (--it->refs > 0) return;
+      bucket.erase(it);
+      break;
+    }
+    if (bucket.empty()) window.meshes.erase(bucket_it);
+    window.mesh_hashes.erase(hash_it);
+    window.released_meshes.push_back(mesh_id);
+  }
+
+  template <typename Command>
+  static void set_mesh_id(uint32_t mesh_id, Command* cmd) {
+    if (cmd->has_triangle_mesh_3d()) {
+      cmd->mutable_triangle_mesh_3d()->set_mesh_id(mesh_id);
     }
+  }
 
-    visualization::Scene2DUpdate scene_update;
-    scene_update.set_window_id(window_uuid);
-    scene_update.set_window_name(window_name);
+  // 须在引用这些网格的删除或几何更新之后发出，客户端收到时已无图元使用它们
+  void send_released_meshes(WindowInfo& window) {
+    if (window.released_meshes.empty()) return;
+    if (has_clients()) {
+      OutgoingMessage item = make_message();
+      auto& u = *item.message->mutable_scene_3d_update();
+      u.set_window_id(window.uuid);
+      auto* ids = u.add_commands()->mutable_delete_meshes()->mutable_mesh_ids();
+      ids->Add(window.released_meshes.begin(), window.released_meshes.end());
+      send_update(std::move(item));
+    }
+    window.released_meshes.clear();
+  }
 
-    std::vector<std::string> processed_ids;
+  // 新连接在窗口创建之后先收到窗口现有的全部材质和网格，之后与实时的
+  // 定义/释放同步。已连接的客户端此时都已有全部材质
+  OutgoingMessage make_definitions(WindowInfo& window) {
+    OutgoingMessage item = make_message();
+    if (window.is_3d) {
+      auto& u = *item.message->mutable_scene_3d_update();
+      u.set_window_id(window.uuid);
+      define_all_materials(window, &u);
+      for (const auto& [hash, bucket] : window.meshes) {
+        for (const MeshEntry& entry : bucket) {
+          to_proto(entry.id, *entry.data,
+                   u.add_commands()->mutable_define_mesh());
+        }
+      }
+    } else {
+      auto& u = *item.message->mutable_scene_2d_update();
+      u.set_window_id(window.uuid);
+      define_all_materials(window, &u);
+    }
+    return item;
+  }
 
-    for (const auto& object_id : dirty_set) {
-      auto it = m_tracked_objects.find(object_id);
-      if (it == m_tracked_objects.end()) continue;
+  // 返回材质在窗口材质表中的 id 并增加一个引用，没有相同的材质时分配新 id
+  uint32_t acquire_material(WindowInfo& window,
+                            const Vis::MaterialProps& material) {
+    uint64_t hash = hash_material(material);
+    auto& bucket = window.material_ids[hash];
+    for (uint32_t material_id : bucket) {
+      MaterialEntry& entry = window.materials.at(material_id);
+      if (same_material(entry.props, material)) {
+        ++entry.refs;
+        return material_id;
+      }
+    }
+    uint32_t material_id = ++window.next_material_id;
+    window.materials.emplace(material_id, MaterialEntry{material, hash, 1});
+    bucket.push_back(material_id);
+    window.new_materials.push_back(material_id);
+    return material_id;
+  }
 
-      const auto& tracked = it->second;
+  // 引用归零的材质记入 released_materials，由 send_released_materials 或
+  // append_released_materials 通知客户端；还没定义过的直接丢弃
+  void release_material(WindowInfo& window, uint32_t material_id) {
+    auto it = window.materials.find(material_id);
+    if (it == window.materials.end() || --it->second.refs > 0) return;
+    auto bucket_it = window.material_ids.find(it->second.hash);
+    auto& bucket = bucket_it->second;
+    bucket.erase(std::find(bucket.begin(), bucket.end(), material_id));
+    if (bucket.empty()) window.material_ids.erase(bucket_it);
+    window.materials.erase(it);
+
+    // 两次定义之间新增的材质很少，线性查找即可
+    auto pending = std::find(window.new_materials.begin(),
+                             window.new_materials.end(), material_id);
+    if (pending != window.new_materials.end()) {
+      window.new_materials.erase(pending);
+    } else {
+      window.released_materials.push_back(material_id);
+    }
+  }
 
-      if (!tracked.is_valid()) continue;
-      auto obj = tracked.get_object();
-      if (!obj) continue;
+  // 新连接或录制开始时定义窗口现有的全部材质。已连接的客户端此时都已有它们
+  template <typename SceneUpdate>
+  static void define_all_materials(WindowInfo& window, SceneUpdate* u) {
+    for (const auto& [material_id, entry] : window.materials) {
+      to_proto(material_id, entry.props,
+               u->add_commands()->mutable_define_material());
+    }
+    window.new_materials.clear();
+  }
 
-      auto* update_geom =
-          scene_update.add_commands()->mutable_update_object_geometry();
-      update_geom->set_id(object_id);
-      populate_2d_geometry_update(obj, update_geom);
+  // 客户端还没有的材质须在引用它的 AddObject 之前定义
+  template <typename SceneUpdate>
+  static void define_new_materials(WindowInfo& window, SceneUpdate* u) {
+    for (uint32_t material_id : window.new_materials) {
+      to_proto(material_id, window.materials.at(material_id).props,
+               u->add_commands()->mutable_define_material());
+    }
+    window.new_materials.clear();
+  }
+
+  // 须排在不再引用这些材质的删除或属性更新之后
+  template <typename SceneUpdate>
+  static void append_released_materials(WindowInfo& window, SceneUpdate* u) {
+    if (window.released_materials.empty()) return;
+    auto* ids = u->add_commands()
+                    ->mutable_delete_materials()
+                    ->mutable_material_ids();
+    ids->Add(window.released_materials.begin(),
+             window.released_materials.end());
+    window.released_materials.clear();
+  }
 
-      processed_ids.push_back(object_id);
+  void send_released_materials(WindowInfo& window) {
+    if (window.released_materials.empty()) return;
+    if (has_clients()) {
+      OutgoingMessage item = make_message();
+      if (window.is_3d) {
+        auto& u = *item.message->mutable_scene_3d_update();
+        u.set_window_id(window.uuid);
+        append_released_materials(window, &u);
+      } else {
+        auto& u = *item.message->mutable_scene_2d_update();
+        u.set_window_id(window.uuid);
+        append_released_materials(window, &u);
+      }
+      send_update(std::move(item));
     }
+    window.released_materials.clear();
+  }
 
-    for (const auto& id : processed_ids) {
-      dirty_set.erase(id);
+  // 把一条 AddObject 命令追加到窗口的批量消息中，超过大小上限时先发出
+  void append_pending_add(WindowInfo& window, ObjectHandle object_id,
+                          uint32_t material_id,
+                          const std::shared_ptr<Vis::Observable>& obj,
+                          bool is_static) {
+    open_pending_adds(window);
+    size_t bytes;
+    if (window.is_3d) {
+      auto* scene_update =
+          window.pending_adds.message->mutable_scene_3d_update();
+      int first = scene_update->commands_size();
+      define_new_materials(window, scene_update);
+      uint32_t mesh_id = bind_mesh(object_id, *obj, scene_update);
+      auto* cmd = scene_update->add_commands()->mutable_add_object();
+      cmd->set_id(object_id);
+      cmd->set_layer(to_layer(is_static));
+      cmd->set_material_id(material_id);
+      populate_geometry(*obj, cmd);
+      set_mesh_id(mesh_id, cmd);
+      window.quantizer.apply(cmd);
+      bytes = 0;
+      for (int i = first; i < scene_update->commands_size(); ++i) {
+        bytes += scene_update->commands(i).ByteSizeLong();
+      }
+    } else {
+      auto* scene_update =
+          window.pending_adds.message->mutable_scene_2d_update();
+      int first = scene_update->commands_size();
+      define_new_materials(window, scene_update);
+      auto* cmd = scene_update->add_commands()->mutable_add_object();
+      cmd->set_id(object_id);
+      cmd->set_layer(to_layer(is_static));
+      cmd->set_material_id(material_id);
+      populate_geometry(*obj, cmd);
+      window.quantizer.apply(cmd);
+      bytes = 0;
+      for (int i = first; i < scene_update->commands_size(); ++i) {
+        bytes += scene_update->commands(i).ByteSizeLong();
+      }
     }
 
-    if (scene_update.commands_size() > 0) {
-      send_update(scene_update);
+    // 每条命令另有 tag 和长度前缀，按 4 字节估算
+    add_pending_bytes(window, bytes + 4);
+  }
+
+  // 同一批中对图元的修改排在其 AddObject 之后，客户端按顺序处理
+  void append_pending_properties(WindowInfo& window, ObjectHandle object_id,
+                                 uint32_t material_id) {
+    open_pending_adds(window);
+    size_t bytes = 0;
+    if (window.is_3d) {
+      auto* scene_update =
+          window.pending_adds.message->mutable_scene_3d_update();
+      int first = scene_update->commands_size();
+      define_new_materials(window, scene_update);
+      auto* cmd =
+          scene_update->add_commands()->mutable_update_object_properties();
+      cmd->set_id(object_id);
+      cmd->set_material_id(material_id);
+      append_released_materials(window, scene_update);
+      for (int i = first; i < scene_update->commands_size(); ++i) {
+        bytes += scene_update->commands(i).ByteSizeLong() + 4;
+      }
+    } else {
+      auto* scene_update =
+          window.pending_adds.message->mutable_scene_2d_update();
+      int first = scene_update->commands_size();
+      define_new_materials(window, scene_update);
+      auto* cmd =
+          scene_update->add_commands()->mutable_update_object_properties();
+      cmd->set_id(object_id);
+      cmd->set_material_id(material_id);
+      append_released_materials(window, scene_update);
+      for (int i = first; i < scene_update->commands_size(); ++i) {
+        bytes += scene_update->commands(i).ByteSizeLong() + 4;
+      }
     }
+    add_pending_bytes(window, bytes);
   }
 
-  void flush_dirty_set_3d_unlocked(const std::string& window_uuid) {
-    auto& dirty_set = m_dirty_objects_3d[window_uuid];
-    if (dirty_set.empty()) return;
+  void open_pending_adds(WindowInfo& window) {
+    if (window.pending_adds.message) return;
+    window.pending_adds = make_message();
+    if (window.is_3d) {
+      auto& scene_update =
+          *window.pending_adds.message->mutable_scene_3d_update();
+      scene_update.set_window_id(window.uuid);
+      scene_update.set_window_name(window.display_name);
+    } else {
+      auto& scene_update =
+          *window.pending_adds.message->mutable_scene_2d_update();
+      scene_update.set_window_id(window.uuid);
+      scene_update.set_window_name(window.display_name);
+    }
+  }
 
-    std::string window_name = "";
-    auto window_it = m_windows.find(window_uuid);
-    if (window_it != m_windows.end()) {
-      window_name = window_it->second.display_name;
+  // 超过大小上限时先发出
+  void add_pending_bytes(WindowInfo& window, size_t bytes) {
+    window.pending_bytes += bytes;
+    if (window.pending_bytes >= kMaxBatchMessageBytes) {
+      send_pending_adds(window);
     }
+  }
 
-    visualization::Scene3DUpdate scene_update;
-    scene_update.set_window_id(window_uuid);
-    scene_update.set_window_name(window_name);
+  void send_pending_adds(WindowInfo& window) {
+    if (!window.pending_adds.message) return;
+    window.pending_bytes = 0;
+    enqueue(std::exchange(window.pending_adds, OutgoingMessage()));
+  }
 
-    std::vector<std::string> processed_ids;
+  void send_all_pending_adds() {
+    for (auto& [window_uuid, window] : m_windows) {
+      send_pending_adds(window);
+    }
+  }
 
-    for (const auto& object_id : dirty_set) {
-      auto it = m_tracked_objects.find(object_id);
-      if (it == m_tracked_objects.end()) continue;
+  void flush_dirty_set_2d_unlocked(WindowInfo& window) {
+    if (window.dirty_objects.empty()) return;
 
-      const auto& tracked = it->second;
+    OutgoingMessage item = make_message();
+    auto& scene_update = *item.message->mutable_scene_2d_update();
+    // 窗口必然已创建，只带 window_id，短 id 可留在 std::string 的内联缓冲区
+    scene_update.set_window_id(window.uuid);
 
-      if (!tracked.is_valid()) continue;
-      auto obj = tracked.get_object();
+    for (ObjectHandle object_id : window.dirty_objects) {
+      TrackedObject* tracked = m_objects.get(object_id);
+      if (!tracked || !tracked->is_dirty) continue;
+      tracked->is_dirty = false;
+
+      if (!tracked->is_valid()) continue;
+      auto obj = tracked->get_object();
       if (!obj) continue;
 
       auto* update_geom =
           scene_update.add_commands()->mutable_update_object_geometry();
       update_geom->set_id(object_id);
-      populate_3d_geometry_update(obj, update_geom);
+      uint32_t fields = obj->take_dirty_fields();
+      if (!populate_append(*tracked, *obj, update_geom) &&
+          !populate_range(*obj, update_geom) &&
+          !populate_tiles(*obj, fields, update_geom)) {
+        populate_update(*obj, fields, update_geom);
+      }
+      window.quantizer.apply(update_geom);
+    }
+    window.dirty_objects.clear();
 
-      processed_ids.push_back(object_id);
+    if (scene_update.commands_size() > 0) {
+      send_update(std::move(item));
     }
+  }
+
+  void flush_dirty_set_3d_unlocked(WindowInfo& window) {
+    if (window.dirty_objects.empty()) return;
+
+    OutgoingMessage item = make_message();
+    auto& scene_update = *item.message->mutable_scene_3d_update();
+    scene_update.set_window_id(window.uuid);
+    // 换用新网格时的 DefineMesh 单独成一条结构性消息，先于几何更新发出，
+    // 几何更新本身仍可合并或丢弃
+    OutgoingMessage defines;
 
-    for (const auto& id : processed_ids) {
-      dirty_set.erase(id);
+    for (ObjectHandle object_id : window.dirty_objects) {
+      TrackedObject* tracked = m_objects.get(object_id);
+      if (!tracked || !tracked->is_dirty) continue;
+      tracked->is_dirty = false;
+
+      if (!tracked->is_valid()) continue;
+      auto obj = tracked->get_object();
+      if (!obj) continue;
+
+      auto* update_geom =
+          scene_update.add_commands()->mutable_update_object_geometry();
+      update_geom->set_id(object_id);
+      uint32_t fields = obj->take_dirty_fields();
+      if (!populate_append(*tracked, *obj, update_geom) &&
+          !populate_range(*obj, update_geom) &&
+          !populate_tiles(*obj, fields, update_geom)) {
+        populate_update(*obj, fields, update_geom);
+      }
+      if (update_geom->has_triangle_mesh_3d() &&
+          (update_geom->field_mask() == 0 ||
+           update_geom->field_mask() &
+               field_bit(visualization::TriangleMesh3D::kMeshIdFieldNumber))) {
+        if (!defines.message) {
+          defines = make_message();
+          defines.message->mutable_scene_3d_update()->set_window_id(
+              window.uuid);
+        }
+        set_mesh_id(bind_mesh(object_id, *obj,
+                              defines.message->mutable_scene_3d_update()),
+                    update_geom);
+      }
+      window.quantizer.apply(update_geom);
     }
+    window.dirty_objects.clear();
 
+    if (defines.message &&
+        defines.message->scene_3d_update().commands_size() > 0) {
+      send_update(std::move(defines));
+    }
     if (scene_update.commands_size() > 0) {
-      send_update(scene_update);
+      send_update(std::move(item));
     }
+    send_released_meshes(window);
   }
 
   std::string get_window_id_for_name(const std::string& window_name,
@@ -948,108 +2310,128 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
     return get_uuid_for_name(window_name, is_3d);
   }
 
-  void populate_2d_geometry(std::shared_ptr<Vis::Observable> obj,
-                            visualization::Add2DObject* cmd) {
-    if (!obj) return;
-    if (auto p = std::dynamic_pointer_cast<Vis::Point2D>(obj)) {
-      to_proto(*p, cmd->mutable_point_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Pose2D>(obj)) {
-      to_proto(*p, cmd->mutable_pose_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Circle>(obj)) {
-      to_proto(*p, cmd->mutable_circle());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Box2D>(obj)) {
-      to_proto(*p, cmd->mutable_box_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Line2D>(obj)) {
-      to_proto(*p, cmd->mutable_line_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Trajectory2D>(obj)) {
-      to_proto(*p, cmd->mutable_trajectory_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Polygon>(obj)) {
-      to_proto(*p, cmd->mutable_polygon());
-    } else {
-      std::cerr << "Warning: Unknown 2D object type" << std::endl;
-    }
-  }
-
-  void populate_3d_geometry(std::shared_ptr<Vis::Observable> obj,
-                            visualization::Add3DObject* cmd) {
-    if (auto p = std::dynamic_pointer_cast<Vis::Point3D>(obj)) {
-      to_proto(*p, cmd->mutable_point_3d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Pose3D>(obj)) {
-      to_proto(*p, cmd->mutable_pose_3d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Ball>(obj)) {
-      to_proto(*p, cmd->mutable_ball());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Box3D>(obj)) {
-      to_proto(*p, cmd->mutable_box_3d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Line3D>(obj)) {
-      to_proto(*p, cmd->mutable_line_3d());
-    }
-    // 添加对2D图元的支持（在3D窗口中显示）
-    else if (auto p = std::dynamic_pointer_cast<Vis::Point2D>(obj)) {
-      to_proto(*p, cmd->mutable_point_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Pose2D>(obj)) {
-      to_proto(*p, cmd->mutable_pose_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Circle>(obj)) {
-      to_proto(*p, cmd->mutable_circle());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Box2D>(obj)) {
-      to_proto(*p, cmd->mutable_box_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Line2D>(obj)) {
-      to_proto(*p, cmd->mutable_line_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Trajectory2D>(obj)) {
-      to_proto(*p, cmd->mutable_trajectory_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Polygon>(obj)) {
-      to_proto(*p, cmd->mutable_polygon());
-    } else {
-      std::cerr << "Warning: Unknown 3D window object type" << std::endl;
-    }
-  }
-
-  void populate_2d_geometry_update(std::shared_ptr<Vis::Observable> obj,
-                                   visualization::Update2DObjectGeometry* cmd) {
-    if (auto p = std::dynamic_pointer_cast<Vis::Point2D>(obj)) {
-      to_proto(*p, cmd->mutable_point_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Pose2D>(obj)) {
-      to_proto(*p, cmd->mutable_pose_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Circle>(obj)) {
-      to_proto(*p, cmd->mutable_circle());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Box2D>(obj)) {
-      to_proto(*p, cmd->mutable_box_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Line2D>(obj)) {
-      to_proto(*p, cmd->mutable_line_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Trajectory2D>(obj)) {
-      to_proto(*p, cmd->mutable_trajectory_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Polygon>(obj)) {
-      to_proto(*p, cmd->mutable_polygon());
-    }
-  }
-
-  void populate_3d_geometry_update(std::shared_ptr<Vis::Observable> obj,
-                                   visualization::Update3DObjectGeometry* cmd) {
-    if (auto p = std::dynamic_pointer_cast<Vis::Point3D>(obj)) {
-      to_proto(*p, cmd->mutable_point_3d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Pose3D>(obj)) {
-      to_proto(*p, cmd->mutable_pose_3d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Ball>(obj)) {
-      to_proto(*p, cmd->mutable_ball());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Box3D>(obj)) {
-      to_proto(*p, cmd->mutable_box_3d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Line3D>(obj)) {
-      to_proto(*p, cmd->mutable_line_3d());
-    }
-    // 添加对2D图元的支持（在3D窗口中更新）
-    else if (auto p = std::dynamic_pointer_cast<Vis::Point2D>(obj)) {
-      to_proto(*p, cmd->mutable_point_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Pose2D>(obj)) {
-      to_proto(*p, cmd->mutable_pose_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Circle>(obj)) {
-      to_proto(*p, cmd->mutable_circle());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Box2D>(obj)) {
-      to_proto(*p, cmd->mutable_box_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Line2D>(obj)) {
-      to_proto(*p, cmd->mutable_line_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Trajectory2D>(obj)) {
-      to_proto(*p, cmd->mutable_trajectory_2d());
-    } else if (auto p = std::dynamic_pointer_cast<Vis::Polygon>(obj)) {
-      to_proto(*p, cmd->mutable_polygon());
+  // 一次 switch 分派到具体类型，写入几何字段
+  template <typename Command>
+  void populate_geometry(const Vis::Observable& obj, Command* cmd) {
+    bool supported =
+        visit(obj, [cmd](const auto& p) { return set_geometry(p, cmd); });
+    if constexpr (std::is_same_v<Command, visualization::Add2DObject>) {
+      if (!supported) {
+        std::cerr << "Warning: Unknown 2D object type" << std::endl;
+      }
+    }
+  }
+
+  // fields 只覆盖图元的部分字段时写部分更新（带 field_mask），否则整体写入
+  template <typename UpdateGeometry>
+  void populate_update(const Vis::Observable& obj, uint32_t fields,
+                       UpdateGeometry* cmd) {
+    if (m_partial_updates) {
+      uint32_t mask = visit(obj, [fields, cmd](const auto& p) {
+        return set_dirty_fields(p, fields, cmd);
+      });
+      if (mask != 0) {
+        cmd->set_field_mask(mask);
+        return;
+      }
+    }
+    populate_geometry(obj, cmd);
+  }
+
+  // 实例数组自上次发出后只改了一部分时，只写入被修改的区间并返回 true。
+  // 多次修改取覆盖它们的最小区间，其间没改的实例也会一并发送
+  template <typename UpdateGeometry>
+  bool populate_range(Vis::Observable& obj, UpdateGeometry* cmd) {
+    std::pair<uint32_t, uint32_t> range;
+    if (!take_dirty_range(obj, &range)) return false;
+    if (!m_partial_updates) return false;
+    auto [begin, end] = range;
+    if (end == Vis::Box3DArray::kWhole) return false;
+    return visit(obj, [begin = begin, end = end, cmd](const auto& p) {
+      using T = std::decay_t<decltype(p)>;
+      if constexpr (std::is_same_v<T, Vis::Box3DArray>) {
+        if constexpr (kIs3DCommand<UpdateGeometry>) {
+          return write_range(p, begin, end, cmd->mutable_box_3d_array());
+        }
+        return false;
+      } else if constexpr (std::is_same_v<T, Vis::CircleArray>) {
+        return write_range(p, begin, end, cmd->mutable_circle_array());
+      } else if constexpr (std::is_same_v<T, Vis::Pose2DArray>) {
+        return write_range(p, begin, end, cmd->mutable_pose_2d_array());
+      }
+      return false;
+    });
+  }
+
+  // 栅格尺寸和格子类型没变、也不是全部瓦片都改过时，只写入头部和改过的
+  // 瓦片并返回 true
+  template <typename UpdateGeometry>
+  bool populate_tiles(Vis::Observable& obj, uint32_t fields,
+                      UpdateGeometry* cmd) {
+    m_dirty_tiles.clear();
+    if (!take_dirty_tiles(obj, &m_dirty_tiles)) return false;
+    if (!m_partial_updates || (fields & Vis::OccupancyGrid::kLayoutField)) {
+      return false;
+    }
+    const auto& grid = static_cast<const Vis::OccupancyGrid&>(obj);
+    if (m_dirty_tiles.size() >= size_t{grid.tiles_x()} * grid.tiles_y()) {
+      return false;
+    }
+    auto* out = cmd->mutable_occupancy_grid();
+    to_proto_header(grid, out);
+    out->set_partial(true);
+    for (uint32_t tile : m_dirty_tiles) {
+      to_proto(grid, tile, out->add_tiles());
+    }
+    return true;
+  }
+
+  // 区间覆盖整个数组（或已无效）时返回 false，由调用方整体写入
+  template <typename Array>
+  static bool write_range(const Array& array, size_t begin, size_t end,
+                          visualization::InstanceArray* out) {
+    end = std::min(end, array.size());
+    if (begin >= end || (begin == 0 && end == array.size())) return false;
+    to_proto(array, begin, end, out);
+    return true;
+  }
+
+  // 折线/轨迹自上次发出后只有追加时，只写入新增的尾部并返回 true；
+  // 被替换、清空或缩短时返回 false，由调用方整体重发。两种情况都会更新水位。
+  // 追加命令带起点下标，客户端按下标拼接，因此新客户端重放时拿到的完整状态
+  // 比水位更新也没关系
+  template <typename UpdateGeometry>
+  bool populate_append(TrackedObject& tracked, const Vis::Observable& obj,
+                       UpdateGeometry* cmd) {
+    uint32_t revision = 0;
+    size_t count = 0;
+    if (!appendable_state(obj, &revision, &count)) return false;
+    size_t start = tracked.sent_count;
+    bool append_only =
+        revision == tracked.sent_revision && count >= start && start > 0;
+    tracked.sent_revision = revision;
+    tracked.sent_count = count;
+    if (!append_only) return false;
+
+    switch (obj.type()) {
+      case Vis::ObjectType::LINE_2D:
+        to_append_proto(static_cast<const Vis::Line2D&>(obj), start,
+                        cmd->mutable_append_points());
+        return true;
+      case Vis::ObjectType::TRAJECTORY_2D:
+        to_append_proto(static_cast<const Vis::Trajectory2D&>(obj), start,
+                        cmd->mutable_append_poses());
+        return true;
+      case Vis::ObjectType::LINE_3D:
+        // 2D 窗口不支持 Line3D，交给 populate_geometry 按原样处理
+        if constexpr (kIs3DCommand<UpdateGeometry>) {
+          to_append_proto(static_cast<const Vis::Line3D&>(obj), start,
+                          cmd->mutable_append_points());
+          return true;
+        }
+        return false;
+      default:
+        return false;
     }
   }
 
@@ -1065,11 +2447,15 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
     std::lock_guard<std::mutex> lock(m_mutex);
     cleanup_expired_objects();
 
-    for (const auto& [window_name, _] : m_dirty_objects_2d) {
-      flush_dirty_set_2d_unlocked(window_name);
-    }
-    for (const auto& [window_name, _] : m_dirty_objects_3d) {
-      flush_dirty_set_3d_unlocked(window_name);
+    // 帧内不定时刷新，由 end_frame 统一发出
+    if (m_frame_depth == 0) {
+      for (auto& [window_uuid, window] : m_windows) {
+        if (window.is_3d) {
+          flush_dirty_set_3d_unlocked(window);
+        } else {
+          flush_dirty_set_2d_unlocked(window);
+        }
+      }
     }
 
     if (m_auto_update_enabled && m_update_interval > 0) {
@@ -1079,88 +2465,472 @@ class VisualizationServer::ServerImpl : public Vis::IObserver {
   /**
    * 发送窗口创建命令到前端
    */
-  void send_window_create_command(const std::string& uuid,
-                                  const std::string& window_name, bool is_3d) {
-    if (!m_has_connection) return;
+  void send_window_create_command(const WindowInfo& window) {
+    if (!has_clients()) return;
 
-    if (is_3d) {
-      visualization::Scene3DUpdate scene_update;
-      scene_update.set_window_id(uuid);
-      scene_update.set_window_name(window_name);
+    send_update(make_window_create_message(window));
+    // std::cout << "📤 发送窗口创建命令: " << window_name << std::endl;
+  }
+
+  OutgoingMessage make_window_create_message(const WindowInfo& window) {
+    OutgoingMessage item = make_message();
+    if (window.is_3d) {
+      auto& scene_update = *item.message->mutable_scene_3d_update();
+      scene_update.set_window_id(window.uuid);
+      scene_update.set_window_name(window.display_name);
       auto* cmd = scene_update.add_commands()->mutable_create_window();
-      cmd->set_window_name(window_name);
-      cmd->set_window_id(uuid);
-      send_update(scene_update);
+      cmd->set_window_name(window.display_name);
+      cmd->set_window_id(window.uuid);
+      if (window.quantizer.enabled()) {
+        window.quantizer.to_proto(cmd->mutable_quantization());
+      }
     } else {
-      visualization::Scene2DUpdate scene_update;
-      scene_update.set_window_id(uuid);
-      scene_update.set_window_name(window_name);
+      auto& scene_update = *item.message->mutable_scene_2d_update();
+      scene_update.set_window_id(window.uuid);
+      scene_update.set_window_name(window.display_name);
       auto* cmd = scene_update.add_commands()->mutable_create_window();
-      cmd->set_window_name(window_name);
-      cmd->set_window_id(uuid);
-      send_update(scene_update);
+      cmd->set_window_name(window.display_name);
+      cmd->set_window_id(window.uuid);
+      if (window.quantizer.enabled()) {
+        window.quantizer.to_proto(cmd->mutable_quantization());
+      }
     }
-
-    // std::cout << "📤 发送窗口创建命令: " << window_name << std::endl;
+    return item;
   }
 
-  void send_existing_objects(const std::string& window_uuid, bool is_3d) {
-    auto it = m_window_objects.find(window_uuid);
-    if (it == m_window_objects.end()) return;
+  // 从 begin 开始把快照中的图元打包成一条消息发出，达到大小上限即停止，
+  // 返回下一个待发送的下标。几何数据在此刻读取，快照后删除的图元直接跳过。
+  // target 为 ONE_CLIENT（发给 hdl）或 RECORDER
+  size_t send_existing_objects(SendTarget target, const connection_hdl& hdl,
+                               const ReplayWindow& window, size_t begin) {
+    OutgoingMessage item = make_message();
+    if (window.is_3d) {
+      item.message->mutable_scene_3d_update()->set_window_id(window.uuid);
+    } else {
+      item.message->mutable_scene_2d_update()->set_window_id(window.uuid);
+    }
 
-    for (const auto& object_id : it->second) {
-      auto tracked_it = m_tracked_objects.find(object_id);
-      if (tracked_it == m_tracked_objects.end()) continue;
+    size_t bytes = 0;
+    size_t count = 0;
+    size_t i = begin;
+    for (; i < window.objects.size() && bytes < kReplayChunkBytes; ++i) {
+      ObjectHandle object_id = window.objects[i];
+      const TrackedObject* tracked_ptr = m_objects.get(object_id);
+      if (!tracked_ptr) continue;
 
-      const auto& tracked = tracked_it->second;
+      const auto& tracked = *tracked_ptr;
       // 使用新的有效性检查方法
       if (!tracked.is_valid()) continue;
       // 使用统一的获取对象方法
       auto obj = tracked.get_object();
       if (!obj) continue;
-      if (is_3d) {
-        visualization::Scene3DUpdate scene_update;
-        scene_update.set_window_id(window_uuid);
-        auto* cmd = scene_update.add_commands()->mutable_add_object();
+      if (window.is_3d) {
+        auto* cmd = item.message->mutable_scene_3d_update()
+                        ->add_commands()
+                        ->mutable_add_object();
         cmd->set_id(object_id);
-        cmd->mutable_material()->CopyFrom(tracked.material);
-        populate_3d_geometry(obj, cmd);
-        send_update(scene_update);
+        cmd->set_layer(to_layer(tracked.is_static));
+        cmd->set_material_id(tracked.material_id);
+        populate_geometry(*obj, cmd);
+        // 引用的网格已随窗口创建或之后的实时消息下发
+        set_mesh_id(tracked.mesh_id, cmd);
+        window.quantizer.apply(cmd);
+        bytes += cmd->ByteSizeLong() + 4;
       } else {
-        visualization::Scene2DUpdate scene_update;
-        scene_update.set_window_id(window_uuid);
-        auto* cmd = scene_update.add_commands()->mutable_add_object();
+        auto* cmd = item.message->mutable_scene_2d_update()
+                        ->add_commands()
+                        ->mutable_add_object();
         cmd->set_id(object_id);
-        cmd->mutable_material()->CopyFrom(tracked.material);
-        populate_2d_geometry(obj, cmd);
-        send_update(scene_update);
+        cmd->set_layer(to_layer(tracked.is_static));
+        cmd->set_material_id(tracked.material_id);
+        populate_geometry(*obj, cmd);
+        window.quantizer.apply(cmd);
+        bytes += cmd->ByteSizeLong() + 4;
       }
+      ++count;
+    }
+    if (count > 0) {
+      item.target = target;
+      item.connection = hdl;
+      push_chunked(std::move(item));
     }
+    return i;
   }
 
-  void on_open(connection_hdl hdl) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_current_connection = hdl;
-    m_has_connection = true;
+  // 在网络线程上逐块重放：每块只短暂持有 m_mutex，块与块之间让出锁和网络线程，
+  // 期间 API 线程的实时命令照常入队。快照之后才入队的实时命令可能先于
+  // 对应图元的 AddObject 到达，客户端会忽略未知图元的更新，而随后的
+  // AddObject 读取的是更新之后的状态，最终结果一致。
+  //
+  // 这依赖一个不变式：每块在持锁时读取状态并入队，同一窗口中晚于它入队的
+  // 实时命令不会先于它到达新客户端。发送队列保证同一窗口的消息不论目标都按
+  // 入队顺序发出（合并不越过重放分块，见 SendQueue），发送线程对落后客户端
+  // 也先发出该窗口积压的更新，再发重放分块
+  void replay_next_chunk(const std::shared_ptr<ReplayState>& replay) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      // 重放期间连接已断开
+      if (!m_clients.count(replay->connection)) return;
+
+      const ReplayWindow& window = replay->windows[replay->window_index];
+      replay->object_index =
+          send_existing_objects(SendTarget::ONE_CLIENT, replay->connection,
+                                window, replay->object_index);
+      if (replay->object_index >= window.objects.size()) {
+        ++replay->window_index;
+        replay->object_index = 0;
+      }
+      if (replay->window_index >= replay->windows.size()) return;
+    }
+    m_server.get_io_service().post(
+        [this, replay]() { replay_next_chunk(replay); });
+  }
+
+  // 发送线程中每个客户端的状态
+  struct ClientChannel {
+    connection_hdl hdl;
+    // 缓冲超过高水位后置位，之后的纯几何更新改为并入 backlog，
+    // 缓冲降到一半以下时发出 backlog 并复位
+    bool lagging = false;
+    GeometryBacklog backlog;
+    bool deflate = false;  // 握手时协商了 permessage-deflate
+  };
+
+  // 同一条消息发给多个连接时共用的帧：原文帧和按需生成的压缩帧
+  struct FrameCache {
+    message_ptr plain;
+    message_ptr deflated;
+  };
+
+  void send_loop() {
+    OutgoingMessage item;
+    std::vector<message_ptr> frames;  // 复用的帧缓冲，仅发送线程访问
+    // 发送线程视角的广播列表，只随队列中的控制项变化，
+    // 因此每条广播恰好发给入队时已加入的客户端
+    std::vector<ClientChannel> clients;
+    std::vector<ClientChannel*> targets;
+    // 同理只随 RECORDING_STARTED / RECORDING_STOPPED 变化
+    std::shared_ptr<SessionRecorder> recorder;
+    while (true) {
+      // 有落后的客户端时定期醒来，检查它们是否已追上
+      if (m_lagging_clients > 0) {
+        auto result = m_send_queue.pop_for(item, kBackpressurePollInterval);
+        if (result == SendQueue::PopResult::CLOSED) break;
+        release_caught_up(clients, frames);
+        if (result == SendQueue::PopResult::TIMEOUT) continue;
+      } else if (!m_send_queue.pop(item)) {
+        break;
+      }
+
+      switch (item.target) {
+        case SendTarget::CLIENT_JOINED: {
+          ClientChannel& client = clients.emplace_back();
+          client.hdl = item.connection;
+          server::connection_ptr con = get_connection(client.hdl);
+          client.deflate =
+              con &&
+              !con->get_response_header("Sec-WebSocket-Extensions").empty();
+          continue;
+        }
+        case SendTarget::CLIENT_LEFT:
+          for (size_t i = 0; i < clients.size(); ++i) {
+            if (!same_connection(clients[i].hdl, item.connection)) continue;
+            if (clients[i].lagging) --m_lagging_clients;
+            clients[i] = std::move(clients.back());
+            clients.pop_back();
+            break;
+          }
+          continue;
+        case SendTarget::ONE_CLIENT:
+          for (ClientChannel& client : clients) {
+            if (same_connection(client.hdl, item.connection)) {
+              targets.push_back(&client);
+            }
+          }
+          break;
+        case SendTarget::ALL_CLIENTS:
+          for (ClientChannel& client : clients) {
+            targets.push_back(&client);
+          }
+          break;
+        case SendTarget::RECORDER:
+          break;
+        case SendTarget::RECORDING_STARTED:
+          recorder = std::move(item.recorder);
+          continue;
+        case SendTarget::RECORDING_STOPPED:
+          // 析构时写完剩余缓冲并关闭文件
+          recorder.reset();
+          continue;
+      }
+
+      // 只序列化（和压缩）一次，各连接的发送队列共享同一个帧
+      FrameCache cache;
+      for (ClientChannel* client : targets) {
+        // 连接可能已在排队期间断开，此时直接丢弃
+        server::connection_ptr con = get_connection(client->hdl);
+        if (!con) continue;
+        if (client->lagging) {
+          if (item.geometry_only) {
+            m_superseded += client->backlog.merge(*item.message);
+            continue;
+          }
+          // 帧内的更新还积压着，帧提交要等它们一起发出
+          if (item.message->has_frame_commit() &&
+              client->backlog.defer_commit(*item.message)) {
+            continue;
+          }
+          // 结构性命令不能越过同一窗口积压的几何更新，
+          // 否则客户端可能在 DeleteWindow 之后收到更新而重建窗口
+          GeometryBacklog::MessagePtr pending =
+              client->backlog.take(window_id_of(*item.message));
+          if (pending) {
+            con->send(encode_frame(frames, con, *pending, client->deflate));
+          }
+        }
+        con->send(
+            encode_frame(frames, con, *item.message, client->deflate, cache));
+      }
+      targets.clear();
+      if (recorder && item.target != SendTarget::ONE_CLIENT) {
+        record(*recorder, *item.message, cache);
+      }
+      mark_lagging(clients);
+    }
+  }
+
+  // 录下的字节与发给客户端的原文帧负载相同，已序列化过就直接拷贝，
+  // 否则（没有客户端或都在落后）直接序列化进录制缓冲区
+  static void record(SessionRecorder& recorder,
+                     const visualization::VisMessage& message,
+                     const FrameCache& cache) {
+    int64_t now_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                         std::chrono::system_clock::now().time_since_epoch())
+                         .count();
+    if (cache.plain) {
+      const std::string& payload = cache.plain->get_payload();
+      std::memcpy(recorder.reserve(now_us, payload.size()), payload.data(),
+                  payload.size());
+    } else {
+      size_t size = message.ByteSizeLong();
+      message.SerializeWithCachedSizesToArray(recorder.reserve(now_us, size));
+    }
+  }
+
+  // 检查各客户端在 websocketpp 中缓冲的字节数，超过高水位的进入落后状态
+  void mark_lagging(std::vector<ClientChannel>& clients) {
+    size_t high_water = m_client_high_water;
+    if (high_water == 0) return;
+    for (ClientChannel& client : clients) {
+      if (client.lagging) continue;
+      server::connection_ptr con = get_connection(client.hdl);
+      if (con && con->get_buffered_amount() > high_water) {
+        client.lagging = true;
+        ++m_lagging_clients;
+      }
+    }
+  }
+
+  // 缓冲已降到高水位一半以下的客户端：发出积压的最新状态，恢复正常发送
+  void release_caught_up(std::vector<ClientChannel>& clients,
+                         std::vector<message_ptr>& frames) {
+    for (ClientChannel& client : clients) {
+      if (!client.lagging) continue;
+      server::connection_ptr con = get_connection(client.hdl);
+      if (con && con->get_buffered_amount() > m_client_high_water / 2) {
+        continue;
+      }
+      client.lagging = false;
+      --m_lagging_clients;
+      if (!con) continue;
+
+      std::vector<GeometryBacklog::MessagePtr> pending;
+      client.backlog.take_all(pending);
+      for (const auto& message : pending) {
+        con->send(encode_frame(frames, con, *message, client.deflate));
+      }
+    }
+  }
+
+  server::connection_ptr get_connection(const connection_hdl& hdl) {
+    websocketpp::lib::error_code ec;
+    server::connection_ptr con = m_server.get_con_from_hdl(hdl, ec);
+    return ec ? nullptr : con;
+  }
+
+  static bool same_connection(const connection_hdl& a,
+                              const connection_hdl& b) {
+    return !a.owner_before(b) && !b.owner_before(a);
+  }
+
+  message_ptr encode_frame(std::vector<message_ptr>& frames,
+                           const server::connection_ptr& con,
+                           const visualization::VisMessage& message,
+                           bool deflate, FrameCache& cache) {
+    if (!cache.plain) cache.plain = serialize_frame(frames, con, message);
+    if (!deflate) return cache.plain;
+    if (!cache.deflated) cache.deflated = deflate_frame(frames, con, cache.plain);
+    return cache.deflated;
+  }
+
+  message_ptr encode_frame(std::vector<message_ptr>& frames,
+                           const server::connection_ptr& con,
+                           const visualization::VisMessage& message,
+                           bool deflate) {
+    FrameCache cache;
+    return encode_frame(frames, con, message, deflate, cache);
+  }
+
+  // 压缩原文帧的负载，帧头置 RSV1 表示压缩（RFC 7692 6.1）。
+  // 小于阈值的消息（位姿更新等）和压缩后不更小的消息仍发原文帧
+  message_ptr deflate_frame(std::vector<message_ptr>& frames,
+                            const server::connection_ptr& con,
+                            const message_ptr& plain) {
+    const std::string& payload = plain->get_payload();
+    if (!m_compression_enabled || payload.size() < m_compress_min_bytes) {
+      return plain;
+    }
+    message_ptr frame = acquire_frame(frames, con, payload.size());
+    std::string& compressed = frame->get_raw_payload();
+    if (!m_deflater.compress(reinterpret_cast<const uint8_t*>(payload.data()),
+                             payload.size(), m_compress_level, &compressed)) {
+      return plain;
+    }
+    ++m_compressed;
+    m_compressed_input_bytes += payload.size();
+    m_compressed_output_bytes += compressed.size();
+    frame->set_header(make_frame_header(compressed.size(), true));
+    frame->set_prepared(true);
+    return frame;
+  }
+
+  // 直接序列化进帧的负载，并自行写好帧头标记为已就绪，
+  // websocketpp 不再把负载拷贝到新的发送缓冲区
+  static message_ptr serialize_frame(std::vector<message_ptr>& frames,
+                                     const server::connection_ptr& con,
+                                     const visualization::VisMessage& message) {
+    size_t size = message.ByteSizeLong();
+    message_ptr frame = acquire_frame(frames, con, size);
+    std::string& payload = frame->get_raw_payload();
+    payload.resize(size);
+    message.SerializeWithCachedSizesToArray(
+        reinterpret_cast<uint8_t*>(&payload[0]));
+    frame->set_header(make_frame_header(size));
+    frame->set_prepared(true);
+    // std::cout << "📤 发送消息大小: " << size << " 字节" << std::endl;
+    return frame;
+  }
+
+  // 取一个 websocketpp 已经写完（只剩我们持有引用）的帧复用，
+  // 没有空闲帧时新建；负载 std::string 的容量随帧保留
+  static message_ptr acquire_frame(std::vector<message_ptr>& frames,
+                                   const server::connection_ptr& con,
+                                   size_t size) {
+    for (const message_ptr& frame : frames) {
+      if (frame.use_count() == 1) return frame;
+    }
+    message_ptr frame =
+        con->get_message(websocketpp::frame::opcode::binary, size);
+    if (frames.size() < kMaxPooledFrames) {
+      frames.push_back(frame);
+    }
+    return frame;
+  }
+
+  // 服务端发往客户端的二进制帧头（RFC 6455 5.2：FIN，不加掩码）
+  static std::string make_frame_header(size_t size, bool compressed = false) {
+    char header[10];
+    size_t len = 0;
+    header[len++] = static_cast<char>(
+        0x80 | (compressed ? 0x40 : 0) | websocketpp::frame::opcode::binary);
+    if (size < 126) {
+      header[len++] = static_cast<char>(size);
+    } else if (size <= 0xffff) {
+      header[len++] = 126;
+      header[len++] = static_cast<char>(size >> 8);
+      header[len++] = static_cast<char>(size);
+    } else {
+      header[len++] = 127;
+      for (int shift = 56; shift >= 0; shift -= 8) {
+        header[len++] = static_cast<char>(static_cast<uint64_t>(size) >> shift);
+      }
+    }
+    return std::string(header, len);
+  }
 
-    // 为所有已创建的窗口发送创建命令和现有对象
-    for (const auto& [window_uuid, window_info] : m_windows) {
-      send_window_create_command(window_uuid, window_info.display_name,
-                                 window_info.is_3d);
-      send_existing_objects(window_uuid, window_info.is_3d);
+  // 握手时协商 permessage-deflate，结果留在响应头中，
+  // 发送线程在客户端加入时据此决定是否为它压缩
+  bool on_validate(connection_hdl hdl) {
+    server::connection_ptr con = get_connection(hdl);
+    if (con && m_compression_enabled &&
+        FrameDeflater::offered(
+            con->get_request_header("Sec-WebSocket-Extensions"))) {
+      con->append_header("Sec-WebSocket-Extensions",
+                         FrameDeflater::response_header());
+    }
+    return true;
+  }
+
+  void on_open(connection_hdl hdl) {
+    auto replay = std::make_shared<ReplayState>();
+    replay->connection = hdl;
+    size_t window_count;
+    size_t client_count;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      // 攒着的批量添加中的图元也在下面的快照里，先发给已有的客户端
+      send_all_pending_adds();
+      m_clients.insert(hdl);
+      client_count = m_clients.size();
+      OutgoingMessage joined;
+      joined.target = SendTarget::CLIENT_JOINED;
+      joined.connection = hdl;
+      m_send_queue.push(std::move(joined));
+
+      // 窗口创建命令很少，持锁时直接发出，之后的实时命令都能找到目标窗口；
+      // 图元只拷贝句柄，由 replay_next_chunk 分块发送
+      window_count = m_windows.size();
+      for (auto& [window_uuid, window_info] : m_windows) {
+        send_to(hdl, make_window_create_message(window_info));
+        if (!window_info.materials.empty() || !window_info.meshes.empty()) {
+          send_to(hdl, make_definitions(window_info));
+        }
+        if (!window_info.objects.empty()) {
+          replay->windows.push_back(
+              {window_uuid, window_info.is_3d, window_info.quantizer,
+               window_info.objects});
+        }
+      }
     }
 
-    std::cout << "✅ 客户端连接成功，已发送 " << m_windows.size()
-              << " 个窗口信息" << std::endl;
+    if (!replay->windows.empty()) {
+      m_server.get_io_service().post(
+          [this, replay]() { replay_next_chunk(replay); });
+    }
+    std::cout << "✅ 客户端连接成功（当前 " << client_count
+              << " 个），已发送 " << window_count << " 个窗口信息，开始重放图元"
+              << std::endl;
   }
 
   void on_close(connection_hdl hdl) {
-    (void)hdl;  // 明确标记参数未使用
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_has_connection = false;
+    m_clients.erase(hdl);
+    OutgoingMessage left;
+    left.target = SendTarget::CLIENT_LEFT;
+    left.connection = hdl;
+    m_send_queue.push(std::move(left));
+    // 最后一个客户端断开后，攒着的添加命令已无人接收，新连接建立时会整体重放
+    if (!has_clients()) discard_pending_adds();
     std::cout << "Client disconnected." << std::endl;
   }
 
+  void discard_pending_adds() {
+    for (auto& [window_uuid, window] : m_windows) {
+      window.pending_adds = OutgoingMessage();
+      window.pending_bytes = 0;
+    }
+  }
+
 };  // ServerImpl 类定义结束
 
 // --- VisualizationServer 实现 ---
@@ -1195,22 +2965,41 @@ VisualizationServer& VisualizationServer::operator=(
 // Public API forwarding
 void VisualizationServer::run() { m_impl->run(); }
 void VisualizationServer::stop() { m_impl->stop(); }
+bool VisualizationServer::start_recording(const std::string& path_prefix,
+                                          size_t rotate_bytes) {
+  return m_impl->start_recording(path_prefix, rotate_bytes);
+}
+void VisualizationServer::stop_recording() { m_impl->stop_recording(); }
 std::vector<std::string> VisualizationServer::get_connected_windows() {
   return m_impl->get_connected_windows();
 }
 bool VisualizationServer::is_connected() const {
   return m_impl->is_connected();
 }
+size_t VisualizationServer::get_client_count() const {
+  return m_impl->get_client_count();
+}
 void VisualizationServer::add(std::shared_ptr<Vis::Observable> obj,
                               const std::string& name,
                               const Vis::MaterialProps& material, bool is_3d) {
-  m_impl->add(obj, name, convert_material(material), is_3d);
+  m_impl->add(obj, name, material, is_3d);
 }
 
 void VisualizationServer::add(const Vis::Observable& obj,
                               const std::string& name,
                               const Vis::MaterialProps& material, bool is_3d) {
-  m_impl->add(obj, name, convert_material(material), is_3d);
+  m_impl->add(obj, name, material, is_3d);
+}
+
+void VisualizationServer::set_material(const Vis::Observable& obj,
+                                       const Vis::MaterialProps& material) {
+  m_impl->set_material(obj, material);
+}
+
+void VisualizationServer::set_material(
+    const std::shared_ptr<Vis::Observable>& obj,
+    const Vis::MaterialProps& material) {
+  if (obj) m_impl->set_material(*obj, material);
 }
 
 void VisualizationServer::clear_static(const std::string& name, bool is_3d) {
@@ -1234,9 +3023,33 @@ void VisualizationServer::set_auto_update_policy(bool enabled, int threshold,
   m_impl->set_auto_update_policy(enabled, threshold, interval_ms);
 }
 
-bool VisualizationServer::create_window(const std::string& name,
-                                        const bool& is_3d) {
-  m_impl->create_window(name, is_3d);
+void VisualizationServer::set_send_queue_policy(Vis::SendOverflowPolicy policy,
+                                                size_t capacity) {
+  m_impl->set_send_queue_policy(policy, capacity);
+}
+
+Vis::SendQueueStats VisualizationServer::get_send_queue_stats() const {
+  return m_impl->get_send_queue_stats();
+}
+void VisualizationServer::set_client_buffer_limit(size_t high_water_bytes) {
+  m_impl->set_client_buffer_limit(high_water_bytes);
+}
+void VisualizationServer::set_compression(bool enabled, size_t min_bytes,
+                                          int level) {
+  m_impl->set_compression(enabled, min_bytes, level);
+}
+
+void VisualizationServer::begin_batch() { m_impl->begin_batch(); }
+void VisualizationServer::end_batch() { m_impl->end_batch(); }
+uint64_t VisualizationServer::begin_frame(double sim_time) {
+  return m_impl->begin_frame(sim_time);
+}
+void VisualizationServer::end_frame() { m_impl->end_frame(); }
+
+bool VisualizationServer::create_window(
+    const std::string& name, const bool& is_3d,
+    const Vis::Quantization& quantization) {
+  return m_impl->create_window(name, is_3d, quantization);
 }
 
 bool VisualizationServer::remove_window(const std::string& name,
@@ -1288,55 +3101,3 @@ size_t VisualizationServer::get_windows_number() const {
 size_t VisualizationServer::get_observables_number() const {
   return m_impl->get_observables_number();
 }
-
-visualization::Material VisualizationServer::convert_material(
-    const Vis::MaterialProps& props) {
-  visualization::Material mat;
-  mat.mutable_color()->set_r(props.color.r);
-  mat.mutable_color()->set_g(props.color.g);
-  mat.mutable_color()->set_b(props.color.b);
-  mat.mutable_color()->set_a(props.color.a);
-  mat.mutable_fill_color()->set_r(props.fill_color.r);
-  mat.mutable_fill_color()->set_g(props.fill_color.g);
-  mat.mutable_fill_color()->set_b(props.fill_color.b);
-  mat.mutable_fill_color()->set_a(props.fill_color.a);
-  mat.set_point_size(props.point_size);
-  mat.set_line_width(props.line_width);
-  mat.set_legend(props.legend);
-  mat.set_filled(props.filled);
-  // 转换点形状
-  switch (props.point_shape) {
-    case Vis::MaterialProps::PointShape::SQUARE:
-      mat.set_point_shape(visualization::Material::SQUARE);
-      break;
-    case Vis::MaterialProps::PointShape::CIRCLE:
-      mat.set_point_shape(visualization::Material::CIRCLE);
-      break;
-    case Vis::MaterialProps::PointShape::CROSS:
-      mat.set_point_shape(visualization::Material::CROSS);
-      break;
-    case Vis::MaterialProps::PointShape::DIAMOND:
-      mat.set_point_shape(visualization::Material::DIAMOND);
-      break;
-    default:
-      mat.set_point_shape(visualization::Material::CIRCLE);
-  }
-
-  // 转换线型
-  switch (props.line_style) {
-    case Vis::MaterialProps::LineStyle::SOLID:
-      mat.set_line_style(visualization::Material::SOLID);
-      break;
-    case Vis::MaterialProps::LineStyle::DASHED:
-      mat.set_line_style(visualization::Material::DASHED);
-      break;
-    case Vis::MaterialProps::LineStyle::DOTTED:
-      mat.set_line_style(visualization::Material::DOTTED);
-      break;
-    default:
-      mat.set_line_style(visualization::Material::SOLID);
-  }
-
-  mat.set_legend_on(props.legend_on);
-  return mat;
-}
\ No newline at end of file
@@ -0,0 +1,228 @@
+// vis_stream/examples/benchmarks/bench_client.h
+//
+// 基准程序共用的最小 WebSocket 客户端：在后台线程完成握手后持续读取，
+// 只解析帧头，统计收到的帧数和负载字节数（压缩帧按压缩后计）。负载默认直接丢弃，
+// 需要检查收到的内容时可以保留下来。
+// 另有各基准程序共用的计时和等待辅助函数。
+#pragma once
+
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <atomic>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <vis_stream.h>
+
+class BenchClient {
+ public:
+  // thread_init 在客户端线程启动时调用，便于基准程序标记该线程；
+  // offer_deflate 为 true 时像浏览器一样在握手中提出 permessage-deflate；
+  // keep_payloads 为 true 时保留每帧的负载，由 take_payloads 取走
+  // （不与 offer_deflate 同用，压缩帧的负载不解压）
+  explicit BenchClient(uint16_t port, void (*thread_init)() = nullptr,
+                       bool offer_deflate = false, bool keep_payloads = false)
+      : m_port(port),
+        m_offer_deflate(offer_deflate),
+        m_keep_payloads(keep_payloads),
+        m_thread([this, thread_init]() {
+          if (thread_init) thread_init();
+          run();
+        }) {}
+
+  ~BenchClient() { close(); }
+
+  BenchClient(const BenchClient&) = delete;
+  BenchClient& operator=(const BenchClient&) = delete;
+
+  void wait_connected() const {
+    while (!m_connected) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+  }
+
+  // 负载收完才计入 frames
+  uint64_t frames() const { return m_frames; }
+  uint64_t bytes() const { return m_bytes; }
+
+  // 取走目前收齐的各帧负载，按到达顺序
+  std::vector<std::string> take_payloads() {
+    std::lock_guard<std::mutex> lock(m_payloads_mutex);
+    return std::exchange(m_payloads, {});
+  }
+
+  // 等到累计收到 frames 帧为止
+  void wait_frames(uint64_t frames) const {
+    while (m_frames < frames) {
+      std::this_thread::yield();
+    }
+  }
+
+  // 暂停读取，模拟处理不过来的慢客户端；数据会积压在内核和服务端缓冲中
+  void pause() { m_paused = true; }
+  void resume() { m_paused = false; }
+
+  // 主动断开：shutdown 会唤醒阻塞中的读取
+  void close() {
+    if (!m_thread.joinable()) return;
+    while (!m_connected && !m_failed) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    if (m_connected) {
+      ::shutdown(m_native_handle, SHUT_RDWR);
+    }
+    m_thread.join();
+  }
+
+ private:
+  void run() {
+    using boost::asio::ip::tcp;
+    boost::asio::io_context io;
+    tcp::socket socket(io);
+    boost::system::error_code ec;
+    for (int retry = 0; retry < 100; ++retry) {
+      socket.connect({boost::asio::ip::make_address("127.0.0.1"), m_port}, ec);
+      if (!ec) break;
+      socket.close();
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    if (ec) {
+      std::fprintf(stderr, "connect failed: %s\n", ec.message().c_str());
+      std::exit(1);
+    }
+
+    const std::string request =
+        "GET / HTTP/1.1\r\n"
+        "Host: 127.0.0.1\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+        "Sec-WebSocket-Version: 13\r\n" +
+        std::string(m_offer_deflate
+                        ? "Sec-WebSocket-Extensions: permessage-deflate; "
+                          "client_max_window_bits\r\n"
+                        : "") +
+        "\r\n";
+    boost::asio::write(socket, boost::asio::buffer(request), ec);
+    boost::asio::streambuf response;
+    size_t header_size =
+        boost::asio::read_until(socket, response, "\r\n\r\n", ec);
+    if (ec) {
+      std::fprintf(stderr, "handshake failed: %s\n", ec.message().c_str());
+      m_failed = true;
+      return;
+    }
+    response.consume(header_size);
+    m_native_handle = socket.native_handle();
+    m_connected = true;
+
+    // 握手响应之后可能已经读入了部分帧数据
+    std::vector<uint8_t> buffer(1 << 16);
+    size_t extra = response.size();
+    if (extra > 0) {
+      boost::asio::buffer_copy(boost::asio::buffer(buffer), response.data());
+      consume(buffer.data(), extra);
+    }
+    while (true) {
+      while (m_paused) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      size_t n = socket.read_some(boost::asio::buffer(buffer), ec);
+      if (ec) break;
+      consume(buffer.data(), n);
+    }
+  }
+
+  // 服务端发来的帧不带掩码：2 字节基本头 + 可选的 2/8 字节扩展长度
+  void consume(const uint8_t* data, size_t size) {
+    while (size > 0) {
+      if (m_payload_left > 0) {
+        size_t skip = static_cast<size_t>(
+            std::min<uint64_t>(m_payload_left, size));
+        if (m_keep_payloads) {
+          m_payload.append(reinterpret_cast<const char*>(data), skip);
+        }
+        m_payload_left -= skip;
+        data += skip;
+        size -= skip;
+        if (m_payload_left == 0) finish_frame();
+        continue;
+      }
+      m_header[m_header_len++] = *data++;
+      --size;
+      if (m_header_len == 2) {
+        uint8_t len7 = m_header[1] & 0x7f;
+        m_header_need = len7 == 126 ? 4 : (len7 == 127 ? 10 : 2);
+      }
+      if (m_header_len < 2 || m_header_len < m_header_need) continue;
+
+      uint64_t length = m_header[1] & 0x7f;
+      if (length >= 126) {
+        length = 0;
+        for (size_t i = 2; i < m_header_need; ++i) {
+          length = (length << 8) | m_header[i];
+        }
+      }
+      m_header_len = 0;
+      m_payload_left = length;
+      m_bytes += length;
+      if (length == 0) finish_frame();
+    }
+  }
+
+  void finish_frame() {
+    if (m_keep_payloads) {
+      std::lock_guard<std::mutex> lock(m_payloads_mutex);
+      m_payloads.push_back(std::move(m_payload));
+      m_payload.clear();
+    }
+    ++m_frames;
+  }
+
+  uint16_t m_port;
+  bool m_offer_deflate;
+  bool m_keep_payloads;
+  std::atomic<bool> m_connected{false};
+  std::atomic<bool> m_failed{false};
+  std::atomic<bool> m_paused{false};
+  int m_native_handle = -1;
+  std::atomic<uint64_t> m_frames{0};
+  std::atomic<uint64_t> m_bytes{0};
+
+  uint8_t m_header[10];
+  size_t m_header_len = 0;
+  size_t m_header_need = 2;
+  uint64_t m_payload_left = 0;
+  std::string m_payload;  // 正在接收的负载，仅 keep_payloads 时使用
+  std::mutex m_payloads_mutex;
+  std::vector<std::string> m_payloads;
+
+  std::thread m_thread;  // 最后初始化，线程启动时其余成员已就绪
+};
+
+inline double to_ms(std::chrono::steady_clock::duration d) {
+  return std::chrono::duration<double, std::milli>(d).count();
+}
+
+// 已入队但客户端还没收到的消息数
+inline uint64_t in_flight(VisualizationServer& server, BenchClient& client) {
+  return server.get_send_queue_stats().enqueued - client.frames();
+}
+
+// 等到客户端收齐已入队的全部消息。offset 为开始计量前已有的差值
+// （例如连接时重放的场景），按有符号数比较，客户端多收时也能返回
+inline void wait_drained(VisualizationServer& server, BenchClient& client,
+                         uint64_t offset = 0) {
+  while (static_cast<int64_t>(in_flight(server, client) - offset) > 0) {
+    std::this_thread::yield();
+  }
+}
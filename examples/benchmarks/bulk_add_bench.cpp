@@ -0,0 +1,85 @@
+// vis_stream/examples/benchmarks/bulk_add_bench.cpp
+//
+// 对比逐个 add 与 add_batch 加载一张大静态地图的开销：
+// 统计发出的消息数、字节数，以及从第一次 add 到客户端收齐全部数据的耗时。
+//
+// 用法: bulk_add_bench [objects]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "bench_client.h"
+
+namespace {
+
+constexpr const char* kWindowName = "map";
+constexpr uint16_t kPort = 9104;
+
+template <typename AddFn>
+void measure(const char* label, VisualizationServer& server,
+             BenchClient& client, AddFn&& add_all) {
+  wait_drained(server, client);
+  uint64_t messages_before = server.get_send_queue_stats().enqueued;
+  uint64_t frames_before = client.frames();
+  uint64_t bytes_before = client.bytes();
+
+  auto start = std::chrono::steady_clock::now();
+  add_all();
+  uint64_t messages = server.get_send_queue_stats().enqueued - messages_before;
+  client.wait_frames(frames_before + messages);
+  auto end = std::chrono::steady_clock::now();
+
+  double ms = std::chrono::duration<double, std::milli>(end - start).count();
+  std::printf("%-10s %12llu %14llu %12.1f\n", label,
+              static_cast<unsigned long long>(messages),
+              static_cast<unsigned long long>(client.bytes() - bytes_before),
+              ms);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t object_count = 30000;
+  if (argc > 1) object_count = std::strtoull(argv[1], nullptr, 10);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.run();
+  server.create_window(kWindowName, false);
+
+  BenchClient client(kPort);
+  client.wait_connected();
+  while (!server.is_connected()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  std::vector<Vis::Point2D> map_points;
+  map_points.reserve(object_count);
+  for (size_t i = 0; i < object_count; ++i) {
+    map_points.push_back(*Vis::Point2D::create(
+        {static_cast<float>(i % 200), static_cast<float>(i / 200)}));
+  }
+  Vis::MaterialProps material;
+
+  std::printf("%-10s %12s %14s %12s\n", "mode", "messages", "bytes", "ms");
+  measure("add", server, client, [&]() {
+    for (const auto& point : map_points) {
+      server.add(point, kWindowName, material, false);
+    }
+  });
+
+  server.clear(kWindowName, false);
+
+  measure("add_batch", server, client, [&]() {
+    server.add_batch(map_points, kWindowName, material, false);
+  });
+
+  client.close();
+  server.stop();
+  return 0;
+}
@@ -0,0 +1,162 @@
+// vis_stream/examples/benchmarks/compression_bench.cpp
+//
+// permessage-deflate 的 CPU 与带宽取舍：先铺一张大静态场景（栅格点、
+// 折线、多边形），再以不同压缩级别各接入一个提出压缩的客户端，
+// 统计重放的字节数、耗时和进程 CPU 时间；最后在已连接时批量添加一批图元，
+// 统计同样的数据。级别 0 表示关闭压缩。
+//
+// 用法: compression_bench [points] [min_bytes]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "bench_client.h"
+
+namespace {
+
+constexpr const char* kWindowName = "map";
+constexpr uint16_t kPort = 9110;
+constexpr int kLevels[] = {0, 1, 3, 6, 9};
+
+using Clock = std::chrono::steady_clock;
+
+double cpu_ms() { return 1000.0 * std::clock() / CLOCKS_PER_SEC; }
+
+void wait_disconnected(VisualizationServer& server) {
+  while (server.is_connected()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+}
+
+// 客户端是唯一的连接，此后入队的每条消息都恰好是它收到的一帧。
+// 等到它收齐全部入队消息，且 100ms 内没有新消息
+uint64_t frames_offset(VisualizationServer& server, BenchClient& client) {
+  return server.get_send_queue_stats().enqueued - client.frames();
+}
+
+void wait_quiescent(VisualizationServer& server, BenchClient& client,
+                    uint64_t offset) {
+  while (true) {
+    uint64_t frames = client.frames();
+    if (offset + frames == server.get_send_queue_stats().enqueued) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      if (client.frames() == frames &&
+          server.get_send_queue_stats().enqueued == offset + frames) {
+        return;
+      }
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+std::vector<Vis::Line2D> make_lines(size_t count, float offset) {
+  std::vector<Vis::Line2D> lines;
+  for (size_t i = 0; i < count; ++i) {
+    std::vector<Vis::Vec2> points;
+    for (int k = 0; k < 100; ++k) {
+      float t = 0.1f * k;
+      points.push_back({offset + t, static_cast<float>(i) + std::sin(t)});
+    }
+    lines.push_back(*Vis::Line2D::create(points));
+  }
+  return lines;
+}
+
+void print_row(const char* phase, int level, uint64_t bytes, double ms,
+               double cpu, uint64_t baseline) {
+  std::printf("%-7s level=%d bytes=%llu ratio=%.3f ms=%.1f cpu_ms=%.1f\n",
+              phase, level, static_cast<unsigned long long>(bytes),
+              static_cast<double>(bytes) / baseline, ms, cpu);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t point_count = 100000;
+  size_t min_bytes = 1024;
+  if (argc > 1) point_count = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2) min_bytes = std::strtoull(argv[2], nullptr, 10);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.run();
+  server.create_window(kWindowName, false);
+
+  std::vector<Vis::Point2D> map_points;
+  map_points.reserve(point_count);
+  for (size_t i = 0; i < point_count; ++i) {
+    map_points.push_back(*Vis::Point2D::create(
+        {static_cast<float>(i % 500), static_cast<float>(i / 500)}));
+  }
+  std::vector<Vis::Polygon> polygons;
+  for (int i = 0; i < 1000; ++i) {
+    float x = static_cast<float>(i % 50) * 10.f;
+    float y = static_cast<float>(i / 50) * 10.f;
+    polygons.push_back(
+        *Vis::Polygon::create({{x, y}, {x + 4, y}, {x + 4, y + 3}, {x, y + 3}}));
+  }
+  Vis::MaterialProps material;
+  server.add_batch(map_points, kWindowName, material, false);
+  server.add_batch(polygons, kWindowName, material, false);
+  server.add_batch(make_lines(1000, 0.f), kWindowName, material, false);
+
+  std::printf("points=%zu polygons=1000 lines=1000x100 min_bytes=%zu\n",
+              point_count, min_bytes);
+  uint64_t replay_baseline = 0;
+  uint64_t bulk_baseline = 0;
+  for (int level : kLevels) {
+    server.set_compression(level > 0, min_bytes, level);
+    BenchClient client(kPort, nullptr, true);
+
+    // 接入时重放整个场景
+    uint64_t offset = frames_offset(server, client);
+    double cpu_start = cpu_ms();
+    auto start = Clock::now();
+    client.wait_connected();
+    wait_quiescent(server, client, offset);
+    double ms = to_ms(Clock::now() - start) - 100.0;
+    double cpu = cpu_ms() - cpu_start;
+    uint64_t bytes = client.bytes();
+    if (level == 0) replay_baseline = bytes;
+    print_row("replay", level, bytes, ms, cpu, replay_baseline);
+
+    // 已连接时批量添加
+    uint64_t bytes_before = client.bytes();
+    offset = frames_offset(server, client);
+    cpu_start = cpu_ms();
+    start = Clock::now();
+    server.add_batch(make_lines(1000, 600.f), kWindowName, material, false);
+    wait_quiescent(server, client, offset);
+    ms = to_ms(Clock::now() - start) - 100.0;
+    cpu = cpu_ms() - cpu_start;
+    bytes = client.bytes() - bytes_before;
+    if (level == 0) bulk_baseline = bytes;
+    print_row("bulk", level, bytes, ms, cpu, bulk_baseline);
+
+    client.close();
+    wait_disconnected(server);
+    server.clear_static(kWindowName, false);
+    server.add_batch(map_points, kWindowName, material, false);
+    server.add_batch(polygons, kWindowName, material, false);
+    server.add_batch(make_lines(1000, 0.f), kWindowName, material, false);
+  }
+
+  Vis::SendQueueStats stats = server.get_send_queue_stats();
+  std::printf("compressed frames=%llu in=%llu out=%llu\n",
+              static_cast<unsigned long long>(stats.compressed),
+              static_cast<unsigned long long>(stats.compressed_input_bytes),
+              static_cast<unsigned long long>(stats.compressed_output_bytes));
+
+  server.stop();
+  return 0;
+}
@@ -0,0 +1,102 @@
+// vis_stream/examples/benchmarks/edit_scope_bench.cpp
+//
+// 多字段修改的通知开销：objects 个 Box2D 每轮各改 4 个字段（中心、宽度、
+// 前后长度），分别测量逐个 setter 通知、每个图元一个 Edit、整轮一个 EditScope
+// 三种写法下平均每个图元的修改耗时（纳秒，不含 drawnow）。
+// 另开一个线程持续修改同一窗口中的图元，模拟锁被争用的情况。
+//
+// 用法: edit_scope_bench [objects] [rounds]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr const char* kWindowName = "edit";
+constexpr uint16_t kPort = 9113;
+
+enum class Mode { PLAIN, OBJECT_EDIT, THREAD_SCOPE };
+
+void touch(Vis::Box2D& box, size_t round) {
+  float t = static_cast<float>(round);
+  box.set_center(*Vis::Pose2D::create({t, 0.f}, 0.f));
+  box.set_width(1.f + t);
+  box.set_length_front(2.f + t);
+  box.set_length_rear(1.f + t);
+}
+
+double measure(VisualizationServer& server,
+               std::vector<std::shared_ptr<Vis::Box2D>>& boxes, size_t rounds,
+               Mode mode) {
+  std::chrono::steady_clock::duration total{};
+  for (size_t round = 0; round < rounds; ++round) {
+    auto start = std::chrono::steady_clock::now();
+    if (mode == Mode::THREAD_SCOPE) {
+      Vis::EditScope scope;
+      for (auto& box : boxes) touch(*box, round);
+    } else if (mode == Mode::OBJECT_EDIT) {
+      for (auto& box : boxes) {
+        auto edit = box->edit();
+        touch(*box, round);
+      }
+    } else {
+      for (auto& box : boxes) touch(*box, round);
+    }
+    total += std::chrono::steady_clock::now() - start;
+    server.drawnow(kWindowName, false);
+  }
+  return std::chrono::duration<double, std::nano>(total).count() /
+         static_cast<double>(boxes.size() * rounds);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t objects = 1000;
+  size_t rounds = 1000;
+  if (argc > 1) objects = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2) rounds = std::strtoull(argv[2], nullptr, 10);
+
+  // 不启动网络线程，刷新只构建消息
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.create_window(kWindowName, false);
+
+  Vis::MaterialProps material;
+  std::vector<std::shared_ptr<Vis::Box2D>> boxes;
+  for (size_t i = 0; i < objects; ++i) {
+    boxes.push_back(Vis::Box2D::create());
+    server.add(boxes.back(), kWindowName, material, false);
+  }
+
+  auto other = Vis::Pose2D::create();
+  server.add(other, kWindowName, material, false);
+  std::atomic<bool> stop{false};
+  std::thread contender([&]() {
+    for (float t = 0; !stop; t += 1.f) other->set_position({t, 0.f});
+  });
+
+  const struct {
+    const char* name;
+    Mode mode;
+  } kModes[] = {{"setters", Mode::PLAIN},
+                {"Observable::Edit", Mode::OBJECT_EDIT},
+                {"EditScope", Mode::THREAD_SCOPE}};
+  for (const auto& m : kModes) {
+    measure(server, boxes, rounds / 10 + 1, m.mode);  // 预热
+    double ns = measure(server, boxes, rounds, m.mode);
+    std::printf("%-18s %8.1f ns/object\n", m.name, ns);
+  }
+
+  stop = true;
+  contender.join();
+  return 0;
+}
@@ -0,0 +1,99 @@
+// vis_stream/examples/benchmarks/fanout_bench.cpp
+//
+// 多客户端广播吞吐：分别接入 1/8/32 个客户端，连续刷新一批运动图元，
+// 统计从第一次 drawnow 到每个客户端都收齐全部消息的耗时。
+// 每条消息只序列化一次，各连接共享同一个帧，耗时应主要随网络写入增长。
+//
+// 用法: fanout_bench [objects] [flushes]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "bench_client.h"
+
+namespace {
+
+constexpr const char* kWindowName = "fanout";
+constexpr uint16_t kPort = 9106;
+
+void wait_client_count(VisualizationServer& server, size_t count) {
+  while (server.get_client_count() != count) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t object_count = 1000;
+  size_t flushes = 500;
+  if (argc > 1) object_count = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2) flushes = std::strtoull(argv[2], nullptr, 10);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.run();
+  server.create_window(kWindowName, false);
+
+  Vis::MaterialProps material;
+  std::vector<std::shared_ptr<Vis::Pose2D>> objects;
+  for (size_t i = 0; i < object_count; ++i) {
+    objects.push_back(Vis::Pose2D::create({static_cast<float>(i), 0.f}, 0.f));
+    server.add(objects.back(), kWindowName, material, false);
+  }
+
+  std::printf("%-8s %10s %14s %10s %14s\n", "clients", "messages",
+              "bytes/client", "ms", "MB/s (total)");
+  size_t round = 0;
+  for (size_t client_count : {1, 8, 32}) {
+    std::vector<std::unique_ptr<BenchClient>> clients;
+    for (size_t i = 0; i < client_count; ++i) {
+      clients.push_back(std::make_unique<BenchClient>(kPort));
+      clients.back()->wait_connected();
+    }
+    wait_client_count(server, client_count);
+    // 等每个客户端都收完自己的场景重放
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    std::vector<uint64_t> frames_before;
+    std::vector<uint64_t> bytes_before;
+    for (const auto& client : clients) {
+      frames_before.push_back(client->frames());
+      bytes_before.push_back(client->bytes());
+    }
+
+    uint64_t messages_before = server.get_send_queue_stats().enqueued;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < flushes; ++i, ++round) {
+      for (size_t j = 0; j < objects.size(); ++j) {
+        objects[j]->set_position(
+            {static_cast<float>(j), static_cast<float>(round % 100)});
+      }
+      server.drawnow(kWindowName, false);
+    }
+    uint64_t messages = server.get_send_queue_stats().enqueued - messages_before;
+    for (size_t i = 0; i < clients.size(); ++i) {
+      clients[i]->wait_frames(frames_before[i] + messages);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+    uint64_t bytes = clients[0]->bytes() - bytes_before[0];
+    std::printf("%-8zu %10llu %14llu %10.1f %14.1f\n", client_count,
+                static_cast<unsigned long long>(messages),
+                static_cast<unsigned long long>(bytes), ms,
+                static_cast<double>(bytes * client_count) / 1e3 / ms);
+
+    for (auto& client : clients) client->close();
+    wait_client_count(server, 0);
+  }
+
+  server.stop();
+  return 0;
+}
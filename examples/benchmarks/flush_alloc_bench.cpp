@@ -0,0 +1,138 @@
+// vis_stream/examples/benchmarks/flush_alloc_bench.cpp
+//
+// 统计稳态下每次 drawnow 刷新产生的堆分配次数。
+// 程序内置一个最小的 WebSocket 客户端连上服务端并丢弃收到的数据，
+// 使刷新走完整的 构建消息 -> 入队 -> 序列化 -> 写入连接 路径。
+// 全局 operator new 被替换为计数版本：
+//   caller  —— 调用 drawnow 的线程（构建消息、入队）
+//   process —— 除内置客户端外的全部线程（含发送线程和网络线程）
+// 预期 caller 为 0；process 中剩余的分配来自传输层内部。
+//
+// 用法: flush_alloc_bench [objects] [flushes]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "bench_client.h"
+
+namespace {
+
+std::atomic<size_t> g_process_allocs{0};
+thread_local size_t t_thread_allocs = 0;
+thread_local bool t_ignored = false;  // 内置客户端线程不计入
+
+void* counted_alloc(std::size_t size) {
+  ++t_thread_allocs;
+  if (!t_ignored) g_process_allocs.fetch_add(1, std::memory_order_relaxed);
+  if (void* p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+
+}  // namespace
+
+void* operator new(std::size_t size) { return counted_alloc(size); }
+void* operator new[](std::size_t size) { return counted_alloc(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  try {
+    return counted_alloc(size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+  return operator new(size, tag);
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+constexpr const char* kWindowName = "bench";
+constexpr uint16_t kPort = 9103;
+
+void mark_client_thread() { t_ignored = true; }
+
+void wait_until_sent(VisualizationServer& server) {
+  while (server.get_send_queue_stats().depth > 0) {
+    std::this_thread::yield();
+  }
+}
+
+void move_all(std::vector<std::shared_ptr<Vis::Pose2D>>& objects,
+              size_t round) {
+  for (size_t i = 0; i < objects.size(); ++i) {
+    objects[i]->set_position(
+        {static_cast<float>(i), static_cast<float>(round % 100)});
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t object_count = 1000;
+  size_t flushes = 2000;
+  if (argc > 1) object_count = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2) flushes = std::strtoull(argv[2], nullptr, 10);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.run();
+  server.create_window(kWindowName, false);
+
+  BenchClient client(kPort, mark_client_thread);
+  client.wait_connected();
+  while (!server.is_connected()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  Vis::MaterialProps material;
+  std::vector<std::shared_ptr<Vis::Pose2D>> objects;
+  for (size_t i = 0; i < object_count; ++i) {
+    objects.push_back(Vis::Pose2D::create({static_cast<float>(i), 0.f}, 0.f));
+    server.add(objects.back(), kWindowName, material, false);
+  }
+
+  // 预热：让 Arena 首块、帧缓冲和各容器长到稳态容量
+  size_t round = 0;
+  for (; round < flushes / 4 + 10; ++round) {
+    move_all(objects, round);
+    server.drawnow(kWindowName, false);
+    wait_until_sent(server);
+  }
+
+  size_t caller_allocs = 0;
+  size_t process_allocs = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < flushes; ++i, ++round) {
+    move_all(objects, round);
+    size_t caller_before = t_thread_allocs;
+    size_t process_before = g_process_allocs.load();
+    server.drawnow(kWindowName, false);
+    wait_until_sent(server);
+    caller_allocs += t_thread_allocs - caller_before;
+    process_allocs += g_process_allocs.load() - process_before;
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  double us = std::chrono::duration<double, std::micro>(end - start).count();
+  std::printf("objects=%zu flushes=%zu us/flush=%.1f\n", object_count,
+              flushes, us / static_cast<double>(flushes));
+  std::printf("allocs/flush: caller=%.3f process=%.3f\n",
+              static_cast<double>(caller_allocs) / flushes,
+              static_cast<double>(process_allocs) / flushes);
+
+  client.close();
+  server.stop();
+  return 0;
+}
@@ -0,0 +1,133 @@
+// vis_stream/examples/benchmarks/flush_dispatch_bench.cpp
+//
+// 每种图元的刷新开销：同一 3D 窗口中放入 objects 个同类图元，
+// 每轮全部修改后 drawnow，统计 drawnow 中平均每个图元的耗时（纳秒）。
+// 不连接客户端，刷新只构建消息，不入队也不序列化，
+// 测到的是按类型分派并把图元写入命令的开销。折线、轨迹和多边形只有 4 个点。
+//
+// 用法: flush_dispatch_bench [objects] [rounds]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr const char* kWindowName = "dispatch";
+constexpr uint16_t kPort = 9111;
+
+struct Options {
+  size_t objects;
+  size_t rounds;
+};
+
+// make(i) 创建第 i 个图元，touch(obj, round) 修改它使其变脏
+template <typename T>
+void measure(VisualizationServer& server, const Options& options,
+             const char* name,
+             const std::function<std::shared_ptr<T>(size_t)>& make,
+             const std::function<void(T&, size_t)>& touch) {
+  Vis::MaterialProps material;
+  std::vector<std::shared_ptr<T>> objects;
+  for (size_t i = 0; i < options.objects; ++i) {
+    objects.push_back(make(i));
+    server.add(objects.back(), kWindowName, material, true);
+  }
+
+  // 前 1/10 轮预热，不计时
+  size_t warmup = options.rounds / 10;
+  std::chrono::steady_clock::duration total{};
+  for (size_t round = 0; round < warmup + options.rounds; ++round) {
+    for (auto& obj : objects) touch(*obj, round);
+    auto start = std::chrono::steady_clock::now();
+    server.drawnow(kWindowName, true);
+    if (round >= warmup) total += std::chrono::steady_clock::now() - start;
+  }
+  double ns = std::chrono::duration<double, std::nano>(total).count() /
+              static_cast<double>(options.objects * options.rounds);
+  std::printf("%-14s %8.1f ns/object\n", name, ns);
+
+  server.clear(kWindowName, true);
+}
+
+float f(size_t v) { return static_cast<float>(v % 1000); }
+
+std::vector<Vis::Vec2> square(size_t round) {
+  float o = f(round);
+  return {{o, 0}, {o + 1, 0}, {o + 1, 1}, {o, 1}};
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options{1000, 1000};
+  if (argc > 1) options.objects = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2) options.rounds = std::strtoull(argv[2], nullptr, 10);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.create_window(kWindowName, true);
+  std::printf("objects=%zu rounds=%zu\n", options.objects, options.rounds);
+
+  measure<Vis::Point2D>(
+      server, options, "Point2D",
+      [](size_t i) { return Vis::Point2D::create({f(i), 0}); },
+      [](Vis::Point2D& p, size_t r) { p.set_position({f(r), 1}); });
+  measure<Vis::Pose2D>(
+      server, options, "Pose2D",
+      [](size_t i) { return Vis::Pose2D::create({f(i), 0}, 0); },
+      [](Vis::Pose2D& p, size_t r) { p.set_angle(f(r)); });
+  measure<Vis::Circle>(
+      server, options, "Circle",
+      [](size_t i) { return Vis::Circle::create({f(i), 0}, 1); },
+      [](Vis::Circle& p, size_t r) { p.set_radius(f(r) + 1); });
+  measure<Vis::Box2D>(
+      server, options, "Box2D",
+      [](size_t) { return Vis::Box2D::create(); },
+      [](Vis::Box2D& p, size_t r) { p.set_width(f(r) + 1); });
+  measure<Vis::Line2D>(
+      server, options, "Line2D",
+      [](size_t i) { return Vis::Line2D::create(square(i)); },
+      [](Vis::Line2D& p, size_t r) { p.set_points(square(r)); });
+  measure<Vis::Trajectory2D>(
+      server, options, "Trajectory2D",
+      [](size_t) { return Vis::Trajectory2D::create(); },
+      [](Vis::Trajectory2D& p, size_t) {
+        p.set_poses(std::vector<Vis::Box2D>(4, *Vis::Box2D::create()));
+      });
+  measure<Vis::Polygon>(
+      server, options, "Polygon",
+      [](size_t i) { return Vis::Polygon::create(square(i)); },
+      [](Vis::Polygon& p, size_t r) { p.set_vertices(square(r)); });
+  measure<Vis::Point3D>(
+      server, options, "Point3D",
+      [](size_t i) { return Vis::Point3D::create({f(i), 0, 0}); },
+      [](Vis::Point3D& p, size_t r) { p.set_position({f(r), 0, 1}); });
+  measure<Vis::Pose3D>(
+      server, options, "Pose3D",
+      [](size_t i) { return Vis::Pose3D::create({f(i), 0, 0}); },
+      [](Vis::Pose3D& p, size_t r) { p.set_position({f(r), 0, 1}); });
+  measure<Vis::Ball>(
+      server, options, "Ball",
+      [](size_t i) { return Vis::Ball::create({f(i), 0, 0}); },
+      [](Vis::Ball& p, size_t r) { p.set_radius(f(r) + 1); });
+  measure<Vis::Box3D>(
+      server, options, "Box3D",
+      [](size_t) { return Vis::Box3D::create(); },
+      [](Vis::Box3D& p, size_t r) { p.set_lengths(f(r) + 1, 1, 1); });
+  measure<Vis::Line3D>(
+      server, options, "Line3D",
+      [](size_t) { return Vis::Line3D::create(); },
+      [](Vis::Line3D& p, size_t r) {
+        float o = f(r);
+        p.set_points({{o, 0, 0}, {o + 1, 0, 0}, {o + 1, 1, 0}, {o, 1, 0}});
+      });
+  return 0;
+}
@@ -0,0 +1,137 @@
+// vis_stream/examples/benchmarks/frame_bench.cpp
+//
+// 每个仿真步移动 vehicles 辆车：2D 窗口中的车框和轨迹、3D 窗口中的车体。
+// 自动刷新按默认策略开启（阈值 50、间隔 33 ms），对比逐窗口 drawnow 与
+// begin_frame/end_frame 两种写法每步发出的消息数、字节数和耗时。
+// 前者的每条消息都会被客户端立即应用，一步之内可能显示出半帧；
+// 后者整步只在帧提交时应用一次。
+//
+// 用法: frame_bench [vehicles] [steps]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "bench_client.h"
+
+namespace {
+
+constexpr const char* kMapWindow = "frame_map";
+constexpr const char* kSceneWindow = "frame_scene";
+constexpr uint16_t kPort = 9120;
+
+using Clock = std::chrono::steady_clock;
+
+struct Vehicle {
+  std::shared_ptr<Vis::Box2D> box;
+  std::shared_ptr<Vis::Trajectory2D> trajectory;
+  std::shared_ptr<Vis::Box3D> body;
+};
+
+struct Result {
+  double ms = 0.0;
+  double messages = 0.0;
+  double bytes = 0.0;
+};
+
+void move(Vehicle& vehicle, size_t index, size_t step) {
+  float t = static_cast<float>(step) * 0.05f;
+  float x = static_cast<float>(index % 50) * 4.f + t;
+  float y = static_cast<float>(index / 50) * 4.f + std::sin(t);
+  Vis::Pose2D pose;
+  pose.set_pose({x, y}, std::cos(t));
+  vehicle.box->set_center(pose);
+  vehicle.trajectory->add_pose(*vehicle.box);
+  vehicle.body->set_center(*Vis::Pose3D::create({x, y, 0.75f}));
+}
+
+Result bench(VisualizationServer& server, BenchClient& client,
+             size_t vehicles, size_t steps, bool frames) {
+  const Vis::MaterialProps material(0.2f, 0.6f, 1.f, "vehicle");
+  std::vector<Vehicle> fleet(vehicles);
+  {
+    VisualizationServer::BatchScope batch(server);
+    for (Vehicle& vehicle : fleet) {
+      vehicle.box = Vis::Box2D::create({}, 1.8f, 3.5f, 1.f);
+      vehicle.trajectory = Vis::Trajectory2D::create();
+      vehicle.body = Vis::Box3D::create({}, 4.5f, 1.8f, 1.5f);
+      server.add(vehicle.box, kMapWindow, material, false);
+      server.add(vehicle.trajectory, kMapWindow, material, false);
+      server.add(vehicle.body, kSceneWindow, material, true);
+    }
+  }
+  uint64_t offset = server.get_send_queue_stats().enqueued - client.frames();
+  wait_drained(server, client, offset);
+
+  uint64_t enqueued_before = server.get_send_queue_stats().enqueued;
+  uint64_t bytes_before = client.bytes();
+  Clock::duration total{};
+  for (size_t step = 1; step <= steps; ++step) {
+    auto start = Clock::now();
+    if (frames) {
+      VisualizationServer::FrameScope frame(server, step * 0.05);
+      for (size_t i = 0; i < fleet.size(); ++i) move(fleet[i], i, step);
+    } else {
+      for (size_t i = 0; i < fleet.size(); ++i) move(fleet[i], i, step);
+      server.drawnow(kMapWindow, false);
+      server.drawnow(kSceneWindow, true);
+    }
+    total += Clock::now() - start;
+    wait_drained(server, client, offset);
+  }
+
+  Result result;
+  result.ms = to_ms(total) / static_cast<double>(steps);
+  result.messages = static_cast<double>(server.get_send_queue_stats().enqueued -
+                                        enqueued_before) /
+                    static_cast<double>(steps);
+  result.bytes = static_cast<double>(client.bytes() - bytes_before) /
+                 static_cast<double>(steps);
+  fleet.clear();
+  server.clear(kMapWindow, false);
+  server.clear(kSceneWindow, true);
+  wait_drained(server, client, offset);
+  return result;
+}
+
+void print_row(const char* name, const Result& r) {
+  std::printf("%-8s ms=%.2f messages=%.1f bytes=%.0f\n", name, r.ms,
+              r.messages, r.bytes);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t vehicles = 500;
+  size_t steps = 100;
+  if (argc > 1) vehicles = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2) steps = std::strtoull(argv[2], nullptr, 10);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(true, 50, 33);
+  server.set_compression(false, 0, 1);
+  server.set_client_buffer_limit(0);
+  server.run();
+  server.create_window(kMapWindow, false);
+  server.create_window(kSceneWindow, true);
+
+  BenchClient client(kPort);
+  client.wait_connected();
+  while (!server.is_connected()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+
+  std::printf("vehicles=%zu steps=%zu\n", vehicles, steps);
+  print_row("drawnow", bench(server, client, vehicles, steps, false));
+  print_row("frame", bench(server, client, vehicles, steps, true));
+
+  server.stop();
+  return 0;
+}
@@ -0,0 +1,164 @@
+// vis_stream/examples/benchmarks/instanced_bench.cpp
+//
+// 大量同类图元：objects 个障碍物框分别用逐个的 Box3D 和一个 Box3DArray 表示，
+// 统计添加的耗时，以及每帧移动全部框、只移动其中 1% 时 drawnow 的耗时和
+// 客户端收到的字节数。
+//
+// 用法: instanced_bench [objects] [frames]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "bench_client.h"
+
+namespace {
+
+constexpr const char* kWindowName = "obstacles";
+constexpr uint16_t kPort = 9115;
+
+using Clock = std::chrono::steady_clock;
+
+Vis::Box3DInstance make_box(size_t i, float t) {
+  Vis::Box3DInstance box;
+  box.center = {static_cast<float>(i % 100) + t, static_cast<float>(i / 100),
+                0.f};
+  box.lengths = {0.5f, 0.5f, 1.f};
+  return box;
+}
+
+struct Result {
+  double add_ms = 0.0;
+  double all_ms = 0.0;
+  double all_bytes = 0.0;
+  double few_ms = 0.0;
+  double few_bytes = 0.0;
+};
+
+// move(frame, stride) 移动下标为 stride 倍数的框
+template <typename Move>
+void run_frames(VisualizationServer& server, BenchClient& client,
+                size_t frames, size_t stride, Move move, double* ms,
+                double* bytes) {
+  uint64_t offset = server.get_send_queue_stats().enqueued - client.frames();
+  uint64_t bytes_before = client.bytes();
+  Clock::duration total{};
+  for (size_t frame = 1; frame <= frames; ++frame) {
+    auto start = Clock::now();
+    move(static_cast<float>(frame) * 0.01f, stride);
+    server.drawnow(kWindowName, true);
+    total += Clock::now() - start;
+    wait_drained(server, client, offset);
+  }
+  *ms = to_ms(total) / static_cast<double>(frames);
+  *bytes = static_cast<double>(client.bytes() - bytes_before) /
+           static_cast<double>(frames);
+}
+
+Result bench_objects(VisualizationServer& server, BenchClient& client,
+                     size_t objects, size_t frames) {
+  Result result;
+  Vis::MaterialProps material;
+  std::vector<std::shared_ptr<Vis::Box3D>> boxes;
+  auto start = Clock::now();
+  {
+    VisualizationServer::BatchScope batch(server);
+    for (size_t i = 0; i < objects; ++i) {
+      Vis::Box3DInstance b = make_box(i, 0.f);
+      boxes.push_back(Vis::Box3D::create(
+          *Vis::Pose3D::create(b.center), b.lengths.x, b.lengths.y,
+          b.lengths.z));
+      server.add(boxes.back(), kWindowName, material, true);
+    }
+  }
+  result.add_ms = to_ms(Clock::now() - start);
+  auto move = [&](float t, size_t stride) {
+    for (size_t i = 0; i < objects; i += stride) {
+      boxes[i]->set_center(*Vis::Pose3D::create(make_box(i, t).center));
+    }
+  };
+  run_frames(server, client, frames, 1, move, &result.all_ms,
+             &result.all_bytes);
+  run_frames(server, client, frames, 100, move, &result.few_ms,
+             &result.few_bytes);
+  server.clear(kWindowName, true);
+  return result;
+}
+
+Result bench_array(VisualizationServer& server, BenchClient& client,
+                   size_t objects, size_t frames) {
+  Result result;
+  Vis::MaterialProps material;
+  auto start = Clock::now();
+  std::vector<Vis::Box3DInstance> items(objects);
+  for (size_t i = 0; i < objects; ++i) items[i] = make_box(i, 0.f);
+  auto boxes = Vis::Box3DArray::create(std::move(items));
+  server.add(boxes, kWindowName, material, true);
+  result.add_ms = to_ms(Clock::now() - start);
+  auto move = [&](float t, size_t stride) {
+    if (stride == 1) {
+      std::vector<Vis::Box3DInstance> next(objects);
+      for (size_t i = 0; i < objects; ++i) next[i] = make_box(i, t);
+      boxes->set(std::move(next));
+      return;
+    }
+    Vis::EditScope scope;
+    for (size_t i = 0; i < objects; i += stride) {
+      boxes->set_item(i, make_box(i, t));
+    }
+  };
+  run_frames(server, client, frames, 1, move, &result.all_ms,
+             &result.all_bytes);
+  // 1% 的框分散在整个数组中，覆盖它们的区间几乎就是全部；
+  // 只改连续的一段才是区间更新的典型用法
+  auto move_block = [&](float t, size_t stride) {
+    Vis::EditScope scope;
+    for (size_t i = 0; i < objects / stride; ++i) {
+      boxes->set_item(i, make_box(i, t));
+    }
+  };
+  run_frames(server, client, frames, 100, move_block, &result.few_ms,
+             &result.few_bytes);
+  server.clear(kWindowName, true);
+  return result;
+}
+
+void print_row(const char* name, const Result& r) {
+  std::printf(
+      "%-12s add_ms=%.1f all: ms=%.2f bytes=%.0f  1%%: ms=%.2f bytes=%.0f\n",
+      name, r.add_ms, r.all_ms, r.all_bytes, r.few_ms, r.few_bytes);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t objects = 10000;
+  size_t frames = 100;
+  if (argc > 1) objects = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2) frames = std::strtoull(argv[2], nullptr, 10);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.set_compression(false, 0, 1);
+  server.run();
+  server.create_window(kWindowName, true);
+
+  BenchClient client(kPort);
+  client.wait_connected();
+  while (!server.is_connected()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+
+  std::printf("objects=%zu frames=%zu\n", objects, frames);
+  print_row("Box3D", bench_objects(server, client, objects, frames));
+  print_row("Box3DArray", bench_array(server, client, objects, frames));
+
+  server.stop();
+  return 0;
+}
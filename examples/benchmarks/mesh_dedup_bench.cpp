@@ -0,0 +1,149 @@
+// vis_stream/examples/benchmarks/mesh_dedup_bench.cpp
+//
+// 大量同形状的网格：objects 个 TriangleMesh3D 分别引用内容相同的网格
+// （每个实例单独构造一份数据，只能靠内容哈希去重）和各不相同的网格，
+// 统计添加的耗时与客户端收到的字节数，以及每帧移动全部实例时的开销。
+//
+// 用法: mesh_dedup_bench [objects] [frames] [segments]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "bench_client.h"
+
+namespace {
+
+constexpr const char* kWindowName = "meshes";
+constexpr uint16_t kPort = 9116;
+
+using Clock = std::chrono::steady_clock;
+
+// 经纬划分的球面，segments 越大三角形越多。scale 不同则内容不同
+std::shared_ptr<const Vis::TriangleMeshData> make_sphere(size_t segments,
+                                                         float scale) {
+  std::vector<Vis::Vec3> vertices;
+  std::vector<uint32_t> indices;
+  const float kPi = 3.14159265f;
+  for (size_t i = 0; i <= segments; ++i) {
+    float theta = kPi * static_cast<float>(i) / static_cast<float>(segments);
+    for (size_t j = 0; j <= segments; ++j) {
+      float phi = 2.f * kPi * static_cast<float>(j) /
+                  static_cast<float>(segments);
+      vertices.push_back({scale * std::sin(theta) * std::cos(phi),
+                          scale * std::sin(theta) * std::sin(phi),
+                          scale * std::cos(theta)});
+    }
+  }
+  const uint32_t row = static_cast<uint32_t>(segments + 1);
+  for (uint32_t i = 0; i < segments; ++i) {
+    for (uint32_t j = 0; j < segments; ++j) {
+      uint32_t a = i * row + j;
+      indices.insert(indices.end(), {a, a + row, a + 1, a + 1, a + row,
+                                     a + row + 1});
+    }
+  }
+  return Vis::TriangleMeshData::create(std::move(vertices),
+                                       std::move(indices));
+}
+
+Vis::Pose3D make_pose(size_t i, float t) {
+  Vis::Pose3D pose;
+  pose.set_position({static_cast<float>(i % 100) * 3.f + t,
+                     static_cast<float>(i / 100) * 3.f, 0.f});
+  return pose;
+}
+
+struct Result {
+  double add_ms = 0.0;
+  double add_bytes = 0.0;
+  double frame_ms = 0.0;
+  double frame_bytes = 0.0;
+};
+
+Result bench(VisualizationServer& server, BenchClient& client, size_t objects,
+             size_t frames, size_t segments, bool shared) {
+  Result result;
+  Vis::MaterialProps material;
+  std::vector<std::shared_ptr<Vis::TriangleMesh3D>> meshes;
+  uint64_t offset = server.get_send_queue_stats().enqueued - client.frames();
+  uint64_t bytes_before = client.bytes();
+  auto start = Clock::now();
+  {
+    VisualizationServer::BatchScope batch(server);
+    for (size_t i = 0; i < objects; ++i) {
+      float scale = shared ? 1.f : 1.f + static_cast<float>(i) * 1e-4f;
+      meshes.push_back(Vis::TriangleMesh3D::create(make_sphere(segments, scale),
+                                                   make_pose(i, 0.f)));
+      server.add(meshes.back(), kWindowName, material, true);
+    }
+  }
+  result.add_ms = to_ms(Clock::now() - start);
+  wait_drained(server, client, offset);
+  result.add_bytes = static_cast<double>(client.bytes() - bytes_before);
+
+  bytes_before = client.bytes();
+  Clock::duration total{};
+  for (size_t frame = 1; frame <= frames; ++frame) {
+    auto frame_start = Clock::now();
+    float t = static_cast<float>(frame) * 0.01f;
+    for (size_t i = 0; i < objects; ++i) {
+      meshes[i]->set_pose(make_pose(i, t));
+    }
+    server.drawnow(kWindowName, true);
+    total += Clock::now() - frame_start;
+    wait_drained(server, client, offset);
+  }
+  result.frame_ms = to_ms(total) / static_cast<double>(frames);
+  result.frame_bytes = static_cast<double>(client.bytes() - bytes_before) /
+                       static_cast<double>(frames);
+  server.clear(kWindowName, true);
+  wait_drained(server, client, offset);
+  return result;
+}
+
+void print_row(const char* name, const Result& r) {
+  std::printf(
+      "%-8s add: ms=%.1f bytes=%.0f  frame: ms=%.2f bytes=%.0f\n", name,
+      r.add_ms, r.add_bytes, r.frame_ms, r.frame_bytes);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t objects = 1000;
+  size_t frames = 100;
+  size_t segments = 32;
+  if (argc > 1) objects = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2) frames = std::strtoull(argv[2], nullptr, 10);
+  if (argc > 3) segments = std::strtoull(argv[3], nullptr, 10);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.set_compression(false, 0, 1);
+  // 不去重时添加阶段有几十 MB，关掉落后判定，让每条消息都如实到达
+  server.set_client_buffer_limit(0);
+  server.run();
+  server.create_window(kWindowName, true);
+
+  BenchClient client(kPort);
+  client.wait_connected();
+  while (!server.is_connected()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+
+  std::printf("objects=%zu frames=%zu triangles=%zu\n", objects, frames,
+              segments * segments * 2);
+  print_row("shared", bench(server, client, objects, frames, segments, true));
+  print_row("unique", bench(server, client, objects, frames, segments, false));
+
+  server.stop();
+  return 0;
+}
@@ -0,0 +1,85 @@
+// vis_stream/examples/benchmarks/notify_scaling_bench.cpp
+//
+// 测量单次 notify（例如 Pose2D::set_position）在不同场景规模下的开销。
+// 场景中动态图元数量从 1k 增长到 1M，每一轮都会释放一小部分图元，
+// 以覆盖过期对象回收路径。理想情况下每次 notify 的耗时不随规模增长。
+//
+// 用法: notify_scaling_bench [max_objects] [notifies_per_round]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr const char* kWindowName = "bench";
+
+// 每轮释放的对象比例（千分之一）
+constexpr size_t kReleasePerMille = 1;
+
+double measure_notify_ns(std::vector<std::shared_ptr<Vis::Pose2D>>& objects,
+                         size_t notifies) {
+  const size_t count = objects.size();
+  // 以大步长跳读，避免只命中缓存中的少量对象
+  const size_t stride = 7919;
+  size_t index = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < notifies; ++i) {
+    objects[index]->set_position({static_cast<float>(i), 0.f});
+    index = (index + stride) % count;
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+         static_cast<double>(notifies);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t max_objects = 1000000;
+  size_t notifies = 200000;
+  if (argc > 1) max_objects = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2) notifies = std::strtoull(argv[2], nullptr, 10);
+
+  // 不启动网络线程：没有客户端时服务端只维护场景状态，正好隔离出 notify 路径
+  VisualizationServer::init(9102);
+  auto& server = VisualizationServer::get();
+  server.create_window(kWindowName, false);
+  // 关闭自动刷新，只测量标脏本身
+  server.set_auto_update_policy(false, 0, 0);
+
+  Vis::MaterialProps material;
+  std::vector<std::shared_ptr<Vis::Pose2D>> objects;
+  objects.reserve(max_objects);
+
+  std::printf("%12s %14s %14s\n", "objects", "ns/notify", "released");
+  for (size_t target = 1000; target <= max_objects; target *= 10) {
+    while (objects.size() < target) {
+      auto pose = Vis::Pose2D::create(
+          {static_cast<float>(objects.size()), 0.f}, 0.f);
+      server.add(pose, kWindowName, material, false);
+      objects.push_back(pose);
+    }
+
+    // 释放一部分对象，下一次 notify 会触发增量回收
+    size_t released = target * kReleasePerMille / 1000;
+    for (size_t i = 0; i < released; ++i) {
+      size_t victim = (i * 104729) % objects.size();
+      objects[victim] = Vis::Pose2D::create();
+      server.add(objects[victim], kWindowName, material, false);
+    }
+
+    // 预热一轮，把回收和首次标脏的开销排除在测量之外
+    measure_notify_ns(objects, notifies / 10 + 1);
+    double ns = measure_notify_ns(objects, notifies);
+    std::printf("%12zu %14.1f %14zu\n", objects.size(), ns, released);
+    server.drawnow(kWindowName, false);
+  }
+
+  std::printf("tracked observables: %zu\n", server.get_observables_number());
+  return 0;
+}
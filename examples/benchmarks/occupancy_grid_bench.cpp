@@ -0,0 +1,119 @@
+// vis_stream/examples/benchmarks/occupancy_grid_bench.cpp
+//
+// 代价地图：size x size 的 UINT8 栅格，每帧在机器人周围 window x window 格的
+// 范围内重新写入代价（局部更新），或整张重写。统计 drawnow 的耗时与客户端
+// 每帧收到的字节数；整张重写即没有瓦片时每帧都要发送的量。
+//
+// 用法: occupancy_grid_bench [size] [frames] [window]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "bench_client.h"
+
+namespace {
+
+constexpr const char* kWindowName = "costmap";
+constexpr uint16_t kPort = 9117;
+
+using Clock = std::chrono::steady_clock;
+
+struct Result {
+  double write_ms = 0.0;
+  double draw_ms = 0.0;
+  double bytes = 0.0;
+};
+
+// write(frame) 修改栅格
+template <typename Write>
+Result run_frames(VisualizationServer& server, BenchClient& client,
+                  size_t frames, Write write) {
+  Result result;
+  uint64_t offset = server.get_send_queue_stats().enqueued - client.frames();
+  uint64_t bytes_before = client.bytes();
+  Clock::duration write_total{};
+  Clock::duration draw_total{};
+  for (size_t frame = 1; frame <= frames; ++frame) {
+    auto start = Clock::now();
+    write(frame);
+    auto drawn = Clock::now();
+    server.drawnow(kWindowName, false);
+    draw_total += Clock::now() - drawn;
+    write_total += drawn - start;
+    wait_drained(server, client, offset);
+  }
+  result.write_ms = to_ms(write_total) / static_cast<double>(frames);
+  result.draw_ms = to_ms(draw_total) / static_cast<double>(frames);
+  result.bytes = static_cast<double>(client.bytes() - bytes_before) /
+                 static_cast<double>(frames);
+  return result;
+}
+
+void print_row(const char* name, const Result& r) {
+  std::printf("%-8s write_ms=%.2f drawnow_ms=%.2f bytes=%.0f\n", name,
+              r.write_ms, r.draw_ms, r.bytes);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  uint32_t size = 2000;
+  size_t frames = 50;
+  uint32_t window = 200;
+  if (argc > 1) size = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+  if (argc > 2) frames = std::strtoull(argv[2], nullptr, 10);
+  if (argc > 3) {
+    window = static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10));
+  }
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.set_compression(false, 0, 1);
+  // 整张 4MB 的栅格会让客户端被判为落后，关掉落后判定，让每帧都如实到达
+  server.set_client_buffer_limit(0);
+  server.run();
+  server.create_window(kWindowName, false);
+
+  BenchClient client(kPort);
+  client.wait_connected();
+  while (!server.is_connected()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+
+  Vis::MaterialProps material;
+  auto grid = Vis::OccupancyGrid::create(size, size, 0.05f);
+  uint64_t offset = server.get_send_queue_stats().enqueued - client.frames();
+  server.add(grid, kWindowName, material, false);
+  wait_drained(server, client, offset);
+
+  std::printf("size=%ux%u frames=%zu window=%u\n", size, size, frames, window);
+  std::vector<uint8_t> block(size_t{window} * window);
+  auto local = [&](size_t frame) {
+    // 机器人沿对角线移动，周围的代价随帧变化
+    uint32_t center = static_cast<uint32_t>(frame * 17 % (size - window));
+    for (size_t i = 0; i < block.size(); ++i) {
+      block[i] = static_cast<uint8_t>((i + frame) % 101);
+    }
+    grid->set_cells(center, center, window, window, block.data());
+  };
+  print_row("local", run_frames(server, client, frames, local));
+
+  std::vector<uint8_t> whole(size_t{size} * size);
+  auto rewrite = [&](size_t frame) {
+    for (size_t i = 0; i < whole.size(); ++i) {
+      whole[i] = static_cast<uint8_t>((i + frame) % 101);
+    }
+    grid->set_cells(0, 0, size, size, whole.data());
+  };
+  print_row("rewrite", run_frames(server, client, frames, rewrite));
+
+  server.stop();
+  return 0;
+}
@@ -0,0 +1,104 @@
+// vis_stream/examples/benchmarks/point_cloud_bench.cpp
+//
+// 大点云的流式发送：一个客户端在线，PointCloud3D 每帧换一批带强度的点，
+// 统计每帧 drawnow 的耗时（编码、降采样和分块）、客户端收齐整帧的耗时、
+// 每帧的消息数和字节数。依次测试不降采样和几种体素大小。
+//
+// 用法: point_cloud_bench [points] [frames]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "bench_client.h"
+
+namespace {
+
+constexpr const char* kWindowName = "lidar";
+constexpr uint16_t kPort = 9114;
+constexpr float kVoxelSizes[] = {0.f, 0.05f, 0.2f};
+
+using Clock = std::chrono::steady_clock;
+
+// 10m 见方的区域内均匀分布的点，每帧整体平移一点
+void make_frame(size_t count, size_t frame, std::mt19937& rng,
+                std::vector<Vis::Vec3>* points,
+                std::vector<float>* intensities) {
+  std::uniform_real_distribution<float> coord(0.f, 10.f);
+  std::uniform_real_distribution<float> unit(0.f, 1.f);
+  float shift = 0.01f * static_cast<float>(frame);
+  points->resize(count);
+  intensities->resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    (*points)[i] = {coord(rng) + shift, coord(rng), coord(rng) * 0.3f};
+    (*intensities)[i] = unit(rng);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t point_count = 1000000;
+  size_t frames = 20;
+  if (argc > 1) point_count = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2) frames = std::strtoull(argv[2], nullptr, 10);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.set_compression(false, 0, 1);
+  // 整帧 16MB 超过默认的客户端缓冲上限，关掉落后判定，让每块都如实到达
+  server.set_client_buffer_limit(0);
+  server.run();
+  server.create_window(kWindowName, true);
+
+  BenchClient client(kPort);
+  client.wait_connected();
+  while (!server.is_connected()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+
+  auto cloud = Vis::PointCloud3D::create();
+  Vis::MaterialProps material;
+  server.add(cloud, kWindowName, material, true);
+
+  std::mt19937 rng(42);
+  std::vector<Vis::Vec3> points;
+  std::vector<float> intensities;
+  std::printf("points=%zu frames=%zu\n", point_count, frames);
+  for (float voxel : kVoxelSizes) {
+    cloud->set_voxel_size(voxel);
+    uint64_t offset = in_flight(server, client);
+    uint64_t messages_before = client.frames();
+    uint64_t bytes_before = client.bytes();
+    double encode_ms = 0.0;
+    double total_ms = 0.0;
+    for (size_t frame = 0; frame < frames; ++frame) {
+      make_frame(point_count, frame, rng, &points, &intensities);
+      auto start = Clock::now();
+      cloud->set_points(std::move(points), std::move(intensities));
+      server.drawnow(kWindowName, true);
+      encode_ms += to_ms(Clock::now() - start);
+      wait_drained(server, client, offset);
+      total_ms += to_ms(Clock::now() - start);
+      points.clear();
+      intensities.clear();
+    }
+    double n = static_cast<double>(frames);
+    std::printf(
+        "voxel=%.2f drawnow_ms=%.1f frame_ms=%.1f messages/frame=%.1f "
+        "bytes/frame=%.0f\n",
+        voxel, encode_ms / n, total_ms / n,
+        static_cast<double>(client.frames() - messages_before) / n,
+        static_cast<double>(client.bytes() - bytes_before) / n);
+  }
+
+  server.stop();
+  return 0;
+}
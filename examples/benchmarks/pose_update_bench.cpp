@@ -0,0 +1,94 @@
+// vis_stream/examples/benchmarks/pose_update_bench.cpp
+//
+// 只动位姿的常见场景：2D 窗口中的 Box2D 和 3D 窗口中的 Box3D / Ball 每帧只改中心，
+// 尺寸保持不变。统计每帧客户端收到的平均字节数和总耗时。
+// 按字段发送部分更新时每条命令只带中心，尺寸字段不再重复发送。
+//
+// 用法: pose_update_bench [objects] [flushes]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "bench_client.h"
+
+namespace {
+
+constexpr const char* kWindow2D = "poses_2d";
+constexpr const char* kWindow3D = "poses_3d";
+constexpr uint16_t kPort = 9112;
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t objects = 1000;
+  size_t flushes = 500;
+  if (argc > 1) objects = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2) flushes = std::strtoull(argv[2], nullptr, 10);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.run();
+  server.create_window(kWindow2D, false);
+  server.create_window(kWindow3D, true);
+
+  BenchClient client(kPort);
+  client.wait_connected();
+  while (!server.is_connected()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  Vis::MaterialProps material;
+  std::vector<std::shared_ptr<Vis::Box2D>> boxes_2d;
+  std::vector<std::shared_ptr<Vis::Box3D>> boxes_3d;
+  std::vector<std::shared_ptr<Vis::Ball>> balls;
+  server.begin_batch();
+  for (size_t i = 0; i < objects; ++i) {
+    float x = static_cast<float>(i);
+    boxes_2d.push_back(Vis::Box2D::create(*Vis::Pose2D::create({x, 0}, 0),
+                                          1.8f, 3.5f, 1.0f));
+    boxes_3d.push_back(Vis::Box3D::create(*Vis::Pose3D::create({x, 0, 0}),
+                                          4.5f, 1.8f, 1.5f));
+    balls.push_back(Vis::Ball::create({x, 5, 0}, 0.3f));
+    server.add(boxes_2d.back(), kWindow2D, material, false);
+    server.add(boxes_3d.back(), kWindow3D, material, true);
+    server.add(balls.back(), kWindow3D, material, true);
+  }
+  server.end_batch();
+  client.wait_frames(server.get_send_queue_stats().enqueued);
+
+  uint64_t bytes_before = client.bytes();
+  auto start = std::chrono::steady_clock::now();
+  for (size_t f = 0; f < flushes; ++f) {
+    float t = static_cast<float>(f) * 0.01f;
+    for (size_t i = 0; i < objects; ++i) {
+      float x = static_cast<float>(i) + t;
+      boxes_2d[i]->set_center(*Vis::Pose2D::create({x, std::sin(t)}, t));
+      Vis::Quaternion q{std::cos(t / 2), 0, 0, std::sin(t / 2)};
+      boxes_3d[i]->set_center(*Vis::Pose3D::create({x, std::sin(t), 0}, q));
+      balls[i]->set_center({x, 5, std::cos(t)});
+    }
+    server.drawnow(kWindow2D, false);
+    server.drawnow(kWindow3D, true);
+  }
+  client.wait_frames(server.get_send_queue_stats().enqueued);
+  auto end = std::chrono::steady_clock::now();
+
+  uint64_t total = client.bytes() - bytes_before;
+  double ms = std::chrono::duration<double, std::milli>(end - start).count();
+  std::printf("objects=%zu x3 flushes=%zu total_bytes=%llu bytes_per_flush=%.0f "
+              "ms=%.1f\n",
+              objects, flushes, static_cast<unsigned long long>(total),
+              static_cast<double>(total) / flushes, ms);
+
+  client.close();
+  server.stop();
+  return 0;
+}
@@ -0,0 +1,120 @@
+// vis_stream/examples/benchmarks/quantized_scene_bench.cpp
+//
+// 大规模 Line2D / Polygon 场景的带宽：同一组折线和多边形分别添加到
+// 未量化和按 step 量化的两个窗口，统计客户端各自收到的字节数。
+// 量化后每个坐标的误差不超过 step / 2。
+//
+// 用法: quantized_scene_bench [lines] [points_per_line] [step]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "bench_client.h"
+
+namespace {
+
+constexpr const char* kFloatWindow = "float";
+constexpr const char* kQuantizedWindow = "quantized";
+constexpr uint16_t kPort = 9109;
+constexpr int kPolygonVertices = 64;
+
+// 平滑的随机游走，模拟车辆轨迹、车道线一类相邻点间距很小的折线
+std::vector<Vis::Vec2> make_path(std::mt19937& rng, size_t points) {
+  std::uniform_real_distribution<float> start(-50.f, 50.f);
+  std::normal_distribution<float> turn(0.f, 0.05f);
+  std::vector<Vis::Vec2> path;
+  path.reserve(points);
+  float x = start(rng);
+  float y = start(rng);
+  float heading = start(rng);
+  for (size_t i = 0; i < points; ++i) {
+    path.push_back({x, y});
+    heading += turn(rng);
+    x += 0.1f * std::cos(heading);
+    y += 0.1f * std::sin(heading);
+  }
+  return path;
+}
+
+std::vector<Vis::Vec2> make_polygon(std::mt19937& rng) {
+  std::uniform_real_distribution<float> center(-50.f, 50.f);
+  std::uniform_real_distribution<float> radius(0.5f, 3.f);
+  float cx = center(rng);
+  float cy = center(rng);
+  float r = radius(rng);
+  std::vector<Vis::Vec2> vertices;
+  for (int i = 0; i < kPolygonVertices; ++i) {
+    float a = 2.f * static_cast<float>(M_PI) * i / kPolygonVertices;
+    vertices.push_back({cx + r * std::cos(a), cy + r * std::sin(a)});
+  }
+  return vertices;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t lines = 200;
+  size_t points = 1000;
+  float step = 0.001f;
+  if (argc > 1) lines = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2) points = std::strtoull(argv[2], nullptr, 10);
+  if (argc > 3) step = std::strtof(argv[3], nullptr);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.run();
+
+  BenchClient client(kPort);
+  client.wait_connected();
+  while (!server.is_connected()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  Vis::Quantization quantization;
+  quantization.step = step;
+  server.create_window(kFloatWindow, false);
+  server.create_window(kQuantizedWindow, false, quantization);
+  client.wait_frames(server.get_send_queue_stats().enqueued);
+
+  // 两个窗口使用相同的随机种子，内容完全一致
+  Vis::MaterialProps material;
+  uint64_t window_bytes[2] = {0, 0};
+  double window_ms[2] = {0, 0};
+  const char* windows[2] = {kFloatWindow, kQuantizedWindow};
+  for (int w = 0; w < 2; ++w) {
+    std::mt19937 rng(42);
+    uint64_t bytes_before = client.bytes();
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < lines; ++i) {
+      auto line = Vis::Line2D::create(make_path(rng, points));
+      server.add(line, windows[w], material, false);
+      auto polygon = Vis::Polygon::create(make_polygon(rng));
+      server.add(polygon, windows[w], material, false);
+    }
+    client.wait_frames(server.get_send_queue_stats().enqueued);
+    auto end = std::chrono::steady_clock::now();
+    window_bytes[w] = client.bytes() - bytes_before;
+    window_ms[w] = std::chrono::duration<double, std::milli>(end - start).count();
+  }
+
+  std::printf("lines=%zu points=%zu polygons=%zu step=%g max_error=%g\n",
+              lines, points, lines, step, step / 2);
+  std::printf("float:     bytes=%llu ms=%.1f\n",
+              static_cast<unsigned long long>(window_bytes[0]), window_ms[0]);
+  std::printf("quantized: bytes=%llu ms=%.1f ratio=%.3f\n",
+              static_cast<unsigned long long>(window_bytes[1]), window_ms[1],
+              static_cast<double>(window_bytes[1]) / window_bytes[0]);
+
+  client.close();
+  server.stop();
+  return 0;
+}
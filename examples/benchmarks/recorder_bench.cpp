@@ -0,0 +1,156 @@
+// vis_stream/examples/benchmarks/recorder_bench.cpp
+//
+// 会话录制：PointCloud3D 每帧换一批点（约 16 字节/点），依次测试
+//   live      一个客户端在线，不录制
+//   live+rec  一个客户端在线，同时录制
+//   rec       客户端断开，只录制，尽快连续 drawnow
+// 前两项统计 drawnow 和客户端收齐整帧的耗时，看录制对实时发送的影响；
+// 最后一项统计从第一帧到文件全部写完（server.stop() 返回）的写盘速率。
+//
+// 用法: recorder_bench [points] [frames] [path_prefix] [rotate_mb]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_client.h"
+
+namespace {
+
+constexpr const char* kWindowName = "lidar";
+constexpr uint16_t kPort = 9119;
+
+using Clock = std::chrono::steady_clock;
+
+struct Frame {
+  std::vector<Vis::Vec3> points;
+  std::vector<float> intensities;
+};
+
+// 预先生成几帧轮流使用，避免随机数生成拖慢写盘速率的测量
+std::vector<Frame> make_frames(size_t count) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> coord(0.f, 10.f);
+  std::uniform_real_distribution<float> unit(0.f, 1.f);
+  std::vector<Frame> frames(4);
+  for (Frame& frame : frames) {
+    frame.points.resize(count);
+    frame.intensities.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+      frame.points[i] = {coord(rng), coord(rng), coord(rng) * 0.3f};
+      frame.intensities[i] = unit(rng);
+    }
+  }
+  return frames;
+}
+
+// 以 prefix 开头的全部录制文件的总字节数和文件数
+uintmax_t recorded_size(const std::string& prefix, size_t* files) {
+  uintmax_t total = 0;
+  *files = 0;
+  for (size_t i = 0;; ++i) {
+    char suffix[32];
+    std::snprintf(suffix, sizeof(suffix), "-%04zu.visrec", i);
+    std::error_code ec;
+    uintmax_t size = std::filesystem::file_size(prefix + suffix, ec);
+    if (ec) break;
+    total += size;
+    ++*files;
+  }
+  return total;
+}
+
+void run_live(const char* name, VisualizationServer& server,
+              BenchClient& client, Vis::PointCloud3D& cloud,
+              const std::vector<Frame>& frames, size_t count) {
+  uint64_t offset = server.get_send_queue_stats().enqueued - client.frames();
+  double draw_ms = 0.0;
+  double total_ms = 0.0;
+  for (size_t i = 0; i < count; ++i) {
+    const Frame& frame = frames[i % frames.size()];
+    auto start = Clock::now();
+    cloud.set_points(frame.points, frame.intensities);
+    server.drawnow(kWindowName, true);
+    draw_ms += to_ms(Clock::now() - start);
+    wait_drained(server, client, offset);
+    total_ms += to_ms(Clock::now() - start);
+  }
+  double n = static_cast<double>(count);
+  std::printf("%-9s drawnow_ms=%.1f frame_ms=%.1f\n", name, draw_ms / n,
+              total_ms / n);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t point_count = 1000000;
+  size_t frames = 40;
+  std::string prefix = "/tmp/recorder_bench";
+  size_t rotate_mb = 256;
+  if (argc > 1) point_count = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2) frames = std::strtoull(argv[2], nullptr, 10);
+  if (argc > 3) prefix = argv[3];
+  if (argc > 4) rotate_mb = std::strtoull(argv[4], nullptr, 10);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.set_compression(false, 0, 1);
+  server.set_client_buffer_limit(0);
+  server.run();
+  server.create_window(kWindowName, true);
+
+  BenchClient client(kPort);
+  client.wait_connected();
+  while (!server.is_connected()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+
+  auto cloud = Vis::PointCloud3D::create();
+  Vis::MaterialProps material;
+  server.add(cloud, kWindowName, material, true);
+  std::vector<Frame> data = make_frames(point_count);
+  std::printf("points=%zu frames=%zu rotate_mb=%zu\n", point_count, frames,
+              rotate_mb);
+
+  run_live("live", server, client, *cloud, data, frames);
+  server.start_recording(prefix + "-live", rotate_mb << 20);
+  run_live("live+rec", server, client, *cloud, data, frames);
+  server.stop_recording();
+
+  client.close();
+  while (server.is_connected()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+
+  const std::string rec_prefix = prefix + "-rec";
+  auto start = Clock::now();
+  server.start_recording(rec_prefix, rotate_mb << 20);
+  double draw_ms = 0.0;
+  for (size_t i = 0; i < frames; ++i) {
+    const Frame& frame = data[i % data.size()];
+    auto draw_start = Clock::now();
+    cloud->set_points(frame.points, frame.intensities);
+    server.drawnow(kWindowName, true);
+    draw_ms += to_ms(Clock::now() - draw_start);
+  }
+  // 发送线程退出时关闭录制，写完全部数据后才返回
+  server.stop();
+  double elapsed_ms = to_ms(Clock::now() - start);
+
+  size_t files = 0;
+  uintmax_t bytes = recorded_size(rec_prefix, &files);
+  std::printf("%-9s drawnow_ms=%.1f total_ms=%.0f bytes=%ju files=%zu "
+              "MB/s=%.0f\n",
+              "rec", draw_ms / static_cast<double>(frames), elapsed_ms, bytes,
+              files, static_cast<double>(bytes) / 1e6 / (elapsed_ms / 1e3));
+  return 0;
+}
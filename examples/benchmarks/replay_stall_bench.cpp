@@ -0,0 +1,121 @@
+// vis_stream/examples/benchmarks/replay_stall_bench.cpp
+//
+// 测量客户端连接时的场景重放对 API 线程的影响：
+// 先铺一张大静态地图，让一个生产者线程持续更新动态图元并 drawnow，
+// 期间接入客户端，统计生产者单次调用的最大和 p99 耗时，以及客户端收齐重放数据的耗时。
+//
+// 用法: replay_stall_bench [objects]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "bench_client.h"
+
+namespace {
+
+constexpr const char* kWindowName = "map";
+constexpr uint16_t kPort = 9105;
+
+using Clock = std::chrono::steady_clock;
+
+void wait_disconnected(VisualizationServer& server) {
+  while (server.is_connected()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+}
+
+// 等到客户端收齐全部入队消息且 100ms 内没有新消息，返回重放字节数
+uint64_t wait_quiescent(VisualizationServer& server, BenchClient& client) {
+  while (true) {
+    uint64_t frames = client.frames();
+    if (frames == server.get_send_queue_stats().enqueued) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      if (client.frames() == frames &&
+          server.get_send_queue_stats().enqueued == frames) {
+        return client.bytes();
+      }
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t object_count = 100000;
+  if (argc > 1) object_count = std::strtoull(argv[1], nullptr, 10);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.run();
+  server.create_window(kWindowName, false);
+
+  std::vector<Vis::Point2D> map_points;
+  map_points.reserve(object_count);
+  for (size_t i = 0; i < object_count; ++i) {
+    map_points.push_back(*Vis::Point2D::create(
+        {static_cast<float>(i % 500), static_cast<float>(i / 500)}));
+  }
+  Vis::MaterialProps material;
+  server.add_batch(map_points, kWindowName, material, false);
+  auto robot = Vis::Pose2D::create({0.f, 0.f}, 0.f);
+  server.add(robot, kWindowName, material, false);
+
+  // 第一次连接：没有生产者干扰，测出重放耗时和数据量
+  uint64_t replay_bytes;
+  double replay_ms;
+  {
+    auto start = Clock::now();
+    BenchClient client(kPort);
+    client.wait_connected();
+    replay_bytes = wait_quiescent(server, client);
+    replay_ms = to_ms(Clock::now() - start) - 100.0;
+    client.close();
+  }
+  wait_disconnected(server);
+
+  // 第二次连接：生产者持续 update + drawnow，记录每次调用的耗时
+  std::atomic<bool> running{true};
+  std::vector<double> latencies;
+  std::thread producer([&]() {
+    for (size_t round = 0; running; ++round) {
+      auto start = Clock::now();
+      robot->set_position({static_cast<float>(round % 100), 0.f});
+      server.drawnow(kWindowName, false);
+      latencies.push_back(to_ms(Clock::now() - start));
+      std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  {
+    BenchClient client(kPort);
+    client.wait_connected();
+    while (client.bytes() < replay_bytes) {
+      std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    running = false;
+    producer.join();
+    client.close();
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  double p99 = latencies[latencies.size() * 99 / 100];
+  std::printf("objects=%zu replay: %.1f ms, %llu bytes\n", object_count,
+              replay_ms, static_cast<unsigned long long>(replay_bytes));
+  std::printf("producer calls=%zu max=%.3f ms p99=%.3f ms\n",
+              latencies.size(), latencies.back(), p99);
+
+  server.stop();
+  return 0;
+}
@@ -0,0 +1,119 @@
+// vis_stream/examples/benchmarks/restyle_bench.cpp
+//
+// 每帧把 objects 个 Box2D 在两种样式之间切换：用 set_material_batch 只发
+// UpdateObjectProperties，或像以前那样删掉图元再以新材质重新 add。
+// 统计每帧的耗时与客户端收到的字节数。
+//
+// 用法: restyle_bench [objects] [frames]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "bench_client.h"
+
+namespace {
+
+constexpr const char* kWindowName = "restyle";
+constexpr uint16_t kPort = 9118;
+
+using Clock = std::chrono::steady_clock;
+
+std::shared_ptr<Vis::Box2D> make_box(size_t i) {
+  Vis::Pose2D center;
+  center.set_position({static_cast<float>(i % 100) * 2.f,
+                       static_cast<float>(i / 100) * 2.f});
+  return Vis::Box2D::create(center, 1.f, 0.8f, 0.2f);
+}
+
+const Vis::MaterialProps& style(size_t frame) {
+  static const Vis::MaterialProps kNormal(0.2f, 0.6f, 1.f, "obstacle");
+  static const Vis::MaterialProps kSelected = [] {
+    Vis::MaterialProps m(1.f, 0.3f, 0.f, "selected");
+    m.filled = true;
+    m.line_width = 3.f;
+    return m;
+  }();
+  return frame % 2 ? kSelected : kNormal;
+}
+
+struct Result {
+  double ms = 0.0;
+  double bytes = 0.0;
+};
+
+Result bench(VisualizationServer& server, BenchClient& client, size_t objects,
+             size_t frames, bool readd) {
+  std::vector<std::shared_ptr<Vis::Box2D>> boxes;
+  for (size_t i = 0; i < objects; ++i) boxes.push_back(make_box(i));
+  server.add_batch(boxes, kWindowName, style(0), false);
+  uint64_t offset = server.get_send_queue_stats().enqueued - client.frames();
+  wait_drained(server, client, offset);
+
+  Result result;
+  uint64_t bytes_before = client.bytes();
+  Clock::duration total{};
+  for (size_t frame = 1; frame <= frames; ++frame) {
+    auto start = Clock::now();
+    if (readd) {
+      // 换掉的旧图元析构后由 add 中的回收发出删除
+      VisualizationServer::BatchScope batch(server);
+      for (auto& box : boxes) {
+        box = Vis::Box2D::create(box->get_center(), box->get_width(),
+                                 box->get_length_front(),
+                                 box->get_length_rear());
+        server.add(box, kWindowName, style(frame), false);
+      }
+    } else {
+      server.set_material_batch(boxes, style(frame));
+    }
+    total += Clock::now() - start;
+    wait_drained(server, client, offset);
+  }
+  result.ms = to_ms(total) / static_cast<double>(frames);
+  result.bytes = static_cast<double>(client.bytes() - bytes_before) /
+                 static_cast<double>(frames);
+  boxes.clear();
+  server.clear(kWindowName, false);
+  wait_drained(server, client, offset);
+  return result;
+}
+
+void print_row(const char* name, const Result& r) {
+  std::printf("%-8s ms=%.2f bytes=%.0f\n", name, r.ms, r.bytes);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t objects = 5000;
+  size_t frames = 50;
+  if (argc > 1) objects = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2) frames = std::strtoull(argv[2], nullptr, 10);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.set_compression(false, 0, 1);
+  server.set_client_buffer_limit(0);
+  server.run();
+  server.create_window(kWindowName, false);
+
+  BenchClient client(kPort);
+  client.wait_connected();
+  while (!server.is_connected()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+
+  std::printf("objects=%zu frames=%zu\n", objects, frames);
+  print_row("restyle", bench(server, client, objects, frames, false));
+  print_row("re-add", bench(server, client, objects, frames, true));
+
+  server.stop();
+  return 0;
+}
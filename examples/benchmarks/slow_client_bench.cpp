@@ -0,0 +1,107 @@
+// vis_stream/examples/benchmarks/slow_client_bench.cpp
+//
+// 慢客户端背压：一个正常客户端和一个暂停读取的客户端同时在线，
+// 连续刷新一批运动图元后恢复慢客户端，对比两者收到的数据量和进程峰值内存。
+// 第二个参数为单客户端缓冲高水位（字节），0 表示不限制。
+//
+// 用法: slow_client_bench [flushes] [high_water_bytes]
+#include <sys/resource.h>
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "bench_client.h"
+
+namespace {
+
+constexpr const char* kWindowName = "slow";
+constexpr uint16_t kPort = 9107;
+constexpr size_t kObjectCount = 1000;
+
+long peak_rss_mb() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss / 1024;
+}
+
+// 等到客户端 200ms 内没有收到新数据
+void wait_quiescent(const BenchClient& client) {
+  uint64_t bytes = client.bytes();
+  while (true) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    if (client.bytes() == bytes) return;
+    bytes = client.bytes();
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t flushes = 3000;
+  size_t high_water = 8 * 1024 * 1024;
+  if (argc > 1) flushes = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2) high_water = std::strtoull(argv[2], nullptr, 10);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.set_client_buffer_limit(high_water);
+  server.run();
+  server.create_window(kWindowName, false);
+
+  Vis::MaterialProps material;
+  std::vector<std::shared_ptr<Vis::Pose2D>> objects;
+  for (size_t i = 0; i < kObjectCount; ++i) {
+    objects.push_back(Vis::Pose2D::create({static_cast<float>(i), 0.f}, 0.f));
+    server.add(objects.back(), kWindowName, material, false);
+  }
+
+  BenchClient fast(kPort);
+  BenchClient slow(kPort);
+  fast.wait_connected();
+  slow.wait_connected();
+  while (server.get_client_count() != 2) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  wait_quiescent(slow);
+  slow.pause();
+
+  uint64_t fast_before = fast.bytes();
+  uint64_t slow_before = slow.bytes();
+  uint64_t messages_before = server.get_send_queue_stats().enqueued;
+  for (size_t round = 0; round < flushes; ++round) {
+    for (size_t j = 0; j < objects.size(); ++j) {
+      objects[j]->set_position(
+          {static_cast<float>(j), static_cast<float>(round % 100)});
+    }
+    server.drawnow(kWindowName, false);
+  }
+  uint64_t messages = server.get_send_queue_stats().enqueued - messages_before;
+  wait_quiescent(fast);
+  Vis::SendQueueStats stats = server.get_send_queue_stats();
+
+  slow.resume();
+  wait_quiescent(slow);
+
+  std::printf("high_water=%zu flushes=%zu messages=%llu\n", high_water,
+              flushes, static_cast<unsigned long long>(messages));
+  std::printf("fast client: %llu bytes\n",
+              static_cast<unsigned long long>(fast.bytes() - fast_before));
+  std::printf("slow client: %llu bytes\n",
+              static_cast<unsigned long long>(slow.bytes() - slow_before));
+  std::printf("lagging_clients=%zu superseded=%llu peak_rss=%ld MB\n",
+              stats.lagging_clients,
+              static_cast<unsigned long long>(stats.superseded),
+              peak_rss_mb());
+
+  fast.close();
+  slow.close();
+  server.stop();
+  return 0;
+}
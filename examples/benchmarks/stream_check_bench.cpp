@@ -0,0 +1,204 @@
+// vis_stream/examples/benchmarks/stream_check_bench.cpp
+//
+// 检查合并路径的正确性而不是速度：发送队列容量很小、按 COALESCE 合并，
+// 每步给少量车辆的折线和轨迹追加点（AppendPoints/AppendPoses）、移动车框
+// 并不时改宽度（field_mask 部分更新）、跳着改标记数组中的实例（区间更新，
+// 可越过末尾）后 drawnow，消息小而密，队列常满。一个客户端从头在线，
+// 另有几个在中途连入：窗口里另有大量静态折线，重放分成许多块，与实时更新
+// 在队列中交错。还有一个客户端中途暂停读取一段时间，落后期间的更新并入
+// 服务端为它积压的 backlog。结束后再连一个新客户端，它收到的重放即服务端的
+// 最终状态；其余客户端按协议逐条应用收到的消息得到的场景都必须与之相同，
+// 否则打印第一处差异并以 1 退出。
+//
+// 用法: stream_check_bench [vehicles] [steps] [queue_capacity]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_client.h"
+#include "scene_model.h"
+
+namespace {
+
+constexpr const char* kWindowName = "check";
+constexpr uint16_t kPort = 9121;
+// 只为让中途连入的重放足够长的静态折线
+constexpr size_t kSceneryLines = 2000;
+constexpr size_t kSceneryPoints = 500;
+constexpr size_t kJoins = 4;  // 中途连入的客户端数
+constexpr size_t kMarkers = 16;  // 每辆车标记数组的长度
+// 很小的高水位，暂停读取的客户端很快进入落后状态
+constexpr size_t kClientHighWater = 64 * 1024;
+
+struct Vehicle {
+  std::shared_ptr<Vis::Box2D> box;
+  std::shared_ptr<Vis::Line2D> line;
+  std::shared_ptr<Vis::Trajectory2D> trajectory;
+  std::shared_ptr<Vis::CircleArray> markers;
+};
+
+// 等到客户端 200ms 内没有收到新数据
+void wait_quiescent(const BenchClient& client) {
+  uint64_t bytes = client.bytes();
+  while (true) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    if (client.bytes() == bytes) return;
+    bytes = client.bytes();
+  }
+}
+
+void move(Vehicle& vehicle, size_t index, size_t step) {
+  float t = static_cast<float>(step) * 0.05f;
+  float x = static_cast<float>(index % 40) * 5.f + t;
+  float y = static_cast<float>(index / 40) * 5.f + std::sin(t);
+  Vis::Pose2D pose;
+  pose.set_pose({x, y}, std::cos(t));
+  vehicle.box->set_center(pose);
+  if (step % 7 == 0) {
+    vehicle.box->set_width(1.8f + 0.1f * static_cast<float>(step % 3));
+  }
+  vehicle.line->add_point({x, y});
+  vehicle.trajectory->add_pose(*vehicle.box);
+  // 步长 3 跳着写，数组变长时中间留下默认实例
+  vehicle.markers->set_item(step * 3 % kMarkers, {{x, y}, 0.5f});
+}
+
+// 按协议逐条应用客户端收到的消息，导出得到的场景
+std::vector<std::string> rebuild(BenchClient& client) {
+  SceneModel model;
+  for (const std::string& payload : client.take_payloads()) {
+    visualization::VisMessage message;
+    if (!message.ParseFromString(payload)) {
+      std::fprintf(stderr, "❌ 错误：无法解析收到的消息\n");
+      std::exit(1);
+    }
+    model.apply(&message);
+  }
+  return model.snapshot();
+}
+
+bool same_scene(const char* name, const std::vector<std::string>& scene,
+                const std::vector<std::string>& expected) {
+  for (size_t i = 0; i < scene.size() && i < expected.size(); ++i) {
+    if (scene[i] != expected[i]) {
+      std::printf("%-8s MISMATCH at message %zu of %zu\n", name, i,
+                  expected.size());
+      return false;
+    }
+  }
+  if (scene.size() != expected.size()) {
+    std::printf("%-8s MISMATCH messages=%zu expected=%zu\n", name,
+                scene.size(), expected.size());
+    return false;
+  }
+  std::printf("%-8s ok messages=%zu\n", name, scene.size());
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t vehicles = 40;
+  size_t steps = 20000;
+  size_t capacity = 64;
+  if (argc > 1) vehicles = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2) steps = std::strtoull(argv[2], nullptr, 10);
+  if (argc > 3) capacity = std::strtoull(argv[3], nullptr, 10);
+  vehicles = std::min(std::max<size_t>(vehicles, 1), kSceneryLines);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false);
+  server.set_compression(false, 0, 1);
+  server.set_send_queue_policy(Vis::SendOverflowPolicy::COALESCE, capacity);
+  server.set_client_buffer_limit(kClientHighWater);
+  server.run();
+  server.create_window(kWindowName, false);
+
+  BenchClient live(kPort, nullptr, false, true);
+  BenchClient slow(kPort, nullptr, false, true);
+  live.wait_connected();
+  slow.wait_connected();
+  while (server.get_client_count() != 2) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+
+  const Vis::MaterialProps material(0.2f, 0.6f, 1.f, "vehicle");
+  std::vector<Vehicle> fleet(vehicles);
+  std::vector<std::shared_ptr<Vis::Line2D>> scenery(kSceneryLines);
+  {
+    // 车辆夹在静态折线之间，重放的每一块里都有正在更新的图元
+    VisualizationServer::BatchScope batch(server);
+    std::vector<Vis::Vec2> points(kSceneryPoints);
+    size_t lines_per_vehicle = scenery.size() / vehicles;
+    for (size_t i = 0; i < scenery.size(); ++i) {
+      for (size_t j = 0; j < points.size(); ++j) {
+        points[j] = {static_cast<float>(j), static_cast<float>(i)};
+      }
+      scenery[i] = Vis::Line2D::create(points);
+      server.add(scenery[i], kWindowName, material, false);
+      if (i % lines_per_vehicle != 0 || i / lines_per_vehicle >= vehicles) {
+        continue;
+      }
+      size_t v = i / lines_per_vehicle;
+      Vehicle& vehicle = fleet[v];
+      vehicle.box = Vis::Box2D::create({}, 1.8f, 3.5f, 1.f);
+      vehicle.line = Vis::Line2D::create();
+      vehicle.trajectory = Vis::Trajectory2D::create();
+      vehicle.markers = Vis::CircleArray::create();
+      for (size_t step = 0; step < 50; ++step) move(vehicle, v, step);
+      server.add(vehicle.box, kWindowName, material, false);
+      server.add(vehicle.line, kWindowName, material, false);
+      server.add(vehicle.trajectory, kWindowName, material, false);
+      server.add(vehicle.markers, kWindowName, material, false);
+    }
+  }
+
+  // 中途连入的客户端：重放分块排在实时更新之间
+  std::vector<std::unique_ptr<BenchClient>> joined;
+  for (size_t step = 0; step < steps; ++step) {
+    for (size_t i = 0; i < fleet.size(); ++i) move(fleet[i], i, step + 50);
+    server.drawnow(kWindowName, false);
+    if (step == steps / 3) slow.pause();
+    if (step == steps * 2 / 3) slow.resume();
+    if (step % (steps / kJoins + 1) == steps / kJoins / 2) {
+      joined.push_back(
+          std::make_unique<BenchClient>(kPort, nullptr, false, true));
+    }
+  }
+  server.drawnow(kWindowName, false);
+  wait_quiescent(live);
+  wait_quiescent(slow);
+  for (const auto& client : joined) wait_quiescent(*client);
+
+  BenchClient fresh(kPort, nullptr, false, true);
+  fresh.wait_connected();
+  wait_quiescent(fresh);
+
+  Vis::SendQueueStats stats = server.get_send_queue_stats();
+  // 暂停过的客户端少收的字节即落后期间在 backlog 中合并掉的部分
+  std::printf(
+      "vehicles=%zu steps=%zu capacity=%zu coalesced=%llu live=%.1fMB "
+      "slow=%.1fMB\n",
+      vehicles, steps, capacity,
+      static_cast<unsigned long long>(stats.coalesced), live.bytes() / 1e6,
+      slow.bytes() / 1e6);
+  std::vector<std::string> expected = rebuild(fresh);
+  bool ok = same_scene("live", rebuild(live), expected);
+  ok = same_scene("slow", rebuild(slow), expected) && ok;
+  for (const auto& client : joined) {
+    ok = same_scene("joined", rebuild(*client), expected) && ok;
+  }
+
+  server.stop();
+  return ok ? 0 : 1;
+}
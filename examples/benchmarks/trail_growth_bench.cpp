@@ -0,0 +1,74 @@
+// vis_stream/examples/benchmarks/trail_growth_bench.cpp
+//
+// 轨迹逐帧增长：一条 Line2D 和一条 Trajectory2D 每次刷新各追加一个点（位姿），
+// 统计客户端收到的总字节数、最后一帧的字节数和总耗时。
+// 每帧只发新增尾部时总量随帧数线性增长，整条重发时则是平方增长。
+//
+// 用法: trail_growth_bench [flushes]
+#include <vis_primitives.h>
+#include <vis_stream.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+
+#include "bench_client.h"
+
+namespace {
+
+constexpr const char* kWindowName = "trail";
+constexpr uint16_t kPort = 9108;
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t flushes = 5000;
+  if (argc > 1) flushes = std::strtoull(argv[1], nullptr, 10);
+
+  VisualizationServer::init(kPort);
+  auto& server = VisualizationServer::get();
+  server.set_auto_update_policy(false, 0, 0);
+  server.run();
+  server.create_window(kWindowName, false);
+
+  BenchClient client(kPort);
+  client.wait_connected();
+  while (!server.is_connected()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  Vis::MaterialProps material;
+  auto line = Vis::Line2D::create();
+  auto trajectory = Vis::Trajectory2D::create();
+  server.add(line, kWindowName, material, false);
+  server.add(trajectory, kWindowName, material, false);
+  client.wait_frames(server.get_send_queue_stats().enqueued);
+
+  uint64_t bytes_before = client.bytes();
+  uint64_t last_frame_bytes = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < flushes; ++i) {
+    float t = static_cast<float>(i) * 0.01f;
+    line->add_point({t, std::sin(t)});
+    auto pose = Vis::Pose2D::create({t, std::cos(t)}, t);
+    trajectory->add_pose(*Vis::Box2D::create(*pose, 1.f, 2.f, 1.f));
+    uint64_t frame_start = client.bytes();
+    server.drawnow(kWindowName, false);
+    client.wait_frames(server.get_send_queue_stats().enqueued);
+    last_frame_bytes = client.bytes() - frame_start;
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  double ms = std::chrono::duration<double, std::milli>(end - start).count();
+  std::printf("flushes=%zu total_bytes=%llu last_frame_bytes=%llu ms=%.1f\n",
+              flushes,
+              static_cast<unsigned long long>(client.bytes() - bytes_before),
+              static_cast<unsigned long long>(last_frame_bytes), ms);
+
+  client.close();
+  server.stop();
+  return 0;
+}
@@ -0,0 +1,215 @@
+#include "keyframe_index.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+namespace {
+
+constexpr char kIndexMagic[8] = {'V', 'I', 'S', 'I', 'D', 'X', '1', '\n'};
+
+void put_le(std::string* out, uint64_t value, size_t bytes) {
+  for (size_t i = 0; i < bytes; ++i) {
+    out->push_back(static_cast<char>(value >> (8 * i)));
+  }
+}
+
+// 顺序读取索引文件，越界后 ok 置 false，之后读到的都是 0
+struct IndexCursor {
+  const std::string& data;
+  size_t offset = 0;
+  bool ok = true;
+
+  uint64_t get(size_t bytes) {
+    if (!ok || offset + bytes > data.size()) {
+      ok = false;
+      return 0;
+    }
+    uint64_t value =
+        read_le(reinterpret_cast<const uint8_t*>(data.data()) + offset, bytes);
+    offset += bytes;
+    return value;
+  }
+};
+
+}  // namespace
+
+bool KeyframeIndex::open(const std::string& prefix,
+                         const RecordingReader& reader,
+                         uint64_t interval_bytes) {
+  const std::string index_path = prefix + ".visidx";
+  const std::string key_path = prefix + ".viskey";
+  if (read_index(index_path, reader, interval_bytes)) {
+    if (m_keyframes.empty()) return true;
+    const Keyframe& last = m_keyframes.back();
+    if (m_keyframe_file.open(key_path) &&
+        last.offset + last.bytes <= m_keyframe_file.size()) {
+      return true;
+    }
+  }
+
+  std::cout << "🔨 建立关键帧索引（" << reader.total_bytes() / (1024 * 1024)
+            << " MB）..." << std::endl;
+  if (!build(key_path, reader, interval_bytes)) return false;
+  if (!m_keyframes.empty() && !m_keyframe_file.open(key_path)) {
+    std::cerr << "❌ 错误：无法读取关键帧文件 " << key_path << std::endl;
+    return false;
+  }
+  // 写不了索引只是下次还要重建，不影响本次回放
+  if (!write_index(index_path, reader, interval_bytes)) {
+    std::cerr << "⚠️ 无法写入索引文件 " << index_path << std::endl;
+  }
+  return true;
+}
+
+const Keyframe* KeyframeIndex::find(int64_t timestamp_us) const {
+  auto it = std::upper_bound(
+      m_keyframes.begin(), m_keyframes.end(), timestamp_us,
+      [](int64_t t, const Keyframe& keyframe) { return t < keyframe.timestamp_us; });
+  if (it == m_keyframes.begin()) return nullptr;
+  return &*(it - 1);
+}
+
+void KeyframeIndex::load(const Keyframe& keyframe, SceneModel* model) const {
+  model->clear();
+  const size_t end = std::min<uint64_t>(keyframe.offset + keyframe.bytes,
+                                        m_keyframe_file.size());
+  uint64_t offset = keyframe.offset;
+  RecordedFrame frame;
+  visualization::VisMessage message;
+  while (read_frame(m_keyframe_file.data(), end, &offset, &frame)) {
+    if (message.ParseFromArray(frame.data, static_cast<int>(frame.size))) {
+      model->apply(&message);
+    }
+  }
+}
+
+// 扫描整个录制，每隔一段应用过的数据导出一次场景写入关键帧文件
+bool KeyframeIndex::build(const std::string& key_path,
+                          const RecordingReader& reader,
+                          uint64_t interval_bytes) {
+  m_keyframes.clear();
+  m_frame_count = 0;
+  std::FILE* out = std::fopen(key_path.c_str(), "wb");
+  if (!out) {
+    std::cerr << "❌ 错误：无法创建关键帧文件 " << key_path << std::endl;
+    return false;
+  }
+  bool ok = std::fwrite(kRecordingMagic, 1, sizeof(kRecordingMagic), out) ==
+            sizeof(kRecordingMagic);
+  uint64_t key_offset = sizeof(kRecordingMagic);
+
+  SceneModel model;
+  visualization::VisMessage message;
+  FramePosition pos;
+  RecordedFrame frame;
+  uint64_t interval = interval_bytes;
+  uint64_t since_keyframe = 0;
+  uint64_t invalid = 0;
+  std::string header;
+  while (ok && reader.next(&pos, &frame)) {
+    if (m_frame_count++ == 0) m_first_timestamp = frame.timestamp_us;
+    m_last_timestamp = frame.timestamp_us;
+    if (!message.ParseFromArray(frame.data, static_cast<int>(frame.size))) {
+      ++invalid;
+      continue;
+    }
+    model.apply(&message);
+    since_keyframe += kRecordingFrameHeaderBytes + frame.size;
+    if (since_keyframe < interval) continue;
+
+    Keyframe keyframe;
+    keyframe.timestamp_us = frame.timestamp_us;
+    keyframe.next = pos;
+    keyframe.offset = key_offset;
+    for (const std::string& snapshot : model.snapshot()) {
+      header.clear();
+      put_le(&header, snapshot.size(), 4);
+      put_le(&header, static_cast<uint64_t>(frame.timestamp_us), 8);
+      ok = ok &&
+           std::fwrite(header.data(), 1, header.size(), out) == header.size() &&
+           std::fwrite(snapshot.data(), 1, snapshot.size(), out) ==
+               snapshot.size();
+      keyframe.bytes += header.size() + snapshot.size();
+    }
+    key_offset += keyframe.bytes;
+    m_keyframes.push_back(keyframe);
+    since_keyframe = 0;
+    // 场景很大时相应拉长间隔，关键帧总量不超过录制的一半
+    interval = std::max(interval_bytes, 2 * keyframe.bytes);
+  }
+  ok = std::fclose(out) == 0 && ok;
+  if (!ok) {
+    std::cerr << "❌ 错误：写入关键帧文件失败 " << key_path << std::endl;
+    return false;
+  }
+  if (invalid > 0) {
+    std::cerr << "⚠️ 跳过了 " << invalid << " 条无法解析的消息" << std::endl;
+  }
+  return true;
+}
+
+// 索引文件：魔数；关键帧间隔；各段大小；时间范围和帧数；关键帧表
+bool KeyframeIndex::write_index(const std::string& path,
+                                const RecordingReader& reader,
+                                uint64_t interval_bytes) const {
+  std::string data(kIndexMagic, sizeof(kIndexMagic));
+  put_le(&data, interval_bytes, 8);
+  put_le(&data, reader.segments(), 4);
+  for (size_t i = 0; i < reader.segments(); ++i) {
+    put_le(&data, reader.segment_size(i), 8);
+  }
+  put_le(&data, static_cast<uint64_t>(m_first_timestamp), 8);
+  put_le(&data, static_cast<uint64_t>(m_last_timestamp), 8);
+  put_le(&data, m_frame_count, 8);
+  put_le(&data, m_keyframes.size(), 4);
+  for (const Keyframe& keyframe : m_keyframes) {
+    put_le(&data, static_cast<uint64_t>(keyframe.timestamp_us), 8);
+    put_le(&data, keyframe.next.segment, 4);
+    put_le(&data, keyframe.next.offset, 8);
+    put_le(&data, keyframe.offset, 8);
+    put_le(&data, keyframe.bytes, 8);
+  }
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(data.data(), static_cast<std::streamsize>(data.size()));
+  return static_cast<bool>(out);
+}
+
+// 录制分段的数目或大小变了（如录制仍在进行）、间隔不同都视为过期
+bool KeyframeIndex::read_index(const std::string& path,
+                               const RecordingReader& reader,
+                               uint64_t interval_bytes) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) return false;
+  std::string data((std::istreambuf_iterator<char>(in)),
+                   std::istreambuf_iterator<char>());
+  if (data.size() < sizeof(kIndexMagic) ||
+      std::memcmp(data.data(), kIndexMagic, sizeof(kIndexMagic)) != 0) {
+    return false;
+  }
+  IndexCursor cursor{data, sizeof(kIndexMagic)};
+  if (cursor.get(8) != interval_bytes) return false;
+  if (cursor.get(4) != reader.segments()) return false;
+  for (size_t i = 0; i < reader.segments(); ++i) {
+    if (cursor.get(8) != reader.segment_size(i)) return false;
+  }
+  m_first_timestamp = static_cast<int64_t>(cursor.get(8));
+  m_last_timestamp = static_cast<int64_t>(cursor.get(8));
+  m_frame_count = cursor.get(8);
+  size_t count = cursor.get(4);
+  m_keyframes.clear();
+  for (size_t i = 0; i < count && cursor.ok; ++i) {
+    Keyframe keyframe;
+    keyframe.timestamp_us = static_cast<int64_t>(cursor.get(8));
+    keyframe.next.segment = static_cast<uint32_t>(cursor.get(4));
+    keyframe.next.offset = cursor.get(8);
+    keyframe.offset = cursor.get(8);
+    keyframe.bytes = cursor.get(8);
+    m_keyframes.push_back(keyframe);
+  }
+  if (!cursor.ok) m_keyframes.clear();
+  return cursor.ok;
+}
@@ -0,0 +1,55 @@
+// tools/replay/keyframe_index.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "recording_reader.h"
+#include "scene_model.h"
+
+// 关键帧：录制到某一帧为止的完整场景，由 SceneModel::snapshot 导出
+struct Keyframe {
+  int64_t timestamp_us = 0;  // 关键帧之前最后一帧的时间戳
+  FramePosition next;        // 关键帧之后的第一帧
+  uint64_t offset = 0;       // 在关键帧文件中的位置
+  uint64_t bytes = 0;
+};
+
+// 录制的关键帧索引。跳转时从目标时间之前最近的关键帧载入场景，
+// 只需再应用其后不到一个间隔的帧，而不必从头重放。
+// 索引与关键帧保存在录制旁的两个文件中，下次打开时直接读取：
+//   <prefix>.visidx   各段大小（用于判断索引是否过期）、时间范围和关键帧表
+//   <prefix>.viskey   关键帧的消息，格式与录制文件相同
+class KeyframeIndex {
+ public:
+  // 读取已有的索引；没有或与录制不符时扫描整个录制重建。
+  // 相邻关键帧之间至少间隔 interval_bytes 的录制数据
+  bool open(const std::string& prefix, const RecordingReader& reader,
+            uint64_t interval_bytes);
+
+  // 时间戳不晚于 timestamp_us 的最后一个关键帧，没有则返回 nullptr
+  const Keyframe* find(int64_t timestamp_us) const;
+  // 清空 model 后载入关键帧
+  void load(const Keyframe& keyframe, SceneModel* model) const;
+
+  int64_t first_timestamp() const { return m_first_timestamp; }
+  int64_t last_timestamp() const { return m_last_timestamp; }
+  uint64_t frame_count() const { return m_frame_count; }
+  size_t size() const { return m_keyframes.size(); }
+
+ private:
+  bool read_index(const std::string& path, const RecordingReader& reader,
+                  uint64_t interval_bytes);
+  bool build(const std::string& key_path, const RecordingReader& reader,
+             uint64_t interval_bytes);
+  bool write_index(const std::string& path, const RecordingReader& reader,
+                   uint64_t interval_bytes) const;
+
+  std::vector<Keyframe> m_keyframes;
+  MappedFile m_keyframe_file;
+  int64_t m_first_timestamp = 0;
+  int64_t m_last_timestamp = 0;
+  uint64_t m_frame_count = 0;
+};
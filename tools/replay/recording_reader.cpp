@@ -0,0 +1,89 @@
+#include "recording_reader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <iostream>
+
+MappedFile::~MappedFile() {
+  if (m_data) {
+    munmap(const_cast<uint8_t*>(m_data), m_size);
+  }
+}
+
+bool MappedFile::open(const std::string& path) {
+  if (m_data) {
+    munmap(const_cast<uint8_t*>(m_data), m_size);
+    m_data = nullptr;
+    m_size = 0;
+  }
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  struct stat info;
+  if (fstat(fd, &info) != 0 || info.st_size == 0) {
+    ::close(fd);
+    return false;
+  }
+  void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ,
+                    MAP_PRIVATE, fd, 0);
+  // 映射建立后即可关闭描述符
+  ::close(fd);
+  if (data == MAP_FAILED) return false;
+  m_data = static_cast<const uint8_t*>(data);
+  m_size = static_cast<size_t>(info.st_size);
+  return true;
+}
+
+bool read_frame(const uint8_t* data, size_t size, uint64_t* offset,
+                RecordedFrame* frame) {
+  if (*offset + kRecordingFrameHeaderBytes > size) return false;
+  const uint8_t* header = data + *offset;
+  uint64_t payload = read_le(header, 4);
+  if (*offset + kRecordingFrameHeaderBytes + payload > size) return false;
+  frame->size = static_cast<uint32_t>(payload);
+  frame->timestamp_us = static_cast<int64_t>(read_le(header + 4, 8));
+  frame->data = header + kRecordingFrameHeaderBytes;
+  *offset += kRecordingFrameHeaderBytes + payload;
+  return true;
+}
+
+bool RecordingReader::open(const std::string& prefix) {
+  m_files.clear();
+  for (size_t i = 0;; ++i) {
+    std::string path = recording_file_path(prefix, i);
+    auto file = std::make_unique<MappedFile>();
+    if (!file->open(path)) {
+      if (i == 0) {
+        std::cerr << "❌ 错误：无法打开录制文件 " << path << std::endl;
+      }
+      break;
+    }
+    if (file->size() < sizeof(kRecordingMagic) ||
+        std::memcmp(file->data(), kRecordingMagic, sizeof(kRecordingMagic)) !=
+            0) {
+      std::cerr << "❌ 错误：" << path << " 不是录制文件" << std::endl;
+      break;
+    }
+    m_files.push_back(std::move(file));
+  }
+  return !m_files.empty();
+}
+
+bool RecordingReader::next(FramePosition* pos, RecordedFrame* frame) const {
+  while (pos->segment < m_files.size()) {
+    const MappedFile& file = *m_files[pos->segment];
+    if (read_frame(file.data(), file.size(), &pos->offset, frame)) return true;
+    ++pos->segment;
+    pos->offset = sizeof(kRecordingMagic);
+  }
+  return false;
+}
+
+uint64_t RecordingReader::total_bytes() const {
+  uint64_t total = 0;
+  for (const auto& file : m_files) total += file->size();
+  return total;
+}
@@ -0,0 +1,73 @@
+// tools/replay/recording_reader.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "session_recorder.h"
+
+// 小端整数
+inline uint64_t read_le(const uint8_t* data, size_t bytes) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < bytes; ++i) {
+    value |= static_cast<uint64_t>(data[i]) << (8 * i);
+  }
+  return value;
+}
+
+// 只读映射的整个文件
+class MappedFile {
+ public:
+  MappedFile() = default;
+  ~MappedFile();
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  bool open(const std::string& path);
+  const uint8_t* data() const { return m_data; }
+  size_t size() const { return m_size; }
+
+ private:
+  const uint8_t* m_data = nullptr;
+  size_t m_size = 0;
+};
+
+struct RecordedFrame {
+  int64_t timestamp_us = 0;
+  const uint8_t* data = nullptr;  // 序列化的 VisMessage，指向映射的文件
+  uint32_t size = 0;
+};
+
+// 帧在录制中的位置：分段文件的下标和段内偏移
+struct FramePosition {
+  uint32_t segment = 0;
+  uint64_t offset = sizeof(kRecordingMagic);
+};
+
+// 读取 [data, data + size) 中 *offset 处的一帧并前移 offset；
+// 剩余字节不足一帧（末尾被截断）时返回 false
+bool read_frame(const uint8_t* data, size_t size, uint64_t* offset,
+                RecordedFrame* frame);
+
+// 映射一份录制的全部分段文件（格式见 session_recorder.h），按帧顺序读取。
+// 录制进程异常退出时最后一帧可能不完整，读到那里即视为该段结束
+class RecordingReader {
+ public:
+  // 依次映射 <prefix>-0000.visrec 起的各段，至少要有第一段
+  bool open(const std::string& prefix);
+
+  // 读取 *pos 处的帧并把 *pos 移到下一帧，到达录制末尾时返回 false
+  bool next(FramePosition* pos, RecordedFrame* frame) const;
+
+  size_t segments() const { return m_files.size(); }
+  uint64_t segment_size(size_t segment) const {
+    return m_files[segment]->size();
+  }
+  uint64_t total_bytes() const;
+
+ private:
+  std::vector<std::unique_ptr<MappedFile>> m_files;
+};
@@ -0,0 +1,444 @@
+#include "scene_model.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+using google::protobuf::FieldDescriptor;
+using google::protobuf::Message;
+
+// 快照中每条消息的大小上限，与服务端批量添加的上限相同
+constexpr size_t kSnapshotChunkBytes = 256 * 1024;
+
+template <typename SceneUpdate>
+SceneUpdate* mutable_scene_update(visualization::VisMessage* message) {
+  if constexpr (std::is_same_v<SceneUpdate, visualization::Scene3DUpdate>) {
+    return message->mutable_scene_3d_update();
+  } else {
+    return message->mutable_scene_2d_update();
+  }
+}
+
+// 把 src 写到 dst 的 offset 处，dst 不够长时补零
+void write_at(std::string* dst, size_t offset, const std::string& src) {
+  if (dst->size() < offset + src.size()) dst->resize(offset + src.size());
+  if (!src.empty()) std::memcpy(&(*dst)[offset], src.data(), src.size());
+}
+
+// 保留 data 中前 start 个元素（每个 stride 字节），其后接上 tail
+void splice_bytes(std::string* data, uint32_t start, size_t stride,
+                  const std::string& tail) {
+  data->resize(std::min(data->size(), size_t{start} * stride));
+  data->append(tail);
+}
+
+// 量化折线的 dxy 中首点相对原点，其后为与前一点的差值。追加段的首点
+// 同样相对原点，接在保留部分之后时要改成与保留的最后一点的差值
+void splice_dxy(google::protobuf::RepeatedField<int32_t>* dxy, uint32_t start,
+                const google::protobuf::RepeatedField<int32_t>& tail) {
+  int keep = static_cast<int>(
+      std::min(size_t{start}, static_cast<size_t>(dxy->size()) / 2) * 2);
+  int64_t qx = 0;
+  int64_t qy = 0;
+  for (int i = 0; i < keep; i += 2) {
+    qx += dxy->Get(i);
+    qy += dxy->Get(i + 1);
+  }
+  dxy->Truncate(keep);
+  for (int i = 0; i + 1 < tail.size(); i += 2) {
+    int64_t dx = tail.Get(i);
+    int64_t dy = tail.Get(i + 1);
+    if (i == 0) {
+      dx -= qx;
+      dy -= qy;
+    }
+    dxy->Add(static_cast<int32_t>(dx));
+    dxy->Add(static_cast<int32_t>(dy));
+  }
+}
+
+template <typename AddObject>
+void append_points(const visualization::AppendPoints& append, AddObject* add) {
+  if (add->has_line_2d()) {
+    auto* line = add->mutable_line_2d();
+    if (append.dxy_size() > 0) {
+      splice_dxy(line->mutable_dxy(), append.start(), append.dxy());
+    } else {
+      splice_bytes(line->mutable_xy(), append.start(), 2 * sizeof(float),
+                   append.xy());
+    }
+    return;
+  }
+  if constexpr (std::is_same_v<AddObject, visualization::Add3DObject>) {
+    if (add->has_line_3d()) {
+      splice_bytes(add->mutable_line_3d()->mutable_xyz(), append.start(),
+                   3 * sizeof(float), append.xyz());
+    }
+  }
+}
+
+void append_poses(visualization::AppendPoses* append,
+                  visualization::Trajectory2D* trajectory) {
+  auto* poses = trajectory->mutable_poses();
+  int keep = std::min(static_cast<int>(append->start()), poses->size());
+  poses->DeleteSubrange(keep, poses->size() - keep);
+  for (auto& pose : *append->mutable_poses()) {
+    poses->Add()->Swap(&pose);
+  }
+}
+
+// start 为 0 的块开始新的一帧，其余块写在 start 偏移处
+void merge_point_cloud(visualization::PointCloud3D* patch,
+                       visualization::PointCloud3D* full) {
+  if (patch->start() == 0) {
+    full->Swap(patch);
+    return;
+  }
+  size_t start = patch->start();
+  write_at(full->mutable_xyz(), start * 3 * sizeof(float), patch->xyz());
+  if (!patch->intensity().empty()) {
+    write_at(full->mutable_intensity(), start * sizeof(float),
+             patch->intensity());
+  }
+  if (!patch->rgb().empty()) {
+    write_at(full->mutable_rgb(), start * 3, patch->rgb());
+  }
+  full->set_total(std::max(full->total(), patch->total()));
+}
+
+// starts 为空时整体替换；否则按 total 调整大小，保留已有实例，写入各段
+void merge_instances(visualization::InstanceArray* patch,
+                     visualization::InstanceArray* full, size_t stride) {
+  if (patch->starts_size() == 0) {
+    full->Swap(patch);
+    return;
+  }
+  const size_t instance_bytes = stride * sizeof(float);
+  std::string* values = full->mutable_values();
+  values->resize(size_t{patch->total()} * instance_bytes);
+  full->set_total(patch->total());
+  const std::string& source = patch->values();
+  size_t offset = 0;
+  for (int i = 0; i < patch->starts_size() && i < patch->counts_size(); ++i) {
+    size_t bytes = size_t{patch->counts(i)} * instance_bytes;
+    size_t target = size_t{patch->starts(i)} * instance_bytes;
+    if (offset + bytes > source.size() || target + bytes > values->size()) {
+      break;
+    }
+    std::memcpy(&(*values)[target], source.data() + offset, bytes);
+    offset += bytes;
+  }
+}
+
+// 模型中的栅格总是单个覆盖全图的瓦片。完整更新按头部重建，
+// 部分更新（尺寸和格子类型不变）只写入所带的瓦片
+void merge_grid(visualization::OccupancyGrid* patch,
+                visualization::OccupancyGrid* full) {
+  const size_t cell_bytes =
+      patch->cell_type() == visualization::OccupancyGrid::FLOAT32 ? 4 : 1;
+  const size_t width = patch->width();
+  const size_t height = patch->height();
+  bool rebuild = !patch->partial() || full->tiles_size() != 1 ||
+                 full->width() != patch->width() ||
+                 full->height() != patch->height() ||
+                 full->cell_type() != patch->cell_type();
+  std::string cells;
+  if (rebuild) {
+    cells.assign(width * height * cell_bytes, '\0');
+  } else {
+    cells.swap(*full->mutable_tiles(0)->mutable_cells());
+  }
+  for (const auto& tile : patch->tiles()) {
+    size_t row_bytes = size_t{tile.width()} * cell_bytes;
+    if (size_t{tile.x()} + tile.width() > width ||
+        size_t{tile.y()} + tile.height() > height ||
+        tile.cells().size() < row_bytes * tile.height()) {
+      continue;
+    }
+    for (size_t row = 0; row < tile.height(); ++row) {
+      size_t target = ((tile.y() + row) * width + tile.x()) * cell_bytes;
+      std::memcpy(&cells[target], tile.cells().data() + row * row_bytes,
+                  row_bytes);
+    }
+  }
+  // 头部取自这条消息，格子换成合并后的整张
+  patch->clear_tiles();
+  patch->set_partial(false);
+  auto* tile = patch->add_tiles();
+  tile->set_width(patch->width());
+  tile->set_height(patch->height());
+  tile->mutable_cells()->swap(cells);
+  full->Swap(patch);
+}
+
+// 几何更新合并进添加命令。除追加外，更新与添加中同一几何的 oneof 字段号
+// 和消息类型相同，按字段号经反射找到对方。部分更新只交换 field_mask 中的字段
+template <typename UpdateGeometry, typename AddObject>
+void merge_geometry(UpdateGeometry* update, AddObject* add) {
+  const int number = static_cast<int>(update->geometry_data_case());
+  if (number == UpdateGeometry::kAppendPoints) {
+    append_points(update->append_points(), add);
+    return;
+  }
+  if (number == UpdateGeometry::kAppendPoses) {
+    if (add->has_trajectory_2d()) {
+      append_poses(update->mutable_append_poses(),
+                   add->mutable_trajectory_2d());
+    }
+    return;
+  }
+  const FieldDescriptor* add_field =
+      AddObject::descriptor()->FindFieldByNumber(number);
+  const FieldDescriptor* update_field =
+      UpdateGeometry::descriptor()->FindFieldByNumber(number);
+  if (!add_field || !update_field || !add_field->containing_oneof() ||
+      add_field->message_type() != update_field->message_type()) {
+    return;
+  }
+  Message* patch = update->GetReflection()->MutableMessage(update, update_field);
+  Message* full = add->GetReflection()->MutableMessage(add, add_field);
+  const auto* type = add_field->message_type();
+  if (type == visualization::PointCloud3D::descriptor()) {
+    merge_point_cloud(static_cast<visualization::PointCloud3D*>(patch),
+                      static_cast<visualization::PointCloud3D*>(full));
+  } else if (type == visualization::InstanceArray::descriptor()) {
+    // 每个实例的 float 数，见 visualization.proto 中 InstanceArray 的说明
+    size_t stride = add_field->name() == "box_3d_array" ? 10 : 3;
+    merge_instances(static_cast<visualization::InstanceArray*>(patch),
+                    static_cast<visualization::InstanceArray*>(full), stride);
+  } else if (type == visualization::OccupancyGrid::descriptor()) {
+    merge_grid(static_cast<visualization::OccupancyGrid*>(patch),
+               static_cast<visualization::OccupancyGrid*>(full));
+  } else if (update->field_mask() != 0) {
+    std::vector<const FieldDescriptor*> fields;
+    for (int i = 0; i < type->field_count(); ++i) {
+      const FieldDescriptor* field = type->field(i);
+      if (field->number() < 32 &&
+          (update->field_mask() & (1u << field->number()))) {
+        fields.push_back(field);
+      }
+    }
+    full->GetReflection()->SwapFields(full, patch, fields);
+  } else {
+    full->GetReflection()->Swap(full, patch);
+  }
+}
+
+template <typename Window>
+void clear_objects(visualization::ClearWindow::Scope scope, Window* window) {
+  if (scope == visualization::ClearWindow::ALL) {
+    window->objects.clear();
+    return;
+  }
+  auto layer = scope == visualization::ClearWindow::STATIC
+                   ? visualization::LAYER_STATIC
+                   : visualization::LAYER_DYNAMIC;
+  for (auto it = window->objects.begin(); it != window->objects.end();) {
+    if (it->second.layer() == layer) {
+      it = window->objects.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+template <typename Command, typename Window>
+void apply_command(Command* command, Window* window) {
+  switch (command->command_type_case()) {
+    case Command::kAddObject: {
+      auto* add = command->mutable_add_object();
+      window->objects[add->id()].Swap(add);
+      break;
+    }
+    case Command::kUpdateObjectGeometry: {
+      auto* update = command->mutable_update_object_geometry();
+      // 客户端同样忽略未知图元的更新
+      auto it = window->objects.find(update->id());
+      if (it != window->objects.end()) merge_geometry(update, &it->second);
+      break;
+    }
+    case Command::kUpdateObjectProperties: {
+      auto* props = command->mutable_update_object_properties();
+      auto it = window->objects.find(props->id());
+      if (it == window->objects.end()) break;
+      if (props->material_id() != 0) {
+        it->second.set_material_id(props->material_id());
+        it->second.clear_material();
+      } else {
+        it->second.set_material_id(0);
+        it->second.mutable_material()->Swap(props->mutable_material());
+      }
+      break;
+    }
+    case Command::kDeleteObject:
+      window->objects.erase(command->delete_object().id());
+      break;
+    case Command::kDeleteObjects:
+      for (uint32_t id : command->delete_objects().ids()) {
+        window->objects.erase(id);
+      }
+      break;
+    case Command::kClearWindow:
+      clear_objects(command->clear_window().scope(), window);
+      break;
+    case Command::kCreateWindow:
+      window->create.Swap(command->mutable_create_window());
+      break;
+    case Command::kDefineMaterial: {
+      auto* define = command->mutable_define_material();
+      window->materials[define->material_id()].Swap(define);
+      break;
+    }
+    case Command::kDeleteMaterials:
+      for (uint32_t id : command->delete_materials().material_ids()) {
+        window->materials.erase(id);
+      }
+      break;
+    case Command::kDeleteWindow:  // 已在 apply_update 中处理
+    case Command::COMMAND_TYPE_NOT_SET:
+      break;
+    default:
+      if constexpr (std::is_same_v<Command, visualization::Command3D>) {
+        if (command->has_define_mesh()) {
+          auto* define = command->mutable_define_mesh();
+          window->meshes[define->mesh_id()].Swap(define);
+          break;
+        }
+        if (command->has_delete_meshes()) {
+          for (uint32_t id : command->delete_meshes().mesh_ids()) {
+            window->meshes.erase(id);
+          }
+          break;
+        }
+      }
+      // 其余为窗口设置
+      window->settings[static_cast<int>(command->command_type_case())].Swap(
+          command);
+      break;
+  }
+}
+
+template <typename SceneUpdate, typename Window>
+void apply_update(SceneUpdate* update, std::map<std::string, Window>* windows) {
+  const std::string& id = update->window_id();
+  bool creates = false;
+  for (const auto& command : update->commands()) {
+    // 与客户端一致：删除窗口时忽略同一消息中的其余命令
+    if (command.has_delete_window()) {
+      windows->erase(id);
+      return;
+    }
+    creates = creates || command.has_create_window();
+  }
+  auto it = windows->find(id);
+  if (it == windows->end()) {
+    // 未知窗口的任何消息都会让客户端新建这个窗口
+    it = windows->emplace(id, Window()).first;
+    it->second.name = update->window_name();
+  } else if (creates) {
+    return;  // 客户端忽略对已有窗口的重复创建
+  }
+  for (auto& command : *update->mutable_commands()) {
+    apply_command(&command, &it->second);
+  }
+}
+
+template <typename SceneUpdate, typename Window>
+void snapshot_window(const std::string& id, const Window& window,
+                     std::vector<std::string>* out) {
+  visualization::VisMessage message;
+  SceneUpdate* update = nullptr;
+  auto begin_message = [&]() {
+    message.Clear();
+    update = mutable_scene_update<SceneUpdate>(&message);
+    update->set_window_id(id);
+    update->set_window_name(window.name);
+  };
+
+  begin_message();
+  auto* create = update->add_commands()->mutable_create_window();
+  *create = window.create;
+  create->set_window_id(id);
+  if (create->window_name().empty()) create->set_window_name(window.name);
+  for (const auto& [type, command] : window.settings) {
+    *update->add_commands() = command;
+  }
+  // 图元引用的材质和网格先于图元定义
+  for (const auto& [material_id, define] : window.materials) {
+    *update->add_commands()->mutable_define_material() = define;
+  }
+  if constexpr (std::is_same_v<SceneUpdate, visualization::Scene3DUpdate>) {
+    for (const auto& [mesh_id, define] : window.meshes) {
+      *update->add_commands()->mutable_define_mesh() = define;
+    }
+  }
+
+  size_t bytes = message.ByteSizeLong();
+  for (const auto& [object_id, add] : window.objects) {
+    if (bytes >= kSnapshotChunkBytes) {
+      out->push_back(message.SerializeAsString());
+      begin_message();
+      bytes = 0;
+    }
+    *update->add_commands()->mutable_add_object() = add;
+    bytes += add.ByteSizeLong() + 4;
+  }
+  if (update->commands_size() > 0) {
+    out->push_back(message.SerializeAsString());
+  }
+}
+
+template <typename SceneUpdate, typename Window>
+void delete_window_messages(const std::map<std::string, Window>& windows,
+                            std::vector<std::string>* out) {
+  for (const auto& [id, window] : windows) {
+    visualization::VisMessage message;
+    SceneUpdate* update = mutable_scene_update<SceneUpdate>(&message);
+    update->set_window_id(id);
+    update->add_commands()->mutable_delete_window()->set_window_id(id);
+    out->push_back(message.SerializeAsString());
+  }
+}
+
+}  // namespace
+
+void SceneModel::apply(visualization::VisMessage* message) {
+  if (message->has_scene_2d_update()) {
+    apply_update(message->mutable_scene_2d_update(), &m_windows_2d);
+  } else if (message->has_scene_3d_update()) {
+    apply_update(message->mutable_scene_3d_update(), &m_windows_3d);
+  }
+}
+
+void SceneModel::clear() {
+  m_windows_2d.clear();
+  m_windows_3d.clear();
+}
+
+std::vector<std::string> SceneModel::snapshot() const {
+  std::vector<std::string> messages;
+  for (const auto& [id, window] : m_windows_2d) {
+    snapshot_window<visualization::Scene2DUpdate>(id, window, &messages);
+  }
+  for (const auto& [id, window] : m_windows_3d) {
+    snapshot_window<visualization::Scene3DUpdate>(id, window, &messages);
+  }
+  return messages;
+}
+
+std::vector<std::string> SceneModel::delete_windows() const {
+  std::vector<std::string> messages;
+  delete_window_messages<visualization::Scene2DUpdate>(m_windows_2d, &messages);
+  delete_window_messages<visualization::Scene3DUpdate>(m_windows_3d, &messages);
+  return messages;
+}
+
+size_t SceneModel::object_count() const {
+  size_t count = 0;
+  for (const auto& [id, window] : m_windows_2d) count += window.objects.size();
+  for (const auto& [id, window] : m_windows_3d) count += window.objects.size();
+  return count;
+}
@@ -0,0 +1,52 @@
+// tools/replay/scene_model.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "visualization.pb.h"
+
+// 按协议维护的场景状态，相当于一个不渲染的客户端：依次应用录制中的消息，
+// 随时可以把当前场景导出为一组消息，发给空白的客户端即得到同样的场景。
+// 每个图元只保留一条添加命令，之后的几何和材质更新（包括部分更新、
+// 追加、点云分块、实例和栅格的局部写入）都合并进去，因此导出的大小
+// 只取决于场景本身，与录制的长短无关
+class SceneModel {
+ public:
+  // 应用一条消息。其中的数据会被移入模型，调用后 message 不再可用
+  void apply(visualization::VisMessage* message);
+  void clear();
+
+  // 当前场景：每个窗口依次为窗口创建、窗口设置和材质/网格定义，
+  // 然后是分块的添加命令。返回序列化后的消息
+  std::vector<std::string> snapshot() const;
+  // 让客户端删除当前全部窗口的消息
+  std::vector<std::string> delete_windows() const;
+
+  size_t window_count() const {
+    return m_windows_2d.size() + m_windows_3d.size();
+  }
+  size_t object_count() const;
+
+  template <typename Command, typename AddObject>
+  struct Window {
+    std::string name;
+    visualization::CreateWindow create;
+    // 窗口设置（标题、网格、图例等）每类只保留最后一条，键为命令类型
+    std::map<int, Command> settings;
+    std::map<uint32_t, visualization::DefineMaterial> materials;
+    std::map<uint32_t, visualization::DefineMesh> meshes;  // 仅 3D 窗口
+    std::map<uint32_t, AddObject> objects;  // 合并了之后全部更新的添加命令
+  };
+  using Window2D =
+      Window<visualization::Command2D, visualization::Add2DObject>;
+  using Window3D =
+      Window<visualization::Command3D, visualization::Add3DObject>;
+
+ private:
+  std::map<std::string, Window2D> m_windows_2d;
+  std::map<std::string, Window3D> m_windows_3d;
+};
@@ -0,0 +1,451 @@
+// vis_stream/tools/replay/vis_stream_replay.cpp
+//
+// 录制回放：读取 VisualizationServer::start_recording 写下的录制，以同样的
+// WebSocket 协议发给现有的网页客户端。录制按原始时间间隔播放，可变速、
+// 暂停、单步，或跳转到任意时间；控制命令从标准输入读取（输入 h 查看）。
+//
+// 第一次打开录制时扫描全部数据，在旁边写下关键帧和索引（见 keyframe_index.h），
+// 之后跳转只需载入最近的关键帧再应用少量消息。
+//
+// 用法: vis_stream_replay <path_prefix> [--port 9002] [--speed 1]
+//                         [--start 秒] [--paused] [--keyframe-mb 32]
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <websocketpp/config/asio_no_tls.hpp>
+#include <websocketpp/server.hpp>
+
+#include "keyframe_index.h"
+#include "recording_reader.h"
+#include "scene_model.h"
+#include "visualization.pb.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double to_seconds(int64_t us) { return static_cast<double>(us) / 1e6; }
+
+class ReplayServer {
+ public:
+  using server = websocketpp::server<websocketpp::config::asio>;
+  using connection_hdl = websocketpp::connection_hdl;
+
+  ReplayServer(const RecordingReader& reader, const KeyframeIndex& index)
+      : m_reader(reader),
+        m_index(index),
+        m_clock_us(index.first_timestamp()),
+        m_clock_wall(Clock::now()) {
+    m_server.clear_access_channels(websocketpp::log::alevel::all);
+    m_server.clear_error_channels(websocketpp::log::elevel::all);
+    m_server.init_asio();
+    m_server.set_reuse_addr(true);
+    m_server.set_open_handler(
+        std::bind(&ReplayServer::on_open, this, std::placeholders::_1));
+    m_server.set_close_handler(
+        std::bind(&ReplayServer::on_close, this, std::placeholders::_1));
+  }
+
+  bool run(uint16_t port) {
+    try {
+      m_server.listen(port);
+      m_server.start_accept();
+    } catch (const std::exception& e) {
+      std::cerr << "❌ 错误：无法监听端口 " << port << ": " << e.what()
+                << std::endl;
+      return false;
+    }
+    m_io_thread = std::thread([this]() { m_server.run(); });
+    m_playback_thread = std::thread([this]() { playback_loop(); });
+    std::cout << "Replay server started on port " << port << std::endl;
+    return true;
+  }
+
+  void stop() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+    }
+    m_wake.notify_all();
+    if (m_playback_thread.joinable()) m_playback_thread.join();
+
+    m_server.stop_listening();
+    std::vector<connection_hdl> clients;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      clients.assign(m_clients.begin(), m_clients.end());
+    }
+    for (const connection_hdl& hdl : clients) {
+      websocketpp::lib::error_code ec;
+      m_server.close(hdl, websocketpp::close::status::going_away, "", ec);
+    }
+    m_server.stop();
+    if (m_io_thread.joinable()) m_io_thread.join();
+  }
+
+  // --- 播放控制，由控制台线程调用 ---
+
+  void set_paused(bool paused) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (paused == m_paused) return;
+    reanchor_locked();
+    m_paused = paused;
+    m_wake.notify_all();
+  }
+
+  void toggle_pause() {
+    bool paused;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      paused = m_paused;
+    }
+    set_paused(!paused);
+    std::cout << (paused ? "▶️ 继续" : "⏸ 暂停") << std::endl;
+  }
+
+  // 暂停并依次播放接下来的 frames 条消息
+  void step(size_t frames) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    reanchor_locked();
+    m_paused = true;
+    m_steps += frames;
+    m_wake.notify_all();
+  }
+
+  void set_speed(double speed) {
+    if (!(speed > 0.0)) {
+      std::cerr << "❌ 错误：播放速度必须大于 0" << std::endl;
+      return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    reanchor_locked();
+    m_speed = speed;
+    m_wake.notify_all();
+  }
+
+  // 客户端先删除现有窗口，再收到目标时间的完整场景：从之前最近的关键帧
+  // 载入场景，应用其后到目标时间为止的消息
+  void seek(int64_t timestamp_us) {
+    auto start = Clock::now();
+    timestamp_us = std::min(std::max(timestamp_us, m_index.first_timestamp()),
+                            m_index.last_timestamp());
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<std::string> removal = m_model.delete_windows();
+    FramePosition position;
+    if (const Keyframe* keyframe = m_index.find(timestamp_us)) {
+      m_index.load(*keyframe, &m_model);
+      position = keyframe->next;
+    } else {
+      m_model.clear();
+    }
+    size_t applied = 0;
+    FramePosition next = position;
+    RecordedFrame frame;
+    while (m_reader.next(&next, &frame) && frame.timestamp_us <= timestamp_us) {
+      apply_locked(frame);
+      position = next;
+      ++applied;
+    }
+    m_position = position;
+    m_clock_us = timestamp_us;
+    m_clock_wall = Clock::now();
+    m_steps = 0;
+    // 跳转点可能在一帧中间，客户端暂存着的半帧先全部应用，
+    // 否则之后的删除和快照也要排在暂存之后等待下一个帧提交
+    visualization::VisMessage flush;
+    flush.mutable_frame_commit();
+    broadcast_locked(flush.SerializeAsString());
+    for (const std::string& message : removal) broadcast_locked(message);
+    for (const std::string& message : m_model.snapshot()) {
+      broadcast_locked(message);
+    }
+    m_wake.notify_all();
+    std::printf("⏩ 跳转到 %.3f s：之后应用 %zu 条消息，用时 %.1f ms\n",
+                to_seconds(timestamp_us - m_index.first_timestamp()), applied,
+                std::chrono::duration<double, std::milli>(Clock::now() - start)
+                    .count());
+  }
+
+  // 相对当前播放位置跳转
+  void seek_relative(double seconds) {
+    int64_t now_us;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      now_us = playback_time_locked(Clock::now());
+    }
+    seek(now_us + static_cast<int64_t>(seconds * 1e6));
+  }
+
+  void print_status() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    int64_t now_us = playback_time_locked(Clock::now());
+    std::printf(
+        "%s %.3f / %.3f s  速度 %.2fx  客户端 %zu  窗口 %zu  图元 %zu\n",
+        m_paused ? "⏸" : "▶️",
+        to_seconds(now_us - m_index.first_timestamp()),
+        to_seconds(m_index.last_timestamp() - m_index.first_timestamp()),
+        m_speed, m_clients.size(), m_model.window_count(),
+        m_model.object_count());
+  }
+
+ private:
+  // 播放时钟：m_clock_wall 时刻的回放时间为 m_clock_us，之后按 m_speed 前进，
+  // 到录制末尾为止
+  int64_t playback_time_locked(Clock::time_point now) const {
+    if (m_paused) return m_clock_us;
+    auto elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(now - m_clock_wall);
+    int64_t time_us = m_clock_us + static_cast<int64_t>(
+                                       static_cast<double>(elapsed.count()) *
+                                       m_speed);
+    return std::min(time_us, m_index.last_timestamp());
+  }
+
+  void reanchor_locked() {
+    auto now = Clock::now();
+    m_clock_us = playback_time_locked(now);
+    m_clock_wall = now;
+  }
+
+  void playback_loop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    bool ended = false;
+    while (!m_stopping) {
+      FramePosition next = m_position;
+      RecordedFrame frame;
+      if (!m_reader.next(&next, &frame)) {
+        if (!ended) std::cout << "⏹ 已播放到录制末尾" << std::endl;
+        ended = true;
+        m_steps = 0;
+        m_wake.wait(lock);
+        continue;
+      }
+      ended = false;
+
+      if (m_steps > 0) {
+        --m_steps;
+        m_clock_us = frame.timestamp_us;
+        m_clock_wall = Clock::now();
+      } else if (m_paused) {
+        m_wake.wait(lock);
+        continue;
+      } else {
+        auto now = Clock::now();
+        int64_t ahead = frame.timestamp_us - playback_time_locked(now);
+        if (ahead > 0) {
+          m_wake.wait_until(lock, now + std::chrono::microseconds(
+                                            static_cast<int64_t>(
+                                                static_cast<double>(ahead) /
+                                                m_speed)));
+          continue;
+        }
+        // 客户端积压过多时停住时钟，等它们追上后接着播放
+        if (clients_backlogged_locked()) {
+          reanchor_locked();
+          m_wake.wait_for(lock, kBackpressurePollInterval);
+          m_clock_wall = Clock::now();
+          continue;
+        }
+      }
+
+      m_position = next;
+      broadcast_locked(frame.data, frame.size);
+      apply_locked(frame);
+    }
+  }
+
+  void apply_locked(const RecordedFrame& frame) {
+    if (m_message.ParseFromArray(frame.data, static_cast<int>(frame.size))) {
+      m_model.apply(&m_message);
+    }
+  }
+
+  void broadcast_locked(const void* data, size_t size) {
+    for (const connection_hdl& hdl : m_clients) {
+      websocketpp::lib::error_code ec;
+      m_server.send(hdl, data, size, websocketpp::frame::opcode::binary, ec);
+    }
+  }
+
+  void broadcast_locked(const std::string& message) {
+    broadcast_locked(message.data(), message.size());
+  }
+
+  bool clients_backlogged_locked() {
+    for (const connection_hdl& hdl : m_clients) {
+      websocketpp::lib::error_code ec;
+      server::connection_ptr con = m_server.get_con_from_hdl(hdl, ec);
+      if (!ec && con->get_buffered_amount() > kClientHighWater) return true;
+    }
+    return false;
+  }
+
+  // 新客户端先收到当前场景，之后与其他客户端一起接收回放
+  void on_open(connection_hdl hdl) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_clients.insert(hdl);
+    for (const std::string& message : m_model.snapshot()) {
+      websocketpp::lib::error_code ec;
+      m_server.send(hdl, message.data(), message.size(),
+                    websocketpp::frame::opcode::binary, ec);
+    }
+    std::cout << "✅ 客户端连接成功（当前 " << m_clients.size() << " 个）"
+              << std::endl;
+  }
+
+  void on_close(connection_hdl hdl) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_clients.erase(hdl);
+    std::cout << "Client disconnected." << std::endl;
+  }
+
+  static constexpr size_t kClientHighWater = 32 * 1024 * 1024;
+  static constexpr std::chrono::milliseconds kBackpressurePollInterval{5};
+
+  server m_server;
+  std::thread m_io_thread;
+  std::thread m_playback_thread;
+  const RecordingReader& m_reader;
+  const KeyframeIndex& m_index;
+
+  // 以下受 m_mutex 保护
+  std::mutex m_mutex;
+  std::condition_variable m_wake;  // 控制命令或停止时唤醒播放线程
+  std::set<connection_hdl, std::owner_less<connection_hdl>> m_clients;
+  SceneModel m_model;  // 播放位置处的场景，供新客户端和跳转使用
+  visualization::VisMessage m_message;  // 复用的解析缓冲
+  FramePosition m_position;             // 下一条要播放的消息
+  int64_t m_clock_us;
+  Clock::time_point m_clock_wall;
+  double m_speed = 1.0;
+  bool m_paused = false;
+  size_t m_steps = 0;  // 待单步播放的消息数
+  bool m_stopping = false;
+};
+
+void print_help() {
+  std::cout << "命令：\n"
+               "  p          暂停 / 继续\n"
+               "  s [n]      暂停并单步播放 n 条消息（默认 1）\n"
+               "  x <倍速>   播放速度，如 0.5、4\n"
+               "  g <秒>     跳转到录制开始后的第几秒；+n / -n 为相对当前位置\n"
+               "  i          当前状态\n"
+               "  q          退出\n"
+            << std::flush;
+}
+
+void print_usage() {
+  std::cerr << "用法: vis_stream_replay <path_prefix> [--port 9002] "
+               "[--speed 1] [--start 秒] [--paused] [--keyframe-mb 32]"
+            << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    print_usage();
+    return 1;
+  }
+  std::string prefix = argv[1];
+  uint16_t port = 9002;
+  double speed = 1.0;
+  double start_seconds = 0.0;
+  bool paused = false;
+  uint64_t keyframe_mb = 32;
+  for (int i = 2; i < argc; ++i) {
+    std::string arg = argv[i];
+    bool has_value = i + 1 < argc;
+    if (arg == "--port" && has_value) {
+      port = static_cast<uint16_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (arg == "--speed" && has_value) {
+      speed = std::strtod(argv[++i], nullptr);
+    } else if (arg == "--start" && has_value) {
+      start_seconds = std::strtod(argv[++i], nullptr);
+    } else if (arg == "--paused") {
+      paused = true;
+    } else if (arg == "--keyframe-mb" && has_value) {
+      keyframe_mb = std::strtoull(argv[++i], nullptr, 10);
+    } else {
+      print_usage();
+      return 1;
+    }
+  }
+
+  RecordingReader reader;
+  if (!reader.open(prefix)) return 1;
+  KeyframeIndex index;
+  auto index_start = Clock::now();
+  if (!index.open(prefix, reader, std::max<uint64_t>(keyframe_mb, 1) << 20)) {
+    return 1;
+  }
+  std::printf("✅ 录制 %s：%zu 个文件，%llu 条消息，时长 %.3f s，%zu 个关键帧"
+              "（打开用时 %.0f ms）\n",
+              prefix.c_str(), reader.segments(),
+              static_cast<unsigned long long>(index.frame_count()),
+              to_seconds(index.last_timestamp() - index.first_timestamp()),
+              index.size(),
+              std::chrono::duration<double, std::milli>(Clock::now() -
+                                                        index_start)
+                  .count());
+
+  ReplayServer replay(reader, index);
+  replay.set_speed(speed);
+  replay.set_paused(paused);
+  if (start_seconds > 0.0) {
+    replay.seek(index.first_timestamp() +
+                static_cast<int64_t>(start_seconds * 1e6));
+  }
+  if (!replay.run(port)) return 1;
+  print_help();
+
+  std::string line;
+  while (std::getline(std::cin, line)) {
+    std::istringstream in(line);
+    std::string command;
+    if (!(in >> command)) continue;
+    if (command == "p") {
+      replay.toggle_pause();
+    } else if (command == "s") {
+      size_t frames = 1;
+      in >> frames;
+      replay.step(frames);
+    } else if (command == "x") {
+      double value = 0.0;
+      if (in >> value) replay.set_speed(value);
+    } else if (command == "g") {
+      std::string target;
+      in >> target;
+      if (target.empty()) continue;
+      double seconds = std::strtod(target.c_str(), nullptr);
+      if (target[0] == '+' || target[0] == '-') {
+        replay.seek_relative(seconds);
+      } else {
+        replay.seek(index.first_timestamp() +
+                    static_cast<int64_t>(seconds * 1e6));
+      }
+    } else if (command == "i") {
+      replay.print_status();
+    } else if (command == "q") {
+      break;
+    } else {
+      print_help();
+    }
+  }
+  // 标准输入关闭（如在后台运行）时继续服务，直到进程被终止
+  if (!std::cin) {
+    while (true) std::this_thread::sleep_for(std::chrono::hours(1));
+  }
+  replay.stop();
+  return 0;
+}
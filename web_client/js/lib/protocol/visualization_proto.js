@@ -10,26 +10,43 @@
 
 goog.provide('proto.visualization.Add2DObject');
 goog.provide('proto.visualization.Add3DObject');
+goog.provide('proto.visualization.AppendPoints');
+goog.provide('proto.visualization.AppendPoses');
 goog.provide('proto.visualization.Ball');
 goog.provide('proto.visualization.Box2D');
 goog.provide('proto.visualization.Box3D');
 goog.provide('proto.visualization.Circle');
+goog.provide('proto.visualization.ClearWindow');
+goog.provide('proto.visualization.ClearWindow.Scope');
 goog.provide('proto.visualization.ColorRGBA');
 goog.provide('proto.visualization.Command2D');
 goog.provide('proto.visualization.Command3D');
 goog.provide('proto.visualization.CreateWindow');
+goog.provide('proto.visualization.DefineMaterial');
+goog.provide('proto.visualization.DefineMesh');
+goog.provide('proto.visualization.DeleteMaterials');
+goog.provide('proto.visualization.DeleteMeshes');
 goog.provide('proto.visualization.DeleteObject');
+goog.provide('proto.visualization.DeleteObjects');
 goog.provide('proto.visualization.DeleteWindow');
+goog.provide('proto.visualization.FrameCommit');
+goog.provide('proto.visualization.GridTile');
+goog.provide('proto.visualization.InstanceArray');
 goog.provide('proto.visualization.Line2D');
 goog.provide('proto.visualization.Line3D');
 goog.provide('proto.visualization.Material');
 goog.provide('proto.visualization.Material.LineStyle');
 goog.provide('proto.visualization.Material.PointShape');
+goog.provide('proto.visualization.ObjectLayer');
+goog.provide('proto.visualization.OccupancyGrid');
+goog.provide('proto.visualization.OccupancyGrid.CellType');
 goog.provide('proto.visualization.Point2D');
 goog.provide('proto.visualization.Point3D');
+goog.provide('proto.visualization.PointCloud3D');
 goog.provide('proto.visualization.Polygon');
 goog.provide('proto.visualization.Pose2D');
 goog.provide('proto.visualization.Pose3D');
+goog.provide('proto.visualization.Quantization');
 goog.provide('proto.visualization.Quaternion');
 goog.provide('proto.visualization.Scene2DUpdate');
 goog.provide('proto.visualization.Scene3DUpdate');
@@ -39,6 +56,7 @@ goog.provide('proto.visualization.SetGridVisible');
 goog.provide('proto.visualization.SetLegend');
 goog.provide('proto.visualization.SetTitle');
 goog.provide('proto.visualization.Trajectory2D');
+goog.provide('proto.visualization.TriangleMesh3D');
 goog.provide('proto.visualization.Update2DObjectGeometry');
 goog.provide('proto.visualization.Update3DObjectGeometry');
 goog.provide('proto.visualization.UpdateObjectProperties');
@@ -1824,7 +1842,7 @@ if (goog.DEBUG && !COMPILED) {
  * @private {!Array<number>}
  * @const
  */
-proto.visualization.Line2D.repeatedFields_ = [1];
+proto.visualization.Line2D.repeatedFields_ = [3];
 
 
 
@@ -1855,8 +1873,8 @@ proto.visualization.Line2D.prototype.toObject = function(opt_includeInstance) {
  */
 proto.visualization.Line2D.toObject = function(includeInstance, msg) {
   var f, obj = {
-    pointsList: jspb.Message.toObjectList(msg.getPointsList(),
-    proto.visualization.Point2D.toObject, includeInstance)
+    xy: msg.getXy_asB64(),
+    dxyList: (f = jspb.Message.getRepeatedField(msg, 3)) == null ? undefined : f
   };
 
   if (includeInstance) {
@@ -1893,10 +1911,13 @@ proto.visualization.Line2D.deserializeBinaryFromReader = function(msg, reader) {
     }
     var field = reader.getFieldNumber();
     switch (field) {
-    case 1:
-      var value = new proto.visualization.Point2D;
-      reader.readMessage(value,proto.visualization.Point2D.deserializeBinaryFromReader);
-      msg.addPoints(value);
+    case 2:
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setXy(value);
+      break;
+    case 3:
+      var value = /** @type {!Array<number>} */ (reader.readPackedSint32());
+      msg.setDxyList(value);
       break;
     default:
       reader.skipField();
@@ -1927,45 +1948,88 @@ proto.visualization.Line2D.prototype.serializeBinary = function() {
  */
 proto.visualization.Line2D.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getPointsList();
+  f = message.getXy_asU8();
   if (f.length > 0) {
-    writer.writeRepeatedMessage(
-      1,
-      f,
-      proto.visualization.Point2D.serializeBinaryToWriter
+    writer.writeBytes(
+      2,
+      f
+    );
+  }
+  f = message.getDxyList();
+  if (f.length > 0) {
+    writer.writePackedSint32(
+      3,
+      f
     );
   }
 };
 
 
 /**
- * repeated Point2D points = 1;
- * @return {!Array<!proto.visualization.Point2D>}
+ * optional bytes xy = 2;
+ * @return {!(string|Uint8Array)}
  */
-proto.visualization.Line2D.prototype.getPointsList = function() {
-  return /** @type{!Array<!proto.visualization.Point2D>} */ (
-    jspb.Message.getRepeatedWrapperField(this, proto.visualization.Point2D, 1));
+proto.visualization.Line2D.prototype.getXy = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
 };
 
 
-/** @param {!Array<!proto.visualization.Point2D>} value */
-proto.visualization.Line2D.prototype.setPointsList = function(value) {
-  jspb.Message.setRepeatedWrapperField(this, 1, value);
+/**
+ * optional bytes xy = 2;
+ * This is a type-conversion wrapper around `getXy()`
+ * @return {string}
+ */
+proto.visualization.Line2D.prototype.getXy_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getXy()));
+};
+
+
+/**
+ * optional bytes xy = 2;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getXy()`
+ * @return {!Uint8Array}
+ */
+proto.visualization.Line2D.prototype.getXy_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getXy()));
+};
+
+
+/** @param {!(string|Uint8Array)} value */
+proto.visualization.Line2D.prototype.setXy = function(value) {
+  jspb.Message.setProto3BytesField(this, 2, value);
+};
+
+
+/**
+ * repeated sint32 dxy = 3;
+ * @return {!Array<number>}
+ */
+proto.visualization.Line2D.prototype.getDxyList = function() {
+  return /** @type {!Array<number>} */ (jspb.Message.getRepeatedField(this, 3));
+};
+
+
+/** @param {!Array<number>} value */
+proto.visualization.Line2D.prototype.setDxyList = function(value) {
+  jspb.Message.setField(this, 3, value || []);
 };
 
 
 /**
- * @param {!proto.visualization.Point2D=} opt_value
+ * @param {!number} value
  * @param {number=} opt_index
- * @return {!proto.visualization.Point2D}
  */
-proto.visualization.Line2D.prototype.addPoints = function(opt_value, opt_index) {
-  return jspb.Message.addToRepeatedWrapperField(this, 1, opt_value, proto.visualization.Point2D, opt_index);
+proto.visualization.Line2D.prototype.addDxy = function(value, opt_index) {
+  jspb.Message.addToRepeatedField(this, 3, value, opt_index);
 };
 
 
-proto.visualization.Line2D.prototype.clearPointsList = function() {
-  this.setPointsList([]);
+proto.visualization.Line2D.prototype.clearDxyList = function() {
+  this.setDxyList([]);
 };
 
 
@@ -2160,7 +2224,7 @@ if (goog.DEBUG && !COMPILED) {
  * @private {!Array<number>}
  * @const
  */
-proto.visualization.Polygon.repeatedFields_ = [1];
+proto.visualization.Polygon.repeatedFields_ = [3];
 
 
 
@@ -2191,8 +2255,8 @@ proto.visualization.Polygon.prototype.toObject = function(opt_includeInstance) {
  */
 proto.visualization.Polygon.toObject = function(includeInstance, msg) {
   var f, obj = {
-    verticesList: jspb.Message.toObjectList(msg.getVerticesList(),
-    proto.visualization.Point2D.toObject, includeInstance)
+    xy: msg.getXy_asB64(),
+    dxyList: (f = jspb.Message.getRepeatedField(msg, 3)) == null ? undefined : f
   };
 
   if (includeInstance) {
@@ -2229,10 +2293,13 @@ proto.visualization.Polygon.deserializeBinaryFromReader = function(msg, reader)
     }
     var field = reader.getFieldNumber();
     switch (field) {
-    case 1:
-      var value = new proto.visualization.Point2D;
-      reader.readMessage(value,proto.visualization.Point2D.deserializeBinaryFromReader);
-      msg.addVertices(value);
+    case 2:
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setXy(value);
+      break;
+    case 3:
+      var value = /** @type {!Array<number>} */ (reader.readPackedSint32());
+      msg.setDxyList(value);
       break;
     default:
       reader.skipField();
@@ -2263,45 +2330,88 @@ proto.visualization.Polygon.prototype.serializeBinary = function() {
  */
 proto.visualization.Polygon.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getVerticesList();
+  f = message.getXy_asU8();
   if (f.length > 0) {
-    writer.writeRepeatedMessage(
-      1,
-      f,
-      proto.visualization.Point2D.serializeBinaryToWriter
+    writer.writeBytes(
+      2,
+      f
+    );
+  }
+  f = message.getDxyList();
+  if (f.length > 0) {
+    writer.writePackedSint32(
+      3,
+      f
     );
   }
 };
 
 
 /**
- * repeated Point2D vertices = 1;
- * @return {!Array<!proto.visualization.Point2D>}
+ * optional bytes xy = 2;
+ * @return {!(string|Uint8Array)}
  */
-proto.visualization.Polygon.prototype.getVerticesList = function() {
-  return /** @type{!Array<!proto.visualization.Point2D>} */ (
-    jspb.Message.getRepeatedWrapperField(this, proto.visualization.Point2D, 1));
+proto.visualization.Polygon.prototype.getXy = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
 };
 
 
-/** @param {!Array<!proto.visualization.Point2D>} value */
-proto.visualization.Polygon.prototype.setVerticesList = function(value) {
-  jspb.Message.setRepeatedWrapperField(this, 1, value);
+/**
+ * optional bytes xy = 2;
+ * This is a type-conversion wrapper around `getXy()`
+ * @return {string}
+ */
+proto.visualization.Polygon.prototype.getXy_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getXy()));
+};
+
+
+/**
+ * optional bytes xy = 2;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getXy()`
+ * @return {!Uint8Array}
+ */
+proto.visualization.Polygon.prototype.getXy_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getXy()));
+};
+
+
+/** @param {!(string|Uint8Array)} value */
+proto.visualization.Polygon.prototype.setXy = function(value) {
+  jspb.Message.setProto3BytesField(this, 2, value);
+};
+
+
+/**
+ * repeated sint32 dxy = 3;
+ * @return {!Array<number>}
+ */
+proto.visualization.Polygon.prototype.getDxyList = function() {
+  return /** @type {!Array<number>} */ (jspb.Message.getRepeatedField(this, 3));
+};
+
+
+/** @param {!Array<number>} value */
+proto.visualization.Polygon.prototype.setDxyList = function(value) {
+  jspb.Message.setField(this, 3, value || []);
 };
 
 
 /**
- * @param {!proto.visualization.Point2D=} opt_value
+ * @param {!number} value
  * @param {number=} opt_index
- * @return {!proto.visualization.Point2D}
  */
-proto.visualization.Polygon.prototype.addVertices = function(opt_value, opt_index) {
-  return jspb.Message.addToRepeatedWrapperField(this, 1, opt_value, proto.visualization.Point2D, opt_index);
+proto.visualization.Polygon.prototype.addDxy = function(value, opt_index) {
+  jspb.Message.addToRepeatedField(this, 3, value, opt_index);
 };
 
 
-proto.visualization.Polygon.prototype.clearVerticesList = function() {
-  this.setVerticesList([]);
+proto.visualization.Polygon.prototype.clearDxyList = function() {
+  this.setDxyList([]);
 };
 
 
@@ -3105,19 +3215,12 @@ proto.visualization.Box3D.prototype.setZLength = function(value) {
  * @constructor
  */
 proto.visualization.Line3D = function(opt_data) {
-  jspb.Message.initialize(this, opt_data, 0, -1, proto.visualization.Line3D.repeatedFields_, null);
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
 };
 goog.inherits(proto.visualization.Line3D, jspb.Message);
 if (goog.DEBUG && !COMPILED) {
   proto.visualization.Line3D.displayName = 'proto.visualization.Line3D';
 }
-/**
- * List of repeated fields within this message type.
- * @private {!Array<number>}
- * @const
- */
-proto.visualization.Line3D.repeatedFields_ = [1];
-
 
 
 if (jspb.Message.GENERATE_TO_OBJECT) {
@@ -3147,8 +3250,7 @@ proto.visualization.Line3D.prototype.toObject = function(opt_includeInstance) {
  */
 proto.visualization.Line3D.toObject = function(includeInstance, msg) {
   var f, obj = {
-    pointsList: jspb.Message.toObjectList(msg.getPointsList(),
-    proto.visualization.Point3D.toObject, includeInstance)
+    xyz: msg.getXyz_asB64()
   };
 
   if (includeInstance) {
@@ -3185,10 +3287,9 @@ proto.visualization.Line3D.deserializeBinaryFromReader = function(msg, reader) {
     }
     var field = reader.getFieldNumber();
     switch (field) {
-    case 1:
-      var value = new proto.visualization.Point3D;
-      reader.readMessage(value,proto.visualization.Point3D.deserializeBinaryFromReader);
-      msg.addPoints(value);
+    case 2:
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setXyz(value);
       break;
     default:
       reader.skipField();
@@ -3219,45 +3320,52 @@ proto.visualization.Line3D.prototype.serializeBinary = function() {
  */
 proto.visualization.Line3D.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getPointsList();
+  f = message.getXyz_asU8();
   if (f.length > 0) {
-    writer.writeRepeatedMessage(
-      1,
-      f,
-      proto.visualization.Point3D.serializeBinaryToWriter
+    writer.writeBytes(
+      2,
+      f
     );
   }
 };
 
 
 /**
- * repeated Point3D points = 1;
- * @return {!Array<!proto.visualization.Point3D>}
+ * optional bytes xyz = 2;
+ * @return {!(string|Uint8Array)}
  */
-proto.visualization.Line3D.prototype.getPointsList = function() {
-  return /** @type{!Array<!proto.visualization.Point3D>} */ (
-    jspb.Message.getRepeatedWrapperField(this, proto.visualization.Point3D, 1));
+proto.visualization.Line3D.prototype.getXyz = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
 };
 
 
-/** @param {!Array<!proto.visualization.Point3D>} value */
-proto.visualization.Line3D.prototype.setPointsList = function(value) {
-  jspb.Message.setRepeatedWrapperField(this, 1, value);
+/**
+ * optional bytes xyz = 2;
+ * This is a type-conversion wrapper around `getXyz()`
+ * @return {string}
+ */
+proto.visualization.Line3D.prototype.getXyz_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getXyz()));
 };
 
 
 /**
- * @param {!proto.visualization.Point3D=} opt_value
- * @param {number=} opt_index
- * @return {!proto.visualization.Point3D}
+ * optional bytes xyz = 2;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getXyz()`
+ * @return {!Uint8Array}
  */
-proto.visualization.Line3D.prototype.addPoints = function(opt_value, opt_index) {
-  return jspb.Message.addToRepeatedWrapperField(this, 1, opt_value, proto.visualization.Point3D, opt_index);
+proto.visualization.Line3D.prototype.getXyz_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getXyz()));
 };
 
 
-proto.visualization.Line3D.prototype.clearPointsList = function() {
-  this.setPointsList([]);
+/** @param {!(string|Uint8Array)} value */
+proto.visualization.Line3D.prototype.setXyz = function(value) {
+  jspb.Message.setProto3BytesField(this, 2, value);
 };
 
 
@@ -3272,12 +3380,12 @@ proto.visualization.Line3D.prototype.clearPointsList = function() {
  * @extends {jspb.Message}
  * @constructor
  */
-proto.visualization.Material = function(opt_data) {
+proto.visualization.PointCloud3D = function(opt_data) {
   jspb.Message.initialize(this, opt_data, 0, -1, null, null);
 };
-goog.inherits(proto.visualization.Material, jspb.Message);
+goog.inherits(proto.visualization.PointCloud3D, jspb.Message);
 if (goog.DEBUG && !COMPILED) {
-  proto.visualization.Material.displayName = 'proto.visualization.Material';
+  proto.visualization.PointCloud3D.displayName = 'proto.visualization.PointCloud3D';
 }
 
 
@@ -3292,8 +3400,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     for transitional soy proto support: http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.visualization.Material.prototype.toObject = function(opt_includeInstance) {
-  return proto.visualization.Material.toObject(opt_includeInstance, this);
+proto.visualization.PointCloud3D.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.PointCloud3D.toObject(opt_includeInstance, this);
 };
 
 
@@ -3302,21 +3410,17 @@ proto.visualization.Material.prototype.toObject = function(opt_includeInstance)
  * @param {boolean|undefined} includeInstance Whether to include the JSPB
  *     instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.visualization.Material} msg The msg instance to transform.
+ * @param {!proto.visualization.PointCloud3D} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.Material.toObject = function(includeInstance, msg) {
+proto.visualization.PointCloud3D.toObject = function(includeInstance, msg) {
   var f, obj = {
-    legend: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    color: (f = msg.getColor()) && proto.visualization.ColorRGBA.toObject(includeInstance, f),
-    pointSize: +jspb.Message.getFieldWithDefault(msg, 3, 0.0),
-    lineWidth: +jspb.Message.getFieldWithDefault(msg, 4, 0.0),
-    filled: jspb.Message.getFieldWithDefault(msg, 5, false),
-    fillColor: (f = msg.getFillColor()) && proto.visualization.ColorRGBA.toObject(includeInstance, f),
-    legendOn: jspb.Message.getFieldWithDefault(msg, 7, false),
-    lineStyle: jspb.Message.getFieldWithDefault(msg, 8, 0),
-    pointShape: jspb.Message.getFieldWithDefault(msg, 9, 0)
+    start: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    total: jspb.Message.getFieldWithDefault(msg, 2, 0),
+    xyz: msg.getXyz_asB64(),
+    intensity: msg.getIntensity_asB64(),
+    rgb: msg.getRgb_asB64()
   };
 
   if (includeInstance) {
@@ -3330,23 +3434,23 @@ proto.visualization.Material.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.visualization.Material}
+ * @return {!proto.visualization.PointCloud3D}
  */
-proto.visualization.Material.deserializeBinary = function(bytes) {
+proto.visualization.PointCloud3D.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.visualization.Material;
-  return proto.visualization.Material.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.visualization.PointCloud3D;
+  return proto.visualization.PointCloud3D.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.visualization.Material} msg The message object to deserialize into.
+ * @param {!proto.visualization.PointCloud3D} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.visualization.Material}
+ * @return {!proto.visualization.PointCloud3D}
  */
-proto.visualization.Material.deserializeBinaryFromReader = function(msg, reader) {
+proto.visualization.PointCloud3D.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -3354,42 +3458,24 @@ proto.visualization.Material.deserializeBinaryFromReader = function(msg, reader)
     var field = reader.getFieldNumber();
     switch (field) {
     case 1:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setLegend(value);
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setStart(value);
       break;
     case 2:
-      var value = new proto.visualization.ColorRGBA;
-      reader.readMessage(value,proto.visualization.ColorRGBA.deserializeBinaryFromReader);
-      msg.setColor(value);
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setTotal(value);
       break;
     case 3:
-      var value = /** @type {number} */ (reader.readFloat());
-      msg.setPointSize(value);
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setXyz(value);
       break;
     case 4:
-      var value = /** @type {number} */ (reader.readFloat());
-      msg.setLineWidth(value);
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setIntensity(value);
       break;
     case 5:
-      var value = /** @type {boolean} */ (reader.readBool());
-      msg.setFilled(value);
-      break;
-    case 6:
-      var value = new proto.visualization.ColorRGBA;
-      reader.readMessage(value,proto.visualization.ColorRGBA.deserializeBinaryFromReader);
-      msg.setFillColor(value);
-      break;
-    case 7:
-      var value = /** @type {boolean} */ (reader.readBool());
-      msg.setLegendOn(value);
-      break;
-    case 8:
-      var value = /** @type {!proto.visualization.Material.LineStyle} */ (reader.readEnum());
-      msg.setLineStyle(value);
-      break;
-    case 9:
-      var value = /** @type {!proto.visualization.Material.PointShape} */ (reader.readEnum());
-      msg.setPointShape(value);
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setRgb(value);
       break;
     default:
       reader.skipField();
@@ -3404,9 +3490,9 @@ proto.visualization.Material.deserializeBinaryFromReader = function(msg, reader)
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.visualization.Material.prototype.serializeBinary = function() {
+proto.visualization.PointCloud3D.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.visualization.Material.serializeBinaryToWriter(this, writer);
+  proto.visualization.PointCloud3D.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -3414,265 +3500,194 @@ proto.visualization.Material.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.visualization.Material} message
+ * @param {!proto.visualization.PointCloud3D} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.Material.serializeBinaryToWriter = function(message, writer) {
+proto.visualization.PointCloud3D.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getLegend();
-  if (f.length > 0) {
-    writer.writeString(
+  f = message.getStart();
+  if (f !== 0) {
+    writer.writeUint32(
       1,
       f
     );
   }
-  f = message.getColor();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getTotal();
+  if (f !== 0) {
+    writer.writeUint32(
       2,
-      f,
-      proto.visualization.ColorRGBA.serializeBinaryToWriter
+      f
     );
   }
-  f = message.getPointSize();
-  if (f !== 0.0) {
-    writer.writeFloat(
+  f = message.getXyz_asU8();
+  if (f.length > 0) {
+    writer.writeBytes(
       3,
       f
     );
   }
-  f = message.getLineWidth();
-  if (f !== 0.0) {
-    writer.writeFloat(
+  f = message.getIntensity_asU8();
+  if (f.length > 0) {
+    writer.writeBytes(
       4,
       f
     );
   }
-  f = message.getFilled();
-  if (f) {
-    writer.writeBool(
+  f = message.getRgb_asU8();
+  if (f.length > 0) {
+    writer.writeBytes(
       5,
       f
     );
   }
-  f = message.getFillColor();
-  if (f != null) {
-    writer.writeMessage(
-      6,
-      f,
-      proto.visualization.ColorRGBA.serializeBinaryToWriter
-    );
-  }
-  f = message.getLegendOn();
-  if (f) {
-    writer.writeBool(
-      7,
-      f
-    );
-  }
-  f = message.getLineStyle();
-  if (f !== 0.0) {
-    writer.writeEnum(
-      8,
-      f
-    );
-  }
-  f = message.getPointShape();
-  if (f !== 0.0) {
-    writer.writeEnum(
-      9,
-      f
-    );
-  }
 };
 
 
 /**
- * @enum {number}
+ * optional uint32 start = 1;
+ * @return {number}
  */
-proto.visualization.Material.LineStyle = {
-  SOLID: 0,
-  DASHED: 1,
-  DOTTED: 2
+proto.visualization.PointCloud3D.prototype.getStart = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
 };
 
-/**
- * @enum {number}
- */
-proto.visualization.Material.PointShape = {
-  SQUARE: 0,
-  CIRCLE: 1,
-  CROSS: 2,
-  DIAMOND: 3
+
+/** @param {number} value */
+proto.visualization.PointCloud3D.prototype.setStart = function(value) {
+  jspb.Message.setProto3IntField(this, 1, value);
 };
 
+
 /**
- * optional string legend = 1;
- * @return {string}
+ * optional uint32 total = 2;
+ * @return {number}
  */
-proto.visualization.Material.prototype.getLegend = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+proto.visualization.PointCloud3D.prototype.getTotal = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
 };
 
 
-/** @param {string} value */
-proto.visualization.Material.prototype.setLegend = function(value) {
-  jspb.Message.setProto3StringField(this, 1, value);
+/** @param {number} value */
+proto.visualization.PointCloud3D.prototype.setTotal = function(value) {
+  jspb.Message.setProto3IntField(this, 2, value);
 };
 
 
 /**
- * optional ColorRGBA color = 2;
- * @return {?proto.visualization.ColorRGBA}
+ * optional bytes xyz = 3;
+ * @return {!(string|Uint8Array)}
  */
-proto.visualization.Material.prototype.getColor = function() {
-  return /** @type{?proto.visualization.ColorRGBA} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.ColorRGBA, 2));
+proto.visualization.PointCloud3D.prototype.getXyz = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldWithDefault(this, 3, ""));
 };
 
 
-/** @param {?proto.visualization.ColorRGBA|undefined} value */
-proto.visualization.Material.prototype.setColor = function(value) {
-  jspb.Message.setWrapperField(this, 2, value);
+/**
+ * optional bytes xyz = 3;
+ * This is a type-conversion wrapper around `getXyz()`
+ * @return {string}
+ */
+proto.visualization.PointCloud3D.prototype.getXyz_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getXyz()));
 };
 
 
-proto.visualization.Material.prototype.clearColor = function() {
-  this.setColor(undefined);
+/**
+ * optional bytes xyz = 3;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getXyz()`
+ * @return {!Uint8Array}
+ */
+proto.visualization.PointCloud3D.prototype.getXyz_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getXyz()));
+};
+
+
+/** @param {!(string|Uint8Array)} value */
+proto.visualization.PointCloud3D.prototype.setXyz = function(value) {
+  jspb.Message.setProto3BytesField(this, 3, value);
 };
 
 
 /**
- * Returns whether this field is set.
- * @return {!boolean}
- */
-proto.visualization.Material.prototype.hasColor = function() {
-  return jspb.Message.getField(this, 2) != null;
-};
-
-
-/**
- * optional float point_size = 3;
- * @return {number}
- */
-proto.visualization.Material.prototype.getPointSize = function() {
-  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 3, 0.0));
-};
-
-
-/** @param {number} value */
-proto.visualization.Material.prototype.setPointSize = function(value) {
-  jspb.Message.setProto3FloatField(this, 3, value);
-};
-
-
-/**
- * optional float line_width = 4;
- * @return {number}
+ * optional bytes intensity = 4;
+ * @return {!(string|Uint8Array)}
  */
-proto.visualization.Material.prototype.getLineWidth = function() {
-  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 4, 0.0));
-};
-
-
-/** @param {number} value */
-proto.visualization.Material.prototype.setLineWidth = function(value) {
-  jspb.Message.setProto3FloatField(this, 4, value);
+proto.visualization.PointCloud3D.prototype.getIntensity = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldWithDefault(this, 4, ""));
 };
 
 
 /**
- * optional bool filled = 5;
- * Note that Boolean fields may be set to 0/1 when serialized from a Java server.
- * You should avoid comparisons like {@code val === true/false} in those cases.
- * @return {boolean}
+ * optional bytes intensity = 4;
+ * This is a type-conversion wrapper around `getIntensity()`
+ * @return {string}
  */
-proto.visualization.Material.prototype.getFilled = function() {
-  return /** @type {boolean} */ (jspb.Message.getFieldWithDefault(this, 5, false));
-};
-
-
-/** @param {boolean} value */
-proto.visualization.Material.prototype.setFilled = function(value) {
-  jspb.Message.setProto3BooleanField(this, 5, value);
+proto.visualization.PointCloud3D.prototype.getIntensity_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getIntensity()));
 };
 
 
 /**
- * optional ColorRGBA fill_color = 6;
- * @return {?proto.visualization.ColorRGBA}
+ * optional bytes intensity = 4;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getIntensity()`
+ * @return {!Uint8Array}
  */
-proto.visualization.Material.prototype.getFillColor = function() {
-  return /** @type{?proto.visualization.ColorRGBA} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.ColorRGBA, 6));
-};
-
-
-/** @param {?proto.visualization.ColorRGBA|undefined} value */
-proto.visualization.Material.prototype.setFillColor = function(value) {
-  jspb.Message.setWrapperField(this, 6, value);
-};
-
-
-proto.visualization.Material.prototype.clearFillColor = function() {
-  this.setFillColor(undefined);
+proto.visualization.PointCloud3D.prototype.getIntensity_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getIntensity()));
 };
 
 
-/**
- * Returns whether this field is set.
- * @return {!boolean}
- */
-proto.visualization.Material.prototype.hasFillColor = function() {
-  return jspb.Message.getField(this, 6) != null;
+/** @param {!(string|Uint8Array)} value */
+proto.visualization.PointCloud3D.prototype.setIntensity = function(value) {
+  jspb.Message.setProto3BytesField(this, 4, value);
 };
 
 
 /**
- * optional bool legend_on = 7;
- * Note that Boolean fields may be set to 0/1 when serialized from a Java server.
- * You should avoid comparisons like {@code val === true/false} in those cases.
- * @return {boolean}
+ * optional bytes rgb = 5;
+ * @return {!(string|Uint8Array)}
  */
-proto.visualization.Material.prototype.getLegendOn = function() {
-  return /** @type {boolean} */ (jspb.Message.getFieldWithDefault(this, 7, false));
-};
-
-
-/** @param {boolean} value */
-proto.visualization.Material.prototype.setLegendOn = function(value) {
-  jspb.Message.setProto3BooleanField(this, 7, value);
+proto.visualization.PointCloud3D.prototype.getRgb = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldWithDefault(this, 5, ""));
 };
 
 
 /**
- * optional LineStyle line_style = 8;
- * @return {!proto.visualization.Material.LineStyle}
+ * optional bytes rgb = 5;
+ * This is a type-conversion wrapper around `getRgb()`
+ * @return {string}
  */
-proto.visualization.Material.prototype.getLineStyle = function() {
-  return /** @type {!proto.visualization.Material.LineStyle} */ (jspb.Message.getFieldWithDefault(this, 8, 0));
-};
-
-
-/** @param {!proto.visualization.Material.LineStyle} value */
-proto.visualization.Material.prototype.setLineStyle = function(value) {
-  jspb.Message.setProto3EnumField(this, 8, value);
+proto.visualization.PointCloud3D.prototype.getRgb_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getRgb()));
 };
 
 
 /**
- * optional PointShape point_shape = 9;
- * @return {!proto.visualization.Material.PointShape}
+ * optional bytes rgb = 5;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getRgb()`
+ * @return {!Uint8Array}
  */
-proto.visualization.Material.prototype.getPointShape = function() {
-  return /** @type {!proto.visualization.Material.PointShape} */ (jspb.Message.getFieldWithDefault(this, 9, 0));
+proto.visualization.PointCloud3D.prototype.getRgb_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getRgb()));
 };
 
 
-/** @param {!proto.visualization.Material.PointShape} value */
-proto.visualization.Material.prototype.setPointShape = function(value) {
-  jspb.Message.setProto3EnumField(this, 9, value);
+/** @param {!(string|Uint8Array)} value */
+proto.visualization.PointCloud3D.prototype.setRgb = function(value) {
+  jspb.Message.setProto3BytesField(this, 5, value);
 };
 
 
@@ -3687,43 +3702,19 @@ proto.visualization.Material.prototype.setPointShape = function(value) {
  * @extends {jspb.Message}
  * @constructor
  */
-proto.visualization.Add2DObject = function(opt_data) {
-  jspb.Message.initialize(this, opt_data, 0, -1, null, proto.visualization.Add2DObject.oneofGroups_);
+proto.visualization.InstanceArray = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, proto.visualization.InstanceArray.repeatedFields_, null);
 };
-goog.inherits(proto.visualization.Add2DObject, jspb.Message);
+goog.inherits(proto.visualization.InstanceArray, jspb.Message);
 if (goog.DEBUG && !COMPILED) {
-  proto.visualization.Add2DObject.displayName = 'proto.visualization.Add2DObject';
+  proto.visualization.InstanceArray.displayName = 'proto.visualization.InstanceArray';
 }
 /**
- * Oneof group definitions for this message. Each group defines the field
- * numbers belonging to that group. When of these fields' value is set, all
- * other fields in the group are cleared. During deserialization, if multiple
- * fields are encountered for a group, only the last value seen will be kept.
- * @private {!Array<!Array<number>>}
+ * List of repeated fields within this message type.
+ * @private {!Array<number>}
  * @const
  */
-proto.visualization.Add2DObject.oneofGroups_ = [[3,4,5,6,7,8,9]];
-
-/**
- * @enum {number}
- */
-proto.visualization.Add2DObject.GeometryDataCase = {
-  GEOMETRY_DATA_NOT_SET: 0,
-  POINT_2D: 3,
-  POSE_2D: 4,
-  CIRCLE: 5,
-  BOX_2D: 6,
-  LINE_2D: 7,
-  TRAJECTORY_2D: 8,
-  POLYGON: 9
-};
-
-/**
- * @return {proto.visualization.Add2DObject.GeometryDataCase}
- */
-proto.visualization.Add2DObject.prototype.getGeometryDataCase = function() {
-  return /** @type {proto.visualization.Add2DObject.GeometryDataCase} */(jspb.Message.computeOneofCase(this, proto.visualization.Add2DObject.oneofGroups_[0]));
-};
+proto.visualization.InstanceArray.repeatedFields_ = [2,3];
 
 
 
@@ -3738,8 +3729,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     for transitional soy proto support: http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.visualization.Add2DObject.prototype.toObject = function(opt_includeInstance) {
-  return proto.visualization.Add2DObject.toObject(opt_includeInstance, this);
+proto.visualization.InstanceArray.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.InstanceArray.toObject(opt_includeInstance, this);
 };
 
 
@@ -3748,21 +3739,16 @@ proto.visualization.Add2DObject.prototype.toObject = function(opt_includeInstanc
  * @param {boolean|undefined} includeInstance Whether to include the JSPB
  *     instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.visualization.Add2DObject} msg The msg instance to transform.
+ * @param {!proto.visualization.InstanceArray} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.Add2DObject.toObject = function(includeInstance, msg) {
+proto.visualization.InstanceArray.toObject = function(includeInstance, msg) {
   var f, obj = {
-    id: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    material: (f = msg.getMaterial()) && proto.visualization.Material.toObject(includeInstance, f),
-    point2d: (f = msg.getPoint2d()) && proto.visualization.Point2D.toObject(includeInstance, f),
-    pose2d: (f = msg.getPose2d()) && proto.visualization.Pose2D.toObject(includeInstance, f),
-    circle: (f = msg.getCircle()) && proto.visualization.Circle.toObject(includeInstance, f),
-    box2d: (f = msg.getBox2d()) && proto.visualization.Box2D.toObject(includeInstance, f),
-    line2d: (f = msg.getLine2d()) && proto.visualization.Line2D.toObject(includeInstance, f),
-    trajectory2d: (f = msg.getTrajectory2d()) && proto.visualization.Trajectory2D.toObject(includeInstance, f),
-    polygon: (f = msg.getPolygon()) && proto.visualization.Polygon.toObject(includeInstance, f)
+    total: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    startsList: (f = jspb.Message.getRepeatedField(msg, 2)) == null ? undefined : f,
+    countsList: (f = jspb.Message.getRepeatedField(msg, 3)) == null ? undefined : f,
+    values: msg.getValues_asB64()
   };
 
   if (includeInstance) {
@@ -3776,23 +3762,23 @@ proto.visualization.Add2DObject.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.visualization.Add2DObject}
+ * @return {!proto.visualization.InstanceArray}
  */
-proto.visualization.Add2DObject.deserializeBinary = function(bytes) {
+proto.visualization.InstanceArray.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.visualization.Add2DObject;
-  return proto.visualization.Add2DObject.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.visualization.InstanceArray;
+  return proto.visualization.InstanceArray.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.visualization.Add2DObject} msg The message object to deserialize into.
+ * @param {!proto.visualization.InstanceArray} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.visualization.Add2DObject}
+ * @return {!proto.visualization.InstanceArray}
  */
-proto.visualization.Add2DObject.deserializeBinaryFromReader = function(msg, reader) {
+proto.visualization.InstanceArray.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -3800,48 +3786,20 @@ proto.visualization.Add2DObject.deserializeBinaryFromReader = function(msg, read
     var field = reader.getFieldNumber();
     switch (field) {
     case 1:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setId(value);
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setTotal(value);
       break;
     case 2:
-      var value = new proto.visualization.Material;
-      reader.readMessage(value,proto.visualization.Material.deserializeBinaryFromReader);
-      msg.setMaterial(value);
+      var value = /** @type {!Array<number>} */ (reader.readPackedUint32());
+      msg.setStartsList(value);
       break;
     case 3:
-      var value = new proto.visualization.Point2D;
-      reader.readMessage(value,proto.visualization.Point2D.deserializeBinaryFromReader);
-      msg.setPoint2d(value);
+      var value = /** @type {!Array<number>} */ (reader.readPackedUint32());
+      msg.setCountsList(value);
       break;
     case 4:
-      var value = new proto.visualization.Pose2D;
-      reader.readMessage(value,proto.visualization.Pose2D.deserializeBinaryFromReader);
-      msg.setPose2d(value);
-      break;
-    case 5:
-      var value = new proto.visualization.Circle;
-      reader.readMessage(value,proto.visualization.Circle.deserializeBinaryFromReader);
-      msg.setCircle(value);
-      break;
-    case 6:
-      var value = new proto.visualization.Box2D;
-      reader.readMessage(value,proto.visualization.Box2D.deserializeBinaryFromReader);
-      msg.setBox2d(value);
-      break;
-    case 7:
-      var value = new proto.visualization.Line2D;
-      reader.readMessage(value,proto.visualization.Line2D.deserializeBinaryFromReader);
-      msg.setLine2d(value);
-      break;
-    case 8:
-      var value = new proto.visualization.Trajectory2D;
-      reader.readMessage(value,proto.visualization.Trajectory2D.deserializeBinaryFromReader);
-      msg.setTrajectory2d(value);
-      break;
-    case 9:
-      var value = new proto.visualization.Polygon;
-      reader.readMessage(value,proto.visualization.Polygon.deserializeBinaryFromReader);
-      msg.setPolygon(value);
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setValues(value);
       break;
     default:
       reader.skipField();
@@ -3856,9 +3814,9 @@ proto.visualization.Add2DObject.deserializeBinaryFromReader = function(msg, read
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.visualization.Add2DObject.prototype.serializeBinary = function() {
+proto.visualization.InstanceArray.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.visualization.Add2DObject.serializeBinaryToWriter(this, writer);
+  proto.visualization.InstanceArray.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -3866,340 +3824,428 @@ proto.visualization.Add2DObject.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.visualization.Add2DObject} message
+ * @param {!proto.visualization.InstanceArray} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.Add2DObject.serializeBinaryToWriter = function(message, writer) {
+proto.visualization.InstanceArray.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getId();
-  if (f.length > 0) {
-    writer.writeString(
+  f = message.getTotal();
+  if (f !== 0) {
+    writer.writeUint32(
       1,
       f
     );
   }
-  f = message.getMaterial();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getStartsList();
+  if (f.length > 0) {
+    writer.writePackedUint32(
       2,
-      f,
-      proto.visualization.Material.serializeBinaryToWriter
+      f
     );
   }
-  f = message.getPoint2d();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getCountsList();
+  if (f.length > 0) {
+    writer.writePackedUint32(
       3,
-      f,
-      proto.visualization.Point2D.serializeBinaryToWriter
+      f
     );
   }
-  f = message.getPose2d();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getValues_asU8();
+  if (f.length > 0) {
+    writer.writeBytes(
       4,
-      f,
-      proto.visualization.Pose2D.serializeBinaryToWriter
-    );
-  }
-  f = message.getCircle();
-  if (f != null) {
-    writer.writeMessage(
-      5,
-      f,
-      proto.visualization.Circle.serializeBinaryToWriter
-    );
-  }
-  f = message.getBox2d();
-  if (f != null) {
-    writer.writeMessage(
-      6,
-      f,
-      proto.visualization.Box2D.serializeBinaryToWriter
-    );
-  }
-  f = message.getLine2d();
-  if (f != null) {
-    writer.writeMessage(
-      7,
-      f,
-      proto.visualization.Line2D.serializeBinaryToWriter
-    );
-  }
-  f = message.getTrajectory2d();
-  if (f != null) {
-    writer.writeMessage(
-      8,
-      f,
-      proto.visualization.Trajectory2D.serializeBinaryToWriter
-    );
-  }
-  f = message.getPolygon();
-  if (f != null) {
-    writer.writeMessage(
-      9,
-      f,
-      proto.visualization.Polygon.serializeBinaryToWriter
+      f
     );
   }
 };
 
 
 /**
- * optional string id = 1;
- * @return {string}
+ * optional uint32 total = 1;
+ * @return {number}
  */
-proto.visualization.Add2DObject.prototype.getId = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+proto.visualization.InstanceArray.prototype.getTotal = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
 };
 
 
-/** @param {string} value */
-proto.visualization.Add2DObject.prototype.setId = function(value) {
-  jspb.Message.setProto3StringField(this, 1, value);
+/** @param {number} value */
+proto.visualization.InstanceArray.prototype.setTotal = function(value) {
+  jspb.Message.setProto3IntField(this, 1, value);
 };
 
 
 /**
- * optional Material material = 2;
- * @return {?proto.visualization.Material}
+ * repeated uint32 starts = 2;
+ * @return {!Array<number>}
  */
-proto.visualization.Add2DObject.prototype.getMaterial = function() {
-  return /** @type{?proto.visualization.Material} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Material, 2));
+proto.visualization.InstanceArray.prototype.getStartsList = function() {
+  return /** @type {!Array<number>} */ (jspb.Message.getRepeatedField(this, 2));
 };
 
 
-/** @param {?proto.visualization.Material|undefined} value */
-proto.visualization.Add2DObject.prototype.setMaterial = function(value) {
-  jspb.Message.setWrapperField(this, 2, value);
+/** @param {!Array<number>} value */
+proto.visualization.InstanceArray.prototype.setStartsList = function(value) {
+  jspb.Message.setField(this, 2, value || []);
 };
 
 
-proto.visualization.Add2DObject.prototype.clearMaterial = function() {
-  this.setMaterial(undefined);
+/**
+ * @param {!number} value
+ * @param {number=} opt_index
+ */
+proto.visualization.InstanceArray.prototype.addStarts = function(value, opt_index) {
+  jspb.Message.addToRepeatedField(this, 2, value, opt_index);
 };
 
 
-/**
- * Returns whether this field is set.
- * @return {!boolean}
- */
-proto.visualization.Add2DObject.prototype.hasMaterial = function() {
-  return jspb.Message.getField(this, 2) != null;
+proto.visualization.InstanceArray.prototype.clearStartsList = function() {
+  this.setStartsList([]);
 };
 
 
 /**
- * optional Point2D point_2d = 3;
- * @return {?proto.visualization.Point2D}
+ * repeated uint32 counts = 3;
+ * @return {!Array<number>}
  */
-proto.visualization.Add2DObject.prototype.getPoint2d = function() {
-  return /** @type{?proto.visualization.Point2D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Point2D, 3));
+proto.visualization.InstanceArray.prototype.getCountsList = function() {
+  return /** @type {!Array<number>} */ (jspb.Message.getRepeatedField(this, 3));
 };
 
 
-/** @param {?proto.visualization.Point2D|undefined} value */
-proto.visualization.Add2DObject.prototype.setPoint2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 3, proto.visualization.Add2DObject.oneofGroups_[0], value);
+/** @param {!Array<number>} value */
+proto.visualization.InstanceArray.prototype.setCountsList = function(value) {
+  jspb.Message.setField(this, 3, value || []);
 };
 
 
-proto.visualization.Add2DObject.prototype.clearPoint2d = function() {
-  this.setPoint2d(undefined);
+/**
+ * @param {!number} value
+ * @param {number=} opt_index
+ */
+proto.visualization.InstanceArray.prototype.addCounts = function(value, opt_index) {
+  jspb.Message.addToRepeatedField(this, 3, value, opt_index);
+};
+
+
+proto.visualization.InstanceArray.prototype.clearCountsList = function() {
+  this.setCountsList([]);
 };
 
 
 /**
- * Returns whether this field is set.
- * @return {!boolean}
+ * optional bytes values = 4;
+ * @return {!(string|Uint8Array)}
  */
-proto.visualization.Add2DObject.prototype.hasPoint2d = function() {
-  return jspb.Message.getField(this, 3) != null;
+proto.visualization.InstanceArray.prototype.getValues = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldWithDefault(this, 4, ""));
 };
 
 
 /**
- * optional Pose2D pose_2d = 4;
- * @return {?proto.visualization.Pose2D}
+ * optional bytes values = 4;
+ * This is a type-conversion wrapper around `getValues()`
+ * @return {string}
  */
-proto.visualization.Add2DObject.prototype.getPose2d = function() {
-  return /** @type{?proto.visualization.Pose2D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Pose2D, 4));
+proto.visualization.InstanceArray.prototype.getValues_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getValues()));
 };
 
 
-/** @param {?proto.visualization.Pose2D|undefined} value */
-proto.visualization.Add2DObject.prototype.setPose2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 4, proto.visualization.Add2DObject.oneofGroups_[0], value);
+/**
+ * optional bytes values = 4;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getValues()`
+ * @return {!Uint8Array}
+ */
+proto.visualization.InstanceArray.prototype.getValues_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getValues()));
 };
 
 
-proto.visualization.Add2DObject.prototype.clearPose2d = function() {
-  this.setPose2d(undefined);
+/** @param {!(string|Uint8Array)} value */
+proto.visualization.InstanceArray.prototype.setValues = function(value) {
+  jspb.Message.setProto3BytesField(this, 4, value);
 };
 
 
+
 /**
- * Returns whether this field is set.
- * @return {!boolean}
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
  */
-proto.visualization.Add2DObject.prototype.hasPose2d = function() {
-  return jspb.Message.getField(this, 4) != null;
+proto.visualization.GridTile = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
 };
+goog.inherits(proto.visualization.GridTile, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.visualization.GridTile.displayName = 'proto.visualization.GridTile';
+}
 
 
+if (jspb.Message.GENERATE_TO_OBJECT) {
 /**
- * optional Circle circle = 5;
- * @return {?proto.visualization.Circle}
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
  */
-proto.visualization.Add2DObject.prototype.getCircle = function() {
-  return /** @type{?proto.visualization.Circle} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Circle, 5));
+proto.visualization.GridTile.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.GridTile.toObject(opt_includeInstance, this);
 };
 
 
-/** @param {?proto.visualization.Circle|undefined} value */
-proto.visualization.Add2DObject.prototype.setCircle = function(value) {
-  jspb.Message.setOneofWrapperField(this, 5, proto.visualization.Add2DObject.oneofGroups_[0], value);
-};
-
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.visualization.GridTile} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.GridTile.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    x: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    y: jspb.Message.getFieldWithDefault(msg, 2, 0),
+    width: jspb.Message.getFieldWithDefault(msg, 3, 0),
+    height: jspb.Message.getFieldWithDefault(msg, 4, 0),
+    cells: msg.getCells_asB64()
+  };
 
-proto.visualization.Add2DObject.prototype.clearCircle = function() {
-  this.setCircle(undefined);
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
 };
+}
 
 
 /**
- * Returns whether this field is set.
- * @return {!boolean}
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.visualization.GridTile}
  */
-proto.visualization.Add2DObject.prototype.hasCircle = function() {
-  return jspb.Message.getField(this, 5) != null;
+proto.visualization.GridTile.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.visualization.GridTile;
+  return proto.visualization.GridTile.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
- * optional Box2D box_2d = 6;
- * @return {?proto.visualization.Box2D}
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.visualization.GridTile} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.visualization.GridTile}
  */
-proto.visualization.Add2DObject.prototype.getBox2d = function() {
-  return /** @type{?proto.visualization.Box2D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Box2D, 6));
+proto.visualization.GridTile.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setX(value);
+      break;
+    case 2:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setY(value);
+      break;
+    case 3:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setWidth(value);
+      break;
+    case 4:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setHeight(value);
+      break;
+    case 5:
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setCells(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
 };
 
 
-/** @param {?proto.visualization.Box2D|undefined} value */
-proto.visualization.Add2DObject.prototype.setBox2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 6, proto.visualization.Add2DObject.oneofGroups_[0], value);
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.visualization.GridTile.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.visualization.GridTile.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
 };
 
 
-proto.visualization.Add2DObject.prototype.clearBox2d = function() {
-  this.setBox2d(undefined);
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.visualization.GridTile} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.GridTile.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getX();
+  if (f !== 0) {
+    writer.writeUint32(
+      1,
+      f
+    );
+  }
+  f = message.getY();
+  if (f !== 0) {
+    writer.writeUint32(
+      2,
+      f
+    );
+  }
+  f = message.getWidth();
+  if (f !== 0) {
+    writer.writeUint32(
+      3,
+      f
+    );
+  }
+  f = message.getHeight();
+  if (f !== 0) {
+    writer.writeUint32(
+      4,
+      f
+    );
+  }
+  f = message.getCells_asU8();
+  if (f.length > 0) {
+    writer.writeBytes(
+      5,
+      f
+    );
+  }
 };
 
 
 /**
- * Returns whether this field is set.
- * @return {!boolean}
+ * optional uint32 x = 1;
+ * @return {number}
  */
-proto.visualization.Add2DObject.prototype.hasBox2d = function() {
-  return jspb.Message.getField(this, 6) != null;
+proto.visualization.GridTile.prototype.getX = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
 };
 
 
-/**
- * optional Line2D line_2d = 7;
- * @return {?proto.visualization.Line2D}
- */
-proto.visualization.Add2DObject.prototype.getLine2d = function() {
-  return /** @type{?proto.visualization.Line2D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Line2D, 7));
+/** @param {number} value */
+proto.visualization.GridTile.prototype.setX = function(value) {
+  jspb.Message.setProto3IntField(this, 1, value);
 };
 
 
-/** @param {?proto.visualization.Line2D|undefined} value */
-proto.visualization.Add2DObject.prototype.setLine2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 7, proto.visualization.Add2DObject.oneofGroups_[0], value);
+/**
+ * optional uint32 y = 2;
+ * @return {number}
+ */
+proto.visualization.GridTile.prototype.getY = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
 };
 
 
-proto.visualization.Add2DObject.prototype.clearLine2d = function() {
-  this.setLine2d(undefined);
+/** @param {number} value */
+proto.visualization.GridTile.prototype.setY = function(value) {
+  jspb.Message.setProto3IntField(this, 2, value);
 };
 
 
 /**
- * Returns whether this field is set.
- * @return {!boolean}
+ * optional uint32 width = 3;
+ * @return {number}
  */
-proto.visualization.Add2DObject.prototype.hasLine2d = function() {
-  return jspb.Message.getField(this, 7) != null;
+proto.visualization.GridTile.prototype.getWidth = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 3, 0));
 };
 
 
-/**
- * optional Trajectory2D trajectory_2d = 8;
- * @return {?proto.visualization.Trajectory2D}
- */
-proto.visualization.Add2DObject.prototype.getTrajectory2d = function() {
-  return /** @type{?proto.visualization.Trajectory2D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Trajectory2D, 8));
+/** @param {number} value */
+proto.visualization.GridTile.prototype.setWidth = function(value) {
+  jspb.Message.setProto3IntField(this, 3, value);
 };
 
 
-/** @param {?proto.visualization.Trajectory2D|undefined} value */
-proto.visualization.Add2DObject.prototype.setTrajectory2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 8, proto.visualization.Add2DObject.oneofGroups_[0], value);
+/**
+ * optional uint32 height = 4;
+ * @return {number}
+ */
+proto.visualization.GridTile.prototype.getHeight = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 4, 0));
 };
 
 
-proto.visualization.Add2DObject.prototype.clearTrajectory2d = function() {
-  this.setTrajectory2d(undefined);
+/** @param {number} value */
+proto.visualization.GridTile.prototype.setHeight = function(value) {
+  jspb.Message.setProto3IntField(this, 4, value);
 };
 
 
 /**
- * Returns whether this field is set.
- * @return {!boolean}
+ * optional bytes cells = 5;
+ * @return {!(string|Uint8Array)}
  */
-proto.visualization.Add2DObject.prototype.hasTrajectory2d = function() {
-  return jspb.Message.getField(this, 8) != null;
+proto.visualization.GridTile.prototype.getCells = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldWithDefault(this, 5, ""));
 };
 
 
 /**
- * optional Polygon polygon = 9;
- * @return {?proto.visualization.Polygon}
+ * optional bytes cells = 5;
+ * This is a type-conversion wrapper around `getCells()`
+ * @return {string}
  */
-proto.visualization.Add2DObject.prototype.getPolygon = function() {
-  return /** @type{?proto.visualization.Polygon} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Polygon, 9));
+proto.visualization.GridTile.prototype.getCells_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getCells()));
 };
 
 
-/** @param {?proto.visualization.Polygon|undefined} value */
-proto.visualization.Add2DObject.prototype.setPolygon = function(value) {
-  jspb.Message.setOneofWrapperField(this, 9, proto.visualization.Add2DObject.oneofGroups_[0], value);
+/**
+ * optional bytes cells = 5;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getCells()`
+ * @return {!Uint8Array}
+ */
+proto.visualization.GridTile.prototype.getCells_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getCells()));
 };
 
 
-proto.visualization.Add2DObject.prototype.clearPolygon = function() {
-  this.setPolygon(undefined);
+/** @param {!(string|Uint8Array)} value */
+proto.visualization.GridTile.prototype.setCells = function(value) {
+  jspb.Message.setProto3BytesField(this, 5, value);
 };
-
-
-/**
- * Returns whether this field is set.
- * @return {!boolean}
- */
-proto.visualization.Add2DObject.prototype.hasPolygon = function() {
-  return jspb.Message.getField(this, 9) != null;
-};
-
+
 
 
 /**
@@ -4212,48 +4258,19 @@ proto.visualization.Add2DObject.prototype.hasPolygon = function() {
  * @extends {jspb.Message}
  * @constructor
  */
-proto.visualization.Add3DObject = function(opt_data) {
-  jspb.Message.initialize(this, opt_data, 0, -1, null, proto.visualization.Add3DObject.oneofGroups_);
+proto.visualization.OccupancyGrid = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, proto.visualization.OccupancyGrid.repeatedFields_, null);
 };
-goog.inherits(proto.visualization.Add3DObject, jspb.Message);
+goog.inherits(proto.visualization.OccupancyGrid, jspb.Message);
 if (goog.DEBUG && !COMPILED) {
-  proto.visualization.Add3DObject.displayName = 'proto.visualization.Add3DObject';
+  proto.visualization.OccupancyGrid.displayName = 'proto.visualization.OccupancyGrid';
 }
 /**
- * Oneof group definitions for this message. Each group defines the field
- * numbers belonging to that group. When of these fields' value is set, all
- * other fields in the group are cleared. During deserialization, if multiple
- * fields are encountered for a group, only the last value seen will be kept.
- * @private {!Array<!Array<number>>}
+ * List of repeated fields within this message type.
+ * @private {!Array<number>}
  * @const
  */
-proto.visualization.Add3DObject.oneofGroups_ = [[3,4,5,6,7,8,9,10,11,12,13,14]];
-
-/**
- * @enum {number}
- */
-proto.visualization.Add3DObject.GeometryDataCase = {
-  GEOMETRY_DATA_NOT_SET: 0,
-  POINT_2D: 3,
-  POSE_2D: 4,
-  CIRCLE: 5,
-  BOX_2D: 6,
-  LINE_2D: 7,
-  TRAJECTORY_2D: 8,
-  POLYGON: 9,
-  POINT_3D: 10,
-  POSE_3D: 11,
-  BALL: 12,
-  BOX_3D: 13,
-  LINE_3D: 14
-};
-
-/**
- * @return {proto.visualization.Add3DObject.GeometryDataCase}
- */
-proto.visualization.Add3DObject.prototype.getGeometryDataCase = function() {
-  return /** @type {proto.visualization.Add3DObject.GeometryDataCase} */(jspb.Message.computeOneofCase(this, proto.visualization.Add3DObject.oneofGroups_[0]));
-};
+proto.visualization.OccupancyGrid.repeatedFields_ = [9];
 
 
 
@@ -4268,8 +4285,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     for transitional soy proto support: http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.visualization.Add3DObject.prototype.toObject = function(opt_includeInstance) {
-  return proto.visualization.Add3DObject.toObject(opt_includeInstance, this);
+proto.visualization.OccupancyGrid.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.OccupancyGrid.toObject(opt_includeInstance, this);
 };
 
 
@@ -4278,26 +4295,22 @@ proto.visualization.Add3DObject.prototype.toObject = function(opt_includeInstanc
  * @param {boolean|undefined} includeInstance Whether to include the JSPB
  *     instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.visualization.Add3DObject} msg The msg instance to transform.
+ * @param {!proto.visualization.OccupancyGrid} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.Add3DObject.toObject = function(includeInstance, msg) {
+proto.visualization.OccupancyGrid.toObject = function(includeInstance, msg) {
   var f, obj = {
-    id: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    material: (f = msg.getMaterial()) && proto.visualization.Material.toObject(includeInstance, f),
-    point2d: (f = msg.getPoint2d()) && proto.visualization.Point2D.toObject(includeInstance, f),
-    pose2d: (f = msg.getPose2d()) && proto.visualization.Pose2D.toObject(includeInstance, f),
-    circle: (f = msg.getCircle()) && proto.visualization.Circle.toObject(includeInstance, f),
-    box2d: (f = msg.getBox2d()) && proto.visualization.Box2D.toObject(includeInstance, f),
-    line2d: (f = msg.getLine2d()) && proto.visualization.Line2D.toObject(includeInstance, f),
-    trajectory2d: (f = msg.getTrajectory2d()) && proto.visualization.Trajectory2D.toObject(includeInstance, f),
-    polygon: (f = msg.getPolygon()) && proto.visualization.Polygon.toObject(includeInstance, f),
-    point3d: (f = msg.getPoint3d()) && proto.visualization.Point3D.toObject(includeInstance, f),
-    pose3d: (f = msg.getPose3d()) && proto.visualization.Pose3D.toObject(includeInstance, f),
-    ball: (f = msg.getBall()) && proto.visualization.Ball.toObject(includeInstance, f),
-    box3d: (f = msg.getBox3d()) && proto.visualization.Box3D.toObject(includeInstance, f),
-    line3d: (f = msg.getLine3d()) && proto.visualization.Line3D.toObject(includeInstance, f)
+    width: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    height: jspb.Message.getFieldWithDefault(msg, 2, 0),
+    cellType: jspb.Message.getFieldWithDefault(msg, 3, 0),
+    resolution: +jspb.Message.getFieldWithDefault(msg, 4, 0.0),
+    origin: (f = msg.getOrigin()) && proto.visualization.Vec2.toObject(includeInstance, f),
+    valueMin: +jspb.Message.getFieldWithDefault(msg, 6, 0.0),
+    valueMax: +jspb.Message.getFieldWithDefault(msg, 7, 0.0),
+    partial: jspb.Message.getFieldWithDefault(msg, 8, false),
+    tilesList: jspb.Message.toObjectList(msg.getTilesList(),
+    proto.visualization.GridTile.toObject, includeInstance)
   };
 
   if (includeInstance) {
@@ -4311,23 +4324,23 @@ proto.visualization.Add3DObject.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.visualization.Add3DObject}
+ * @return {!proto.visualization.OccupancyGrid}
  */
-proto.visualization.Add3DObject.deserializeBinary = function(bytes) {
+proto.visualization.OccupancyGrid.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.visualization.Add3DObject;
-  return proto.visualization.Add3DObject.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.visualization.OccupancyGrid;
+  return proto.visualization.OccupancyGrid.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.visualization.Add3DObject} msg The message object to deserialize into.
+ * @param {!proto.visualization.OccupancyGrid} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.visualization.Add3DObject}
+ * @return {!proto.visualization.OccupancyGrid}
  */
-proto.visualization.Add3DObject.deserializeBinaryFromReader = function(msg, reader) {
+proto.visualization.OccupancyGrid.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -4335,73 +4348,42 @@ proto.visualization.Add3DObject.deserializeBinaryFromReader = function(msg, read
     var field = reader.getFieldNumber();
     switch (field) {
     case 1:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setId(value);
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setWidth(value);
       break;
     case 2:
-      var value = new proto.visualization.Material;
-      reader.readMessage(value,proto.visualization.Material.deserializeBinaryFromReader);
-      msg.setMaterial(value);
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setHeight(value);
       break;
     case 3:
-      var value = new proto.visualization.Point2D;
-      reader.readMessage(value,proto.visualization.Point2D.deserializeBinaryFromReader);
-      msg.setPoint2d(value);
+      var value = /** @type {!proto.visualization.OccupancyGrid.CellType} */ (reader.readEnum());
+      msg.setCellType(value);
       break;
     case 4:
-      var value = new proto.visualization.Pose2D;
-      reader.readMessage(value,proto.visualization.Pose2D.deserializeBinaryFromReader);
-      msg.setPose2d(value);
+      var value = /** @type {number} */ (reader.readFloat());
+      msg.setResolution(value);
       break;
     case 5:
-      var value = new proto.visualization.Circle;
-      reader.readMessage(value,proto.visualization.Circle.deserializeBinaryFromReader);
-      msg.setCircle(value);
+      var value = new proto.visualization.Vec2;
+      reader.readMessage(value,proto.visualization.Vec2.deserializeBinaryFromReader);
+      msg.setOrigin(value);
       break;
     case 6:
-      var value = new proto.visualization.Box2D;
-      reader.readMessage(value,proto.visualization.Box2D.deserializeBinaryFromReader);
-      msg.setBox2d(value);
+      var value = /** @type {number} */ (reader.readFloat());
+      msg.setValueMin(value);
       break;
     case 7:
-      var value = new proto.visualization.Line2D;
-      reader.readMessage(value,proto.visualization.Line2D.deserializeBinaryFromReader);
-      msg.setLine2d(value);
+      var value = /** @type {number} */ (reader.readFloat());
+      msg.setValueMax(value);
       break;
     case 8:
-      var value = new proto.visualization.Trajectory2D;
-      reader.readMessage(value,proto.visualization.Trajectory2D.deserializeBinaryFromReader);
-      msg.setTrajectory2d(value);
+      var value = /** @type {boolean} */ (reader.readBool());
+      msg.setPartial(value);
       break;
     case 9:
-      var value = new proto.visualization.Polygon;
-      reader.readMessage(value,proto.visualization.Polygon.deserializeBinaryFromReader);
-      msg.setPolygon(value);
-      break;
-    case 10:
-      var value = new proto.visualization.Point3D;
-      reader.readMessage(value,proto.visualization.Point3D.deserializeBinaryFromReader);
-      msg.setPoint3d(value);
-      break;
-    case 11:
-      var value = new proto.visualization.Pose3D;
-      reader.readMessage(value,proto.visualization.Pose3D.deserializeBinaryFromReader);
-      msg.setPose3d(value);
-      break;
-    case 12:
-      var value = new proto.visualization.Ball;
-      reader.readMessage(value,proto.visualization.Ball.deserializeBinaryFromReader);
-      msg.setBall(value);
-      break;
-    case 13:
-      var value = new proto.visualization.Box3D;
-      reader.readMessage(value,proto.visualization.Box3D.deserializeBinaryFromReader);
-      msg.setBox3d(value);
-      break;
-    case 14:
-      var value = new proto.visualization.Line3D;
-      reader.readMessage(value,proto.visualization.Line3D.deserializeBinaryFromReader);
-      msg.setLine3d(value);
+      var value = new proto.visualization.GridTile;
+      reader.readMessage(value,proto.visualization.GridTile.deserializeBinaryFromReader);
+      msg.addTiles(value);
       break;
     default:
       reader.skipField();
@@ -4416,9 +4398,9 @@ proto.visualization.Add3DObject.deserializeBinaryFromReader = function(msg, read
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.visualization.Add3DObject.prototype.serializeBinary = function() {
+proto.visualization.OccupancyGrid.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.visualization.Add3DObject.serializeBinaryToWriter(this, writer);
+  proto.visualization.OccupancyGrid.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -4426,219 +4408,166 @@ proto.visualization.Add3DObject.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.visualization.Add3DObject} message
+ * @param {!proto.visualization.OccupancyGrid} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.Add3DObject.serializeBinaryToWriter = function(message, writer) {
+proto.visualization.OccupancyGrid.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getId();
-  if (f.length > 0) {
-    writer.writeString(
+  f = message.getWidth();
+  if (f !== 0) {
+    writer.writeUint32(
       1,
       f
     );
   }
-  f = message.getMaterial();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getHeight();
+  if (f !== 0) {
+    writer.writeUint32(
       2,
-      f,
-      proto.visualization.Material.serializeBinaryToWriter
+      f
     );
   }
-  f = message.getPoint2d();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getCellType();
+  if (f !== 0.0) {
+    writer.writeEnum(
       3,
-      f,
-      proto.visualization.Point2D.serializeBinaryToWriter
+      f
     );
   }
-  f = message.getPose2d();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getResolution();
+  if (f !== 0.0) {
+    writer.writeFloat(
       4,
-      f,
-      proto.visualization.Pose2D.serializeBinaryToWriter
+      f
     );
   }
-  f = message.getCircle();
+  f = message.getOrigin();
   if (f != null) {
     writer.writeMessage(
       5,
       f,
-      proto.visualization.Circle.serializeBinaryToWriter
+      proto.visualization.Vec2.serializeBinaryToWriter
     );
   }
-  f = message.getBox2d();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getValueMin();
+  if (f !== 0.0) {
+    writer.writeFloat(
       6,
-      f,
-      proto.visualization.Box2D.serializeBinaryToWriter
+      f
     );
   }
-  f = message.getLine2d();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getValueMax();
+  if (f !== 0.0) {
+    writer.writeFloat(
       7,
-      f,
-      proto.visualization.Line2D.serializeBinaryToWriter
+      f
     );
   }
-  f = message.getTrajectory2d();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getPartial();
+  if (f) {
+    writer.writeBool(
       8,
-      f,
-      proto.visualization.Trajectory2D.serializeBinaryToWriter
+      f
     );
   }
-  f = message.getPolygon();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getTilesList();
+  if (f.length > 0) {
+    writer.writeRepeatedMessage(
       9,
       f,
-      proto.visualization.Polygon.serializeBinaryToWriter
-    );
-  }
-  f = message.getPoint3d();
-  if (f != null) {
-    writer.writeMessage(
-      10,
-      f,
-      proto.visualization.Point3D.serializeBinaryToWriter
-    );
-  }
-  f = message.getPose3d();
-  if (f != null) {
-    writer.writeMessage(
-      11,
-      f,
-      proto.visualization.Pose3D.serializeBinaryToWriter
-    );
-  }
-  f = message.getBall();
-  if (f != null) {
-    writer.writeMessage(
-      12,
-      f,
-      proto.visualization.Ball.serializeBinaryToWriter
-    );
-  }
-  f = message.getBox3d();
-  if (f != null) {
-    writer.writeMessage(
-      13,
-      f,
-      proto.visualization.Box3D.serializeBinaryToWriter
-    );
-  }
-  f = message.getLine3d();
-  if (f != null) {
-    writer.writeMessage(
-      14,
-      f,
-      proto.visualization.Line3D.serializeBinaryToWriter
+      proto.visualization.GridTile.serializeBinaryToWriter
     );
   }
 };
 
 
 /**
- * optional string id = 1;
- * @return {string}
+ * @enum {number}
  */
-proto.visualization.Add3DObject.prototype.getId = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+proto.visualization.OccupancyGrid.CellType = {
+  UINT8: 0,
+  FLOAT32: 1
 };
 
+/**
+ * optional uint32 width = 1;
+ * @return {number}
+ */
+proto.visualization.OccupancyGrid.prototype.getWidth = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
 
-/** @param {string} value */
-proto.visualization.Add3DObject.prototype.setId = function(value) {
-  jspb.Message.setProto3StringField(this, 1, value);
+
+/** @param {number} value */
+proto.visualization.OccupancyGrid.prototype.setWidth = function(value) {
+  jspb.Message.setProto3IntField(this, 1, value);
 };
 
 
 /**
- * optional Material material = 2;
- * @return {?proto.visualization.Material}
+ * optional uint32 height = 2;
+ * @return {number}
  */
-proto.visualization.Add3DObject.prototype.getMaterial = function() {
-  return /** @type{?proto.visualization.Material} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Material, 2));
+proto.visualization.OccupancyGrid.prototype.getHeight = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
 };
 
 
-/** @param {?proto.visualization.Material|undefined} value */
-proto.visualization.Add3DObject.prototype.setMaterial = function(value) {
-  jspb.Message.setWrapperField(this, 2, value);
-};
-
-
-proto.visualization.Add3DObject.prototype.clearMaterial = function() {
-  this.setMaterial(undefined);
-};
-
-
-/**
- * Returns whether this field is set.
- * @return {!boolean}
- */
-proto.visualization.Add3DObject.prototype.hasMaterial = function() {
-  return jspb.Message.getField(this, 2) != null;
+/** @param {number} value */
+proto.visualization.OccupancyGrid.prototype.setHeight = function(value) {
+  jspb.Message.setProto3IntField(this, 2, value);
 };
 
 
 /**
- * optional Point2D point_2d = 3;
- * @return {?proto.visualization.Point2D}
+ * optional CellType cell_type = 3;
+ * @return {!proto.visualization.OccupancyGrid.CellType}
  */
-proto.visualization.Add3DObject.prototype.getPoint2d = function() {
-  return /** @type{?proto.visualization.Point2D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Point2D, 3));
+proto.visualization.OccupancyGrid.prototype.getCellType = function() {
+  return /** @type {!proto.visualization.OccupancyGrid.CellType} */ (jspb.Message.getFieldWithDefault(this, 3, 0));
 };
 
 
-/** @param {?proto.visualization.Point2D|undefined} value */
-proto.visualization.Add3DObject.prototype.setPoint2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 3, proto.visualization.Add3DObject.oneofGroups_[0], value);
+/** @param {!proto.visualization.OccupancyGrid.CellType} value */
+proto.visualization.OccupancyGrid.prototype.setCellType = function(value) {
+  jspb.Message.setProto3EnumField(this, 3, value);
 };
 
 
-proto.visualization.Add3DObject.prototype.clearPoint2d = function() {
-  this.setPoint2d(undefined);
+/**
+ * optional float resolution = 4;
+ * @return {number}
+ */
+proto.visualization.OccupancyGrid.prototype.getResolution = function() {
+  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 4, 0.0));
 };
 
 
-/**
- * Returns whether this field is set.
- * @return {!boolean}
- */
-proto.visualization.Add3DObject.prototype.hasPoint2d = function() {
-  return jspb.Message.getField(this, 3) != null;
+/** @param {number} value */
+proto.visualization.OccupancyGrid.prototype.setResolution = function(value) {
+  jspb.Message.setProto3FloatField(this, 4, value);
 };
 
 
 /**
- * optional Pose2D pose_2d = 4;
- * @return {?proto.visualization.Pose2D}
+ * optional Vec2 origin = 5;
+ * @return {?proto.visualization.Vec2}
  */
-proto.visualization.Add3DObject.prototype.getPose2d = function() {
-  return /** @type{?proto.visualization.Pose2D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Pose2D, 4));
+proto.visualization.OccupancyGrid.prototype.getOrigin = function() {
+  return /** @type{?proto.visualization.Vec2} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Vec2, 5));
 };
 
 
-/** @param {?proto.visualization.Pose2D|undefined} value */
-proto.visualization.Add3DObject.prototype.setPose2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 4, proto.visualization.Add3DObject.oneofGroups_[0], value);
+/** @param {?proto.visualization.Vec2|undefined} value */
+proto.visualization.OccupancyGrid.prototype.setOrigin = function(value) {
+  jspb.Message.setWrapperField(this, 5, value);
 };
 
 
-proto.visualization.Add3DObject.prototype.clearPose2d = function() {
-  this.setPose2d(undefined);
+proto.visualization.OccupancyGrid.prototype.clearOrigin = function() {
+  this.setOrigin(undefined);
 };
 
 
@@ -4646,179 +4575,263 @@ proto.visualization.Add3DObject.prototype.clearPose2d = function() {
  * Returns whether this field is set.
  * @return {!boolean}
  */
-proto.visualization.Add3DObject.prototype.hasPose2d = function() {
-  return jspb.Message.getField(this, 4) != null;
+proto.visualization.OccupancyGrid.prototype.hasOrigin = function() {
+  return jspb.Message.getField(this, 5) != null;
 };
 
 
 /**
- * optional Circle circle = 5;
- * @return {?proto.visualization.Circle}
+ * optional float value_min = 6;
+ * @return {number}
  */
-proto.visualization.Add3DObject.prototype.getCircle = function() {
-  return /** @type{?proto.visualization.Circle} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Circle, 5));
+proto.visualization.OccupancyGrid.prototype.getValueMin = function() {
+  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 6, 0.0));
 };
 
 
-/** @param {?proto.visualization.Circle|undefined} value */
-proto.visualization.Add3DObject.prototype.setCircle = function(value) {
-  jspb.Message.setOneofWrapperField(this, 5, proto.visualization.Add3DObject.oneofGroups_[0], value);
+/** @param {number} value */
+proto.visualization.OccupancyGrid.prototype.setValueMin = function(value) {
+  jspb.Message.setProto3FloatField(this, 6, value);
 };
 
 
-proto.visualization.Add3DObject.prototype.clearCircle = function() {
-  this.setCircle(undefined);
+/**
+ * optional float value_max = 7;
+ * @return {number}
+ */
+proto.visualization.OccupancyGrid.prototype.getValueMax = function() {
+  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 7, 0.0));
 };
 
 
-/**
- * Returns whether this field is set.
- * @return {!boolean}
- */
-proto.visualization.Add3DObject.prototype.hasCircle = function() {
-  return jspb.Message.getField(this, 5) != null;
+/** @param {number} value */
+proto.visualization.OccupancyGrid.prototype.setValueMax = function(value) {
+  jspb.Message.setProto3FloatField(this, 7, value);
 };
 
 
 /**
- * optional Box2D box_2d = 6;
- * @return {?proto.visualization.Box2D}
+ * optional bool partial = 8;
+ * Note that Boolean fields may be set to 0/1 when serialized from a Java server.
+ * You should avoid comparisons like {@code val === true/false} in those cases.
+ * @return {boolean}
  */
-proto.visualization.Add3DObject.prototype.getBox2d = function() {
-  return /** @type{?proto.visualization.Box2D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Box2D, 6));
+proto.visualization.OccupancyGrid.prototype.getPartial = function() {
+  return /** @type {boolean} */ (jspb.Message.getFieldWithDefault(this, 8, false));
 };
 
 
-/** @param {?proto.visualization.Box2D|undefined} value */
-proto.visualization.Add3DObject.prototype.setBox2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 6, proto.visualization.Add3DObject.oneofGroups_[0], value);
+/** @param {boolean} value */
+proto.visualization.OccupancyGrid.prototype.setPartial = function(value) {
+  jspb.Message.setProto3BooleanField(this, 8, value);
 };
 
 
-proto.visualization.Add3DObject.prototype.clearBox2d = function() {
-  this.setBox2d(undefined);
+/**
+ * repeated GridTile tiles = 9;
+ * @return {!Array<!proto.visualization.GridTile>}
+ */
+proto.visualization.OccupancyGrid.prototype.getTilesList = function() {
+  return /** @type{!Array<!proto.visualization.GridTile>} */ (
+    jspb.Message.getRepeatedWrapperField(this, proto.visualization.GridTile, 9));
 };
 
 
-/**
- * Returns whether this field is set.
- * @return {!boolean}
- */
-proto.visualization.Add3DObject.prototype.hasBox2d = function() {
-  return jspb.Message.getField(this, 6) != null;
+/** @param {!Array<!proto.visualization.GridTile>} value */
+proto.visualization.OccupancyGrid.prototype.setTilesList = function(value) {
+  jspb.Message.setRepeatedWrapperField(this, 9, value);
 };
 
 
 /**
- * optional Line2D line_2d = 7;
- * @return {?proto.visualization.Line2D}
+ * @param {!proto.visualization.GridTile=} opt_value
+ * @param {number=} opt_index
+ * @return {!proto.visualization.GridTile}
  */
-proto.visualization.Add3DObject.prototype.getLine2d = function() {
-  return /** @type{?proto.visualization.Line2D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Line2D, 7));
+proto.visualization.OccupancyGrid.prototype.addTiles = function(opt_value, opt_index) {
+  return jspb.Message.addToRepeatedWrapperField(this, 9, opt_value, proto.visualization.GridTile, opt_index);
 };
 
 
-/** @param {?proto.visualization.Line2D|undefined} value */
-proto.visualization.Add3DObject.prototype.setLine2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 7, proto.visualization.Add3DObject.oneofGroups_[0], value);
+proto.visualization.OccupancyGrid.prototype.clearTilesList = function() {
+  this.setTilesList([]);
 };
 
 
-proto.visualization.Add3DObject.prototype.clearLine2d = function() {
-  this.setLine2d(undefined);
-};
-
 
 /**
- * Returns whether this field is set.
- * @return {!boolean}
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
  */
-proto.visualization.Add3DObject.prototype.hasLine2d = function() {
-  return jspb.Message.getField(this, 7) != null;
+proto.visualization.TriangleMesh3D = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
 };
+goog.inherits(proto.visualization.TriangleMesh3D, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.visualization.TriangleMesh3D.displayName = 'proto.visualization.TriangleMesh3D';
+}
 
 
+if (jspb.Message.GENERATE_TO_OBJECT) {
 /**
- * optional Trajectory2D trajectory_2d = 8;
- * @return {?proto.visualization.Trajectory2D}
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
  */
-proto.visualization.Add3DObject.prototype.getTrajectory2d = function() {
-  return /** @type{?proto.visualization.Trajectory2D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Trajectory2D, 8));
+proto.visualization.TriangleMesh3D.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.TriangleMesh3D.toObject(opt_includeInstance, this);
 };
 
 
-/** @param {?proto.visualization.Trajectory2D|undefined} value */
-proto.visualization.Add3DObject.prototype.setTrajectory2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 8, proto.visualization.Add3DObject.oneofGroups_[0], value);
-};
-
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.visualization.TriangleMesh3D} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.TriangleMesh3D.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    meshId: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    pose: (f = msg.getPose()) && proto.visualization.Pose3D.toObject(includeInstance, f)
+  };
 
-proto.visualization.Add3DObject.prototype.clearTrajectory2d = function() {
-  this.setTrajectory2d(undefined);
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
 };
+}
 
 
 /**
- * Returns whether this field is set.
- * @return {!boolean}
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.visualization.TriangleMesh3D}
  */
-proto.visualization.Add3DObject.prototype.hasTrajectory2d = function() {
-  return jspb.Message.getField(this, 8) != null;
+proto.visualization.TriangleMesh3D.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.visualization.TriangleMesh3D;
+  return proto.visualization.TriangleMesh3D.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
- * optional Polygon polygon = 9;
- * @return {?proto.visualization.Polygon}
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.visualization.TriangleMesh3D} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.visualization.TriangleMesh3D}
  */
-proto.visualization.Add3DObject.prototype.getPolygon = function() {
-  return /** @type{?proto.visualization.Polygon} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Polygon, 9));
+proto.visualization.TriangleMesh3D.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setMeshId(value);
+      break;
+    case 2:
+      var value = new proto.visualization.Pose3D;
+      reader.readMessage(value,proto.visualization.Pose3D.deserializeBinaryFromReader);
+      msg.setPose(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
 };
 
 
-/** @param {?proto.visualization.Polygon|undefined} value */
-proto.visualization.Add3DObject.prototype.setPolygon = function(value) {
-  jspb.Message.setOneofWrapperField(this, 9, proto.visualization.Add3DObject.oneofGroups_[0], value);
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.visualization.TriangleMesh3D.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.visualization.TriangleMesh3D.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
 };
 
 
-proto.visualization.Add3DObject.prototype.clearPolygon = function() {
-  this.setPolygon(undefined);
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.visualization.TriangleMesh3D} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.TriangleMesh3D.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getMeshId();
+  if (f !== 0) {
+    writer.writeUint32(
+      1,
+      f
+    );
+  }
+  f = message.getPose();
+  if (f != null) {
+    writer.writeMessage(
+      2,
+      f,
+      proto.visualization.Pose3D.serializeBinaryToWriter
+    );
+  }
 };
 
 
 /**
- * Returns whether this field is set.
- * @return {!boolean}
+ * optional uint32 mesh_id = 1;
+ * @return {number}
  */
-proto.visualization.Add3DObject.prototype.hasPolygon = function() {
-  return jspb.Message.getField(this, 9) != null;
+proto.visualization.TriangleMesh3D.prototype.getMeshId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/** @param {number} value */
+proto.visualization.TriangleMesh3D.prototype.setMeshId = function(value) {
+  jspb.Message.setProto3IntField(this, 1, value);
 };
 
 
 /**
- * optional Point3D point_3d = 10;
- * @return {?proto.visualization.Point3D}
+ * optional Pose3D pose = 2;
+ * @return {?proto.visualization.Pose3D}
  */
-proto.visualization.Add3DObject.prototype.getPoint3d = function() {
-  return /** @type{?proto.visualization.Point3D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Point3D, 10));
+proto.visualization.TriangleMesh3D.prototype.getPose = function() {
+  return /** @type{?proto.visualization.Pose3D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Pose3D, 2));
 };
 
 
-/** @param {?proto.visualization.Point3D|undefined} value */
-proto.visualization.Add3DObject.prototype.setPoint3d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 10, proto.visualization.Add3DObject.oneofGroups_[0], value);
+/** @param {?proto.visualization.Pose3D|undefined} value */
+proto.visualization.TriangleMesh3D.prototype.setPose = function(value) {
+  jspb.Message.setWrapperField(this, 2, value);
 };
 
 
-proto.visualization.Add3DObject.prototype.clearPoint3d = function() {
-  this.setPoint3d(undefined);
+proto.visualization.TriangleMesh3D.prototype.clearPose = function() {
+  this.setPose(undefined);
 };
 
 
@@ -4826,128 +4839,8 @@ proto.visualization.Add3DObject.prototype.clearPoint3d = function() {
  * Returns whether this field is set.
  * @return {!boolean}
  */
-proto.visualization.Add3DObject.prototype.hasPoint3d = function() {
-  return jspb.Message.getField(this, 10) != null;
-};
-
-
-/**
- * optional Pose3D pose_3d = 11;
- * @return {?proto.visualization.Pose3D}
- */
-proto.visualization.Add3DObject.prototype.getPose3d = function() {
-  return /** @type{?proto.visualization.Pose3D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Pose3D, 11));
-};
-
-
-/** @param {?proto.visualization.Pose3D|undefined} value */
-proto.visualization.Add3DObject.prototype.setPose3d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 11, proto.visualization.Add3DObject.oneofGroups_[0], value);
-};
-
-
-proto.visualization.Add3DObject.prototype.clearPose3d = function() {
-  this.setPose3d(undefined);
-};
-
-
-/**
- * Returns whether this field is set.
- * @return {!boolean}
- */
-proto.visualization.Add3DObject.prototype.hasPose3d = function() {
-  return jspb.Message.getField(this, 11) != null;
-};
-
-
-/**
- * optional Ball ball = 12;
- * @return {?proto.visualization.Ball}
- */
-proto.visualization.Add3DObject.prototype.getBall = function() {
-  return /** @type{?proto.visualization.Ball} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Ball, 12));
-};
-
-
-/** @param {?proto.visualization.Ball|undefined} value */
-proto.visualization.Add3DObject.prototype.setBall = function(value) {
-  jspb.Message.setOneofWrapperField(this, 12, proto.visualization.Add3DObject.oneofGroups_[0], value);
-};
-
-
-proto.visualization.Add3DObject.prototype.clearBall = function() {
-  this.setBall(undefined);
-};
-
-
-/**
- * Returns whether this field is set.
- * @return {!boolean}
- */
-proto.visualization.Add3DObject.prototype.hasBall = function() {
-  return jspb.Message.getField(this, 12) != null;
-};
-
-
-/**
- * optional Box3D box_3d = 13;
- * @return {?proto.visualization.Box3D}
- */
-proto.visualization.Add3DObject.prototype.getBox3d = function() {
-  return /** @type{?proto.visualization.Box3D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Box3D, 13));
-};
-
-
-/** @param {?proto.visualization.Box3D|undefined} value */
-proto.visualization.Add3DObject.prototype.setBox3d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 13, proto.visualization.Add3DObject.oneofGroups_[0], value);
-};
-
-
-proto.visualization.Add3DObject.prototype.clearBox3d = function() {
-  this.setBox3d(undefined);
-};
-
-
-/**
- * Returns whether this field is set.
- * @return {!boolean}
- */
-proto.visualization.Add3DObject.prototype.hasBox3d = function() {
-  return jspb.Message.getField(this, 13) != null;
-};
-
-
-/**
- * optional Line3D line_3d = 14;
- * @return {?proto.visualization.Line3D}
- */
-proto.visualization.Add3DObject.prototype.getLine3d = function() {
-  return /** @type{?proto.visualization.Line3D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Line3D, 14));
-};
-
-
-/** @param {?proto.visualization.Line3D|undefined} value */
-proto.visualization.Add3DObject.prototype.setLine3d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 14, proto.visualization.Add3DObject.oneofGroups_[0], value);
-};
-
-
-proto.visualization.Add3DObject.prototype.clearLine3d = function() {
-  this.setLine3d(undefined);
-};
-
-
-/**
- * Returns whether this field is set.
- * @return {!boolean}
- */
-proto.visualization.Add3DObject.prototype.hasLine3d = function() {
-  return jspb.Message.getField(this, 14) != null;
+proto.visualization.TriangleMesh3D.prototype.hasPose = function() {
+  return jspb.Message.getField(this, 2) != null;
 };
 
 
@@ -4962,44 +4855,13 @@ proto.visualization.Add3DObject.prototype.hasLine3d = function() {
  * @extends {jspb.Message}
  * @constructor
  */
-proto.visualization.Update2DObjectGeometry = function(opt_data) {
-  jspb.Message.initialize(this, opt_data, 0, -1, null, proto.visualization.Update2DObjectGeometry.oneofGroups_);
+proto.visualization.Material = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
 };
-goog.inherits(proto.visualization.Update2DObjectGeometry, jspb.Message);
+goog.inherits(proto.visualization.Material, jspb.Message);
 if (goog.DEBUG && !COMPILED) {
-  proto.visualization.Update2DObjectGeometry.displayName = 'proto.visualization.Update2DObjectGeometry';
+  proto.visualization.Material.displayName = 'proto.visualization.Material';
 }
-/**
- * Oneof group definitions for this message. Each group defines the field
- * numbers belonging to that group. When of these fields' value is set, all
- * other fields in the group are cleared. During deserialization, if multiple
- * fields are encountered for a group, only the last value seen will be kept.
- * @private {!Array<!Array<number>>}
- * @const
- */
-proto.visualization.Update2DObjectGeometry.oneofGroups_ = [[3,4,5,6,7,8,9]];
-
-/**
- * @enum {number}
- */
-proto.visualization.Update2DObjectGeometry.GeometryDataCase = {
-  GEOMETRY_DATA_NOT_SET: 0,
-  POINT_2D: 3,
-  POSE_2D: 4,
-  CIRCLE: 5,
-  BOX_2D: 6,
-  LINE_2D: 7,
-  TRAJECTORY_2D: 8,
-  POLYGON: 9
-};
-
-/**
- * @return {proto.visualization.Update2DObjectGeometry.GeometryDataCase}
- */
-proto.visualization.Update2DObjectGeometry.prototype.getGeometryDataCase = function() {
-  return /** @type {proto.visualization.Update2DObjectGeometry.GeometryDataCase} */(jspb.Message.computeOneofCase(this, proto.visualization.Update2DObjectGeometry.oneofGroups_[0]));
-};
-
 
 
 if (jspb.Message.GENERATE_TO_OBJECT) {
@@ -5013,8 +4875,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     for transitional soy proto support: http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.visualization.Update2DObjectGeometry.prototype.toObject = function(opt_includeInstance) {
-  return proto.visualization.Update2DObjectGeometry.toObject(opt_includeInstance, this);
+proto.visualization.Material.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.Material.toObject(opt_includeInstance, this);
 };
 
 
@@ -5023,20 +4885,21 @@ proto.visualization.Update2DObjectGeometry.prototype.toObject = function(opt_inc
  * @param {boolean|undefined} includeInstance Whether to include the JSPB
  *     instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.visualization.Update2DObjectGeometry} msg The msg instance to transform.
+ * @param {!proto.visualization.Material} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.Update2DObjectGeometry.toObject = function(includeInstance, msg) {
+proto.visualization.Material.toObject = function(includeInstance, msg) {
   var f, obj = {
-    id: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    point2d: (f = msg.getPoint2d()) && proto.visualization.Point2D.toObject(includeInstance, f),
-    pose2d: (f = msg.getPose2d()) && proto.visualization.Pose2D.toObject(includeInstance, f),
-    circle: (f = msg.getCircle()) && proto.visualization.Circle.toObject(includeInstance, f),
-    box2d: (f = msg.getBox2d()) && proto.visualization.Box2D.toObject(includeInstance, f),
-    line2d: (f = msg.getLine2d()) && proto.visualization.Line2D.toObject(includeInstance, f),
-    trajectory2d: (f = msg.getTrajectory2d()) && proto.visualization.Trajectory2D.toObject(includeInstance, f),
-    polygon: (f = msg.getPolygon()) && proto.visualization.Polygon.toObject(includeInstance, f)
+    legend: jspb.Message.getFieldWithDefault(msg, 1, ""),
+    color: (f = msg.getColor()) && proto.visualization.ColorRGBA.toObject(includeInstance, f),
+    pointSize: +jspb.Message.getFieldWithDefault(msg, 3, 0.0),
+    lineWidth: +jspb.Message.getFieldWithDefault(msg, 4, 0.0),
+    filled: jspb.Message.getFieldWithDefault(msg, 5, false),
+    fillColor: (f = msg.getFillColor()) && proto.visualization.ColorRGBA.toObject(includeInstance, f),
+    legendOn: jspb.Message.getFieldWithDefault(msg, 7, false),
+    lineStyle: jspb.Message.getFieldWithDefault(msg, 8, 0),
+    pointShape: jspb.Message.getFieldWithDefault(msg, 9, 0)
   };
 
   if (includeInstance) {
@@ -5050,23 +4913,23 @@ proto.visualization.Update2DObjectGeometry.toObject = function(includeInstance,
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.visualization.Update2DObjectGeometry}
+ * @return {!proto.visualization.Material}
  */
-proto.visualization.Update2DObjectGeometry.deserializeBinary = function(bytes) {
+proto.visualization.Material.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.visualization.Update2DObjectGeometry;
-  return proto.visualization.Update2DObjectGeometry.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.visualization.Material;
+  return proto.visualization.Material.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.visualization.Update2DObjectGeometry} msg The message object to deserialize into.
+ * @param {!proto.visualization.Material} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.visualization.Update2DObjectGeometry}
+ * @return {!proto.visualization.Material}
  */
-proto.visualization.Update2DObjectGeometry.deserializeBinaryFromReader = function(msg, reader) {
+proto.visualization.Material.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -5075,42 +4938,41 @@ proto.visualization.Update2DObjectGeometry.deserializeBinaryFromReader = functio
     switch (field) {
     case 1:
       var value = /** @type {string} */ (reader.readString());
-      msg.setId(value);
+      msg.setLegend(value);
+      break;
+    case 2:
+      var value = new proto.visualization.ColorRGBA;
+      reader.readMessage(value,proto.visualization.ColorRGBA.deserializeBinaryFromReader);
+      msg.setColor(value);
       break;
     case 3:
-      var value = new proto.visualization.Point2D;
-      reader.readMessage(value,proto.visualization.Point2D.deserializeBinaryFromReader);
-      msg.setPoint2d(value);
+      var value = /** @type {number} */ (reader.readFloat());
+      msg.setPointSize(value);
       break;
     case 4:
-      var value = new proto.visualization.Pose2D;
-      reader.readMessage(value,proto.visualization.Pose2D.deserializeBinaryFromReader);
-      msg.setPose2d(value);
+      var value = /** @type {number} */ (reader.readFloat());
+      msg.setLineWidth(value);
       break;
     case 5:
-      var value = new proto.visualization.Circle;
-      reader.readMessage(value,proto.visualization.Circle.deserializeBinaryFromReader);
-      msg.setCircle(value);
+      var value = /** @type {boolean} */ (reader.readBool());
+      msg.setFilled(value);
       break;
     case 6:
-      var value = new proto.visualization.Box2D;
-      reader.readMessage(value,proto.visualization.Box2D.deserializeBinaryFromReader);
-      msg.setBox2d(value);
+      var value = new proto.visualization.ColorRGBA;
+      reader.readMessage(value,proto.visualization.ColorRGBA.deserializeBinaryFromReader);
+      msg.setFillColor(value);
       break;
     case 7:
-      var value = new proto.visualization.Line2D;
-      reader.readMessage(value,proto.visualization.Line2D.deserializeBinaryFromReader);
-      msg.setLine2d(value);
+      var value = /** @type {boolean} */ (reader.readBool());
+      msg.setLegendOn(value);
       break;
     case 8:
-      var value = new proto.visualization.Trajectory2D;
-      reader.readMessage(value,proto.visualization.Trajectory2D.deserializeBinaryFromReader);
-      msg.setTrajectory2d(value);
+      var value = /** @type {!proto.visualization.Material.LineStyle} */ (reader.readEnum());
+      msg.setLineStyle(value);
       break;
     case 9:
-      var value = new proto.visualization.Polygon;
-      reader.readMessage(value,proto.visualization.Polygon.deserializeBinaryFromReader);
-      msg.setPolygon(value);
+      var value = /** @type {!proto.visualization.Material.PointShape} */ (reader.readEnum());
+      msg.setPointShape(value);
       break;
     default:
       reader.skipField();
@@ -5125,9 +4987,9 @@ proto.visualization.Update2DObjectGeometry.deserializeBinaryFromReader = functio
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.visualization.Update2DObjectGeometry.prototype.serializeBinary = function() {
+proto.visualization.Material.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.visualization.Update2DObjectGeometry.serializeBinaryToWriter(this, writer);
+  proto.visualization.Material.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -5135,111 +4997,132 @@ proto.visualization.Update2DObjectGeometry.prototype.serializeBinary = function(
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.visualization.Update2DObjectGeometry} message
+ * @param {!proto.visualization.Material} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.Update2DObjectGeometry.serializeBinaryToWriter = function(message, writer) {
+proto.visualization.Material.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getId();
+  f = message.getLegend();
   if (f.length > 0) {
     writer.writeString(
       1,
       f
     );
   }
-  f = message.getPoint2d();
+  f = message.getColor();
   if (f != null) {
     writer.writeMessage(
-      3,
+      2,
       f,
-      proto.visualization.Point2D.serializeBinaryToWriter
+      proto.visualization.ColorRGBA.serializeBinaryToWriter
     );
   }
-  f = message.getPose2d();
-  if (f != null) {
-    writer.writeMessage(
-      4,
-      f,
-      proto.visualization.Pose2D.serializeBinaryToWriter
+  f = message.getPointSize();
+  if (f !== 0.0) {
+    writer.writeFloat(
+      3,
+      f
     );
   }
-  f = message.getCircle();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getLineWidth();
+  if (f !== 0.0) {
+    writer.writeFloat(
+      4,
+      f
+    );
+  }
+  f = message.getFilled();
+  if (f) {
+    writer.writeBool(
       5,
-      f,
-      proto.visualization.Circle.serializeBinaryToWriter
+      f
     );
   }
-  f = message.getBox2d();
+  f = message.getFillColor();
   if (f != null) {
     writer.writeMessage(
       6,
       f,
-      proto.visualization.Box2D.serializeBinaryToWriter
+      proto.visualization.ColorRGBA.serializeBinaryToWriter
     );
   }
-  f = message.getLine2d();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getLegendOn();
+  if (f) {
+    writer.writeBool(
       7,
-      f,
-      proto.visualization.Line2D.serializeBinaryToWriter
+      f
     );
   }
-  f = message.getTrajectory2d();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getLineStyle();
+  if (f !== 0.0) {
+    writer.writeEnum(
       8,
-      f,
-      proto.visualization.Trajectory2D.serializeBinaryToWriter
+      f
     );
   }
-  f = message.getPolygon();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getPointShape();
+  if (f !== 0.0) {
+    writer.writeEnum(
       9,
-      f,
-      proto.visualization.Polygon.serializeBinaryToWriter
+      f
     );
   }
 };
 
 
 /**
- * optional string id = 1;
+ * @enum {number}
+ */
+proto.visualization.Material.LineStyle = {
+  SOLID: 0,
+  DASHED: 1,
+  DOTTED: 2
+};
+
+/**
+ * @enum {number}
+ */
+proto.visualization.Material.PointShape = {
+  SQUARE: 0,
+  CIRCLE: 1,
+  CROSS: 2,
+  DIAMOND: 3
+};
+
+/**
+ * optional string legend = 1;
  * @return {string}
  */
-proto.visualization.Update2DObjectGeometry.prototype.getId = function() {
+proto.visualization.Material.prototype.getLegend = function() {
   return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
 };
 
 
 /** @param {string} value */
-proto.visualization.Update2DObjectGeometry.prototype.setId = function(value) {
+proto.visualization.Material.prototype.setLegend = function(value) {
   jspb.Message.setProto3StringField(this, 1, value);
 };
 
 
 /**
- * optional Point2D point_2d = 3;
- * @return {?proto.visualization.Point2D}
+ * optional ColorRGBA color = 2;
+ * @return {?proto.visualization.ColorRGBA}
  */
-proto.visualization.Update2DObjectGeometry.prototype.getPoint2d = function() {
-  return /** @type{?proto.visualization.Point2D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Point2D, 3));
+proto.visualization.Material.prototype.getColor = function() {
+  return /** @type{?proto.visualization.ColorRGBA} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.ColorRGBA, 2));
 };
 
 
-/** @param {?proto.visualization.Point2D|undefined} value */
-proto.visualization.Update2DObjectGeometry.prototype.setPoint2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 3, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+/** @param {?proto.visualization.ColorRGBA|undefined} value */
+proto.visualization.Material.prototype.setColor = function(value) {
+  jspb.Message.setWrapperField(this, 2, value);
 };
 
 
-proto.visualization.Update2DObjectGeometry.prototype.clearPoint2d = function() {
-  this.setPoint2d(undefined);
+proto.visualization.Material.prototype.clearColor = function() {
+  this.setColor(undefined);
 };
 
 
@@ -5247,89 +5130,76 @@ proto.visualization.Update2DObjectGeometry.prototype.clearPoint2d = function() {
  * Returns whether this field is set.
  * @return {!boolean}
  */
-proto.visualization.Update2DObjectGeometry.prototype.hasPoint2d = function() {
-  return jspb.Message.getField(this, 3) != null;
+proto.visualization.Material.prototype.hasColor = function() {
+  return jspb.Message.getField(this, 2) != null;
 };
 
 
 /**
- * optional Pose2D pose_2d = 4;
- * @return {?proto.visualization.Pose2D}
+ * optional float point_size = 3;
+ * @return {number}
  */
-proto.visualization.Update2DObjectGeometry.prototype.getPose2d = function() {
-  return /** @type{?proto.visualization.Pose2D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Pose2D, 4));
-};
-
-
-/** @param {?proto.visualization.Pose2D|undefined} value */
-proto.visualization.Update2DObjectGeometry.prototype.setPose2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 4, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
-};
-
-
-proto.visualization.Update2DObjectGeometry.prototype.clearPose2d = function() {
-  this.setPose2d(undefined);
+proto.visualization.Material.prototype.getPointSize = function() {
+  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 3, 0.0));
 };
 
 
-/**
- * Returns whether this field is set.
- * @return {!boolean}
- */
-proto.visualization.Update2DObjectGeometry.prototype.hasPose2d = function() {
-  return jspb.Message.getField(this, 4) != null;
+/** @param {number} value */
+proto.visualization.Material.prototype.setPointSize = function(value) {
+  jspb.Message.setProto3FloatField(this, 3, value);
 };
 
 
 /**
- * optional Circle circle = 5;
- * @return {?proto.visualization.Circle}
+ * optional float line_width = 4;
+ * @return {number}
  */
-proto.visualization.Update2DObjectGeometry.prototype.getCircle = function() {
-  return /** @type{?proto.visualization.Circle} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Circle, 5));
+proto.visualization.Material.prototype.getLineWidth = function() {
+  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 4, 0.0));
 };
 
 
-/** @param {?proto.visualization.Circle|undefined} value */
-proto.visualization.Update2DObjectGeometry.prototype.setCircle = function(value) {
-  jspb.Message.setOneofWrapperField(this, 5, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+/** @param {number} value */
+proto.visualization.Material.prototype.setLineWidth = function(value) {
+  jspb.Message.setProto3FloatField(this, 4, value);
 };
 
 
-proto.visualization.Update2DObjectGeometry.prototype.clearCircle = function() {
-  this.setCircle(undefined);
+/**
+ * optional bool filled = 5;
+ * Note that Boolean fields may be set to 0/1 when serialized from a Java server.
+ * You should avoid comparisons like {@code val === true/false} in those cases.
+ * @return {boolean}
+ */
+proto.visualization.Material.prototype.getFilled = function() {
+  return /** @type {boolean} */ (jspb.Message.getFieldWithDefault(this, 5, false));
 };
 
 
-/**
- * Returns whether this field is set.
- * @return {!boolean}
- */
-proto.visualization.Update2DObjectGeometry.prototype.hasCircle = function() {
-  return jspb.Message.getField(this, 5) != null;
+/** @param {boolean} value */
+proto.visualization.Material.prototype.setFilled = function(value) {
+  jspb.Message.setProto3BooleanField(this, 5, value);
 };
 
 
 /**
- * optional Box2D box_2d = 6;
- * @return {?proto.visualization.Box2D}
+ * optional ColorRGBA fill_color = 6;
+ * @return {?proto.visualization.ColorRGBA}
  */
-proto.visualization.Update2DObjectGeometry.prototype.getBox2d = function() {
-  return /** @type{?proto.visualization.Box2D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Box2D, 6));
+proto.visualization.Material.prototype.getFillColor = function() {
+  return /** @type{?proto.visualization.ColorRGBA} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.ColorRGBA, 6));
 };
 
 
-/** @param {?proto.visualization.Box2D|undefined} value */
-proto.visualization.Update2DObjectGeometry.prototype.setBox2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 6, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+/** @param {?proto.visualization.ColorRGBA|undefined} value */
+proto.visualization.Material.prototype.setFillColor = function(value) {
+  jspb.Message.setWrapperField(this, 6, value);
 };
 
 
-proto.visualization.Update2DObjectGeometry.prototype.clearBox2d = function() {
-  this.setBox2d(undefined);
+proto.visualization.Material.prototype.clearFillColor = function() {
+  this.setFillColor(undefined);
 };
 
 
@@ -5337,119 +5207,76 @@ proto.visualization.Update2DObjectGeometry.prototype.clearBox2d = function() {
  * Returns whether this field is set.
  * @return {!boolean}
  */
-proto.visualization.Update2DObjectGeometry.prototype.hasBox2d = function() {
+proto.visualization.Material.prototype.hasFillColor = function() {
   return jspb.Message.getField(this, 6) != null;
 };
 
 
 /**
- * optional Line2D line_2d = 7;
- * @return {?proto.visualization.Line2D}
+ * optional bool legend_on = 7;
+ * Note that Boolean fields may be set to 0/1 when serialized from a Java server.
+ * You should avoid comparisons like {@code val === true/false} in those cases.
+ * @return {boolean}
  */
-proto.visualization.Update2DObjectGeometry.prototype.getLine2d = function() {
-  return /** @type{?proto.visualization.Line2D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Line2D, 7));
+proto.visualization.Material.prototype.getLegendOn = function() {
+  return /** @type {boolean} */ (jspb.Message.getFieldWithDefault(this, 7, false));
 };
 
 
-/** @param {?proto.visualization.Line2D|undefined} value */
-proto.visualization.Update2DObjectGeometry.prototype.setLine2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 7, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+/** @param {boolean} value */
+proto.visualization.Material.prototype.setLegendOn = function(value) {
+  jspb.Message.setProto3BooleanField(this, 7, value);
 };
 
 
-proto.visualization.Update2DObjectGeometry.prototype.clearLine2d = function() {
-  this.setLine2d(undefined);
+/**
+ * optional LineStyle line_style = 8;
+ * @return {!proto.visualization.Material.LineStyle}
+ */
+proto.visualization.Material.prototype.getLineStyle = function() {
+  return /** @type {!proto.visualization.Material.LineStyle} */ (jspb.Message.getFieldWithDefault(this, 8, 0));
 };
 
 
-/**
- * Returns whether this field is set.
- * @return {!boolean}
- */
-proto.visualization.Update2DObjectGeometry.prototype.hasLine2d = function() {
-  return jspb.Message.getField(this, 7) != null;
+/** @param {!proto.visualization.Material.LineStyle} value */
+proto.visualization.Material.prototype.setLineStyle = function(value) {
+  jspb.Message.setProto3EnumField(this, 8, value);
 };
 
 
 /**
- * optional Trajectory2D trajectory_2d = 8;
- * @return {?proto.visualization.Trajectory2D}
+ * optional PointShape point_shape = 9;
+ * @return {!proto.visualization.Material.PointShape}
  */
-proto.visualization.Update2DObjectGeometry.prototype.getTrajectory2d = function() {
-  return /** @type{?proto.visualization.Trajectory2D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Trajectory2D, 8));
+proto.visualization.Material.prototype.getPointShape = function() {
+  return /** @type {!proto.visualization.Material.PointShape} */ (jspb.Message.getFieldWithDefault(this, 9, 0));
 };
 
 
-/** @param {?proto.visualization.Trajectory2D|undefined} value */
-proto.visualization.Update2DObjectGeometry.prototype.setTrajectory2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 8, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+/** @param {!proto.visualization.Material.PointShape} value */
+proto.visualization.Material.prototype.setPointShape = function(value) {
+  jspb.Message.setProto3EnumField(this, 9, value);
 };
 
 
-proto.visualization.Update2DObjectGeometry.prototype.clearTrajectory2d = function() {
-  this.setTrajectory2d(undefined);
-};
-
 
 /**
- * Returns whether this field is set.
- * @return {!boolean}
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
  */
-proto.visualization.Update2DObjectGeometry.prototype.hasTrajectory2d = function() {
-  return jspb.Message.getField(this, 8) != null;
+proto.visualization.Add2DObject = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, proto.visualization.Add2DObject.oneofGroups_);
 };
-
-
-/**
- * optional Polygon polygon = 9;
- * @return {?proto.visualization.Polygon}
- */
-proto.visualization.Update2DObjectGeometry.prototype.getPolygon = function() {
-  return /** @type{?proto.visualization.Polygon} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Polygon, 9));
-};
-
-
-/** @param {?proto.visualization.Polygon|undefined} value */
-proto.visualization.Update2DObjectGeometry.prototype.setPolygon = function(value) {
-  jspb.Message.setOneofWrapperField(this, 9, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
-};
-
-
-proto.visualization.Update2DObjectGeometry.prototype.clearPolygon = function() {
-  this.setPolygon(undefined);
-};
-
-
-/**
- * Returns whether this field is set.
- * @return {!boolean}
- */
-proto.visualization.Update2DObjectGeometry.prototype.hasPolygon = function() {
-  return jspb.Message.getField(this, 9) != null;
-};
-
-
-
-/**
- * Generated by JsPbCodeGenerator.
- * @param {Array=} opt_data Optional initial data array, typically from a
- * server response, or constructed directly in Javascript. The array is used
- * in place and becomes part of the constructed object. It is not cloned.
- * If no data is provided, the constructed object will be empty, but still
- * valid.
- * @extends {jspb.Message}
- * @constructor
- */
-proto.visualization.Update3DObjectGeometry = function(opt_data) {
-  jspb.Message.initialize(this, opt_data, 0, -1, null, proto.visualization.Update3DObjectGeometry.oneofGroups_);
-};
-goog.inherits(proto.visualization.Update3DObjectGeometry, jspb.Message);
-if (goog.DEBUG && !COMPILED) {
-  proto.visualization.Update3DObjectGeometry.displayName = 'proto.visualization.Update3DObjectGeometry';
-}
+goog.inherits(proto.visualization.Add2DObject, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.visualization.Add2DObject.displayName = 'proto.visualization.Add2DObject';
+}
 /**
  * Oneof group definitions for this message. Each group defines the field
  * numbers belonging to that group. When of these fields' value is set, all
@@ -5458,12 +5285,12 @@ if (goog.DEBUG && !COMPILED) {
  * @private {!Array<!Array<number>>}
  * @const
  */
-proto.visualization.Update3DObjectGeometry.oneofGroups_ = [[3,4,5,6,7,8,9,10,11,12,13,14]];
+proto.visualization.Add2DObject.oneofGroups_ = [[3,4,5,6,7,8,9,19,20,22]];
 
 /**
  * @enum {number}
  */
-proto.visualization.Update3DObjectGeometry.GeometryDataCase = {
+proto.visualization.Add2DObject.GeometryDataCase = {
   GEOMETRY_DATA_NOT_SET: 0,
   POINT_2D: 3,
   POSE_2D: 4,
@@ -5472,18 +5299,16 @@ proto.visualization.Update3DObjectGeometry.GeometryDataCase = {
   LINE_2D: 7,
   TRAJECTORY_2D: 8,
   POLYGON: 9,
-  POINT_3D: 10,
-  POSE_3D: 11,
-  BALL: 12,
-  BOX_3D: 13,
-  LINE_3D: 14
+  CIRCLE_ARRAY: 19,
+  POSE_2D_ARRAY: 20,
+  OCCUPANCY_GRID: 22
 };
 
 /**
- * @return {proto.visualization.Update3DObjectGeometry.GeometryDataCase}
+ * @return {proto.visualization.Add2DObject.GeometryDataCase}
  */
-proto.visualization.Update3DObjectGeometry.prototype.getGeometryDataCase = function() {
-  return /** @type {proto.visualization.Update3DObjectGeometry.GeometryDataCase} */(jspb.Message.computeOneofCase(this, proto.visualization.Update3DObjectGeometry.oneofGroups_[0]));
+proto.visualization.Add2DObject.prototype.getGeometryDataCase = function() {
+  return /** @type {proto.visualization.Add2DObject.GeometryDataCase} */(jspb.Message.computeOneofCase(this, proto.visualization.Add2DObject.oneofGroups_[0]));
 };
 
 
@@ -5499,8 +5324,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     for transitional soy proto support: http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.visualization.Update3DObjectGeometry.prototype.toObject = function(opt_includeInstance) {
-  return proto.visualization.Update3DObjectGeometry.toObject(opt_includeInstance, this);
+proto.visualization.Add2DObject.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.Add2DObject.toObject(opt_includeInstance, this);
 };
 
 
@@ -5509,13 +5334,15 @@ proto.visualization.Update3DObjectGeometry.prototype.toObject = function(opt_inc
  * @param {boolean|undefined} includeInstance Whether to include the JSPB
  *     instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.visualization.Update3DObjectGeometry} msg The msg instance to transform.
+ * @param {!proto.visualization.Add2DObject} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.Update3DObjectGeometry.toObject = function(includeInstance, msg) {
+proto.visualization.Add2DObject.toObject = function(includeInstance, msg) {
   var f, obj = {
-    id: jspb.Message.getFieldWithDefault(msg, 1, ""),
+    id: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    material: (f = msg.getMaterial()) && proto.visualization.Material.toObject(includeInstance, f),
+    materialId: jspb.Message.getFieldWithDefault(msg, 16, 0),
     point2d: (f = msg.getPoint2d()) && proto.visualization.Point2D.toObject(includeInstance, f),
     pose2d: (f = msg.getPose2d()) && proto.visualization.Pose2D.toObject(includeInstance, f),
     circle: (f = msg.getCircle()) && proto.visualization.Circle.toObject(includeInstance, f),
@@ -5523,11 +5350,10 @@ proto.visualization.Update3DObjectGeometry.toObject = function(includeInstance,
     line2d: (f = msg.getLine2d()) && proto.visualization.Line2D.toObject(includeInstance, f),
     trajectory2d: (f = msg.getTrajectory2d()) && proto.visualization.Trajectory2D.toObject(includeInstance, f),
     polygon: (f = msg.getPolygon()) && proto.visualization.Polygon.toObject(includeInstance, f),
-    point3d: (f = msg.getPoint3d()) && proto.visualization.Point3D.toObject(includeInstance, f),
-    pose3d: (f = msg.getPose3d()) && proto.visualization.Pose3D.toObject(includeInstance, f),
-    ball: (f = msg.getBall()) && proto.visualization.Ball.toObject(includeInstance, f),
-    box3d: (f = msg.getBox3d()) && proto.visualization.Box3D.toObject(includeInstance, f),
-    line3d: (f = msg.getLine3d()) && proto.visualization.Line3D.toObject(includeInstance, f)
+    circleArray: (f = msg.getCircleArray()) && proto.visualization.InstanceArray.toObject(includeInstance, f),
+    pose2dArray: (f = msg.getPose2dArray()) && proto.visualization.InstanceArray.toObject(includeInstance, f),
+    occupancyGrid: (f = msg.getOccupancyGrid()) && proto.visualization.OccupancyGrid.toObject(includeInstance, f),
+    layer: jspb.Message.getFieldWithDefault(msg, 15, 0)
   };
 
   if (includeInstance) {
@@ -5541,23 +5367,23 @@ proto.visualization.Update3DObjectGeometry.toObject = function(includeInstance,
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.visualization.Update3DObjectGeometry}
+ * @return {!proto.visualization.Add2DObject}
  */
-proto.visualization.Update3DObjectGeometry.deserializeBinary = function(bytes) {
+proto.visualization.Add2DObject.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.visualization.Update3DObjectGeometry;
-  return proto.visualization.Update3DObjectGeometry.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.visualization.Add2DObject;
+  return proto.visualization.Add2DObject.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.visualization.Update3DObjectGeometry} msg The message object to deserialize into.
+ * @param {!proto.visualization.Add2DObject} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.visualization.Update3DObjectGeometry}
+ * @return {!proto.visualization.Add2DObject}
  */
-proto.visualization.Update3DObjectGeometry.deserializeBinaryFromReader = function(msg, reader) {
+proto.visualization.Add2DObject.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -5565,9 +5391,18 @@ proto.visualization.Update3DObjectGeometry.deserializeBinaryFromReader = functio
     var field = reader.getFieldNumber();
     switch (field) {
     case 1:
-      var value = /** @type {string} */ (reader.readString());
+      var value = /** @type {number} */ (reader.readUint32());
       msg.setId(value);
       break;
+    case 2:
+      var value = new proto.visualization.Material;
+      reader.readMessage(value,proto.visualization.Material.deserializeBinaryFromReader);
+      msg.setMaterial(value);
+      break;
+    case 16:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setMaterialId(value);
+      break;
     case 3:
       var value = new proto.visualization.Point2D;
       reader.readMessage(value,proto.visualization.Point2D.deserializeBinaryFromReader);
@@ -5603,30 +5438,24 @@ proto.visualization.Update3DObjectGeometry.deserializeBinaryFromReader = functio
       reader.readMessage(value,proto.visualization.Polygon.deserializeBinaryFromReader);
       msg.setPolygon(value);
       break;
-    case 10:
-      var value = new proto.visualization.Point3D;
-      reader.readMessage(value,proto.visualization.Point3D.deserializeBinaryFromReader);
-      msg.setPoint3d(value);
-      break;
-    case 11:
-      var value = new proto.visualization.Pose3D;
-      reader.readMessage(value,proto.visualization.Pose3D.deserializeBinaryFromReader);
-      msg.setPose3d(value);
+    case 19:
+      var value = new proto.visualization.InstanceArray;
+      reader.readMessage(value,proto.visualization.InstanceArray.deserializeBinaryFromReader);
+      msg.setCircleArray(value);
       break;
-    case 12:
-      var value = new proto.visualization.Ball;
-      reader.readMessage(value,proto.visualization.Ball.deserializeBinaryFromReader);
-      msg.setBall(value);
+    case 20:
+      var value = new proto.visualization.InstanceArray;
+      reader.readMessage(value,proto.visualization.InstanceArray.deserializeBinaryFromReader);
+      msg.setPose2dArray(value);
       break;
-    case 13:
-      var value = new proto.visualization.Box3D;
-      reader.readMessage(value,proto.visualization.Box3D.deserializeBinaryFromReader);
-      msg.setBox3d(value);
+    case 22:
+      var value = new proto.visualization.OccupancyGrid;
+      reader.readMessage(value,proto.visualization.OccupancyGrid.deserializeBinaryFromReader);
+      msg.setOccupancyGrid(value);
       break;
-    case 14:
-      var value = new proto.visualization.Line3D;
-      reader.readMessage(value,proto.visualization.Line3D.deserializeBinaryFromReader);
-      msg.setLine3d(value);
+    case 15:
+      var value = /** @type {!proto.visualization.ObjectLayer} */ (reader.readEnum());
+      msg.setLayer(value);
       break;
     default:
       reader.skipField();
@@ -5641,9 +5470,9 @@ proto.visualization.Update3DObjectGeometry.deserializeBinaryFromReader = functio
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.visualization.Update3DObjectGeometry.prototype.serializeBinary = function() {
+proto.visualization.Add2DObject.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.visualization.Update3DObjectGeometry.serializeBinaryToWriter(this, writer);
+  proto.visualization.Add2DObject.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -5651,19 +5480,34 @@ proto.visualization.Update3DObjectGeometry.prototype.serializeBinary = function(
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.visualization.Update3DObjectGeometry} message
+ * @param {!proto.visualization.Add2DObject} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.Update3DObjectGeometry.serializeBinaryToWriter = function(message, writer) {
+proto.visualization.Add2DObject.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
   f = message.getId();
-  if (f.length > 0) {
-    writer.writeString(
+  if (f !== 0) {
+    writer.writeUint32(
       1,
       f
     );
   }
+  f = message.getMaterial();
+  if (f != null) {
+    writer.writeMessage(
+      2,
+      f,
+      proto.visualization.Material.serializeBinaryToWriter
+    );
+  }
+  f = message.getMaterialId();
+  if (f !== 0) {
+    writer.writeUint32(
+      16,
+      f
+    );
+  }
   f = message.getPoint2d();
   if (f != null) {
     writer.writeMessage(
@@ -5720,61 +5564,97 @@ proto.visualization.Update3DObjectGeometry.serializeBinaryToWriter = function(me
       proto.visualization.Polygon.serializeBinaryToWriter
     );
   }
-  f = message.getPoint3d();
-  if (f != null) {
-    writer.writeMessage(
-      10,
-      f,
-      proto.visualization.Point3D.serializeBinaryToWriter
-    );
-  }
-  f = message.getPose3d();
+  f = message.getCircleArray();
   if (f != null) {
     writer.writeMessage(
-      11,
+      19,
       f,
-      proto.visualization.Pose3D.serializeBinaryToWriter
+      proto.visualization.InstanceArray.serializeBinaryToWriter
     );
   }
-  f = message.getBall();
+  f = message.getPose2dArray();
   if (f != null) {
     writer.writeMessage(
-      12,
+      20,
       f,
-      proto.visualization.Ball.serializeBinaryToWriter
+      proto.visualization.InstanceArray.serializeBinaryToWriter
     );
   }
-  f = message.getBox3d();
+  f = message.getOccupancyGrid();
   if (f != null) {
     writer.writeMessage(
-      13,
+      22,
       f,
-      proto.visualization.Box3D.serializeBinaryToWriter
+      proto.visualization.OccupancyGrid.serializeBinaryToWriter
     );
   }
-  f = message.getLine3d();
-  if (f != null) {
-    writer.writeMessage(
-      14,
-      f,
-      proto.visualization.Line3D.serializeBinaryToWriter
+  f = message.getLayer();
+  if (f !== 0.0) {
+    writer.writeEnum(
+      15,
+      f
     );
   }
 };
 
 
 /**
- * optional string id = 1;
- * @return {string}
+ * optional uint32 id = 1;
+ * @return {number}
  */
-proto.visualization.Update3DObjectGeometry.prototype.getId = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+proto.visualization.Add2DObject.prototype.getId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
 };
 
 
-/** @param {string} value */
-proto.visualization.Update3DObjectGeometry.prototype.setId = function(value) {
-  jspb.Message.setProto3StringField(this, 1, value);
+/** @param {number} value */
+proto.visualization.Add2DObject.prototype.setId = function(value) {
+  jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+/**
+ * optional Material material = 2;
+ * @return {?proto.visualization.Material}
+ */
+proto.visualization.Add2DObject.prototype.getMaterial = function() {
+  return /** @type{?proto.visualization.Material} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Material, 2));
+};
+
+
+/** @param {?proto.visualization.Material|undefined} value */
+proto.visualization.Add2DObject.prototype.setMaterial = function(value) {
+  jspb.Message.setWrapperField(this, 2, value);
+};
+
+
+proto.visualization.Add2DObject.prototype.clearMaterial = function() {
+  this.setMaterial(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add2DObject.prototype.hasMaterial = function() {
+  return jspb.Message.getField(this, 2) != null;
+};
+
+
+/**
+ * optional uint32 material_id = 16;
+ * @return {number}
+ */
+proto.visualization.Add2DObject.prototype.getMaterialId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 16, 0));
+};
+
+
+/** @param {number} value */
+proto.visualization.Add2DObject.prototype.setMaterialId = function(value) {
+  jspb.Message.setProto3IntField(this, 16, value);
 };
 
 
@@ -5782,19 +5662,19 @@ proto.visualization.Update3DObjectGeometry.prototype.setId = function(value) {
  * optional Point2D point_2d = 3;
  * @return {?proto.visualization.Point2D}
  */
-proto.visualization.Update3DObjectGeometry.prototype.getPoint2d = function() {
+proto.visualization.Add2DObject.prototype.getPoint2d = function() {
   return /** @type{?proto.visualization.Point2D} */ (
     jspb.Message.getWrapperField(this, proto.visualization.Point2D, 3));
 };
 
 
 /** @param {?proto.visualization.Point2D|undefined} value */
-proto.visualization.Update3DObjectGeometry.prototype.setPoint2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 3, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+proto.visualization.Add2DObject.prototype.setPoint2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 3, proto.visualization.Add2DObject.oneofGroups_[0], value);
 };
 
 
-proto.visualization.Update3DObjectGeometry.prototype.clearPoint2d = function() {
+proto.visualization.Add2DObject.prototype.clearPoint2d = function() {
   this.setPoint2d(undefined);
 };
 
@@ -5803,7 +5683,7 @@ proto.visualization.Update3DObjectGeometry.prototype.clearPoint2d = function() {
  * Returns whether this field is set.
  * @return {!boolean}
  */
-proto.visualization.Update3DObjectGeometry.prototype.hasPoint2d = function() {
+proto.visualization.Add2DObject.prototype.hasPoint2d = function() {
   return jspb.Message.getField(this, 3) != null;
 };
 
@@ -5812,19 +5692,19 @@ proto.visualization.Update3DObjectGeometry.prototype.hasPoint2d = function() {
  * optional Pose2D pose_2d = 4;
  * @return {?proto.visualization.Pose2D}
  */
-proto.visualization.Update3DObjectGeometry.prototype.getPose2d = function() {
+proto.visualization.Add2DObject.prototype.getPose2d = function() {
   return /** @type{?proto.visualization.Pose2D} */ (
     jspb.Message.getWrapperField(this, proto.visualization.Pose2D, 4));
 };
 
 
 /** @param {?proto.visualization.Pose2D|undefined} value */
-proto.visualization.Update3DObjectGeometry.prototype.setPose2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 4, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+proto.visualization.Add2DObject.prototype.setPose2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 4, proto.visualization.Add2DObject.oneofGroups_[0], value);
 };
 
 
-proto.visualization.Update3DObjectGeometry.prototype.clearPose2d = function() {
+proto.visualization.Add2DObject.prototype.clearPose2d = function() {
   this.setPose2d(undefined);
 };
 
@@ -5833,7 +5713,7 @@ proto.visualization.Update3DObjectGeometry.prototype.clearPose2d = function() {
  * Returns whether this field is set.
  * @return {!boolean}
  */
-proto.visualization.Update3DObjectGeometry.prototype.hasPose2d = function() {
+proto.visualization.Add2DObject.prototype.hasPose2d = function() {
   return jspb.Message.getField(this, 4) != null;
 };
 
@@ -5842,19 +5722,19 @@ proto.visualization.Update3DObjectGeometry.prototype.hasPose2d = function() {
  * optional Circle circle = 5;
  * @return {?proto.visualization.Circle}
  */
-proto.visualization.Update3DObjectGeometry.prototype.getCircle = function() {
+proto.visualization.Add2DObject.prototype.getCircle = function() {
   return /** @type{?proto.visualization.Circle} */ (
     jspb.Message.getWrapperField(this, proto.visualization.Circle, 5));
 };
 
 
 /** @param {?proto.visualization.Circle|undefined} value */
-proto.visualization.Update3DObjectGeometry.prototype.setCircle = function(value) {
-  jspb.Message.setOneofWrapperField(this, 5, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+proto.visualization.Add2DObject.prototype.setCircle = function(value) {
+  jspb.Message.setOneofWrapperField(this, 5, proto.visualization.Add2DObject.oneofGroups_[0], value);
 };
 
 
-proto.visualization.Update3DObjectGeometry.prototype.clearCircle = function() {
+proto.visualization.Add2DObject.prototype.clearCircle = function() {
   this.setCircle(undefined);
 };
 
@@ -5863,7 +5743,7 @@ proto.visualization.Update3DObjectGeometry.prototype.clearCircle = function() {
  * Returns whether this field is set.
  * @return {!boolean}
  */
-proto.visualization.Update3DObjectGeometry.prototype.hasCircle = function() {
+proto.visualization.Add2DObject.prototype.hasCircle = function() {
   return jspb.Message.getField(this, 5) != null;
 };
 
@@ -5872,19 +5752,19 @@ proto.visualization.Update3DObjectGeometry.prototype.hasCircle = function() {
  * optional Box2D box_2d = 6;
  * @return {?proto.visualization.Box2D}
  */
-proto.visualization.Update3DObjectGeometry.prototype.getBox2d = function() {
+proto.visualization.Add2DObject.prototype.getBox2d = function() {
   return /** @type{?proto.visualization.Box2D} */ (
     jspb.Message.getWrapperField(this, proto.visualization.Box2D, 6));
 };
 
 
 /** @param {?proto.visualization.Box2D|undefined} value */
-proto.visualization.Update3DObjectGeometry.prototype.setBox2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 6, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+proto.visualization.Add2DObject.prototype.setBox2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 6, proto.visualization.Add2DObject.oneofGroups_[0], value);
 };
 
 
-proto.visualization.Update3DObjectGeometry.prototype.clearBox2d = function() {
+proto.visualization.Add2DObject.prototype.clearBox2d = function() {
   this.setBox2d(undefined);
 };
 
@@ -5893,7 +5773,7 @@ proto.visualization.Update3DObjectGeometry.prototype.clearBox2d = function() {
  * Returns whether this field is set.
  * @return {!boolean}
  */
-proto.visualization.Update3DObjectGeometry.prototype.hasBox2d = function() {
+proto.visualization.Add2DObject.prototype.hasBox2d = function() {
   return jspb.Message.getField(this, 6) != null;
 };
 
@@ -5902,19 +5782,19 @@ proto.visualization.Update3DObjectGeometry.prototype.hasBox2d = function() {
  * optional Line2D line_2d = 7;
  * @return {?proto.visualization.Line2D}
  */
-proto.visualization.Update3DObjectGeometry.prototype.getLine2d = function() {
+proto.visualization.Add2DObject.prototype.getLine2d = function() {
   return /** @type{?proto.visualization.Line2D} */ (
     jspb.Message.getWrapperField(this, proto.visualization.Line2D, 7));
 };
 
 
 /** @param {?proto.visualization.Line2D|undefined} value */
-proto.visualization.Update3DObjectGeometry.prototype.setLine2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 7, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+proto.visualization.Add2DObject.prototype.setLine2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 7, proto.visualization.Add2DObject.oneofGroups_[0], value);
 };
 
 
-proto.visualization.Update3DObjectGeometry.prototype.clearLine2d = function() {
+proto.visualization.Add2DObject.prototype.clearLine2d = function() {
   this.setLine2d(undefined);
 };
 
@@ -5923,7 +5803,7 @@ proto.visualization.Update3DObjectGeometry.prototype.clearLine2d = function() {
  * Returns whether this field is set.
  * @return {!boolean}
  */
-proto.visualization.Update3DObjectGeometry.prototype.hasLine2d = function() {
+proto.visualization.Add2DObject.prototype.hasLine2d = function() {
   return jspb.Message.getField(this, 7) != null;
 };
 
@@ -5932,19 +5812,19 @@ proto.visualization.Update3DObjectGeometry.prototype.hasLine2d = function() {
  * optional Trajectory2D trajectory_2d = 8;
  * @return {?proto.visualization.Trajectory2D}
  */
-proto.visualization.Update3DObjectGeometry.prototype.getTrajectory2d = function() {
+proto.visualization.Add2DObject.prototype.getTrajectory2d = function() {
   return /** @type{?proto.visualization.Trajectory2D} */ (
     jspb.Message.getWrapperField(this, proto.visualization.Trajectory2D, 8));
 };
 
 
 /** @param {?proto.visualization.Trajectory2D|undefined} value */
-proto.visualization.Update3DObjectGeometry.prototype.setTrajectory2d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 8, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+proto.visualization.Add2DObject.prototype.setTrajectory2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 8, proto.visualization.Add2DObject.oneofGroups_[0], value);
 };
 
 
-proto.visualization.Update3DObjectGeometry.prototype.clearTrajectory2d = function() {
+proto.visualization.Add2DObject.prototype.clearTrajectory2d = function() {
   this.setTrajectory2d(undefined);
 };
 
@@ -5953,7 +5833,7 @@ proto.visualization.Update3DObjectGeometry.prototype.clearTrajectory2d = functio
  * Returns whether this field is set.
  * @return {!boolean}
  */
-proto.visualization.Update3DObjectGeometry.prototype.hasTrajectory2d = function() {
+proto.visualization.Add2DObject.prototype.hasTrajectory2d = function() {
   return jspb.Message.getField(this, 8) != null;
 };
 
@@ -5962,19 +5842,19 @@ proto.visualization.Update3DObjectGeometry.prototype.hasTrajectory2d = function(
  * optional Polygon polygon = 9;
  * @return {?proto.visualization.Polygon}
  */
-proto.visualization.Update3DObjectGeometry.prototype.getPolygon = function() {
+proto.visualization.Add2DObject.prototype.getPolygon = function() {
   return /** @type{?proto.visualization.Polygon} */ (
     jspb.Message.getWrapperField(this, proto.visualization.Polygon, 9));
 };
 
 
 /** @param {?proto.visualization.Polygon|undefined} value */
-proto.visualization.Update3DObjectGeometry.prototype.setPolygon = function(value) {
-  jspb.Message.setOneofWrapperField(this, 9, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+proto.visualization.Add2DObject.prototype.setPolygon = function(value) {
+  jspb.Message.setOneofWrapperField(this, 9, proto.visualization.Add2DObject.oneofGroups_[0], value);
 };
 
 
-proto.visualization.Update3DObjectGeometry.prototype.clearPolygon = function() {
+proto.visualization.Add2DObject.prototype.clearPolygon = function() {
   this.setPolygon(undefined);
 };
 
@@ -5983,29 +5863,29 @@ proto.visualization.Update3DObjectGeometry.prototype.clearPolygon = function() {
  * Returns whether this field is set.
  * @return {!boolean}
  */
-proto.visualization.Update3DObjectGeometry.prototype.hasPolygon = function() {
+proto.visualization.Add2DObject.prototype.hasPolygon = function() {
   return jspb.Message.getField(this, 9) != null;
 };
 
 
 /**
- * optional Point3D point_3d = 10;
- * @return {?proto.visualization.Point3D}
+ * optional InstanceArray circle_array = 19;
+ * @return {?proto.visualization.InstanceArray}
  */
-proto.visualization.Update3DObjectGeometry.prototype.getPoint3d = function() {
-  return /** @type{?proto.visualization.Point3D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Point3D, 10));
+proto.visualization.Add2DObject.prototype.getCircleArray = function() {
+  return /** @type{?proto.visualization.InstanceArray} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.InstanceArray, 19));
 };
 
 
-/** @param {?proto.visualization.Point3D|undefined} value */
-proto.visualization.Update3DObjectGeometry.prototype.setPoint3d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 10, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+/** @param {?proto.visualization.InstanceArray|undefined} value */
+proto.visualization.Add2DObject.prototype.setCircleArray = function(value) {
+  jspb.Message.setOneofWrapperField(this, 19, proto.visualization.Add2DObject.oneofGroups_[0], value);
 };
 
 
-proto.visualization.Update3DObjectGeometry.prototype.clearPoint3d = function() {
-  this.setPoint3d(undefined);
+proto.visualization.Add2DObject.prototype.clearCircleArray = function() {
+  this.setCircleArray(undefined);
 };
 
 
@@ -6013,29 +5893,29 @@ proto.visualization.Update3DObjectGeometry.prototype.clearPoint3d = function() {
  * Returns whether this field is set.
  * @return {!boolean}
  */
-proto.visualization.Update3DObjectGeometry.prototype.hasPoint3d = function() {
-  return jspb.Message.getField(this, 10) != null;
+proto.visualization.Add2DObject.prototype.hasCircleArray = function() {
+  return jspb.Message.getField(this, 19) != null;
 };
 
 
 /**
- * optional Pose3D pose_3d = 11;
- * @return {?proto.visualization.Pose3D}
+ * optional InstanceArray pose_2d_array = 20;
+ * @return {?proto.visualization.InstanceArray}
  */
-proto.visualization.Update3DObjectGeometry.prototype.getPose3d = function() {
-  return /** @type{?proto.visualization.Pose3D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Pose3D, 11));
+proto.visualization.Add2DObject.prototype.getPose2dArray = function() {
+  return /** @type{?proto.visualization.InstanceArray} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.InstanceArray, 20));
 };
 
 
-/** @param {?proto.visualization.Pose3D|undefined} value */
-proto.visualization.Update3DObjectGeometry.prototype.setPose3d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 11, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+/** @param {?proto.visualization.InstanceArray|undefined} value */
+proto.visualization.Add2DObject.prototype.setPose2dArray = function(value) {
+  jspb.Message.setOneofWrapperField(this, 20, proto.visualization.Add2DObject.oneofGroups_[0], value);
 };
 
 
-proto.visualization.Update3DObjectGeometry.prototype.clearPose3d = function() {
-  this.setPose3d(undefined);
+proto.visualization.Add2DObject.prototype.clearPose2dArray = function() {
+  this.setPose2dArray(undefined);
 };
 
 
@@ -6043,98 +5923,4593 @@ proto.visualization.Update3DObjectGeometry.prototype.clearPose3d = function() {
  * Returns whether this field is set.
  * @return {!boolean}
  */
-proto.visualization.Update3DObjectGeometry.prototype.hasPose3d = function() {
-  return jspb.Message.getField(this, 11) != null;
+proto.visualization.Add2DObject.prototype.hasPose2dArray = function() {
+  return jspb.Message.getField(this, 20) != null;
 };
 
 
 /**
- * optional Ball ball = 12;
- * @return {?proto.visualization.Ball}
+ * optional OccupancyGrid occupancy_grid = 22;
+ * @return {?proto.visualization.OccupancyGrid}
  */
-proto.visualization.Update3DObjectGeometry.prototype.getBall = function() {
-  return /** @type{?proto.visualization.Ball} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Ball, 12));
+proto.visualization.Add2DObject.prototype.getOccupancyGrid = function() {
+  return /** @type{?proto.visualization.OccupancyGrid} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.OccupancyGrid, 22));
 };
 
 
-/** @param {?proto.visualization.Ball|undefined} value */
-proto.visualization.Update3DObjectGeometry.prototype.setBall = function(value) {
-  jspb.Message.setOneofWrapperField(this, 12, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+/** @param {?proto.visualization.OccupancyGrid|undefined} value */
+proto.visualization.Add2DObject.prototype.setOccupancyGrid = function(value) {
+  jspb.Message.setOneofWrapperField(this, 22, proto.visualization.Add2DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add2DObject.prototype.clearOccupancyGrid = function() {
+  this.setOccupancyGrid(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add2DObject.prototype.hasOccupancyGrid = function() {
+  return jspb.Message.getField(this, 22) != null;
+};
+
+
+/**
+ * optional ObjectLayer layer = 15;
+ * @return {!proto.visualization.ObjectLayer}
+ */
+proto.visualization.Add2DObject.prototype.getLayer = function() {
+  return /** @type {!proto.visualization.ObjectLayer} */ (jspb.Message.getFieldWithDefault(this, 15, 0));
+};
+
+
+/** @param {!proto.visualization.ObjectLayer} value */
+proto.visualization.Add2DObject.prototype.setLayer = function(value) {
+  jspb.Message.setProto3EnumField(this, 15, value);
+};
+
+
+
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.visualization.Add3DObject = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, proto.visualization.Add3DObject.oneofGroups_);
+};
+goog.inherits(proto.visualization.Add3DObject, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.visualization.Add3DObject.displayName = 'proto.visualization.Add3DObject';
+}
+/**
+ * Oneof group definitions for this message. Each group defines the field
+ * numbers belonging to that group. When of these fields' value is set, all
+ * other fields in the group are cleared. During deserialization, if multiple
+ * fields are encountered for a group, only the last value seen will be kept.
+ * @private {!Array<!Array<number>>}
+ * @const
+ */
+proto.visualization.Add3DObject.oneofGroups_ = [[3,4,5,6,7,8,9,10,11,12,13,14,17,18,19,20,21,22]];
+
+/**
+ * @enum {number}
+ */
+proto.visualization.Add3DObject.GeometryDataCase = {
+  GEOMETRY_DATA_NOT_SET: 0,
+  POINT_2D: 3,
+  POSE_2D: 4,
+  CIRCLE: 5,
+  BOX_2D: 6,
+  LINE_2D: 7,
+  TRAJECTORY_2D: 8,
+  POLYGON: 9,
+  POINT_3D: 10,
+  POSE_3D: 11,
+  BALL: 12,
+  BOX_3D: 13,
+  LINE_3D: 14,
+  POINT_CLOUD_3D: 17,
+  BOX_3D_ARRAY: 18,
+  CIRCLE_ARRAY: 19,
+  POSE_2D_ARRAY: 20,
+  TRIANGLE_MESH_3D: 21,
+  OCCUPANCY_GRID: 22
+};
+
+/**
+ * @return {proto.visualization.Add3DObject.GeometryDataCase}
+ */
+proto.visualization.Add3DObject.prototype.getGeometryDataCase = function() {
+  return /** @type {proto.visualization.Add3DObject.GeometryDataCase} */(jspb.Message.computeOneofCase(this, proto.visualization.Add3DObject.oneofGroups_[0]));
+};
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.visualization.Add3DObject.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.Add3DObject.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.visualization.Add3DObject} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.Add3DObject.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    id: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    material: (f = msg.getMaterial()) && proto.visualization.Material.toObject(includeInstance, f),
+    materialId: jspb.Message.getFieldWithDefault(msg, 16, 0),
+    point2d: (f = msg.getPoint2d()) && proto.visualization.Point2D.toObject(includeInstance, f),
+    pose2d: (f = msg.getPose2d()) && proto.visualization.Pose2D.toObject(includeInstance, f),
+    circle: (f = msg.getCircle()) && proto.visualization.Circle.toObject(includeInstance, f),
+    box2d: (f = msg.getBox2d()) && proto.visualization.Box2D.toObject(includeInstance, f),
+    line2d: (f = msg.getLine2d()) && proto.visualization.Line2D.toObject(includeInstance, f),
+    trajectory2d: (f = msg.getTrajectory2d()) && proto.visualization.Trajectory2D.toObject(includeInstance, f),
+    polygon: (f = msg.getPolygon()) && proto.visualization.Polygon.toObject(includeInstance, f),
+    point3d: (f = msg.getPoint3d()) && proto.visualization.Point3D.toObject(includeInstance, f),
+    pose3d: (f = msg.getPose3d()) && proto.visualization.Pose3D.toObject(includeInstance, f),
+    ball: (f = msg.getBall()) && proto.visualization.Ball.toObject(includeInstance, f),
+    box3d: (f = msg.getBox3d()) && proto.visualization.Box3D.toObject(includeInstance, f),
+    line3d: (f = msg.getLine3d()) && proto.visualization.Line3D.toObject(includeInstance, f),
+    pointCloud3d: (f = msg.getPointCloud3d()) && proto.visualization.PointCloud3D.toObject(includeInstance, f),
+    box3dArray: (f = msg.getBox3dArray()) && proto.visualization.InstanceArray.toObject(includeInstance, f),
+    circleArray: (f = msg.getCircleArray()) && proto.visualization.InstanceArray.toObject(includeInstance, f),
+    pose2dArray: (f = msg.getPose2dArray()) && proto.visualization.InstanceArray.toObject(includeInstance, f),
+    triangleMesh3d: (f = msg.getTriangleMesh3d()) && proto.visualization.TriangleMesh3D.toObject(includeInstance, f),
+    occupancyGrid: (f = msg.getOccupancyGrid()) && proto.visualization.OccupancyGrid.toObject(includeInstance, f),
+    layer: jspb.Message.getFieldWithDefault(msg, 15, 0)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.visualization.Add3DObject}
+ */
+proto.visualization.Add3DObject.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.visualization.Add3DObject;
+  return proto.visualization.Add3DObject.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.visualization.Add3DObject} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.visualization.Add3DObject}
+ */
+proto.visualization.Add3DObject.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setId(value);
+      break;
+    case 2:
+      var value = new proto.visualization.Material;
+      reader.readMessage(value,proto.visualization.Material.deserializeBinaryFromReader);
+      msg.setMaterial(value);
+      break;
+    case 16:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setMaterialId(value);
+      break;
+    case 3:
+      var value = new proto.visualization.Point2D;
+      reader.readMessage(value,proto.visualization.Point2D.deserializeBinaryFromReader);
+      msg.setPoint2d(value);
+      break;
+    case 4:
+      var value = new proto.visualization.Pose2D;
+      reader.readMessage(value,proto.visualization.Pose2D.deserializeBinaryFromReader);
+      msg.setPose2d(value);
+      break;
+    case 5:
+      var value = new proto.visualization.Circle;
+      reader.readMessage(value,proto.visualization.Circle.deserializeBinaryFromReader);
+      msg.setCircle(value);
+      break;
+    case 6:
+      var value = new proto.visualization.Box2D;
+      reader.readMessage(value,proto.visualization.Box2D.deserializeBinaryFromReader);
+      msg.setBox2d(value);
+      break;
+    case 7:
+      var value = new proto.visualization.Line2D;
+      reader.readMessage(value,proto.visualization.Line2D.deserializeBinaryFromReader);
+      msg.setLine2d(value);
+      break;
+    case 8:
+      var value = new proto.visualization.Trajectory2D;
+      reader.readMessage(value,proto.visualization.Trajectory2D.deserializeBinaryFromReader);
+      msg.setTrajectory2d(value);
+      break;
+    case 9:
+      var value = new proto.visualization.Polygon;
+      reader.readMessage(value,proto.visualization.Polygon.deserializeBinaryFromReader);
+      msg.setPolygon(value);
+      break;
+    case 10:
+      var value = new proto.visualization.Point3D;
+      reader.readMessage(value,proto.visualization.Point3D.deserializeBinaryFromReader);
+      msg.setPoint3d(value);
+      break;
+    case 11:
+      var value = new proto.visualization.Pose3D;
+      reader.readMessage(value,proto.visualization.Pose3D.deserializeBinaryFromReader);
+      msg.setPose3d(value);
+      break;
+    case 12:
+      var value = new proto.visualization.Ball;
+      reader.readMessage(value,proto.visualization.Ball.deserializeBinaryFromReader);
+      msg.setBall(value);
+      break;
+    case 13:
+      var value = new proto.visualization.Box3D;
+      reader.readMessage(value,proto.visualization.Box3D.deserializeBinaryFromReader);
+      msg.setBox3d(value);
+      break;
+    case 14:
+      var value = new proto.visualization.Line3D;
+      reader.readMessage(value,proto.visualization.Line3D.deserializeBinaryFromReader);
+      msg.setLine3d(value);
+      break;
+    case 17:
+      var value = new proto.visualization.PointCloud3D;
+      reader.readMessage(value,proto.visualization.PointCloud3D.deserializeBinaryFromReader);
+      msg.setPointCloud3d(value);
+      break;
+    case 18:
+      var value = new proto.visualization.InstanceArray;
+      reader.readMessage(value,proto.visualization.InstanceArray.deserializeBinaryFromReader);
+      msg.setBox3dArray(value);
+      break;
+    case 19:
+      var value = new proto.visualization.InstanceArray;
+      reader.readMessage(value,proto.visualization.InstanceArray.deserializeBinaryFromReader);
+      msg.setCircleArray(value);
+      break;
+    case 20:
+      var value = new proto.visualization.InstanceArray;
+      reader.readMessage(value,proto.visualization.InstanceArray.deserializeBinaryFromReader);
+      msg.setPose2dArray(value);
+      break;
+    case 21:
+      var value = new proto.visualization.TriangleMesh3D;
+      reader.readMessage(value,proto.visualization.TriangleMesh3D.deserializeBinaryFromReader);
+      msg.setTriangleMesh3d(value);
+      break;
+    case 22:
+      var value = new proto.visualization.OccupancyGrid;
+      reader.readMessage(value,proto.visualization.OccupancyGrid.deserializeBinaryFromReader);
+      msg.setOccupancyGrid(value);
+      break;
+    case 15:
+      var value = /** @type {!proto.visualization.ObjectLayer} */ (reader.readEnum());
+      msg.setLayer(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.visualization.Add3DObject.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.visualization.Add3DObject.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.visualization.Add3DObject} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.Add3DObject.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getId();
+  if (f !== 0) {
+    writer.writeUint32(
+      1,
+      f
+    );
+  }
+  f = message.getMaterial();
+  if (f != null) {
+    writer.writeMessage(
+      2,
+      f,
+      proto.visualization.Material.serializeBinaryToWriter
+    );
+  }
+  f = message.getMaterialId();
+  if (f !== 0) {
+    writer.writeUint32(
+      16,
+      f
+    );
+  }
+  f = message.getPoint2d();
+  if (f != null) {
+    writer.writeMessage(
+      3,
+      f,
+      proto.visualization.Point2D.serializeBinaryToWriter
+    );
+  }
+  f = message.getPose2d();
+  if (f != null) {
+    writer.writeMessage(
+      4,
+      f,
+      proto.visualization.Pose2D.serializeBinaryToWriter
+    );
+  }
+  f = message.getCircle();
+  if (f != null) {
+    writer.writeMessage(
+      5,
+      f,
+      proto.visualization.Circle.serializeBinaryToWriter
+    );
+  }
+  f = message.getBox2d();
+  if (f != null) {
+    writer.writeMessage(
+      6,
+      f,
+      proto.visualization.Box2D.serializeBinaryToWriter
+    );
+  }
+  f = message.getLine2d();
+  if (f != null) {
+    writer.writeMessage(
+      7,
+      f,
+      proto.visualization.Line2D.serializeBinaryToWriter
+    );
+  }
+  f = message.getTrajectory2d();
+  if (f != null) {
+    writer.writeMessage(
+      8,
+      f,
+      proto.visualization.Trajectory2D.serializeBinaryToWriter
+    );
+  }
+  f = message.getPolygon();
+  if (f != null) {
+    writer.writeMessage(
+      9,
+      f,
+      proto.visualization.Polygon.serializeBinaryToWriter
+    );
+  }
+  f = message.getPoint3d();
+  if (f != null) {
+    writer.writeMessage(
+      10,
+      f,
+      proto.visualization.Point3D.serializeBinaryToWriter
+    );
+  }
+  f = message.getPose3d();
+  if (f != null) {
+    writer.writeMessage(
+      11,
+      f,
+      proto.visualization.Pose3D.serializeBinaryToWriter
+    );
+  }
+  f = message.getBall();
+  if (f != null) {
+    writer.writeMessage(
+      12,
+      f,
+      proto.visualization.Ball.serializeBinaryToWriter
+    );
+  }
+  f = message.getBox3d();
+  if (f != null) {
+    writer.writeMessage(
+      13,
+      f,
+      proto.visualization.Box3D.serializeBinaryToWriter
+    );
+  }
+  f = message.getLine3d();
+  if (f != null) {
+    writer.writeMessage(
+      14,
+      f,
+      proto.visualization.Line3D.serializeBinaryToWriter
+    );
+  }
+  f = message.getPointCloud3d();
+  if (f != null) {
+    writer.writeMessage(
+      17,
+      f,
+      proto.visualization.PointCloud3D.serializeBinaryToWriter
+    );
+  }
+  f = message.getBox3dArray();
+  if (f != null) {
+    writer.writeMessage(
+      18,
+      f,
+      proto.visualization.InstanceArray.serializeBinaryToWriter
+    );
+  }
+  f = message.getCircleArray();
+  if (f != null) {
+    writer.writeMessage(
+      19,
+      f,
+      proto.visualization.InstanceArray.serializeBinaryToWriter
+    );
+  }
+  f = message.getPose2dArray();
+  if (f != null) {
+    writer.writeMessage(
+      20,
+      f,
+      proto.visualization.InstanceArray.serializeBinaryToWriter
+    );
+  }
+  f = message.getTriangleMesh3d();
+  if (f != null) {
+    writer.writeMessage(
+      21,
+      f,
+      proto.visualization.TriangleMesh3D.serializeBinaryToWriter
+    );
+  }
+  f = message.getOccupancyGrid();
+  if (f != null) {
+    writer.writeMessage(
+      22,
+      f,
+      proto.visualization.OccupancyGrid.serializeBinaryToWriter
+    );
+  }
+  f = message.getLayer();
+  if (f !== 0.0) {
+    writer.writeEnum(
+      15,
+      f
+    );
+  }
+};
+
+
+/**
+ * optional uint32 id = 1;
+ * @return {number}
+ */
+proto.visualization.Add3DObject.prototype.getId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/** @param {number} value */
+proto.visualization.Add3DObject.prototype.setId = function(value) {
+  jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+/**
+ * optional Material material = 2;
+ * @return {?proto.visualization.Material}
+ */
+proto.visualization.Add3DObject.prototype.getMaterial = function() {
+  return /** @type{?proto.visualization.Material} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Material, 2));
+};
+
+
+/** @param {?proto.visualization.Material|undefined} value */
+proto.visualization.Add3DObject.prototype.setMaterial = function(value) {
+  jspb.Message.setWrapperField(this, 2, value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearMaterial = function() {
+  this.setMaterial(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasMaterial = function() {
+  return jspb.Message.getField(this, 2) != null;
+};
+
+
+/**
+ * optional uint32 material_id = 16;
+ * @return {number}
+ */
+proto.visualization.Add3DObject.prototype.getMaterialId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 16, 0));
+};
+
+
+/** @param {number} value */
+proto.visualization.Add3DObject.prototype.setMaterialId = function(value) {
+  jspb.Message.setProto3IntField(this, 16, value);
+};
+
+
+/**
+ * optional Point2D point_2d = 3;
+ * @return {?proto.visualization.Point2D}
+ */
+proto.visualization.Add3DObject.prototype.getPoint2d = function() {
+  return /** @type{?proto.visualization.Point2D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Point2D, 3));
+};
+
+
+/** @param {?proto.visualization.Point2D|undefined} value */
+proto.visualization.Add3DObject.prototype.setPoint2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 3, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearPoint2d = function() {
+  this.setPoint2d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasPoint2d = function() {
+  return jspb.Message.getField(this, 3) != null;
+};
+
+
+/**
+ * optional Pose2D pose_2d = 4;
+ * @return {?proto.visualization.Pose2D}
+ */
+proto.visualization.Add3DObject.prototype.getPose2d = function() {
+  return /** @type{?proto.visualization.Pose2D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Pose2D, 4));
+};
+
+
+/** @param {?proto.visualization.Pose2D|undefined} value */
+proto.visualization.Add3DObject.prototype.setPose2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 4, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearPose2d = function() {
+  this.setPose2d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasPose2d = function() {
+  return jspb.Message.getField(this, 4) != null;
+};
+
+
+/**
+ * optional Circle circle = 5;
+ * @return {?proto.visualization.Circle}
+ */
+proto.visualization.Add3DObject.prototype.getCircle = function() {
+  return /** @type{?proto.visualization.Circle} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Circle, 5));
+};
+
+
+/** @param {?proto.visualization.Circle|undefined} value */
+proto.visualization.Add3DObject.prototype.setCircle = function(value) {
+  jspb.Message.setOneofWrapperField(this, 5, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearCircle = function() {
+  this.setCircle(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasCircle = function() {
+  return jspb.Message.getField(this, 5) != null;
+};
+
+
+/**
+ * optional Box2D box_2d = 6;
+ * @return {?proto.visualization.Box2D}
+ */
+proto.visualization.Add3DObject.prototype.getBox2d = function() {
+  return /** @type{?proto.visualization.Box2D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Box2D, 6));
+};
+
+
+/** @param {?proto.visualization.Box2D|undefined} value */
+proto.visualization.Add3DObject.prototype.setBox2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 6, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearBox2d = function() {
+  this.setBox2d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasBox2d = function() {
+  return jspb.Message.getField(this, 6) != null;
+};
+
+
+/**
+ * optional Line2D line_2d = 7;
+ * @return {?proto.visualization.Line2D}
+ */
+proto.visualization.Add3DObject.prototype.getLine2d = function() {
+  return /** @type{?proto.visualization.Line2D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Line2D, 7));
+};
+
+
+/** @param {?proto.visualization.Line2D|undefined} value */
+proto.visualization.Add3DObject.prototype.setLine2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 7, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearLine2d = function() {
+  this.setLine2d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasLine2d = function() {
+  return jspb.Message.getField(this, 7) != null;
+};
+
+
+/**
+ * optional Trajectory2D trajectory_2d = 8;
+ * @return {?proto.visualization.Trajectory2D}
+ */
+proto.visualization.Add3DObject.prototype.getTrajectory2d = function() {
+  return /** @type{?proto.visualization.Trajectory2D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Trajectory2D, 8));
+};
+
+
+/** @param {?proto.visualization.Trajectory2D|undefined} value */
+proto.visualization.Add3DObject.prototype.setTrajectory2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 8, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearTrajectory2d = function() {
+  this.setTrajectory2d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasTrajectory2d = function() {
+  return jspb.Message.getField(this, 8) != null;
+};
+
+
+/**
+ * optional Polygon polygon = 9;
+ * @return {?proto.visualization.Polygon}
+ */
+proto.visualization.Add3DObject.prototype.getPolygon = function() {
+  return /** @type{?proto.visualization.Polygon} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Polygon, 9));
+};
+
+
+/** @param {?proto.visualization.Polygon|undefined} value */
+proto.visualization.Add3DObject.prototype.setPolygon = function(value) {
+  jspb.Message.setOneofWrapperField(this, 9, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearPolygon = function() {
+  this.setPolygon(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasPolygon = function() {
+  return jspb.Message.getField(this, 9) != null;
+};
+
+
+/**
+ * optional Point3D point_3d = 10;
+ * @return {?proto.visualization.Point3D}
+ */
+proto.visualization.Add3DObject.prototype.getPoint3d = function() {
+  return /** @type{?proto.visualization.Point3D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Point3D, 10));
+};
+
+
+/** @param {?proto.visualization.Point3D|undefined} value */
+proto.visualization.Add3DObject.prototype.setPoint3d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 10, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearPoint3d = function() {
+  this.setPoint3d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasPoint3d = function() {
+  return jspb.Message.getField(this, 10) != null;
+};
+
+
+/**
+ * optional Pose3D pose_3d = 11;
+ * @return {?proto.visualization.Pose3D}
+ */
+proto.visualization.Add3DObject.prototype.getPose3d = function() {
+  return /** @type{?proto.visualization.Pose3D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Pose3D, 11));
+};
+
+
+/** @param {?proto.visualization.Pose3D|undefined} value */
+proto.visualization.Add3DObject.prototype.setPose3d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 11, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearPose3d = function() {
+  this.setPose3d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasPose3d = function() {
+  return jspb.Message.getField(this, 11) != null;
+};
+
+
+/**
+ * optional Ball ball = 12;
+ * @return {?proto.visualization.Ball}
+ */
+proto.visualization.Add3DObject.prototype.getBall = function() {
+  return /** @type{?proto.visualization.Ball} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Ball, 12));
+};
+
+
+/** @param {?proto.visualization.Ball|undefined} value */
+proto.visualization.Add3DObject.prototype.setBall = function(value) {
+  jspb.Message.setOneofWrapperField(this, 12, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearBall = function() {
+  this.setBall(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasBall = function() {
+  return jspb.Message.getField(this, 12) != null;
+};
+
+
+/**
+ * optional Box3D box_3d = 13;
+ * @return {?proto.visualization.Box3D}
+ */
+proto.visualization.Add3DObject.prototype.getBox3d = function() {
+  return /** @type{?proto.visualization.Box3D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Box3D, 13));
+};
+
+
+/** @param {?proto.visualization.Box3D|undefined} value */
+proto.visualization.Add3DObject.prototype.setBox3d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 13, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearBox3d = function() {
+  this.setBox3d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasBox3d = function() {
+  return jspb.Message.getField(this, 13) != null;
+};
+
+
+/**
+ * optional Line3D line_3d = 14;
+ * @return {?proto.visualization.Line3D}
+ */
+proto.visualization.Add3DObject.prototype.getLine3d = function() {
+  return /** @type{?proto.visualization.Line3D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Line3D, 14));
+};
+
+
+/** @param {?proto.visualization.Line3D|undefined} value */
+proto.visualization.Add3DObject.prototype.setLine3d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 14, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearLine3d = function() {
+  this.setLine3d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasLine3d = function() {
+  return jspb.Message.getField(this, 14) != null;
+};
+
+
+/**
+ * optional PointCloud3D point_cloud_3d = 17;
+ * @return {?proto.visualization.PointCloud3D}
+ */
+proto.visualization.Add3DObject.prototype.getPointCloud3d = function() {
+  return /** @type{?proto.visualization.PointCloud3D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.PointCloud3D, 17));
+};
+
+
+/** @param {?proto.visualization.PointCloud3D|undefined} value */
+proto.visualization.Add3DObject.prototype.setPointCloud3d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 17, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearPointCloud3d = function() {
+  this.setPointCloud3d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasPointCloud3d = function() {
+  return jspb.Message.getField(this, 17) != null;
+};
+
+
+/**
+ * optional InstanceArray box_3d_array = 18;
+ * @return {?proto.visualization.InstanceArray}
+ */
+proto.visualization.Add3DObject.prototype.getBox3dArray = function() {
+  return /** @type{?proto.visualization.InstanceArray} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.InstanceArray, 18));
+};
+
+
+/** @param {?proto.visualization.InstanceArray|undefined} value */
+proto.visualization.Add3DObject.prototype.setBox3dArray = function(value) {
+  jspb.Message.setOneofWrapperField(this, 18, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearBox3dArray = function() {
+  this.setBox3dArray(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasBox3dArray = function() {
+  return jspb.Message.getField(this, 18) != null;
+};
+
+
+/**
+ * optional InstanceArray circle_array = 19;
+ * @return {?proto.visualization.InstanceArray}
+ */
+proto.visualization.Add3DObject.prototype.getCircleArray = function() {
+  return /** @type{?proto.visualization.InstanceArray} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.InstanceArray, 19));
+};
+
+
+/** @param {?proto.visualization.InstanceArray|undefined} value */
+proto.visualization.Add3DObject.prototype.setCircleArray = function(value) {
+  jspb.Message.setOneofWrapperField(this, 19, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearCircleArray = function() {
+  this.setCircleArray(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasCircleArray = function() {
+  return jspb.Message.getField(this, 19) != null;
+};
+
+
+/**
+ * optional InstanceArray pose_2d_array = 20;
+ * @return {?proto.visualization.InstanceArray}
+ */
+proto.visualization.Add3DObject.prototype.getPose2dArray = function() {
+  return /** @type{?proto.visualization.InstanceArray} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.InstanceArray, 20));
+};
+
+
+/** @param {?proto.visualization.InstanceArray|undefined} value */
+proto.visualization.Add3DObject.prototype.setPose2dArray = function(value) {
+  jspb.Message.setOneofWrapperField(this, 20, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearPose2dArray = function() {
+  this.setPose2dArray(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasPose2dArray = function() {
+  return jspb.Message.getField(this, 20) != null;
+};
+
+
+/**
+ * optional TriangleMesh3D triangle_mesh_3d = 21;
+ * @return {?proto.visualization.TriangleMesh3D}
+ */
+proto.visualization.Add3DObject.prototype.getTriangleMesh3d = function() {
+  return /** @type{?proto.visualization.TriangleMesh3D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.TriangleMesh3D, 21));
+};
+
+
+/** @param {?proto.visualization.TriangleMesh3D|undefined} value */
+proto.visualization.Add3DObject.prototype.setTriangleMesh3d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 21, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearTriangleMesh3d = function() {
+  this.setTriangleMesh3d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasTriangleMesh3d = function() {
+  return jspb.Message.getField(this, 21) != null;
+};
+
+
+/**
+ * optional OccupancyGrid occupancy_grid = 22;
+ * @return {?proto.visualization.OccupancyGrid}
+ */
+proto.visualization.Add3DObject.prototype.getOccupancyGrid = function() {
+  return /** @type{?proto.visualization.OccupancyGrid} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.OccupancyGrid, 22));
+};
+
+
+/** @param {?proto.visualization.OccupancyGrid|undefined} value */
+proto.visualization.Add3DObject.prototype.setOccupancyGrid = function(value) {
+  jspb.Message.setOneofWrapperField(this, 22, proto.visualization.Add3DObject.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Add3DObject.prototype.clearOccupancyGrid = function() {
+  this.setOccupancyGrid(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Add3DObject.prototype.hasOccupancyGrid = function() {
+  return jspb.Message.getField(this, 22) != null;
+};
+
+
+/**
+ * optional ObjectLayer layer = 15;
+ * @return {!proto.visualization.ObjectLayer}
+ */
+proto.visualization.Add3DObject.prototype.getLayer = function() {
+  return /** @type {!proto.visualization.ObjectLayer} */ (jspb.Message.getFieldWithDefault(this, 15, 0));
+};
+
+
+/** @param {!proto.visualization.ObjectLayer} value */
+proto.visualization.Add3DObject.prototype.setLayer = function(value) {
+  jspb.Message.setProto3EnumField(this, 15, value);
+};
+
+
+
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.visualization.Update2DObjectGeometry = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, proto.visualization.Update2DObjectGeometry.oneofGroups_);
+};
+goog.inherits(proto.visualization.Update2DObjectGeometry, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.visualization.Update2DObjectGeometry.displayName = 'proto.visualization.Update2DObjectGeometry';
+}
+/**
+ * Oneof group definitions for this message. Each group defines the field
+ * numbers belonging to that group. When of these fields' value is set, all
+ * other fields in the group are cleared. During deserialization, if multiple
+ * fields are encountered for a group, only the last value seen will be kept.
+ * @private {!Array<!Array<number>>}
+ * @const
+ */
+proto.visualization.Update2DObjectGeometry.oneofGroups_ = [[3,4,5,6,7,8,9,15,16,19,20,22]];
+
+/**
+ * @enum {number}
+ */
+proto.visualization.Update2DObjectGeometry.GeometryDataCase = {
+  GEOMETRY_DATA_NOT_SET: 0,
+  POINT_2D: 3,
+  POSE_2D: 4,
+  CIRCLE: 5,
+  BOX_2D: 6,
+  LINE_2D: 7,
+  TRAJECTORY_2D: 8,
+  POLYGON: 9,
+  APPEND_POINTS: 15,
+  APPEND_POSES: 16,
+  CIRCLE_ARRAY: 19,
+  POSE_2D_ARRAY: 20,
+  OCCUPANCY_GRID: 22
+};
+
+/**
+ * @return {proto.visualization.Update2DObjectGeometry.GeometryDataCase}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.getGeometryDataCase = function() {
+  return /** @type {proto.visualization.Update2DObjectGeometry.GeometryDataCase} */(jspb.Message.computeOneofCase(this, proto.visualization.Update2DObjectGeometry.oneofGroups_[0]));
+};
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.Update2DObjectGeometry.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.visualization.Update2DObjectGeometry} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.Update2DObjectGeometry.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    id: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    fieldMask: jspb.Message.getFieldWithDefault(msg, 2, 0),
+    point2d: (f = msg.getPoint2d()) && proto.visualization.Point2D.toObject(includeInstance, f),
+    pose2d: (f = msg.getPose2d()) && proto.visualization.Pose2D.toObject(includeInstance, f),
+    circle: (f = msg.getCircle()) && proto.visualization.Circle.toObject(includeInstance, f),
+    box2d: (f = msg.getBox2d()) && proto.visualization.Box2D.toObject(includeInstance, f),
+    line2d: (f = msg.getLine2d()) && proto.visualization.Line2D.toObject(includeInstance, f),
+    trajectory2d: (f = msg.getTrajectory2d()) && proto.visualization.Trajectory2D.toObject(includeInstance, f),
+    polygon: (f = msg.getPolygon()) && proto.visualization.Polygon.toObject(includeInstance, f),
+    appendPoints: (f = msg.getAppendPoints()) && proto.visualization.AppendPoints.toObject(includeInstance, f),
+    appendPoses: (f = msg.getAppendPoses()) && proto.visualization.AppendPoses.toObject(includeInstance, f),
+    circleArray: (f = msg.getCircleArray()) && proto.visualization.InstanceArray.toObject(includeInstance, f),
+    pose2dArray: (f = msg.getPose2dArray()) && proto.visualization.InstanceArray.toObject(includeInstance, f),
+    occupancyGrid: (f = msg.getOccupancyGrid()) && proto.visualization.OccupancyGrid.toObject(includeInstance, f)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.visualization.Update2DObjectGeometry}
+ */
+proto.visualization.Update2DObjectGeometry.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.visualization.Update2DObjectGeometry;
+  return proto.visualization.Update2DObjectGeometry.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.visualization.Update2DObjectGeometry} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.visualization.Update2DObjectGeometry}
+ */
+proto.visualization.Update2DObjectGeometry.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setId(value);
+      break;
+    case 2:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setFieldMask(value);
+      break;
+    case 3:
+      var value = new proto.visualization.Point2D;
+      reader.readMessage(value,proto.visualization.Point2D.deserializeBinaryFromReader);
+      msg.setPoint2d(value);
+      break;
+    case 4:
+      var value = new proto.visualization.Pose2D;
+      reader.readMessage(value,proto.visualization.Pose2D.deserializeBinaryFromReader);
+      msg.setPose2d(value);
+      break;
+    case 5:
+      var value = new proto.visualization.Circle;
+      reader.readMessage(value,proto.visualization.Circle.deserializeBinaryFromReader);
+      msg.setCircle(value);
+      break;
+    case 6:
+      var value = new proto.visualization.Box2D;
+      reader.readMessage(value,proto.visualization.Box2D.deserializeBinaryFromReader);
+      msg.setBox2d(value);
+      break;
+    case 7:
+      var value = new proto.visualization.Line2D;
+      reader.readMessage(value,proto.visualization.Line2D.deserializeBinaryFromReader);
+      msg.setLine2d(value);
+      break;
+    case 8:
+      var value = new proto.visualization.Trajectory2D;
+      reader.readMessage(value,proto.visualization.Trajectory2D.deserializeBinaryFromReader);
+      msg.setTrajectory2d(value);
+      break;
+    case 9:
+      var value = new proto.visualization.Polygon;
+      reader.readMessage(value,proto.visualization.Polygon.deserializeBinaryFromReader);
+      msg.setPolygon(value);
+      break;
+    case 15:
+      var value = new proto.visualization.AppendPoints;
+      reader.readMessage(value,proto.visualization.AppendPoints.deserializeBinaryFromReader);
+      msg.setAppendPoints(value);
+      break;
+    case 16:
+      var value = new proto.visualization.AppendPoses;
+      reader.readMessage(value,proto.visualization.AppendPoses.deserializeBinaryFromReader);
+      msg.setAppendPoses(value);
+      break;
+    case 19:
+      var value = new proto.visualization.InstanceArray;
+      reader.readMessage(value,proto.visualization.InstanceArray.deserializeBinaryFromReader);
+      msg.setCircleArray(value);
+      break;
+    case 20:
+      var value = new proto.visualization.InstanceArray;
+      reader.readMessage(value,proto.visualization.InstanceArray.deserializeBinaryFromReader);
+      msg.setPose2dArray(value);
+      break;
+    case 22:
+      var value = new proto.visualization.OccupancyGrid;
+      reader.readMessage(value,proto.visualization.OccupancyGrid.deserializeBinaryFromReader);
+      msg.setOccupancyGrid(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.visualization.Update2DObjectGeometry.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.visualization.Update2DObjectGeometry} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.Update2DObjectGeometry.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getId();
+  if (f !== 0) {
+    writer.writeUint32(
+      1,
+      f
+    );
+  }
+  f = message.getFieldMask();
+  if (f !== 0) {
+    writer.writeUint32(
+      2,
+      f
+    );
+  }
+  f = message.getPoint2d();
+  if (f != null) {
+    writer.writeMessage(
+      3,
+      f,
+      proto.visualization.Point2D.serializeBinaryToWriter
+    );
+  }
+  f = message.getPose2d();
+  if (f != null) {
+    writer.writeMessage(
+      4,
+      f,
+      proto.visualization.Pose2D.serializeBinaryToWriter
+    );
+  }
+  f = message.getCircle();
+  if (f != null) {
+    writer.writeMessage(
+      5,
+      f,
+      proto.visualization.Circle.serializeBinaryToWriter
+    );
+  }
+  f = message.getBox2d();
+  if (f != null) {
+    writer.writeMessage(
+      6,
+      f,
+      proto.visualization.Box2D.serializeBinaryToWriter
+    );
+  }
+  f = message.getLine2d();
+  if (f != null) {
+    writer.writeMessage(
+      7,
+      f,
+      proto.visualization.Line2D.serializeBinaryToWriter
+    );
+  }
+  f = message.getTrajectory2d();
+  if (f != null) {
+    writer.writeMessage(
+      8,
+      f,
+      proto.visualization.Trajectory2D.serializeBinaryToWriter
+    );
+  }
+  f = message.getPolygon();
+  if (f != null) {
+    writer.writeMessage(
+      9,
+      f,
+      proto.visualization.Polygon.serializeBinaryToWriter
+    );
+  }
+  f = message.getAppendPoints();
+  if (f != null) {
+    writer.writeMessage(
+      15,
+      f,
+      proto.visualization.AppendPoints.serializeBinaryToWriter
+    );
+  }
+  f = message.getAppendPoses();
+  if (f != null) {
+    writer.writeMessage(
+      16,
+      f,
+      proto.visualization.AppendPoses.serializeBinaryToWriter
+    );
+  }
+  f = message.getCircleArray();
+  if (f != null) {
+    writer.writeMessage(
+      19,
+      f,
+      proto.visualization.InstanceArray.serializeBinaryToWriter
+    );
+  }
+  f = message.getPose2dArray();
+  if (f != null) {
+    writer.writeMessage(
+      20,
+      f,
+      proto.visualization.InstanceArray.serializeBinaryToWriter
+    );
+  }
+  f = message.getOccupancyGrid();
+  if (f != null) {
+    writer.writeMessage(
+      22,
+      f,
+      proto.visualization.OccupancyGrid.serializeBinaryToWriter
+    );
+  }
+};
+
+
+/**
+ * optional uint32 id = 1;
+ * @return {number}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.getId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/** @param {number} value */
+proto.visualization.Update2DObjectGeometry.prototype.setId = function(value) {
+  jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+/**
+ * optional uint32 field_mask = 2;
+ * @return {number}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.getFieldMask = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
+};
+
+
+/** @param {number} value */
+proto.visualization.Update2DObjectGeometry.prototype.setFieldMask = function(value) {
+  jspb.Message.setProto3IntField(this, 2, value);
+};
+
+
+/**
+ * optional Point2D point_2d = 3;
+ * @return {?proto.visualization.Point2D}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.getPoint2d = function() {
+  return /** @type{?proto.visualization.Point2D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Point2D, 3));
+};
+
+
+/** @param {?proto.visualization.Point2D|undefined} value */
+proto.visualization.Update2DObjectGeometry.prototype.setPoint2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 3, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update2DObjectGeometry.prototype.clearPoint2d = function() {
+  this.setPoint2d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.hasPoint2d = function() {
+  return jspb.Message.getField(this, 3) != null;
+};
+
+
+/**
+ * optional Pose2D pose_2d = 4;
+ * @return {?proto.visualization.Pose2D}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.getPose2d = function() {
+  return /** @type{?proto.visualization.Pose2D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Pose2D, 4));
+};
+
+
+/** @param {?proto.visualization.Pose2D|undefined} value */
+proto.visualization.Update2DObjectGeometry.prototype.setPose2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 4, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update2DObjectGeometry.prototype.clearPose2d = function() {
+  this.setPose2d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.hasPose2d = function() {
+  return jspb.Message.getField(this, 4) != null;
+};
+
+
+/**
+ * optional Circle circle = 5;
+ * @return {?proto.visualization.Circle}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.getCircle = function() {
+  return /** @type{?proto.visualization.Circle} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Circle, 5));
+};
+
+
+/** @param {?proto.visualization.Circle|undefined} value */
+proto.visualization.Update2DObjectGeometry.prototype.setCircle = function(value) {
+  jspb.Message.setOneofWrapperField(this, 5, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update2DObjectGeometry.prototype.clearCircle = function() {
+  this.setCircle(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.hasCircle = function() {
+  return jspb.Message.getField(this, 5) != null;
+};
+
+
+/**
+ * optional Box2D box_2d = 6;
+ * @return {?proto.visualization.Box2D}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.getBox2d = function() {
+  return /** @type{?proto.visualization.Box2D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Box2D, 6));
+};
+
+
+/** @param {?proto.visualization.Box2D|undefined} value */
+proto.visualization.Update2DObjectGeometry.prototype.setBox2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 6, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update2DObjectGeometry.prototype.clearBox2d = function() {
+  this.setBox2d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.hasBox2d = function() {
+  return jspb.Message.getField(this, 6) != null;
+};
+
+
+/**
+ * optional Line2D line_2d = 7;
+ * @return {?proto.visualization.Line2D}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.getLine2d = function() {
+  return /** @type{?proto.visualization.Line2D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Line2D, 7));
+};
+
+
+/** @param {?proto.visualization.Line2D|undefined} value */
+proto.visualization.Update2DObjectGeometry.prototype.setLine2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 7, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update2DObjectGeometry.prototype.clearLine2d = function() {
+  this.setLine2d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.hasLine2d = function() {
+  return jspb.Message.getField(this, 7) != null;
+};
+
+
+/**
+ * optional Trajectory2D trajectory_2d = 8;
+ * @return {?proto.visualization.Trajectory2D}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.getTrajectory2d = function() {
+  return /** @type{?proto.visualization.Trajectory2D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Trajectory2D, 8));
+};
+
+
+/** @param {?proto.visualization.Trajectory2D|undefined} value */
+proto.visualization.Update2DObjectGeometry.prototype.setTrajectory2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 8, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update2DObjectGeometry.prototype.clearTrajectory2d = function() {
+  this.setTrajectory2d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.hasTrajectory2d = function() {
+  return jspb.Message.getField(this, 8) != null;
+};
+
+
+/**
+ * optional Polygon polygon = 9;
+ * @return {?proto.visualization.Polygon}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.getPolygon = function() {
+  return /** @type{?proto.visualization.Polygon} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Polygon, 9));
+};
+
+
+/** @param {?proto.visualization.Polygon|undefined} value */
+proto.visualization.Update2DObjectGeometry.prototype.setPolygon = function(value) {
+  jspb.Message.setOneofWrapperField(this, 9, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update2DObjectGeometry.prototype.clearPolygon = function() {
+  this.setPolygon(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.hasPolygon = function() {
+  return jspb.Message.getField(this, 9) != null;
+};
+
+
+/**
+ * optional AppendPoints append_points = 15;
+ * @return {?proto.visualization.AppendPoints}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.getAppendPoints = function() {
+  return /** @type{?proto.visualization.AppendPoints} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.AppendPoints, 15));
+};
+
+
+/** @param {?proto.visualization.AppendPoints|undefined} value */
+proto.visualization.Update2DObjectGeometry.prototype.setAppendPoints = function(value) {
+  jspb.Message.setOneofWrapperField(this, 15, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update2DObjectGeometry.prototype.clearAppendPoints = function() {
+  this.setAppendPoints(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.hasAppendPoints = function() {
+  return jspb.Message.getField(this, 15) != null;
+};
+
+
+/**
+ * optional AppendPoses append_poses = 16;
+ * @return {?proto.visualization.AppendPoses}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.getAppendPoses = function() {
+  return /** @type{?proto.visualization.AppendPoses} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.AppendPoses, 16));
+};
+
+
+/** @param {?proto.visualization.AppendPoses|undefined} value */
+proto.visualization.Update2DObjectGeometry.prototype.setAppendPoses = function(value) {
+  jspb.Message.setOneofWrapperField(this, 16, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update2DObjectGeometry.prototype.clearAppendPoses = function() {
+  this.setAppendPoses(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.hasAppendPoses = function() {
+  return jspb.Message.getField(this, 16) != null;
+};
+
+
+/**
+ * optional InstanceArray circle_array = 19;
+ * @return {?proto.visualization.InstanceArray}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.getCircleArray = function() {
+  return /** @type{?proto.visualization.InstanceArray} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.InstanceArray, 19));
+};
+
+
+/** @param {?proto.visualization.InstanceArray|undefined} value */
+proto.visualization.Update2DObjectGeometry.prototype.setCircleArray = function(value) {
+  jspb.Message.setOneofWrapperField(this, 19, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update2DObjectGeometry.prototype.clearCircleArray = function() {
+  this.setCircleArray(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.hasCircleArray = function() {
+  return jspb.Message.getField(this, 19) != null;
+};
+
+
+/**
+ * optional InstanceArray pose_2d_array = 20;
+ * @return {?proto.visualization.InstanceArray}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.getPose2dArray = function() {
+  return /** @type{?proto.visualization.InstanceArray} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.InstanceArray, 20));
+};
+
+
+/** @param {?proto.visualization.InstanceArray|undefined} value */
+proto.visualization.Update2DObjectGeometry.prototype.setPose2dArray = function(value) {
+  jspb.Message.setOneofWrapperField(this, 20, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update2DObjectGeometry.prototype.clearPose2dArray = function() {
+  this.setPose2dArray(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.hasPose2dArray = function() {
+  return jspb.Message.getField(this, 20) != null;
+};
+
+
+/**
+ * optional OccupancyGrid occupancy_grid = 22;
+ * @return {?proto.visualization.OccupancyGrid}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.getOccupancyGrid = function() {
+  return /** @type{?proto.visualization.OccupancyGrid} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.OccupancyGrid, 22));
+};
+
+
+/** @param {?proto.visualization.OccupancyGrid|undefined} value */
+proto.visualization.Update2DObjectGeometry.prototype.setOccupancyGrid = function(value) {
+  jspb.Message.setOneofWrapperField(this, 22, proto.visualization.Update2DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update2DObjectGeometry.prototype.clearOccupancyGrid = function() {
+  this.setOccupancyGrid(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update2DObjectGeometry.prototype.hasOccupancyGrid = function() {
+  return jspb.Message.getField(this, 22) != null;
+};
+
+
+
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.visualization.Update3DObjectGeometry = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, proto.visualization.Update3DObjectGeometry.oneofGroups_);
+};
+goog.inherits(proto.visualization.Update3DObjectGeometry, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.visualization.Update3DObjectGeometry.displayName = 'proto.visualization.Update3DObjectGeometry';
+}
+/**
+ * Oneof group definitions for this message. Each group defines the field
+ * numbers belonging to that group. When of these fields' value is set, all
+ * other fields in the group are cleared. During deserialization, if multiple
+ * fields are encountered for a group, only the last value seen will be kept.
+ * @private {!Array<!Array<number>>}
+ * @const
+ */
+proto.visualization.Update3DObjectGeometry.oneofGroups_ = [[3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22]];
+
+/**
+ * @enum {number}
+ */
+proto.visualization.Update3DObjectGeometry.GeometryDataCase = {
+  GEOMETRY_DATA_NOT_SET: 0,
+  POINT_2D: 3,
+  POSE_2D: 4,
+  CIRCLE: 5,
+  BOX_2D: 6,
+  LINE_2D: 7,
+  TRAJECTORY_2D: 8,
+  POLYGON: 9,
+  POINT_3D: 10,
+  POSE_3D: 11,
+  BALL: 12,
+  BOX_3D: 13,
+  LINE_3D: 14,
+  APPEND_POINTS: 15,
+  APPEND_POSES: 16,
+  POINT_CLOUD_3D: 17,
+  BOX_3D_ARRAY: 18,
+  CIRCLE_ARRAY: 19,
+  POSE_2D_ARRAY: 20,
+  TRIANGLE_MESH_3D: 21,
+  OCCUPANCY_GRID: 22
+};
+
+/**
+ * @return {proto.visualization.Update3DObjectGeometry.GeometryDataCase}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getGeometryDataCase = function() {
+  return /** @type {proto.visualization.Update3DObjectGeometry.GeometryDataCase} */(jspb.Message.computeOneofCase(this, proto.visualization.Update3DObjectGeometry.oneofGroups_[0]));
+};
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.Update3DObjectGeometry.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.visualization.Update3DObjectGeometry} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.Update3DObjectGeometry.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    id: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    fieldMask: jspb.Message.getFieldWithDefault(msg, 2, 0),
+    point2d: (f = msg.getPoint2d()) && proto.visualization.Point2D.toObject(includeInstance, f),
+    pose2d: (f = msg.getPose2d()) && proto.visualization.Pose2D.toObject(includeInstance, f),
+    circle: (f = msg.getCircle()) && proto.visualization.Circle.toObject(includeInstance, f),
+    box2d: (f = msg.getBox2d()) && proto.visualization.Box2D.toObject(includeInstance, f),
+    line2d: (f = msg.getLine2d()) && proto.visualization.Line2D.toObject(includeInstance, f),
+    trajectory2d: (f = msg.getTrajectory2d()) && proto.visualization.Trajectory2D.toObject(includeInstance, f),
+    polygon: (f = msg.getPolygon()) && proto.visualization.Polygon.toObject(includeInstance, f),
+    point3d: (f = msg.getPoint3d()) && proto.visualization.Point3D.toObject(includeInstance, f),
+    pose3d: (f = msg.getPose3d()) && proto.visualization.Pose3D.toObject(includeInstance, f),
+    ball: (f = msg.getBall()) && proto.visualization.Ball.toObject(includeInstance, f),
+    box3d: (f = msg.getBox3d()) && proto.visualization.Box3D.toObject(includeInstance, f),
+    line3d: (f = msg.getLine3d()) && proto.visualization.Line3D.toObject(includeInstance, f),
+    appendPoints: (f = msg.getAppendPoints()) && proto.visualization.AppendPoints.toObject(includeInstance, f),
+    appendPoses: (f = msg.getAppendPoses()) && proto.visualization.AppendPoses.toObject(includeInstance, f),
+    pointCloud3d: (f = msg.getPointCloud3d()) && proto.visualization.PointCloud3D.toObject(includeInstance, f),
+    box3dArray: (f = msg.getBox3dArray()) && proto.visualization.InstanceArray.toObject(includeInstance, f),
+    circleArray: (f = msg.getCircleArray()) && proto.visualization.InstanceArray.toObject(includeInstance, f),
+    pose2dArray: (f = msg.getPose2dArray()) && proto.visualization.InstanceArray.toObject(includeInstance, f),
+    triangleMesh3d: (f = msg.getTriangleMesh3d()) && proto.visualization.TriangleMesh3D.toObject(includeInstance, f),
+    occupancyGrid: (f = msg.getOccupancyGrid()) && proto.visualization.OccupancyGrid.toObject(includeInstance, f)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.visualization.Update3DObjectGeometry}
+ */
+proto.visualization.Update3DObjectGeometry.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.visualization.Update3DObjectGeometry;
+  return proto.visualization.Update3DObjectGeometry.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.visualization.Update3DObjectGeometry} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.visualization.Update3DObjectGeometry}
+ */
+proto.visualization.Update3DObjectGeometry.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setId(value);
+      break;
+    case 2:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setFieldMask(value);
+      break;
+    case 3:
+      var value = new proto.visualization.Point2D;
+      reader.readMessage(value,proto.visualization.Point2D.deserializeBinaryFromReader);
+      msg.setPoint2d(value);
+      break;
+    case 4:
+      var value = new proto.visualization.Pose2D;
+      reader.readMessage(value,proto.visualization.Pose2D.deserializeBinaryFromReader);
+      msg.setPose2d(value);
+      break;
+    case 5:
+      var value = new proto.visualization.Circle;
+      reader.readMessage(value,proto.visualization.Circle.deserializeBinaryFromReader);
+      msg.setCircle(value);
+      break;
+    case 6:
+      var value = new proto.visualization.Box2D;
+      reader.readMessage(value,proto.visualization.Box2D.deserializeBinaryFromReader);
+      msg.setBox2d(value);
+      break;
+    case 7:
+      var value = new proto.visualization.Line2D;
+      reader.readMessage(value,proto.visualization.Line2D.deserializeBinaryFromReader);
+      msg.setLine2d(value);
+      break;
+    case 8:
+      var value = new proto.visualization.Trajectory2D;
+      reader.readMessage(value,proto.visualization.Trajectory2D.deserializeBinaryFromReader);
+      msg.setTrajectory2d(value);
+      break;
+    case 9:
+      var value = new proto.visualization.Polygon;
+      reader.readMessage(value,proto.visualization.Polygon.deserializeBinaryFromReader);
+      msg.setPolygon(value);
+      break;
+    case 10:
+      var value = new proto.visualization.Point3D;
+      reader.readMessage(value,proto.visualization.Point3D.deserializeBinaryFromReader);
+      msg.setPoint3d(value);
+      break;
+    case 11:
+      var value = new proto.visualization.Pose3D;
+      reader.readMessage(value,proto.visualization.Pose3D.deserializeBinaryFromReader);
+      msg.setPose3d(value);
+      break;
+    case 12:
+      var value = new proto.visualization.Ball;
+      reader.readMessage(value,proto.visualization.Ball.deserializeBinaryFromReader);
+      msg.setBall(value);
+      break;
+    case 13:
+      var value = new proto.visualization.Box3D;
+      reader.readMessage(value,proto.visualization.Box3D.deserializeBinaryFromReader);
+      msg.setBox3d(value);
+      break;
+    case 14:
+      var value = new proto.visualization.Line3D;
+      reader.readMessage(value,proto.visualization.Line3D.deserializeBinaryFromReader);
+      msg.setLine3d(value);
+      break;
+    case 15:
+      var value = new proto.visualization.AppendPoints;
+      reader.readMessage(value,proto.visualization.AppendPoints.deserializeBinaryFromReader);
+      msg.setAppendPoints(value);
+      break;
+    case 16:
+      var value = new proto.visualization.AppendPoses;
+      reader.readMessage(value,proto.visualization.AppendPoses.deserializeBinaryFromReader);
+      msg.setAppendPoses(value);
+      break;
+    case 17:
+      var value = new proto.visualization.PointCloud3D;
+      reader.readMessage(value,proto.visualization.PointCloud3D.deserializeBinaryFromReader);
+      msg.setPointCloud3d(value);
+      break;
+    case 18:
+      var value = new proto.visualization.InstanceArray;
+      reader.readMessage(value,proto.visualization.InstanceArray.deserializeBinaryFromReader);
+      msg.setBox3dArray(value);
+      break;
+    case 19:
+      var value = new proto.visualization.InstanceArray;
+      reader.readMessage(value,proto.visualization.InstanceArray.deserializeBinaryFromReader);
+      msg.setCircleArray(value);
+      break;
+    case 20:
+      var value = new proto.visualization.InstanceArray;
+      reader.readMessage(value,proto.visualization.InstanceArray.deserializeBinaryFromReader);
+      msg.setPose2dArray(value);
+      break;
+    case 21:
+      var value = new proto.visualization.TriangleMesh3D;
+      reader.readMessage(value,proto.visualization.TriangleMesh3D.deserializeBinaryFromReader);
+      msg.setTriangleMesh3d(value);
+      break;
+    case 22:
+      var value = new proto.visualization.OccupancyGrid;
+      reader.readMessage(value,proto.visualization.OccupancyGrid.deserializeBinaryFromReader);
+      msg.setOccupancyGrid(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.visualization.Update3DObjectGeometry.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.visualization.Update3DObjectGeometry} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.Update3DObjectGeometry.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getId();
+  if (f !== 0) {
+    writer.writeUint32(
+      1,
+      f
+    );
+  }
+  f = message.getFieldMask();
+  if (f !== 0) {
+    writer.writeUint32(
+      2,
+      f
+    );
+  }
+  f = message.getPoint2d();
+  if (f != null) {
+    writer.writeMessage(
+      3,
+      f,
+      proto.visualization.Point2D.serializeBinaryToWriter
+    );
+  }
+  f = message.getPose2d();
+  if (f != null) {
+    writer.writeMessage(
+      4,
+      f,
+      proto.visualization.Pose2D.serializeBinaryToWriter
+    );
+  }
+  f = message.getCircle();
+  if (f != null) {
+    writer.writeMessage(
+      5,
+      f,
+      proto.visualization.Circle.serializeBinaryToWriter
+    );
+  }
+  f = message.getBox2d();
+  if (f != null) {
+    writer.writeMessage(
+      6,
+      f,
+      proto.visualization.Box2D.serializeBinaryToWriter
+    );
+  }
+  f = message.getLine2d();
+  if (f != null) {
+    writer.writeMessage(
+      7,
+      f,
+      proto.visualization.Line2D.serializeBinaryToWriter
+    );
+  }
+  f = message.getTrajectory2d();
+  if (f != null) {
+    writer.writeMessage(
+      8,
+      f,
+      proto.visualization.Trajectory2D.serializeBinaryToWriter
+    );
+  }
+  f = message.getPolygon();
+  if (f != null) {
+    writer.writeMessage(
+      9,
+      f,
+      proto.visualization.Polygon.serializeBinaryToWriter
+    );
+  }
+  f = message.getPoint3d();
+  if (f != null) {
+    writer.writeMessage(
+      10,
+      f,
+      proto.visualization.Point3D.serializeBinaryToWriter
+    );
+  }
+  f = message.getPose3d();
+  if (f != null) {
+    writer.writeMessage(
+      11,
+      f,
+      proto.visualization.Pose3D.serializeBinaryToWriter
+    );
+  }
+  f = message.getBall();
+  if (f != null) {
+    writer.writeMessage(
+      12,
+      f,
+      proto.visualization.Ball.serializeBinaryToWriter
+    );
+  }
+  f = message.getBox3d();
+  if (f != null) {
+    writer.writeMessage(
+      13,
+      f,
+      proto.visualization.Box3D.serializeBinaryToWriter
+    );
+  }
+  f = message.getLine3d();
+  if (f != null) {
+    writer.writeMessage(
+      14,
+      f,
+      proto.visualization.Line3D.serializeBinaryToWriter
+    );
+  }
+  f = message.getAppendPoints();
+  if (f != null) {
+    writer.writeMessage(
+      15,
+      f,
+      proto.visualization.AppendPoints.serializeBinaryToWriter
+    );
+  }
+  f = message.getAppendPoses();
+  if (f != null) {
+    writer.writeMessage(
+      16,
+      f,
+      proto.visualization.AppendPoses.serializeBinaryToWriter
+    );
+  }
+  f = message.getPointCloud3d();
+  if (f != null) {
+    writer.writeMessage(
+      17,
+      f,
+      proto.visualization.PointCloud3D.serializeBinaryToWriter
+    );
+  }
+  f = message.getBox3dArray();
+  if (f != null) {
+    writer.writeMessage(
+      18,
+      f,
+      proto.visualization.InstanceArray.serializeBinaryToWriter
+    );
+  }
+  f = message.getCircleArray();
+  if (f != null) {
+    writer.writeMessage(
+      19,
+      f,
+      proto.visualization.InstanceArray.serializeBinaryToWriter
+    );
+  }
+  f = message.getPose2dArray();
+  if (f != null) {
+    writer.writeMessage(
+      20,
+      f,
+      proto.visualization.InstanceArray.serializeBinaryToWriter
+    );
+  }
+  f = message.getTriangleMesh3d();
+  if (f != null) {
+    writer.writeMessage(
+      21,
+      f,
+      proto.visualization.TriangleMesh3D.serializeBinaryToWriter
+    );
+  }
+  f = message.getOccupancyGrid();
+  if (f != null) {
+    writer.writeMessage(
+      22,
+      f,
+      proto.visualization.OccupancyGrid.serializeBinaryToWriter
+    );
+  }
+};
+
+
+/**
+ * optional uint32 id = 1;
+ * @return {number}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/** @param {number} value */
+proto.visualization.Update3DObjectGeometry.prototype.setId = function(value) {
+  jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+/**
+ * optional uint32 field_mask = 2;
+ * @return {number}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getFieldMask = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
+};
+
+
+/** @param {number} value */
+proto.visualization.Update3DObjectGeometry.prototype.setFieldMask = function(value) {
+  jspb.Message.setProto3IntField(this, 2, value);
+};
+
+
+/**
+ * optional Point2D point_2d = 3;
+ * @return {?proto.visualization.Point2D}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getPoint2d = function() {
+  return /** @type{?proto.visualization.Point2D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Point2D, 3));
+};
+
+
+/** @param {?proto.visualization.Point2D|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setPoint2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 3, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearPoint2d = function() {
+  this.setPoint2d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasPoint2d = function() {
+  return jspb.Message.getField(this, 3) != null;
+};
+
+
+/**
+ * optional Pose2D pose_2d = 4;
+ * @return {?proto.visualization.Pose2D}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getPose2d = function() {
+  return /** @type{?proto.visualization.Pose2D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Pose2D, 4));
+};
+
+
+/** @param {?proto.visualization.Pose2D|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setPose2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 4, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearPose2d = function() {
+  this.setPose2d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasPose2d = function() {
+  return jspb.Message.getField(this, 4) != null;
+};
+
+
+/**
+ * optional Circle circle = 5;
+ * @return {?proto.visualization.Circle}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getCircle = function() {
+  return /** @type{?proto.visualization.Circle} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Circle, 5));
+};
+
+
+/** @param {?proto.visualization.Circle|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setCircle = function(value) {
+  jspb.Message.setOneofWrapperField(this, 5, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearCircle = function() {
+  this.setCircle(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasCircle = function() {
+  return jspb.Message.getField(this, 5) != null;
+};
+
+
+/**
+ * optional Box2D box_2d = 6;
+ * @return {?proto.visualization.Box2D}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getBox2d = function() {
+  return /** @type{?proto.visualization.Box2D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Box2D, 6));
+};
+
+
+/** @param {?proto.visualization.Box2D|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setBox2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 6, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearBox2d = function() {
+  this.setBox2d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasBox2d = function() {
+  return jspb.Message.getField(this, 6) != null;
+};
+
+
+/**
+ * optional Line2D line_2d = 7;
+ * @return {?proto.visualization.Line2D}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getLine2d = function() {
+  return /** @type{?proto.visualization.Line2D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Line2D, 7));
+};
+
+
+/** @param {?proto.visualization.Line2D|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setLine2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 7, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearLine2d = function() {
+  this.setLine2d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasLine2d = function() {
+  return jspb.Message.getField(this, 7) != null;
+};
+
+
+/**
+ * optional Trajectory2D trajectory_2d = 8;
+ * @return {?proto.visualization.Trajectory2D}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getTrajectory2d = function() {
+  return /** @type{?proto.visualization.Trajectory2D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Trajectory2D, 8));
+};
+
+
+/** @param {?proto.visualization.Trajectory2D|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setTrajectory2d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 8, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearTrajectory2d = function() {
+  this.setTrajectory2d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasTrajectory2d = function() {
+  return jspb.Message.getField(this, 8) != null;
+};
+
+
+/**
+ * optional Polygon polygon = 9;
+ * @return {?proto.visualization.Polygon}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getPolygon = function() {
+  return /** @type{?proto.visualization.Polygon} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Polygon, 9));
+};
+
+
+/** @param {?proto.visualization.Polygon|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setPolygon = function(value) {
+  jspb.Message.setOneofWrapperField(this, 9, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearPolygon = function() {
+  this.setPolygon(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasPolygon = function() {
+  return jspb.Message.getField(this, 9) != null;
+};
+
+
+/**
+ * optional Point3D point_3d = 10;
+ * @return {?proto.visualization.Point3D}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getPoint3d = function() {
+  return /** @type{?proto.visualization.Point3D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Point3D, 10));
+};
+
+
+/** @param {?proto.visualization.Point3D|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setPoint3d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 10, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearPoint3d = function() {
+  this.setPoint3d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasPoint3d = function() {
+  return jspb.Message.getField(this, 10) != null;
+};
+
+
+/**
+ * optional Pose3D pose_3d = 11;
+ * @return {?proto.visualization.Pose3D}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getPose3d = function() {
+  return /** @type{?proto.visualization.Pose3D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Pose3D, 11));
+};
+
+
+/** @param {?proto.visualization.Pose3D|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setPose3d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 11, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearPose3d = function() {
+  this.setPose3d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasPose3d = function() {
+  return jspb.Message.getField(this, 11) != null;
+};
+
+
+/**
+ * optional Ball ball = 12;
+ * @return {?proto.visualization.Ball}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getBall = function() {
+  return /** @type{?proto.visualization.Ball} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Ball, 12));
+};
+
+
+/** @param {?proto.visualization.Ball|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setBall = function(value) {
+  jspb.Message.setOneofWrapperField(this, 12, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearBall = function() {
+  this.setBall(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasBall = function() {
+  return jspb.Message.getField(this, 12) != null;
+};
+
+
+/**
+ * optional Box3D box_3d = 13;
+ * @return {?proto.visualization.Box3D}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getBox3d = function() {
+  return /** @type{?proto.visualization.Box3D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Box3D, 13));
+};
+
+
+/** @param {?proto.visualization.Box3D|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setBox3d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 13, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearBox3d = function() {
+  this.setBox3d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasBox3d = function() {
+  return jspb.Message.getField(this, 13) != null;
+};
+
+
+/**
+ * optional Line3D line_3d = 14;
+ * @return {?proto.visualization.Line3D}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getLine3d = function() {
+  return /** @type{?proto.visualization.Line3D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Line3D, 14));
+};
+
+
+/** @param {?proto.visualization.Line3D|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setLine3d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 14, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearLine3d = function() {
+  this.setLine3d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasLine3d = function() {
+  return jspb.Message.getField(this, 14) != null;
+};
+
+
+/**
+ * optional AppendPoints append_points = 15;
+ * @return {?proto.visualization.AppendPoints}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getAppendPoints = function() {
+  return /** @type{?proto.visualization.AppendPoints} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.AppendPoints, 15));
+};
+
+
+/** @param {?proto.visualization.AppendPoints|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setAppendPoints = function(value) {
+  jspb.Message.setOneofWrapperField(this, 15, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearAppendPoints = function() {
+  this.setAppendPoints(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasAppendPoints = function() {
+  return jspb.Message.getField(this, 15) != null;
+};
+
+
+/**
+ * optional AppendPoses append_poses = 16;
+ * @return {?proto.visualization.AppendPoses}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getAppendPoses = function() {
+  return /** @type{?proto.visualization.AppendPoses} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.AppendPoses, 16));
+};
+
+
+/** @param {?proto.visualization.AppendPoses|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setAppendPoses = function(value) {
+  jspb.Message.setOneofWrapperField(this, 16, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearAppendPoses = function() {
+  this.setAppendPoses(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasAppendPoses = function() {
+  return jspb.Message.getField(this, 16) != null;
+};
+
+
+/**
+ * optional PointCloud3D point_cloud_3d = 17;
+ * @return {?proto.visualization.PointCloud3D}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getPointCloud3d = function() {
+  return /** @type{?proto.visualization.PointCloud3D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.PointCloud3D, 17));
+};
+
+
+/** @param {?proto.visualization.PointCloud3D|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setPointCloud3d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 17, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearPointCloud3d = function() {
+  this.setPointCloud3d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasPointCloud3d = function() {
+  return jspb.Message.getField(this, 17) != null;
+};
+
+
+/**
+ * optional InstanceArray box_3d_array = 18;
+ * @return {?proto.visualization.InstanceArray}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getBox3dArray = function() {
+  return /** @type{?proto.visualization.InstanceArray} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.InstanceArray, 18));
+};
+
+
+/** @param {?proto.visualization.InstanceArray|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setBox3dArray = function(value) {
+  jspb.Message.setOneofWrapperField(this, 18, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearBox3dArray = function() {
+  this.setBox3dArray(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasBox3dArray = function() {
+  return jspb.Message.getField(this, 18) != null;
+};
+
+
+/**
+ * optional InstanceArray circle_array = 19;
+ * @return {?proto.visualization.InstanceArray}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getCircleArray = function() {
+  return /** @type{?proto.visualization.InstanceArray} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.InstanceArray, 19));
+};
+
+
+/** @param {?proto.visualization.InstanceArray|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setCircleArray = function(value) {
+  jspb.Message.setOneofWrapperField(this, 19, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearCircleArray = function() {
+  this.setCircleArray(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasCircleArray = function() {
+  return jspb.Message.getField(this, 19) != null;
+};
+
+
+/**
+ * optional InstanceArray pose_2d_array = 20;
+ * @return {?proto.visualization.InstanceArray}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getPose2dArray = function() {
+  return /** @type{?proto.visualization.InstanceArray} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.InstanceArray, 20));
+};
+
+
+/** @param {?proto.visualization.InstanceArray|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setPose2dArray = function(value) {
+  jspb.Message.setOneofWrapperField(this, 20, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearPose2dArray = function() {
+  this.setPose2dArray(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasPose2dArray = function() {
+  return jspb.Message.getField(this, 20) != null;
+};
+
+
+/**
+ * optional TriangleMesh3D triangle_mesh_3d = 21;
+ * @return {?proto.visualization.TriangleMesh3D}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getTriangleMesh3d = function() {
+  return /** @type{?proto.visualization.TriangleMesh3D} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.TriangleMesh3D, 21));
+};
+
+
+/** @param {?proto.visualization.TriangleMesh3D|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setTriangleMesh3d = function(value) {
+  jspb.Message.setOneofWrapperField(this, 21, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearTriangleMesh3d = function() {
+  this.setTriangleMesh3d(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasTriangleMesh3d = function() {
+  return jspb.Message.getField(this, 21) != null;
+};
+
+
+/**
+ * optional OccupancyGrid occupancy_grid = 22;
+ * @return {?proto.visualization.OccupancyGrid}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.getOccupancyGrid = function() {
+  return /** @type{?proto.visualization.OccupancyGrid} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.OccupancyGrid, 22));
+};
+
+
+/** @param {?proto.visualization.OccupancyGrid|undefined} value */
+proto.visualization.Update3DObjectGeometry.prototype.setOccupancyGrid = function(value) {
+  jspb.Message.setOneofWrapperField(this, 22, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Update3DObjectGeometry.prototype.clearOccupancyGrid = function() {
+  this.setOccupancyGrid(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Update3DObjectGeometry.prototype.hasOccupancyGrid = function() {
+  return jspb.Message.getField(this, 22) != null;
+};
+
+
+
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.visualization.AppendPoints = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, proto.visualization.AppendPoints.repeatedFields_, proto.visualization.AppendPoints.oneofGroups_);
+};
+goog.inherits(proto.visualization.AppendPoints, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.visualization.AppendPoints.displayName = 'proto.visualization.AppendPoints';
+}
+/**
+ * List of repeated fields within this message type.
+ * @private {!Array<number>}
+ * @const
+ */
+proto.visualization.AppendPoints.repeatedFields_ = [4];
+
+/**
+ * Oneof group definitions for this message. Each group defines the field
+ * numbers belonging to that group. When of these fields' value is set, all
+ * other fields in the group are cleared. During deserialization, if multiple
+ * fields are encountered for a group, only the last value seen will be kept.
+ * @private {!Array<!Array<number>>}
+ * @const
+ */
+proto.visualization.AppendPoints.oneofGroups_ = [[2,3]];
+
+/**
+ * @enum {number}
+ */
+proto.visualization.AppendPoints.PointsCase = {
+  POINTS_NOT_SET: 0,
+  XY: 2,
+  XYZ: 3
+};
+
+/**
+ * @return {proto.visualization.AppendPoints.PointsCase}
+ */
+proto.visualization.AppendPoints.prototype.getPointsCase = function() {
+  return /** @type {proto.visualization.AppendPoints.PointsCase} */(jspb.Message.computeOneofCase(this, proto.visualization.AppendPoints.oneofGroups_[0]));
+};
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.visualization.AppendPoints.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.AppendPoints.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.visualization.AppendPoints} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.AppendPoints.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    start: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    xy: msg.getXy_asB64(),
+    xyz: msg.getXyz_asB64(),
+    dxyList: (f = jspb.Message.getRepeatedField(msg, 4)) == null ? undefined : f
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.visualization.AppendPoints}
+ */
+proto.visualization.AppendPoints.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.visualization.AppendPoints;
+  return proto.visualization.AppendPoints.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.visualization.AppendPoints} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.visualization.AppendPoints}
+ */
+proto.visualization.AppendPoints.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setStart(value);
+      break;
+    case 2:
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setXy(value);
+      break;
+    case 3:
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setXyz(value);
+      break;
+    case 4:
+      var value = /** @type {!Array<number>} */ (reader.readPackedSint32());
+      msg.setDxyList(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.visualization.AppendPoints.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.visualization.AppendPoints.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.visualization.AppendPoints} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.AppendPoints.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getStart();
+  if (f !== 0) {
+    writer.writeUint32(
+      1,
+      f
+    );
+  }
+  f = /** @type {!(string|Uint8Array)} */ (jspb.Message.getField(message, 2));
+  if (f != null) {
+    writer.writeBytes(
+      2,
+      f
+    );
+  }
+  f = /** @type {!(string|Uint8Array)} */ (jspb.Message.getField(message, 3));
+  if (f != null) {
+    writer.writeBytes(
+      3,
+      f
+    );
+  }
+  f = message.getDxyList();
+  if (f.length > 0) {
+    writer.writePackedSint32(
+      4,
+      f
+    );
+  }
+};
+
+
+/**
+ * optional uint32 start = 1;
+ * @return {number}
+ */
+proto.visualization.AppendPoints.prototype.getStart = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/** @param {number} value */
+proto.visualization.AppendPoints.prototype.setStart = function(value) {
+  jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+/**
+ * optional bytes xy = 2;
+ * @return {!(string|Uint8Array)}
+ */
+proto.visualization.AppendPoints.prototype.getXy = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+};
+
+
+/**
+ * optional bytes xy = 2;
+ * This is a type-conversion wrapper around `getXy()`
+ * @return {string}
+ */
+proto.visualization.AppendPoints.prototype.getXy_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getXy()));
+};
+
+
+/**
+ * optional bytes xy = 2;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getXy()`
+ * @return {!Uint8Array}
+ */
+proto.visualization.AppendPoints.prototype.getXy_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getXy()));
+};
+
+
+/** @param {!(string|Uint8Array)} value */
+proto.visualization.AppendPoints.prototype.setXy = function(value) {
+  jspb.Message.setOneofField(this, 2, proto.visualization.AppendPoints.oneofGroups_[0], value);
+};
+
+
+proto.visualization.AppendPoints.prototype.clearXy = function() {
+  jspb.Message.setOneofField(this, 2, proto.visualization.AppendPoints.oneofGroups_[0], undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.AppendPoints.prototype.hasXy = function() {
+  return jspb.Message.getField(this, 2) != null;
+};
+
+
+/**
+ * optional bytes xyz = 3;
+ * @return {!(string|Uint8Array)}
+ */
+proto.visualization.AppendPoints.prototype.getXyz = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldWithDefault(this, 3, ""));
+};
+
+
+/**
+ * optional bytes xyz = 3;
+ * This is a type-conversion wrapper around `getXyz()`
+ * @return {string}
+ */
+proto.visualization.AppendPoints.prototype.getXyz_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getXyz()));
+};
+
+
+/**
+ * optional bytes xyz = 3;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getXyz()`
+ * @return {!Uint8Array}
+ */
+proto.visualization.AppendPoints.prototype.getXyz_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getXyz()));
+};
+
+
+/** @param {!(string|Uint8Array)} value */
+proto.visualization.AppendPoints.prototype.setXyz = function(value) {
+  jspb.Message.setOneofField(this, 3, proto.visualization.AppendPoints.oneofGroups_[0], value);
+};
+
+
+proto.visualization.AppendPoints.prototype.clearXyz = function() {
+  jspb.Message.setOneofField(this, 3, proto.visualization.AppendPoints.oneofGroups_[0], undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.AppendPoints.prototype.hasXyz = function() {
+  return jspb.Message.getField(this, 3) != null;
+};
+
+
+/**
+ * repeated sint32 dxy = 4;
+ * @return {!Array<number>}
+ */
+proto.visualization.AppendPoints.prototype.getDxyList = function() {
+  return /** @type {!Array<number>} */ (jspb.Message.getRepeatedField(this, 4));
+};
+
+
+/** @param {!Array<number>} value */
+proto.visualization.AppendPoints.prototype.setDxyList = function(value) {
+  jspb.Message.setField(this, 4, value || []);
+};
+
+
+/**
+ * @param {!number} value
+ * @param {number=} opt_index
+ */
+proto.visualization.AppendPoints.prototype.addDxy = function(value, opt_index) {
+  jspb.Message.addToRepeatedField(this, 4, value, opt_index);
+};
+
+
+proto.visualization.AppendPoints.prototype.clearDxyList = function() {
+  this.setDxyList([]);
+};
+
+
+
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.visualization.AppendPoses = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, proto.visualization.AppendPoses.repeatedFields_, null);
+};
+goog.inherits(proto.visualization.AppendPoses, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.visualization.AppendPoses.displayName = 'proto.visualization.AppendPoses';
+}
+/**
+ * List of repeated fields within this message type.
+ * @private {!Array<number>}
+ * @const
+ */
+proto.visualization.AppendPoses.repeatedFields_ = [2];
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.visualization.AppendPoses.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.AppendPoses.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.visualization.AppendPoses} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.AppendPoses.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    start: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    posesList: jspb.Message.toObjectList(msg.getPosesList(),
+    proto.visualization.Box2D.toObject, includeInstance)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.visualization.AppendPoses}
+ */
+proto.visualization.AppendPoses.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.visualization.AppendPoses;
+  return proto.visualization.AppendPoses.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.visualization.AppendPoses} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.visualization.AppendPoses}
+ */
+proto.visualization.AppendPoses.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setStart(value);
+      break;
+    case 2:
+      var value = new proto.visualization.Box2D;
+      reader.readMessage(value,proto.visualization.Box2D.deserializeBinaryFromReader);
+      msg.addPoses(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.visualization.AppendPoses.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.visualization.AppendPoses.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.visualization.AppendPoses} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.AppendPoses.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getStart();
+  if (f !== 0) {
+    writer.writeUint32(
+      1,
+      f
+    );
+  }
+  f = message.getPosesList();
+  if (f.length > 0) {
+    writer.writeRepeatedMessage(
+      2,
+      f,
+      proto.visualization.Box2D.serializeBinaryToWriter
+    );
+  }
+};
+
+
+/**
+ * optional uint32 start = 1;
+ * @return {number}
+ */
+proto.visualization.AppendPoses.prototype.getStart = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/** @param {number} value */
+proto.visualization.AppendPoses.prototype.setStart = function(value) {
+  jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+/**
+ * repeated Box2D poses = 2;
+ * @return {!Array<!proto.visualization.Box2D>}
+ */
+proto.visualization.AppendPoses.prototype.getPosesList = function() {
+  return /** @type{!Array<!proto.visualization.Box2D>} */ (
+    jspb.Message.getRepeatedWrapperField(this, proto.visualization.Box2D, 2));
+};
+
+
+/** @param {!Array<!proto.visualization.Box2D>} value */
+proto.visualization.AppendPoses.prototype.setPosesList = function(value) {
+  jspb.Message.setRepeatedWrapperField(this, 2, value);
+};
+
+
+/**
+ * @param {!proto.visualization.Box2D=} opt_value
+ * @param {number=} opt_index
+ * @return {!proto.visualization.Box2D}
+ */
+proto.visualization.AppendPoses.prototype.addPoses = function(opt_value, opt_index) {
+  return jspb.Message.addToRepeatedWrapperField(this, 2, opt_value, proto.visualization.Box2D, opt_index);
+};
+
+
+proto.visualization.AppendPoses.prototype.clearPosesList = function() {
+  this.setPosesList([]);
+};
+
+
+
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.visualization.UpdateObjectProperties = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+};
+goog.inherits(proto.visualization.UpdateObjectProperties, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.visualization.UpdateObjectProperties.displayName = 'proto.visualization.UpdateObjectProperties';
+}
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.visualization.UpdateObjectProperties.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.UpdateObjectProperties.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.visualization.UpdateObjectProperties} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.UpdateObjectProperties.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    id: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    material: (f = msg.getMaterial()) && proto.visualization.Material.toObject(includeInstance, f),
+    materialId: jspb.Message.getFieldWithDefault(msg, 3, 0)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.visualization.UpdateObjectProperties}
+ */
+proto.visualization.UpdateObjectProperties.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.visualization.UpdateObjectProperties;
+  return proto.visualization.UpdateObjectProperties.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.visualization.UpdateObjectProperties} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.visualization.UpdateObjectProperties}
+ */
+proto.visualization.UpdateObjectProperties.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setId(value);
+      break;
+    case 2:
+      var value = new proto.visualization.Material;
+      reader.readMessage(value,proto.visualization.Material.deserializeBinaryFromReader);
+      msg.setMaterial(value);
+      break;
+    case 3:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setMaterialId(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.visualization.UpdateObjectProperties.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.visualization.UpdateObjectProperties.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.visualization.UpdateObjectProperties} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.UpdateObjectProperties.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getId();
+  if (f !== 0) {
+    writer.writeUint32(
+      1,
+      f
+    );
+  }
+  f = message.getMaterial();
+  if (f != null) {
+    writer.writeMessage(
+      2,
+      f,
+      proto.visualization.Material.serializeBinaryToWriter
+    );
+  }
+  f = message.getMaterialId();
+  if (f !== 0) {
+    writer.writeUint32(
+      3,
+      f
+    );
+  }
+};
+
+
+/**
+ * optional uint32 id = 1;
+ * @return {number}
+ */
+proto.visualization.UpdateObjectProperties.prototype.getId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/** @param {number} value */
+proto.visualization.UpdateObjectProperties.prototype.setId = function(value) {
+  jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+/**
+ * optional Material material = 2;
+ * @return {?proto.visualization.Material}
+ */
+proto.visualization.UpdateObjectProperties.prototype.getMaterial = function() {
+  return /** @type{?proto.visualization.Material} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Material, 2));
+};
+
+
+/** @param {?proto.visualization.Material|undefined} value */
+proto.visualization.UpdateObjectProperties.prototype.setMaterial = function(value) {
+  jspb.Message.setWrapperField(this, 2, value);
+};
+
+
+proto.visualization.UpdateObjectProperties.prototype.clearMaterial = function() {
+  this.setMaterial(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.UpdateObjectProperties.prototype.hasMaterial = function() {
+  return jspb.Message.getField(this, 2) != null;
+};
+
+
+/**
+ * optional uint32 material_id = 3;
+ * @return {number}
+ */
+proto.visualization.UpdateObjectProperties.prototype.getMaterialId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 3, 0));
+};
+
+
+/** @param {number} value */
+proto.visualization.UpdateObjectProperties.prototype.setMaterialId = function(value) {
+  jspb.Message.setProto3IntField(this, 3, value);
+};
+
+
+
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.visualization.DeleteObject = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+};
+goog.inherits(proto.visualization.DeleteObject, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.visualization.DeleteObject.displayName = 'proto.visualization.DeleteObject';
+}
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.visualization.DeleteObject.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.DeleteObject.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.visualization.DeleteObject} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.DeleteObject.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    id: jspb.Message.getFieldWithDefault(msg, 1, 0)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.visualization.DeleteObject}
+ */
+proto.visualization.DeleteObject.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.visualization.DeleteObject;
+  return proto.visualization.DeleteObject.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.visualization.DeleteObject} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.visualization.DeleteObject}
+ */
+proto.visualization.DeleteObject.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setId(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.visualization.DeleteObject.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.visualization.DeleteObject.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.visualization.DeleteObject} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.DeleteObject.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getId();
+  if (f !== 0) {
+    writer.writeUint32(
+      1,
+      f
+    );
+  }
+};
+
+
+/**
+ * optional uint32 id = 1;
+ * @return {number}
+ */
+proto.visualization.DeleteObject.prototype.getId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/** @param {number} value */
+proto.visualization.DeleteObject.prototype.setId = function(value) {
+  jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.visualization.DeleteObjects = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, proto.visualization.DeleteObjects.repeatedFields_, null);
+};
+goog.inherits(proto.visualization.DeleteObjects, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.visualization.DeleteObjects.displayName = 'proto.visualization.DeleteObjects';
+}
+/**
+ * List of repeated fields within this message type.
+ * @private {!Array<number>}
+ * @const
+ */
+proto.visualization.DeleteObjects.repeatedFields_ = [1];
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.visualization.DeleteObjects.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.DeleteObjects.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.visualization.DeleteObjects} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.DeleteObjects.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    idsList: (f = jspb.Message.getRepeatedField(msg, 1)) == null ? undefined : f
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.visualization.DeleteObjects}
+ */
+proto.visualization.DeleteObjects.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.visualization.DeleteObjects;
+  return proto.visualization.DeleteObjects.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.visualization.DeleteObjects} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.visualization.DeleteObjects}
+ */
+proto.visualization.DeleteObjects.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {!Array<number>} */ (reader.readPackedUint32());
+      msg.setIdsList(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.visualization.DeleteObjects.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.visualization.DeleteObjects.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.visualization.DeleteObjects} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.DeleteObjects.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getIdsList();
+  if (f.length > 0) {
+    writer.writePackedUint32(
+      1,
+      f
+    );
+  }
+};
+
+
+/**
+ * repeated uint32 ids = 1;
+ * @return {!Array<number>}
+ */
+proto.visualization.DeleteObjects.prototype.getIdsList = function() {
+  return /** @type {!Array<number>} */ (jspb.Message.getRepeatedField(this, 1));
+};
+
+
+/** @param {!Array<number>} value */
+proto.visualization.DeleteObjects.prototype.setIdsList = function(value) {
+  jspb.Message.setField(this, 1, value || []);
+};
+
+
+/**
+ * @param {!number} value
+ * @param {number=} opt_index
+ */
+proto.visualization.DeleteObjects.prototype.addIds = function(value, opt_index) {
+  jspb.Message.addToRepeatedField(this, 1, value, opt_index);
+};
+
+
+proto.visualization.DeleteObjects.prototype.clearIdsList = function() {
+  this.setIdsList([]);
+};
+
+
+
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.visualization.ClearWindow = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+};
+goog.inherits(proto.visualization.ClearWindow, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.visualization.ClearWindow.displayName = 'proto.visualization.ClearWindow';
+}
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.visualization.ClearWindow.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.ClearWindow.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.visualization.ClearWindow} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.ClearWindow.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    scope: jspb.Message.getFieldWithDefault(msg, 1, 0)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.visualization.ClearWindow}
+ */
+proto.visualization.ClearWindow.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.visualization.ClearWindow;
+  return proto.visualization.ClearWindow.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.visualization.ClearWindow} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.visualization.ClearWindow}
+ */
+proto.visualization.ClearWindow.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {!proto.visualization.ClearWindow.Scope} */ (reader.readEnum());
+      msg.setScope(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.visualization.ClearWindow.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.visualization.ClearWindow.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.visualization.ClearWindow} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.ClearWindow.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getScope();
+  if (f !== 0.0) {
+    writer.writeEnum(
+      1,
+      f
+    );
+  }
+};
+
+
+/**
+ * @enum {number}
+ */
+proto.visualization.ClearWindow.Scope = {
+  ALL: 0,
+  STATIC: 1,
+  DYNAMIC: 2
+};
+
+/**
+ * optional Scope scope = 1;
+ * @return {!proto.visualization.ClearWindow.Scope}
+ */
+proto.visualization.ClearWindow.prototype.getScope = function() {
+  return /** @type {!proto.visualization.ClearWindow.Scope} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/** @param {!proto.visualization.ClearWindow.Scope} value */
+proto.visualization.ClearWindow.prototype.setScope = function(value) {
+  jspb.Message.setProto3EnumField(this, 1, value);
+};
+
+
+
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.visualization.SetGridVisible = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+};
+goog.inherits(proto.visualization.SetGridVisible, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.visualization.SetGridVisible.displayName = 'proto.visualization.SetGridVisible';
+}
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.visualization.SetGridVisible.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.SetGridVisible.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.visualization.SetGridVisible} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.SetGridVisible.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    visible: jspb.Message.getFieldWithDefault(msg, 1, false)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.visualization.SetGridVisible}
+ */
+proto.visualization.SetGridVisible.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.visualization.SetGridVisible;
+  return proto.visualization.SetGridVisible.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.visualization.SetGridVisible} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.visualization.SetGridVisible}
+ */
+proto.visualization.SetGridVisible.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {boolean} */ (reader.readBool());
+      msg.setVisible(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.visualization.SetGridVisible.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.visualization.SetGridVisible.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.visualization.SetGridVisible} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.SetGridVisible.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getVisible();
+  if (f) {
+    writer.writeBool(
+      1,
+      f
+    );
+  }
+};
+
+
+/**
+ * optional bool visible = 1;
+ * Note that Boolean fields may be set to 0/1 when serialized from a Java server.
+ * You should avoid comparisons like {@code val === true/false} in those cases.
+ * @return {boolean}
+ */
+proto.visualization.SetGridVisible.prototype.getVisible = function() {
+  return /** @type {boolean} */ (jspb.Message.getFieldWithDefault(this, 1, false));
+};
+
+
+/** @param {boolean} value */
+proto.visualization.SetGridVisible.prototype.setVisible = function(value) {
+  jspb.Message.setProto3BooleanField(this, 1, value);
+};
+
+
+
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.visualization.SetAxesVisible = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+};
+goog.inherits(proto.visualization.SetAxesVisible, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.visualization.SetAxesVisible.displayName = 'proto.visualization.SetAxesVisible';
+}
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.visualization.SetAxesVisible.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.SetAxesVisible.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.visualization.SetAxesVisible} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.SetAxesVisible.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    visible: jspb.Message.getFieldWithDefault(msg, 1, false)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.visualization.SetAxesVisible}
+ */
+proto.visualization.SetAxesVisible.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.visualization.SetAxesVisible;
+  return proto.visualization.SetAxesVisible.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.visualization.SetAxesVisible} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.visualization.SetAxesVisible}
+ */
+proto.visualization.SetAxesVisible.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {boolean} */ (reader.readBool());
+      msg.setVisible(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.visualization.SetAxesVisible.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.visualization.SetAxesVisible.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.visualization.SetAxesVisible} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.SetAxesVisible.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getVisible();
+  if (f) {
+    writer.writeBool(
+      1,
+      f
+    );
+  }
+};
+
+
+/**
+ * optional bool visible = 1;
+ * Note that Boolean fields may be set to 0/1 when serialized from a Java server.
+ * You should avoid comparisons like {@code val === true/false} in those cases.
+ * @return {boolean}
+ */
+proto.visualization.SetAxesVisible.prototype.getVisible = function() {
+  return /** @type {boolean} */ (jspb.Message.getFieldWithDefault(this, 1, false));
 };
 
 
-proto.visualization.Update3DObjectGeometry.prototype.clearBall = function() {
-  this.setBall(undefined);
+/** @param {boolean} value */
+proto.visualization.SetAxesVisible.prototype.setVisible = function(value) {
+  jspb.Message.setProto3BooleanField(this, 1, value);
 };
 
 
+
 /**
- * Returns whether this field is set.
- * @return {!boolean}
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
  */
-proto.visualization.Update3DObjectGeometry.prototype.hasBall = function() {
-  return jspb.Message.getField(this, 12) != null;
+proto.visualization.SetTitle = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
 };
+goog.inherits(proto.visualization.SetTitle, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.visualization.SetTitle.displayName = 'proto.visualization.SetTitle';
+}
 
 
+if (jspb.Message.GENERATE_TO_OBJECT) {
 /**
- * optional Box3D box_3d = 13;
- * @return {?proto.visualization.Box3D}
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
  */
-proto.visualization.Update3DObjectGeometry.prototype.getBox3d = function() {
-  return /** @type{?proto.visualization.Box3D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Box3D, 13));
+proto.visualization.SetTitle.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.SetTitle.toObject(opt_includeInstance, this);
 };
 
 
-/** @param {?proto.visualization.Box3D|undefined} value */
-proto.visualization.Update3DObjectGeometry.prototype.setBox3d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 13, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
-};
-
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.visualization.SetTitle} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.SetTitle.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    title: jspb.Message.getFieldWithDefault(msg, 1, "")
+  };
 
-proto.visualization.Update3DObjectGeometry.prototype.clearBox3d = function() {
-  this.setBox3d(undefined);
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
 };
+}
 
 
 /**
- * Returns whether this field is set.
- * @return {!boolean}
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.visualization.SetTitle}
  */
-proto.visualization.Update3DObjectGeometry.prototype.hasBox3d = function() {
-  return jspb.Message.getField(this, 13) != null;
+proto.visualization.SetTitle.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.visualization.SetTitle;
+  return proto.visualization.SetTitle.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
- * optional Line3D line_3d = 14;
- * @return {?proto.visualization.Line3D}
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.visualization.SetTitle} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.visualization.SetTitle}
  */
-proto.visualization.Update3DObjectGeometry.prototype.getLine3d = function() {
-  return /** @type{?proto.visualization.Line3D} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Line3D, 14));
+proto.visualization.SetTitle.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setTitle(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
 };
 
 
-/** @param {?proto.visualization.Line3D|undefined} value */
-proto.visualization.Update3DObjectGeometry.prototype.setLine3d = function(value) {
-  jspb.Message.setOneofWrapperField(this, 14, proto.visualization.Update3DObjectGeometry.oneofGroups_[0], value);
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.visualization.SetTitle.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.visualization.SetTitle.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
 };
 
 
-proto.visualization.Update3DObjectGeometry.prototype.clearLine3d = function() {
-  this.setLine3d(undefined);
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.visualization.SetTitle} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.SetTitle.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getTitle();
+  if (f.length > 0) {
+    writer.writeString(
+      1,
+      f
+    );
+  }
 };
 
 
 /**
- * Returns whether this field is set.
- * @return {!boolean}
+ * optional string title = 1;
+ * @return {string}
  */
-proto.visualization.Update3DObjectGeometry.prototype.hasLine3d = function() {
-  return jspb.Message.getField(this, 14) != null;
+proto.visualization.SetTitle.prototype.getTitle = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+};
+
+
+/** @param {string} value */
+proto.visualization.SetTitle.prototype.setTitle = function(value) {
+  jspb.Message.setProto3StringField(this, 1, value);
 };
 
 
@@ -6149,12 +10524,12 @@ proto.visualization.Update3DObjectGeometry.prototype.hasLine3d = function() {
  * @extends {jspb.Message}
  * @constructor
  */
-proto.visualization.UpdateObjectProperties = function(opt_data) {
+proto.visualization.SetLegend = function(opt_data) {
   jspb.Message.initialize(this, opt_data, 0, -1, null, null);
 };
-goog.inherits(proto.visualization.UpdateObjectProperties, jspb.Message);
+goog.inherits(proto.visualization.SetLegend, jspb.Message);
 if (goog.DEBUG && !COMPILED) {
-  proto.visualization.UpdateObjectProperties.displayName = 'proto.visualization.UpdateObjectProperties';
+  proto.visualization.SetLegend.displayName = 'proto.visualization.SetLegend';
 }
 
 
@@ -6169,8 +10544,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     for transitional soy proto support: http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.visualization.UpdateObjectProperties.prototype.toObject = function(opt_includeInstance) {
-  return proto.visualization.UpdateObjectProperties.toObject(opt_includeInstance, this);
+proto.visualization.SetLegend.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.SetLegend.toObject(opt_includeInstance, this);
 };
 
 
@@ -6179,14 +10554,14 @@ proto.visualization.UpdateObjectProperties.prototype.toObject = function(opt_inc
  * @param {boolean|undefined} includeInstance Whether to include the JSPB
  *     instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.visualization.UpdateObjectProperties} msg The msg instance to transform.
+ * @param {!proto.visualization.SetLegend} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.UpdateObjectProperties.toObject = function(includeInstance, msg) {
+proto.visualization.SetLegend.toObject = function(includeInstance, msg) {
   var f, obj = {
-    id: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    material: (f = msg.getMaterial()) && proto.visualization.Material.toObject(includeInstance, f)
+    visible: jspb.Message.getFieldWithDefault(msg, 1, false),
+    fillColor: (f = msg.getFillColor()) && proto.visualization.ColorRGBA.toObject(includeInstance, f)
   };
 
   if (includeInstance) {
@@ -6200,23 +10575,23 @@ proto.visualization.UpdateObjectProperties.toObject = function(includeInstance,
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.visualization.UpdateObjectProperties}
+ * @return {!proto.visualization.SetLegend}
  */
-proto.visualization.UpdateObjectProperties.deserializeBinary = function(bytes) {
+proto.visualization.SetLegend.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.visualization.UpdateObjectProperties;
-  return proto.visualization.UpdateObjectProperties.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.visualization.SetLegend;
+  return proto.visualization.SetLegend.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.visualization.UpdateObjectProperties} msg The message object to deserialize into.
+ * @param {!proto.visualization.SetLegend} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.visualization.UpdateObjectProperties}
+ * @return {!proto.visualization.SetLegend}
  */
-proto.visualization.UpdateObjectProperties.deserializeBinaryFromReader = function(msg, reader) {
+proto.visualization.SetLegend.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -6224,13 +10599,13 @@ proto.visualization.UpdateObjectProperties.deserializeBinaryFromReader = functio
     var field = reader.getFieldNumber();
     switch (field) {
     case 1:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setId(value);
+      var value = /** @type {boolean} */ (reader.readBool());
+      msg.setVisible(value);
       break;
     case 2:
-      var value = new proto.visualization.Material;
-      reader.readMessage(value,proto.visualization.Material.deserializeBinaryFromReader);
-      msg.setMaterial(value);
+      var value = new proto.visualization.ColorRGBA;
+      reader.readMessage(value,proto.visualization.ColorRGBA.deserializeBinaryFromReader);
+      msg.setFillColor(value);
       break;
     default:
       reader.skipField();
@@ -6245,9 +10620,9 @@ proto.visualization.UpdateObjectProperties.deserializeBinaryFromReader = functio
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.visualization.UpdateObjectProperties.prototype.serializeBinary = function() {
+proto.visualization.SetLegend.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.visualization.UpdateObjectProperties.serializeBinaryToWriter(this, writer);
+  proto.visualization.SetLegend.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -6255,63 +10630,65 @@ proto.visualization.UpdateObjectProperties.prototype.serializeBinary = function(
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.visualization.UpdateObjectProperties} message
+ * @param {!proto.visualization.SetLegend} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.UpdateObjectProperties.serializeBinaryToWriter = function(message, writer) {
+proto.visualization.SetLegend.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getId();
-  if (f.length > 0) {
-    writer.writeString(
+  f = message.getVisible();
+  if (f) {
+    writer.writeBool(
       1,
       f
     );
   }
-  f = message.getMaterial();
+  f = message.getFillColor();
   if (f != null) {
     writer.writeMessage(
       2,
       f,
-      proto.visualization.Material.serializeBinaryToWriter
+      proto.visualization.ColorRGBA.serializeBinaryToWriter
     );
   }
 };
 
 
 /**
- * optional string id = 1;
- * @return {string}
+ * optional bool visible = 1;
+ * Note that Boolean fields may be set to 0/1 when serialized from a Java server.
+ * You should avoid comparisons like {@code val === true/false} in those cases.
+ * @return {boolean}
  */
-proto.visualization.UpdateObjectProperties.prototype.getId = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+proto.visualization.SetLegend.prototype.getVisible = function() {
+  return /** @type {boolean} */ (jspb.Message.getFieldWithDefault(this, 1, false));
 };
 
 
-/** @param {string} value */
-proto.visualization.UpdateObjectProperties.prototype.setId = function(value) {
-  jspb.Message.setProto3StringField(this, 1, value);
+/** @param {boolean} value */
+proto.visualization.SetLegend.prototype.setVisible = function(value) {
+  jspb.Message.setProto3BooleanField(this, 1, value);
 };
 
 
 /**
- * optional Material material = 2;
- * @return {?proto.visualization.Material}
+ * optional ColorRGBA fill_color = 2;
+ * @return {?proto.visualization.ColorRGBA}
  */
-proto.visualization.UpdateObjectProperties.prototype.getMaterial = function() {
-  return /** @type{?proto.visualization.Material} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.Material, 2));
+proto.visualization.SetLegend.prototype.getFillColor = function() {
+  return /** @type{?proto.visualization.ColorRGBA} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.ColorRGBA, 2));
 };
 
 
-/** @param {?proto.visualization.Material|undefined} value */
-proto.visualization.UpdateObjectProperties.prototype.setMaterial = function(value) {
+/** @param {?proto.visualization.ColorRGBA|undefined} value */
+proto.visualization.SetLegend.prototype.setFillColor = function(value) {
   jspb.Message.setWrapperField(this, 2, value);
 };
 
 
-proto.visualization.UpdateObjectProperties.prototype.clearMaterial = function() {
-  this.setMaterial(undefined);
+proto.visualization.SetLegend.prototype.clearFillColor = function() {
+  this.setFillColor(undefined);
 };
 
 
@@ -6319,7 +10696,7 @@ proto.visualization.UpdateObjectProperties.prototype.clearMaterial = function()
  * Returns whether this field is set.
  * @return {!boolean}
  */
-proto.visualization.UpdateObjectProperties.prototype.hasMaterial = function() {
+proto.visualization.SetLegend.prototype.hasFillColor = function() {
   return jspb.Message.getField(this, 2) != null;
 };
 
@@ -6335,12 +10712,12 @@ proto.visualization.UpdateObjectProperties.prototype.hasMaterial = function() {
  * @extends {jspb.Message}
  * @constructor
  */
-proto.visualization.DeleteObject = function(opt_data) {
+proto.visualization.Set2DAxisProperties = function(opt_data) {
   jspb.Message.initialize(this, opt_data, 0, -1, null, null);
 };
-goog.inherits(proto.visualization.DeleteObject, jspb.Message);
+goog.inherits(proto.visualization.Set2DAxisProperties, jspb.Message);
 if (goog.DEBUG && !COMPILED) {
-  proto.visualization.DeleteObject.displayName = 'proto.visualization.DeleteObject';
+  proto.visualization.Set2DAxisProperties.displayName = 'proto.visualization.Set2DAxisProperties';
 }
 
 
@@ -6355,8 +10732,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     for transitional soy proto support: http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.visualization.DeleteObject.prototype.toObject = function(opt_includeInstance) {
-  return proto.visualization.DeleteObject.toObject(opt_includeInstance, this);
+proto.visualization.Set2DAxisProperties.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.Set2DAxisProperties.toObject(opt_includeInstance, this);
 };
 
 
@@ -6365,13 +10742,19 @@ proto.visualization.DeleteObject.prototype.toObject = function(opt_includeInstan
  * @param {boolean|undefined} includeInstance Whether to include the JSPB
  *     instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.visualization.DeleteObject} msg The msg instance to transform.
+ * @param {!proto.visualization.Set2DAxisProperties} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.DeleteObject.toObject = function(includeInstance, msg) {
+proto.visualization.Set2DAxisProperties.toObject = function(includeInstance, msg) {
   var f, obj = {
-    id: jspb.Message.getFieldWithDefault(msg, 1, "")
+    xLabel: jspb.Message.getFieldWithDefault(msg, 1, ""),
+    yLabel: jspb.Message.getFieldWithDefault(msg, 2, ""),
+    xMin: +jspb.Message.getFieldWithDefault(msg, 3, 0.0),
+    xMax: +jspb.Message.getFieldWithDefault(msg, 4, 0.0),
+    yMin: +jspb.Message.getFieldWithDefault(msg, 5, 0.0),
+    yMax: +jspb.Message.getFieldWithDefault(msg, 6, 0.0),
+    autoScale: jspb.Message.getFieldWithDefault(msg, 7, false)
   };
 
   if (includeInstance) {
@@ -6385,23 +10768,23 @@ proto.visualization.DeleteObject.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.visualization.DeleteObject}
+ * @return {!proto.visualization.Set2DAxisProperties}
  */
-proto.visualization.DeleteObject.deserializeBinary = function(bytes) {
+proto.visualization.Set2DAxisProperties.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.visualization.DeleteObject;
-  return proto.visualization.DeleteObject.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.visualization.Set2DAxisProperties;
+  return proto.visualization.Set2DAxisProperties.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.visualization.DeleteObject} msg The message object to deserialize into.
+ * @param {!proto.visualization.Set2DAxisProperties} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.visualization.DeleteObject}
+ * @return {!proto.visualization.Set2DAxisProperties}
  */
-proto.visualization.DeleteObject.deserializeBinaryFromReader = function(msg, reader) {
+proto.visualization.Set2DAxisProperties.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -6410,7 +10793,31 @@ proto.visualization.DeleteObject.deserializeBinaryFromReader = function(msg, rea
     switch (field) {
     case 1:
       var value = /** @type {string} */ (reader.readString());
-      msg.setId(value);
+      msg.setXLabel(value);
+      break;
+    case 2:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setYLabel(value);
+      break;
+    case 3:
+      var value = /** @type {number} */ (reader.readFloat());
+      msg.setXMin(value);
+      break;
+    case 4:
+      var value = /** @type {number} */ (reader.readFloat());
+      msg.setXMax(value);
+      break;
+    case 5:
+      var value = /** @type {number} */ (reader.readFloat());
+      msg.setYMin(value);
+      break;
+    case 6:
+      var value = /** @type {number} */ (reader.readFloat());
+      msg.setYMax(value);
+      break;
+    case 7:
+      var value = /** @type {boolean} */ (reader.readBool());
+      msg.setAutoScale(value);
       break;
     default:
       reader.skipField();
@@ -6425,9 +10832,9 @@ proto.visualization.DeleteObject.deserializeBinaryFromReader = function(msg, rea
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.visualization.DeleteObject.prototype.serializeBinary = function() {
+proto.visualization.Set2DAxisProperties.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.visualization.DeleteObject.serializeBinaryToWriter(this, writer);
+  proto.visualization.Set2DAxisProperties.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -6435,37 +10842,171 @@ proto.visualization.DeleteObject.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.visualization.DeleteObject} message
+ * @param {!proto.visualization.Set2DAxisProperties} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.DeleteObject.serializeBinaryToWriter = function(message, writer) {
+proto.visualization.Set2DAxisProperties.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getId();
+  f = message.getXLabel();
   if (f.length > 0) {
     writer.writeString(
       1,
       f
     );
   }
+  f = message.getYLabel();
+  if (f.length > 0) {
+    writer.writeString(
+      2,
+      f
+    );
+  }
+  f = message.getXMin();
+  if (f !== 0.0) {
+    writer.writeFloat(
+      3,
+      f
+    );
+  }
+  f = message.getXMax();
+  if (f !== 0.0) {
+    writer.writeFloat(
+      4,
+      f
+    );
+  }
+  f = message.getYMin();
+  if (f !== 0.0) {
+    writer.writeFloat(
+      5,
+      f
+    );
+  }
+  f = message.getYMax();
+  if (f !== 0.0) {
+    writer.writeFloat(
+      6,
+      f
+    );
+  }
+  f = message.getAutoScale();
+  if (f) {
+    writer.writeBool(
+      7,
+      f
+    );
+  }
 };
 
 
 /**
- * optional string id = 1;
+ * optional string x_label = 1;
  * @return {string}
  */
-proto.visualization.DeleteObject.prototype.getId = function() {
+proto.visualization.Set2DAxisProperties.prototype.getXLabel = function() {
   return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
 };
 
 
 /** @param {string} value */
-proto.visualization.DeleteObject.prototype.setId = function(value) {
+proto.visualization.Set2DAxisProperties.prototype.setXLabel = function(value) {
   jspb.Message.setProto3StringField(this, 1, value);
 };
 
 
+/**
+ * optional string y_label = 2;
+ * @return {string}
+ */
+proto.visualization.Set2DAxisProperties.prototype.getYLabel = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+};
+
+
+/** @param {string} value */
+proto.visualization.Set2DAxisProperties.prototype.setYLabel = function(value) {
+  jspb.Message.setProto3StringField(this, 2, value);
+};
+
+
+/**
+ * optional float x_min = 3;
+ * @return {number}
+ */
+proto.visualization.Set2DAxisProperties.prototype.getXMin = function() {
+  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 3, 0.0));
+};
+
+
+/** @param {number} value */
+proto.visualization.Set2DAxisProperties.prototype.setXMin = function(value) {
+  jspb.Message.setProto3FloatField(this, 3, value);
+};
+
+
+/**
+ * optional float x_max = 4;
+ * @return {number}
+ */
+proto.visualization.Set2DAxisProperties.prototype.getXMax = function() {
+  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 4, 0.0));
+};
+
+
+/** @param {number} value */
+proto.visualization.Set2DAxisProperties.prototype.setXMax = function(value) {
+  jspb.Message.setProto3FloatField(this, 4, value);
+};
+
+
+/**
+ * optional float y_min = 5;
+ * @return {number}
+ */
+proto.visualization.Set2DAxisProperties.prototype.getYMin = function() {
+  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 5, 0.0));
+};
+
+
+/** @param {number} value */
+proto.visualization.Set2DAxisProperties.prototype.setYMin = function(value) {
+  jspb.Message.setProto3FloatField(this, 5, value);
+};
+
+
+/**
+ * optional float y_max = 6;
+ * @return {number}
+ */
+proto.visualization.Set2DAxisProperties.prototype.getYMax = function() {
+  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 6, 0.0));
+};
+
+
+/** @param {number} value */
+proto.visualization.Set2DAxisProperties.prototype.setYMax = function(value) {
+  jspb.Message.setProto3FloatField(this, 6, value);
+};
+
+
+/**
+ * optional bool auto_scale = 7;
+ * Note that Boolean fields may be set to 0/1 when serialized from a Java server.
+ * You should avoid comparisons like {@code val === true/false} in those cases.
+ * @return {boolean}
+ */
+proto.visualization.Set2DAxisProperties.prototype.getAutoScale = function() {
+  return /** @type {boolean} */ (jspb.Message.getFieldWithDefault(this, 7, false));
+};
+
+
+/** @param {boolean} value */
+proto.visualization.Set2DAxisProperties.prototype.setAutoScale = function(value) {
+  jspb.Message.setProto3BooleanField(this, 7, value);
+};
+
+
 
 /**
  * Generated by JsPbCodeGenerator.
@@ -6477,12 +11018,12 @@ proto.visualization.DeleteObject.prototype.setId = function(value) {
  * @extends {jspb.Message}
  * @constructor
  */
-proto.visualization.SetGridVisible = function(opt_data) {
+proto.visualization.Quantization = function(opt_data) {
   jspb.Message.initialize(this, opt_data, 0, -1, null, null);
 };
-goog.inherits(proto.visualization.SetGridVisible, jspb.Message);
+goog.inherits(proto.visualization.Quantization, jspb.Message);
 if (goog.DEBUG && !COMPILED) {
-  proto.visualization.SetGridVisible.displayName = 'proto.visualization.SetGridVisible';
+  proto.visualization.Quantization.displayName = 'proto.visualization.Quantization';
 }
 
 
@@ -6497,8 +11038,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     for transitional soy proto support: http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.visualization.SetGridVisible.prototype.toObject = function(opt_includeInstance) {
-  return proto.visualization.SetGridVisible.toObject(opt_includeInstance, this);
+proto.visualization.Quantization.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.Quantization.toObject(opt_includeInstance, this);
 };
 
 
@@ -6507,13 +11048,14 @@ proto.visualization.SetGridVisible.prototype.toObject = function(opt_includeInst
  * @param {boolean|undefined} includeInstance Whether to include the JSPB
  *     instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.visualization.SetGridVisible} msg The msg instance to transform.
+ * @param {!proto.visualization.Quantization} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.SetGridVisible.toObject = function(includeInstance, msg) {
+proto.visualization.Quantization.toObject = function(includeInstance, msg) {
   var f, obj = {
-    visible: jspb.Message.getFieldWithDefault(msg, 1, false)
+    step: +jspb.Message.getFieldWithDefault(msg, 1, 0.0),
+    origin: (f = msg.getOrigin()) && proto.visualization.Vec2.toObject(includeInstance, f)
   };
 
   if (includeInstance) {
@@ -6527,23 +11069,23 @@ proto.visualization.SetGridVisible.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.visualization.SetGridVisible}
+ * @return {!proto.visualization.Quantization}
  */
-proto.visualization.SetGridVisible.deserializeBinary = function(bytes) {
+proto.visualization.Quantization.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.visualization.SetGridVisible;
-  return proto.visualization.SetGridVisible.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.visualization.Quantization;
+  return proto.visualization.Quantization.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.visualization.SetGridVisible} msg The message object to deserialize into.
+ * @param {!proto.visualization.Quantization} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.visualization.SetGridVisible}
+ * @return {!proto.visualization.Quantization}
  */
-proto.visualization.SetGridVisible.deserializeBinaryFromReader = function(msg, reader) {
+proto.visualization.Quantization.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -6551,8 +11093,13 @@ proto.visualization.SetGridVisible.deserializeBinaryFromReader = function(msg, r
     var field = reader.getFieldNumber();
     switch (field) {
     case 1:
-      var value = /** @type {boolean} */ (reader.readBool());
-      msg.setVisible(value);
+      var value = /** @type {number} */ (reader.readFloat());
+      msg.setStep(value);
+      break;
+    case 2:
+      var value = new proto.visualization.Vec2;
+      reader.readMessage(value,proto.visualization.Vec2.deserializeBinaryFromReader);
+      msg.setOrigin(value);
       break;
     default:
       reader.skipField();
@@ -6567,9 +11114,9 @@ proto.visualization.SetGridVisible.deserializeBinaryFromReader = function(msg, r
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.visualization.SetGridVisible.prototype.serializeBinary = function() {
+proto.visualization.Quantization.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.visualization.SetGridVisible.serializeBinaryToWriter(this, writer);
+  proto.visualization.Quantization.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -6577,36 +11124,72 @@ proto.visualization.SetGridVisible.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.visualization.SetGridVisible} message
+ * @param {!proto.visualization.Quantization} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.SetGridVisible.serializeBinaryToWriter = function(message, writer) {
+proto.visualization.Quantization.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getVisible();
-  if (f) {
-    writer.writeBool(
+  f = message.getStep();
+  if (f !== 0.0) {
+    writer.writeFloat(
       1,
       f
     );
   }
+  f = message.getOrigin();
+  if (f != null) {
+    writer.writeMessage(
+      2,
+      f,
+      proto.visualization.Vec2.serializeBinaryToWriter
+    );
+  }
 };
 
 
 /**
- * optional bool visible = 1;
- * Note that Boolean fields may be set to 0/1 when serialized from a Java server.
- * You should avoid comparisons like {@code val === true/false} in those cases.
- * @return {boolean}
+ * optional float step = 1;
+ * @return {number}
  */
-proto.visualization.SetGridVisible.prototype.getVisible = function() {
-  return /** @type {boolean} */ (jspb.Message.getFieldWithDefault(this, 1, false));
+proto.visualization.Quantization.prototype.getStep = function() {
+  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 1, 0.0));
+};
+
+
+/** @param {number} value */
+proto.visualization.Quantization.prototype.setStep = function(value) {
+  jspb.Message.setProto3FloatField(this, 1, value);
+};
+
+
+/**
+ * optional Vec2 origin = 2;
+ * @return {?proto.visualization.Vec2}
+ */
+proto.visualization.Quantization.prototype.getOrigin = function() {
+  return /** @type{?proto.visualization.Vec2} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Vec2, 2));
+};
+
+
+/** @param {?proto.visualization.Vec2|undefined} value */
+proto.visualization.Quantization.prototype.setOrigin = function(value) {
+  jspb.Message.setWrapperField(this, 2, value);
 };
 
 
-/** @param {boolean} value */
-proto.visualization.SetGridVisible.prototype.setVisible = function(value) {
-  jspb.Message.setProto3BooleanField(this, 1, value);
+proto.visualization.Quantization.prototype.clearOrigin = function() {
+  this.setOrigin(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Quantization.prototype.hasOrigin = function() {
+  return jspb.Message.getField(this, 2) != null;
 };
 
 
@@ -6621,12 +11204,12 @@ proto.visualization.SetGridVisible.prototype.setVisible = function(value) {
  * @extends {jspb.Message}
  * @constructor
  */
-proto.visualization.SetAxesVisible = function(opt_data) {
+proto.visualization.CreateWindow = function(opt_data) {
   jspb.Message.initialize(this, opt_data, 0, -1, null, null);
 };
-goog.inherits(proto.visualization.SetAxesVisible, jspb.Message);
+goog.inherits(proto.visualization.CreateWindow, jspb.Message);
 if (goog.DEBUG && !COMPILED) {
-  proto.visualization.SetAxesVisible.displayName = 'proto.visualization.SetAxesVisible';
+  proto.visualization.CreateWindow.displayName = 'proto.visualization.CreateWindow';
 }
 
 
@@ -6641,8 +11224,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     for transitional soy proto support: http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.visualization.SetAxesVisible.prototype.toObject = function(opt_includeInstance) {
-  return proto.visualization.SetAxesVisible.toObject(opt_includeInstance, this);
+proto.visualization.CreateWindow.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.CreateWindow.toObject(opt_includeInstance, this);
 };
 
 
@@ -6651,13 +11234,15 @@ proto.visualization.SetAxesVisible.prototype.toObject = function(opt_includeInst
  * @param {boolean|undefined} includeInstance Whether to include the JSPB
  *     instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.visualization.SetAxesVisible} msg The msg instance to transform.
+ * @param {!proto.visualization.CreateWindow} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.SetAxesVisible.toObject = function(includeInstance, msg) {
+proto.visualization.CreateWindow.toObject = function(includeInstance, msg) {
   var f, obj = {
-    visible: jspb.Message.getFieldWithDefault(msg, 1, false)
+    windowId: jspb.Message.getFieldWithDefault(msg, 1, ""),
+    windowName: jspb.Message.getFieldWithDefault(msg, 2, ""),
+    quantization: (f = msg.getQuantization()) && proto.visualization.Quantization.toObject(includeInstance, f)
   };
 
   if (includeInstance) {
@@ -6671,23 +11256,23 @@ proto.visualization.SetAxesVisible.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.visualization.SetAxesVisible}
+ * @return {!proto.visualization.CreateWindow}
  */
-proto.visualization.SetAxesVisible.deserializeBinary = function(bytes) {
+proto.visualization.CreateWindow.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.visualization.SetAxesVisible;
-  return proto.visualization.SetAxesVisible.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.visualization.CreateWindow;
+  return proto.visualization.CreateWindow.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.visualization.SetAxesVisible} msg The message object to deserialize into.
+ * @param {!proto.visualization.CreateWindow} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.visualization.SetAxesVisible}
+ * @return {!proto.visualization.CreateWindow}
  */
-proto.visualization.SetAxesVisible.deserializeBinaryFromReader = function(msg, reader) {
+proto.visualization.CreateWindow.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -6695,8 +11280,17 @@ proto.visualization.SetAxesVisible.deserializeBinaryFromReader = function(msg, r
     var field = reader.getFieldNumber();
     switch (field) {
     case 1:
-      var value = /** @type {boolean} */ (reader.readBool());
-      msg.setVisible(value);
+      var value = /** @type {string} */ (reader.readString());
+      msg.setWindowId(value);
+      break;
+    case 2:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setWindowName(value);
+      break;
+    case 3:
+      var value = new proto.visualization.Quantization;
+      reader.readMessage(value,proto.visualization.Quantization.deserializeBinaryFromReader);
+      msg.setQuantization(value);
       break;
     default:
       reader.skipField();
@@ -6711,9 +11305,9 @@ proto.visualization.SetAxesVisible.deserializeBinaryFromReader = function(msg, r
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.visualization.SetAxesVisible.prototype.serializeBinary = function() {
+proto.visualization.CreateWindow.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.visualization.SetAxesVisible.serializeBinaryToWriter(this, writer);
+  proto.visualization.CreateWindow.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -6721,36 +11315,94 @@ proto.visualization.SetAxesVisible.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.visualization.SetAxesVisible} message
+ * @param {!proto.visualization.CreateWindow} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.SetAxesVisible.serializeBinaryToWriter = function(message, writer) {
+proto.visualization.CreateWindow.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getVisible();
-  if (f) {
-    writer.writeBool(
+  f = message.getWindowId();
+  if (f.length > 0) {
+    writer.writeString(
       1,
       f
     );
   }
+  f = message.getWindowName();
+  if (f.length > 0) {
+    writer.writeString(
+      2,
+      f
+    );
+  }
+  f = message.getQuantization();
+  if (f != null) {
+    writer.writeMessage(
+      3,
+      f,
+      proto.visualization.Quantization.serializeBinaryToWriter
+    );
+  }
 };
 
 
 /**
- * optional bool visible = 1;
- * Note that Boolean fields may be set to 0/1 when serialized from a Java server.
- * You should avoid comparisons like {@code val === true/false} in those cases.
- * @return {boolean}
+ * optional string window_id = 1;
+ * @return {string}
  */
-proto.visualization.SetAxesVisible.prototype.getVisible = function() {
-  return /** @type {boolean} */ (jspb.Message.getFieldWithDefault(this, 1, false));
+proto.visualization.CreateWindow.prototype.getWindowId = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
 };
 
 
-/** @param {boolean} value */
-proto.visualization.SetAxesVisible.prototype.setVisible = function(value) {
-  jspb.Message.setProto3BooleanField(this, 1, value);
+/** @param {string} value */
+proto.visualization.CreateWindow.prototype.setWindowId = function(value) {
+  jspb.Message.setProto3StringField(this, 1, value);
+};
+
+
+/**
+ * optional string window_name = 2;
+ * @return {string}
+ */
+proto.visualization.CreateWindow.prototype.getWindowName = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+};
+
+
+/** @param {string} value */
+proto.visualization.CreateWindow.prototype.setWindowName = function(value) {
+  jspb.Message.setProto3StringField(this, 2, value);
+};
+
+
+/**
+ * optional Quantization quantization = 3;
+ * @return {?proto.visualization.Quantization}
+ */
+proto.visualization.CreateWindow.prototype.getQuantization = function() {
+  return /** @type{?proto.visualization.Quantization} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Quantization, 3));
+};
+
+
+/** @param {?proto.visualization.Quantization|undefined} value */
+proto.visualization.CreateWindow.prototype.setQuantization = function(value) {
+  jspb.Message.setWrapperField(this, 3, value);
+};
+
+
+proto.visualization.CreateWindow.prototype.clearQuantization = function() {
+  this.setQuantization(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.CreateWindow.prototype.hasQuantization = function() {
+  return jspb.Message.getField(this, 3) != null;
 };
 
 
@@ -6765,12 +11417,12 @@ proto.visualization.SetAxesVisible.prototype.setVisible = function(value) {
  * @extends {jspb.Message}
  * @constructor
  */
-proto.visualization.SetTitle = function(opt_data) {
+proto.visualization.DeleteWindow = function(opt_data) {
   jspb.Message.initialize(this, opt_data, 0, -1, null, null);
 };
-goog.inherits(proto.visualization.SetTitle, jspb.Message);
+goog.inherits(proto.visualization.DeleteWindow, jspb.Message);
 if (goog.DEBUG && !COMPILED) {
-  proto.visualization.SetTitle.displayName = 'proto.visualization.SetTitle';
+  proto.visualization.DeleteWindow.displayName = 'proto.visualization.DeleteWindow';
 }
 
 
@@ -6785,8 +11437,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     for transitional soy proto support: http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.visualization.SetTitle.prototype.toObject = function(opt_includeInstance) {
-  return proto.visualization.SetTitle.toObject(opt_includeInstance, this);
+proto.visualization.DeleteWindow.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.DeleteWindow.toObject(opt_includeInstance, this);
 };
 
 
@@ -6795,13 +11447,13 @@ proto.visualization.SetTitle.prototype.toObject = function(opt_includeInstance)
  * @param {boolean|undefined} includeInstance Whether to include the JSPB
  *     instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.visualization.SetTitle} msg The msg instance to transform.
+ * @param {!proto.visualization.DeleteWindow} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.SetTitle.toObject = function(includeInstance, msg) {
+proto.visualization.DeleteWindow.toObject = function(includeInstance, msg) {
   var f, obj = {
-    title: jspb.Message.getFieldWithDefault(msg, 1, "")
+    windowId: jspb.Message.getFieldWithDefault(msg, 1, "")
   };
 
   if (includeInstance) {
@@ -6815,23 +11467,23 @@ proto.visualization.SetTitle.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.visualization.SetTitle}
+ * @return {!proto.visualization.DeleteWindow}
  */
-proto.visualization.SetTitle.deserializeBinary = function(bytes) {
+proto.visualization.DeleteWindow.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.visualization.SetTitle;
-  return proto.visualization.SetTitle.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.visualization.DeleteWindow;
+  return proto.visualization.DeleteWindow.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.visualization.SetTitle} msg The message object to deserialize into.
+ * @param {!proto.visualization.DeleteWindow} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.visualization.SetTitle}
+ * @return {!proto.visualization.DeleteWindow}
  */
-proto.visualization.SetTitle.deserializeBinaryFromReader = function(msg, reader) {
+proto.visualization.DeleteWindow.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -6840,7 +11492,7 @@ proto.visualization.SetTitle.deserializeBinaryFromReader = function(msg, reader)
     switch (field) {
     case 1:
       var value = /** @type {string} */ (reader.readString());
-      msg.setTitle(value);
+      msg.setWindowId(value);
       break;
     default:
       reader.skipField();
@@ -6855,9 +11507,9 @@ proto.visualization.SetTitle.deserializeBinaryFromReader = function(msg, reader)
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.visualization.SetTitle.prototype.serializeBinary = function() {
+proto.visualization.DeleteWindow.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.visualization.SetTitle.serializeBinaryToWriter(this, writer);
+  proto.visualization.DeleteWindow.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -6865,13 +11517,13 @@ proto.visualization.SetTitle.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.visualization.SetTitle} message
+ * @param {!proto.visualization.DeleteWindow} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.SetTitle.serializeBinaryToWriter = function(message, writer) {
+proto.visualization.DeleteWindow.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getTitle();
+  f = message.getWindowId();
   if (f.length > 0) {
     writer.writeString(
       1,
@@ -6882,16 +11534,16 @@ proto.visualization.SetTitle.serializeBinaryToWriter = function(message, writer)
 
 
 /**
- * optional string title = 1;
+ * optional string window_id = 1;
  * @return {string}
  */
-proto.visualization.SetTitle.prototype.getTitle = function() {
+proto.visualization.DeleteWindow.prototype.getWindowId = function() {
   return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
 };
 
 
 /** @param {string} value */
-proto.visualization.SetTitle.prototype.setTitle = function(value) {
+proto.visualization.DeleteWindow.prototype.setWindowId = function(value) {
   jspb.Message.setProto3StringField(this, 1, value);
 };
 
@@ -6907,12 +11559,12 @@ proto.visualization.SetTitle.prototype.setTitle = function(value) {
  * @extends {jspb.Message}
  * @constructor
  */
-proto.visualization.SetLegend = function(opt_data) {
+proto.visualization.DefineMesh = function(opt_data) {
   jspb.Message.initialize(this, opt_data, 0, -1, null, null);
 };
-goog.inherits(proto.visualization.SetLegend, jspb.Message);
+goog.inherits(proto.visualization.DefineMesh, jspb.Message);
 if (goog.DEBUG && !COMPILED) {
-  proto.visualization.SetLegend.displayName = 'proto.visualization.SetLegend';
+  proto.visualization.DefineMesh.displayName = 'proto.visualization.DefineMesh';
 }
 
 
@@ -6927,8 +11579,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     for transitional soy proto support: http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.visualization.SetLegend.prototype.toObject = function(opt_includeInstance) {
-  return proto.visualization.SetLegend.toObject(opt_includeInstance, this);
+proto.visualization.DefineMesh.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.DefineMesh.toObject(opt_includeInstance, this);
 };
 
 
@@ -6937,14 +11589,15 @@ proto.visualization.SetLegend.prototype.toObject = function(opt_includeInstance)
  * @param {boolean|undefined} includeInstance Whether to include the JSPB
  *     instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.visualization.SetLegend} msg The msg instance to transform.
+ * @param {!proto.visualization.DefineMesh} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.SetLegend.toObject = function(includeInstance, msg) {
+proto.visualization.DefineMesh.toObject = function(includeInstance, msg) {
   var f, obj = {
-    visible: jspb.Message.getFieldWithDefault(msg, 1, false),
-    fillColor: (f = msg.getFillColor()) && proto.visualization.ColorRGBA.toObject(includeInstance, f)
+    meshId: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    xyz: msg.getXyz_asB64(),
+    indices: msg.getIndices_asB64()
   };
 
   if (includeInstance) {
@@ -6958,23 +11611,23 @@ proto.visualization.SetLegend.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.visualization.SetLegend}
+ * @return {!proto.visualization.DefineMesh}
  */
-proto.visualization.SetLegend.deserializeBinary = function(bytes) {
+proto.visualization.DefineMesh.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.visualization.SetLegend;
-  return proto.visualization.SetLegend.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.visualization.DefineMesh;
+  return proto.visualization.DefineMesh.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.visualization.SetLegend} msg The message object to deserialize into.
+ * @param {!proto.visualization.DefineMesh} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.visualization.SetLegend}
+ * @return {!proto.visualization.DefineMesh}
  */
-proto.visualization.SetLegend.deserializeBinaryFromReader = function(msg, reader) {
+proto.visualization.DefineMesh.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -6982,13 +11635,16 @@ proto.visualization.SetLegend.deserializeBinaryFromReader = function(msg, reader
     var field = reader.getFieldNumber();
     switch (field) {
     case 1:
-      var value = /** @type {boolean} */ (reader.readBool());
-      msg.setVisible(value);
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setMeshId(value);
       break;
     case 2:
-      var value = new proto.visualization.ColorRGBA;
-      reader.readMessage(value,proto.visualization.ColorRGBA.deserializeBinaryFromReader);
-      msg.setFillColor(value);
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setXyz(value);
+      break;
+    case 3:
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setIndices(value);
       break;
     default:
       reader.skipField();
@@ -7003,9 +11659,9 @@ proto.visualization.SetLegend.deserializeBinaryFromReader = function(msg, reader
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.visualization.SetLegend.prototype.serializeBinary = function() {
+proto.visualization.DefineMesh.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.visualization.SetLegend.serializeBinaryToWriter(this, writer);
+  proto.visualization.DefineMesh.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -7013,74 +11669,126 @@ proto.visualization.SetLegend.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.visualization.SetLegend} message
+ * @param {!proto.visualization.DefineMesh} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.SetLegend.serializeBinaryToWriter = function(message, writer) {
+proto.visualization.DefineMesh.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getVisible();
-  if (f) {
-    writer.writeBool(
+  f = message.getMeshId();
+  if (f !== 0) {
+    writer.writeUint32(
       1,
       f
     );
   }
-  f = message.getFillColor();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getXyz_asU8();
+  if (f.length > 0) {
+    writer.writeBytes(
       2,
-      f,
-      proto.visualization.ColorRGBA.serializeBinaryToWriter
+      f
+    );
+  }
+  f = message.getIndices_asU8();
+  if (f.length > 0) {
+    writer.writeBytes(
+      3,
+      f
     );
   }
 };
 
 
 /**
- * optional bool visible = 1;
- * Note that Boolean fields may be set to 0/1 when serialized from a Java server.
- * You should avoid comparisons like {@code val === true/false} in those cases.
- * @return {boolean}
+ * optional uint32 mesh_id = 1;
+ * @return {number}
  */
-proto.visualization.SetLegend.prototype.getVisible = function() {
-  return /** @type {boolean} */ (jspb.Message.getFieldWithDefault(this, 1, false));
+proto.visualization.DefineMesh.prototype.getMeshId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
 };
 
 
-/** @param {boolean} value */
-proto.visualization.SetLegend.prototype.setVisible = function(value) {
-  jspb.Message.setProto3BooleanField(this, 1, value);
+/** @param {number} value */
+proto.visualization.DefineMesh.prototype.setMeshId = function(value) {
+  jspb.Message.setProto3IntField(this, 1, value);
 };
 
 
 /**
- * optional ColorRGBA fill_color = 2;
- * @return {?proto.visualization.ColorRGBA}
+ * optional bytes xyz = 2;
+ * @return {!(string|Uint8Array)}
  */
-proto.visualization.SetLegend.prototype.getFillColor = function() {
-  return /** @type{?proto.visualization.ColorRGBA} */ (
-    jspb.Message.getWrapperField(this, proto.visualization.ColorRGBA, 2));
+proto.visualization.DefineMesh.prototype.getXyz = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
 };
 
 
-/** @param {?proto.visualization.ColorRGBA|undefined} value */
-proto.visualization.SetLegend.prototype.setFillColor = function(value) {
-  jspb.Message.setWrapperField(this, 2, value);
+/**
+ * optional bytes xyz = 2;
+ * This is a type-conversion wrapper around `getXyz()`
+ * @return {string}
+ */
+proto.visualization.DefineMesh.prototype.getXyz_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getXyz()));
+};
+
+
+/**
+ * optional bytes xyz = 2;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getXyz()`
+ * @return {!Uint8Array}
+ */
+proto.visualization.DefineMesh.prototype.getXyz_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getXyz()));
+};
+
+
+/** @param {!(string|Uint8Array)} value */
+proto.visualization.DefineMesh.prototype.setXyz = function(value) {
+  jspb.Message.setProto3BytesField(this, 2, value);
+};
+
+
+/**
+ * optional bytes indices = 3;
+ * @return {!(string|Uint8Array)}
+ */
+proto.visualization.DefineMesh.prototype.getIndices = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldWithDefault(this, 3, ""));
 };
 
 
-proto.visualization.SetLegend.prototype.clearFillColor = function() {
-  this.setFillColor(undefined);
+/**
+ * optional bytes indices = 3;
+ * This is a type-conversion wrapper around `getIndices()`
+ * @return {string}
+ */
+proto.visualization.DefineMesh.prototype.getIndices_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getIndices()));
 };
 
 
 /**
- * Returns whether this field is set.
- * @return {!boolean}
+ * optional bytes indices = 3;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getIndices()`
+ * @return {!Uint8Array}
  */
-proto.visualization.SetLegend.prototype.hasFillColor = function() {
-  return jspb.Message.getField(this, 2) != null;
+proto.visualization.DefineMesh.prototype.getIndices_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getIndices()));
+};
+
+
+/** @param {!(string|Uint8Array)} value */
+proto.visualization.DefineMesh.prototype.setIndices = function(value) {
+  jspb.Message.setProto3BytesField(this, 3, value);
 };
 
 
@@ -7095,13 +11803,20 @@ proto.visualization.SetLegend.prototype.hasFillColor = function() {
  * @extends {jspb.Message}
  * @constructor
  */
-proto.visualization.Set2DAxisProperties = function(opt_data) {
-  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+proto.visualization.DeleteMeshes = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, proto.visualization.DeleteMeshes.repeatedFields_, null);
 };
-goog.inherits(proto.visualization.Set2DAxisProperties, jspb.Message);
+goog.inherits(proto.visualization.DeleteMeshes, jspb.Message);
 if (goog.DEBUG && !COMPILED) {
-  proto.visualization.Set2DAxisProperties.displayName = 'proto.visualization.Set2DAxisProperties';
+  proto.visualization.DeleteMeshes.displayName = 'proto.visualization.DeleteMeshes';
 }
+/**
+ * List of repeated fields within this message type.
+ * @private {!Array<number>}
+ * @const
+ */
+proto.visualization.DeleteMeshes.repeatedFields_ = [1];
+
 
 
 if (jspb.Message.GENERATE_TO_OBJECT) {
@@ -7115,8 +11830,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     for transitional soy proto support: http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.visualization.Set2DAxisProperties.prototype.toObject = function(opt_includeInstance) {
-  return proto.visualization.Set2DAxisProperties.toObject(opt_includeInstance, this);
+proto.visualization.DeleteMeshes.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.DeleteMeshes.toObject(opt_includeInstance, this);
 };
 
 
@@ -7125,19 +11840,13 @@ proto.visualization.Set2DAxisProperties.prototype.toObject = function(opt_includ
  * @param {boolean|undefined} includeInstance Whether to include the JSPB
  *     instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.visualization.Set2DAxisProperties} msg The msg instance to transform.
+ * @param {!proto.visualization.DeleteMeshes} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.Set2DAxisProperties.toObject = function(includeInstance, msg) {
+proto.visualization.DeleteMeshes.toObject = function(includeInstance, msg) {
   var f, obj = {
-    xLabel: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    yLabel: jspb.Message.getFieldWithDefault(msg, 2, ""),
-    xMin: +jspb.Message.getFieldWithDefault(msg, 3, 0.0),
-    xMax: +jspb.Message.getFieldWithDefault(msg, 4, 0.0),
-    yMin: +jspb.Message.getFieldWithDefault(msg, 5, 0.0),
-    yMax: +jspb.Message.getFieldWithDefault(msg, 6, 0.0),
-    autoScale: jspb.Message.getFieldWithDefault(msg, 7, false)
+    meshIdsList: (f = jspb.Message.getRepeatedField(msg, 1)) == null ? undefined : f
   };
 
   if (includeInstance) {
@@ -7151,23 +11860,23 @@ proto.visualization.Set2DAxisProperties.toObject = function(includeInstance, msg
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.visualization.Set2DAxisProperties}
+ * @return {!proto.visualization.DeleteMeshes}
  */
-proto.visualization.Set2DAxisProperties.deserializeBinary = function(bytes) {
+proto.visualization.DeleteMeshes.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.visualization.Set2DAxisProperties;
-  return proto.visualization.Set2DAxisProperties.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.visualization.DeleteMeshes;
+  return proto.visualization.DeleteMeshes.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.visualization.Set2DAxisProperties} msg The message object to deserialize into.
+ * @param {!proto.visualization.DeleteMeshes} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.visualization.Set2DAxisProperties}
+ * @return {!proto.visualization.DeleteMeshes}
  */
-proto.visualization.Set2DAxisProperties.deserializeBinaryFromReader = function(msg, reader) {
+proto.visualization.DeleteMeshes.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -7175,32 +11884,8 @@ proto.visualization.Set2DAxisProperties.deserializeBinaryFromReader = function(m
     var field = reader.getFieldNumber();
     switch (field) {
     case 1:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setXLabel(value);
-      break;
-    case 2:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setYLabel(value);
-      break;
-    case 3:
-      var value = /** @type {number} */ (reader.readFloat());
-      msg.setXMin(value);
-      break;
-    case 4:
-      var value = /** @type {number} */ (reader.readFloat());
-      msg.setXMax(value);
-      break;
-    case 5:
-      var value = /** @type {number} */ (reader.readFloat());
-      msg.setYMin(value);
-      break;
-    case 6:
-      var value = /** @type {number} */ (reader.readFloat());
-      msg.setYMax(value);
-      break;
-    case 7:
-      var value = /** @type {boolean} */ (reader.readBool());
-      msg.setAutoScale(value);
+      var value = /** @type {!Array<number>} */ (reader.readPackedUint32());
+      msg.setMeshIdsList(value);
       break;
     default:
       reader.skipField();
@@ -7215,9 +11900,9 @@ proto.visualization.Set2DAxisProperties.deserializeBinaryFromReader = function(m
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.visualization.Set2DAxisProperties.prototype.serializeBinary = function() {
+proto.visualization.DeleteMeshes.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.visualization.Set2DAxisProperties.serializeBinaryToWriter(this, writer);
+  proto.visualization.DeleteMeshes.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -7225,168 +11910,48 @@ proto.visualization.Set2DAxisProperties.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.visualization.Set2DAxisProperties} message
+ * @param {!proto.visualization.DeleteMeshes} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.Set2DAxisProperties.serializeBinaryToWriter = function(message, writer) {
+proto.visualization.DeleteMeshes.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getXLabel();
+  f = message.getMeshIdsList();
   if (f.length > 0) {
-    writer.writeString(
+    writer.writePackedUint32(
       1,
       f
     );
   }
-  f = message.getYLabel();
-  if (f.length > 0) {
-    writer.writeString(
-      2,
-      f
-    );
-  }
-  f = message.getXMin();
-  if (f !== 0.0) {
-    writer.writeFloat(
-      3,
-      f
-    );
-  }
-  f = message.getXMax();
-  if (f !== 0.0) {
-    writer.writeFloat(
-      4,
-      f
-    );
-  }
-  f = message.getYMin();
-  if (f !== 0.0) {
-    writer.writeFloat(
-      5,
-      f
-    );
-  }
-  f = message.getYMax();
-  if (f !== 0.0) {
-    writer.writeFloat(
-      6,
-      f
-    );
-  }
-  f = message.getAutoScale();
-  if (f) {
-    writer.writeBool(
-      7,
-      f
-    );
-  }
-};
-
-
-/**
- * optional string x_label = 1;
- * @return {string}
- */
-proto.visualization.Set2DAxisProperties.prototype.getXLabel = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
-};
-
-
-/** @param {string} value */
-proto.visualization.Set2DAxisProperties.prototype.setXLabel = function(value) {
-  jspb.Message.setProto3StringField(this, 1, value);
-};
-
-
-/**
- * optional string y_label = 2;
- * @return {string}
- */
-proto.visualization.Set2DAxisProperties.prototype.getYLabel = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
-};
-
-
-/** @param {string} value */
-proto.visualization.Set2DAxisProperties.prototype.setYLabel = function(value) {
-  jspb.Message.setProto3StringField(this, 2, value);
-};
-
-
-/**
- * optional float x_min = 3;
- * @return {number}
- */
-proto.visualization.Set2DAxisProperties.prototype.getXMin = function() {
-  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 3, 0.0));
-};
-
-
-/** @param {number} value */
-proto.visualization.Set2DAxisProperties.prototype.setXMin = function(value) {
-  jspb.Message.setProto3FloatField(this, 3, value);
-};
-
-
-/**
- * optional float x_max = 4;
- * @return {number}
- */
-proto.visualization.Set2DAxisProperties.prototype.getXMax = function() {
-  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 4, 0.0));
-};
-
-
-/** @param {number} value */
-proto.visualization.Set2DAxisProperties.prototype.setXMax = function(value) {
-  jspb.Message.setProto3FloatField(this, 4, value);
 };
 
 
 /**
- * optional float y_min = 5;
- * @return {number}
- */
-proto.visualization.Set2DAxisProperties.prototype.getYMin = function() {
-  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 5, 0.0));
-};
-
-
-/** @param {number} value */
-proto.visualization.Set2DAxisProperties.prototype.setYMin = function(value) {
-  jspb.Message.setProto3FloatField(this, 5, value);
-};
-
-
-/**
- * optional float y_max = 6;
- * @return {number}
+ * repeated uint32 mesh_ids = 1;
+ * @return {!Array<number>}
  */
-proto.visualization.Set2DAxisProperties.prototype.getYMax = function() {
-  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 6, 0.0));
+proto.visualization.DeleteMeshes.prototype.getMeshIdsList = function() {
+  return /** @type {!Array<number>} */ (jspb.Message.getRepeatedField(this, 1));
 };
 
 
-/** @param {number} value */
-proto.visualization.Set2DAxisProperties.prototype.setYMax = function(value) {
-  jspb.Message.setProto3FloatField(this, 6, value);
+/** @param {!Array<number>} value */
+proto.visualization.DeleteMeshes.prototype.setMeshIdsList = function(value) {
+  jspb.Message.setField(this, 1, value || []);
 };
 
 
 /**
- * optional bool auto_scale = 7;
- * Note that Boolean fields may be set to 0/1 when serialized from a Java server.
- * You should avoid comparisons like {@code val === true/false} in those cases.
- * @return {boolean}
+ * @param {!number} value
+ * @param {number=} opt_index
  */
-proto.visualization.Set2DAxisProperties.prototype.getAutoScale = function() {
-  return /** @type {boolean} */ (jspb.Message.getFieldWithDefault(this, 7, false));
+proto.visualization.DeleteMeshes.prototype.addMeshIds = function(value, opt_index) {
+  jspb.Message.addToRepeatedField(this, 1, value, opt_index);
 };
 
 
-/** @param {boolean} value */
-proto.visualization.Set2DAxisProperties.prototype.setAutoScale = function(value) {
-  jspb.Message.setProto3BooleanField(this, 7, value);
+proto.visualization.DeleteMeshes.prototype.clearMeshIdsList = function() {
+  this.setMeshIdsList([]);
 };
 
 
@@ -7401,12 +11966,12 @@ proto.visualization.Set2DAxisProperties.prototype.setAutoScale = function(value)
  * @extends {jspb.Message}
  * @constructor
  */
-proto.visualization.CreateWindow = function(opt_data) {
+proto.visualization.DefineMaterial = function(opt_data) {
   jspb.Message.initialize(this, opt_data, 0, -1, null, null);
 };
-goog.inherits(proto.visualization.CreateWindow, jspb.Message);
+goog.inherits(proto.visualization.DefineMaterial, jspb.Message);
 if (goog.DEBUG && !COMPILED) {
-  proto.visualization.CreateWindow.displayName = 'proto.visualization.CreateWindow';
+  proto.visualization.DefineMaterial.displayName = 'proto.visualization.DefineMaterial';
 }
 
 
@@ -7421,8 +11986,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     for transitional soy proto support: http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.visualization.CreateWindow.prototype.toObject = function(opt_includeInstance) {
-  return proto.visualization.CreateWindow.toObject(opt_includeInstance, this);
+proto.visualization.DefineMaterial.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.DefineMaterial.toObject(opt_includeInstance, this);
 };
 
 
@@ -7431,14 +11996,14 @@ proto.visualization.CreateWindow.prototype.toObject = function(opt_includeInstan
  * @param {boolean|undefined} includeInstance Whether to include the JSPB
  *     instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.visualization.CreateWindow} msg The msg instance to transform.
+ * @param {!proto.visualization.DefineMaterial} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.CreateWindow.toObject = function(includeInstance, msg) {
+proto.visualization.DefineMaterial.toObject = function(includeInstance, msg) {
   var f, obj = {
-    windowId: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    windowName: jspb.Message.getFieldWithDefault(msg, 2, "")
+    materialId: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    material: (f = msg.getMaterial()) && proto.visualization.Material.toObject(includeInstance, f)
   };
 
   if (includeInstance) {
@@ -7452,23 +12017,23 @@ proto.visualization.CreateWindow.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.visualization.CreateWindow}
+ * @return {!proto.visualization.DefineMaterial}
  */
-proto.visualization.CreateWindow.deserializeBinary = function(bytes) {
+proto.visualization.DefineMaterial.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.visualization.CreateWindow;
-  return proto.visualization.CreateWindow.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.visualization.DefineMaterial;
+  return proto.visualization.DefineMaterial.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.visualization.CreateWindow} msg The message object to deserialize into.
+ * @param {!proto.visualization.DefineMaterial} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.visualization.CreateWindow}
+ * @return {!proto.visualization.DefineMaterial}
  */
-proto.visualization.CreateWindow.deserializeBinaryFromReader = function(msg, reader) {
+proto.visualization.DefineMaterial.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -7476,12 +12041,13 @@ proto.visualization.CreateWindow.deserializeBinaryFromReader = function(msg, rea
     var field = reader.getFieldNumber();
     switch (field) {
     case 1:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setWindowId(value);
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setMaterialId(value);
       break;
     case 2:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setWindowName(value);
+      var value = new proto.visualization.Material;
+      reader.readMessage(value,proto.visualization.Material.deserializeBinaryFromReader);
+      msg.setMaterial(value);
       break;
     default:
       reader.skipField();
@@ -7496,9 +12062,9 @@ proto.visualization.CreateWindow.deserializeBinaryFromReader = function(msg, rea
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.visualization.CreateWindow.prototype.serializeBinary = function() {
+proto.visualization.DefineMaterial.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.visualization.CreateWindow.serializeBinaryToWriter(this, writer);
+  proto.visualization.DefineMaterial.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -7506,56 +12072,72 @@ proto.visualization.CreateWindow.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.visualization.CreateWindow} message
+ * @param {!proto.visualization.DefineMaterial} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.CreateWindow.serializeBinaryToWriter = function(message, writer) {
+proto.visualization.DefineMaterial.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getWindowId();
-  if (f.length > 0) {
-    writer.writeString(
+  f = message.getMaterialId();
+  if (f !== 0) {
+    writer.writeUint32(
       1,
       f
     );
   }
-  f = message.getWindowName();
-  if (f.length > 0) {
-    writer.writeString(
+  f = message.getMaterial();
+  if (f != null) {
+    writer.writeMessage(
       2,
-      f
+      f,
+      proto.visualization.Material.serializeBinaryToWriter
     );
   }
 };
 
 
 /**
- * optional string window_id = 1;
- * @return {string}
+ * optional uint32 material_id = 1;
+ * @return {number}
+ */
+proto.visualization.DefineMaterial.prototype.getMaterialId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/** @param {number} value */
+proto.visualization.DefineMaterial.prototype.setMaterialId = function(value) {
+  jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+/**
+ * optional Material material = 2;
+ * @return {?proto.visualization.Material}
  */
-proto.visualization.CreateWindow.prototype.getWindowId = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+proto.visualization.DefineMaterial.prototype.getMaterial = function() {
+  return /** @type{?proto.visualization.Material} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.Material, 2));
 };
 
 
-/** @param {string} value */
-proto.visualization.CreateWindow.prototype.setWindowId = function(value) {
-  jspb.Message.setProto3StringField(this, 1, value);
+/** @param {?proto.visualization.Material|undefined} value */
+proto.visualization.DefineMaterial.prototype.setMaterial = function(value) {
+  jspb.Message.setWrapperField(this, 2, value);
 };
 
 
-/**
- * optional string window_name = 2;
- * @return {string}
- */
-proto.visualization.CreateWindow.prototype.getWindowName = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+proto.visualization.DefineMaterial.prototype.clearMaterial = function() {
+  this.setMaterial(undefined);
 };
 
 
-/** @param {string} value */
-proto.visualization.CreateWindow.prototype.setWindowName = function(value) {
-  jspb.Message.setProto3StringField(this, 2, value);
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.DefineMaterial.prototype.hasMaterial = function() {
+  return jspb.Message.getField(this, 2) != null;
 };
 
 
@@ -7570,13 +12152,20 @@ proto.visualization.CreateWindow.prototype.setWindowName = function(value) {
  * @extends {jspb.Message}
  * @constructor
  */
-proto.visualization.DeleteWindow = function(opt_data) {
-  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+proto.visualization.DeleteMaterials = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, proto.visualization.DeleteMaterials.repeatedFields_, null);
 };
-goog.inherits(proto.visualization.DeleteWindow, jspb.Message);
+goog.inherits(proto.visualization.DeleteMaterials, jspb.Message);
 if (goog.DEBUG && !COMPILED) {
-  proto.visualization.DeleteWindow.displayName = 'proto.visualization.DeleteWindow';
+  proto.visualization.DeleteMaterials.displayName = 'proto.visualization.DeleteMaterials';
 }
+/**
+ * List of repeated fields within this message type.
+ * @private {!Array<number>}
+ * @const
+ */
+proto.visualization.DeleteMaterials.repeatedFields_ = [1];
+
 
 
 if (jspb.Message.GENERATE_TO_OBJECT) {
@@ -7590,8 +12179,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     for transitional soy proto support: http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.visualization.DeleteWindow.prototype.toObject = function(opt_includeInstance) {
-  return proto.visualization.DeleteWindow.toObject(opt_includeInstance, this);
+proto.visualization.DeleteMaterials.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.DeleteMaterials.toObject(opt_includeInstance, this);
 };
 
 
@@ -7600,13 +12189,13 @@ proto.visualization.DeleteWindow.prototype.toObject = function(opt_includeInstan
  * @param {boolean|undefined} includeInstance Whether to include the JSPB
  *     instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.visualization.DeleteWindow} msg The msg instance to transform.
+ * @param {!proto.visualization.DeleteMaterials} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.DeleteWindow.toObject = function(includeInstance, msg) {
+proto.visualization.DeleteMaterials.toObject = function(includeInstance, msg) {
   var f, obj = {
-    windowId: jspb.Message.getFieldWithDefault(msg, 1, "")
+    materialIdsList: (f = jspb.Message.getRepeatedField(msg, 1)) == null ? undefined : f
   };
 
   if (includeInstance) {
@@ -7620,23 +12209,23 @@ proto.visualization.DeleteWindow.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.visualization.DeleteWindow}
+ * @return {!proto.visualization.DeleteMaterials}
  */
-proto.visualization.DeleteWindow.deserializeBinary = function(bytes) {
+proto.visualization.DeleteMaterials.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.visualization.DeleteWindow;
-  return proto.visualization.DeleteWindow.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.visualization.DeleteMaterials;
+  return proto.visualization.DeleteMaterials.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.visualization.DeleteWindow} msg The message object to deserialize into.
+ * @param {!proto.visualization.DeleteMaterials} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.visualization.DeleteWindow}
+ * @return {!proto.visualization.DeleteMaterials}
  */
-proto.visualization.DeleteWindow.deserializeBinaryFromReader = function(msg, reader) {
+proto.visualization.DeleteMaterials.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -7644,8 +12233,8 @@ proto.visualization.DeleteWindow.deserializeBinaryFromReader = function(msg, rea
     var field = reader.getFieldNumber();
     switch (field) {
     case 1:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setWindowId(value);
+      var value = /** @type {!Array<number>} */ (reader.readPackedUint32());
+      msg.setMaterialIdsList(value);
       break;
     default:
       reader.skipField();
@@ -7660,9 +12249,9 @@ proto.visualization.DeleteWindow.deserializeBinaryFromReader = function(msg, rea
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.visualization.DeleteWindow.prototype.serializeBinary = function() {
+proto.visualization.DeleteMaterials.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.visualization.DeleteWindow.serializeBinaryToWriter(this, writer);
+  proto.visualization.DeleteMaterials.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -7670,15 +12259,15 @@ proto.visualization.DeleteWindow.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.visualization.DeleteWindow} message
+ * @param {!proto.visualization.DeleteMaterials} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.visualization.DeleteWindow.serializeBinaryToWriter = function(message, writer) {
+proto.visualization.DeleteMaterials.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getWindowId();
+  f = message.getMaterialIdsList();
   if (f.length > 0) {
-    writer.writeString(
+    writer.writePackedUint32(
       1,
       f
     );
@@ -7687,17 +12276,31 @@ proto.visualization.DeleteWindow.serializeBinaryToWriter = function(message, wri
 
 
 /**
- * optional string window_id = 1;
- * @return {string}
+ * repeated uint32 material_ids = 1;
+ * @return {!Array<number>}
  */
-proto.visualization.DeleteWindow.prototype.getWindowId = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+proto.visualization.DeleteMaterials.prototype.getMaterialIdsList = function() {
+  return /** @type {!Array<number>} */ (jspb.Message.getRepeatedField(this, 1));
 };
 
 
-/** @param {string} value */
-proto.visualization.DeleteWindow.prototype.setWindowId = function(value) {
-  jspb.Message.setProto3StringField(this, 1, value);
+/** @param {!Array<number>} value */
+proto.visualization.DeleteMaterials.prototype.setMaterialIdsList = function(value) {
+  jspb.Message.setField(this, 1, value || []);
+};
+
+
+/**
+ * @param {!number} value
+ * @param {number=} opt_index
+ */
+proto.visualization.DeleteMaterials.prototype.addMaterialIds = function(value, opt_index) {
+  jspb.Message.addToRepeatedField(this, 1, value, opt_index);
+};
+
+
+proto.visualization.DeleteMaterials.prototype.clearMaterialIdsList = function() {
+  this.setMaterialIdsList([]);
 };
 
 
@@ -7727,7 +12330,7 @@ if (goog.DEBUG && !COMPILED) {
  * @private {!Array<!Array<number>>}
  * @const
  */
-proto.visualization.Command2D.oneofGroups_ = [[1,2,3,4,10,11,12,13,14,15,16]];
+proto.visualization.Command2D.oneofGroups_ = [[1,2,3,4,5,6,10,11,12,13,14,15,16,19,20]];
 
 /**
  * @enum {number}
@@ -7738,13 +12341,17 @@ proto.visualization.Command2D.CommandTypeCase = {
   UPDATE_OBJECT_GEOMETRY: 2,
   UPDATE_OBJECT_PROPERTIES: 3,
   DELETE_OBJECT: 4,
+  DELETE_OBJECTS: 5,
+  CLEAR_WINDOW: 6,
   SET_GRID_VISIBLE: 10,
   SET_AXES_VISIBLE: 11,
   SET_TITLE: 12,
   SET_LEGEND: 13,
   SET_AXIS_PROPERTIES: 14,
   CREATE_WINDOW: 15,
-  DELETE_WINDOW: 16
+  DELETE_WINDOW: 16,
+  DEFINE_MATERIAL: 19,
+  DELETE_MATERIALS: 20
 };
 
 /**
@@ -7787,13 +12394,17 @@ proto.visualization.Command2D.toObject = function(includeInstance, msg) {
     updateObjectGeometry: (f = msg.getUpdateObjectGeometry()) && proto.visualization.Update2DObjectGeometry.toObject(includeInstance, f),
     updateObjectProperties: (f = msg.getUpdateObjectProperties()) && proto.visualization.UpdateObjectProperties.toObject(includeInstance, f),
     deleteObject: (f = msg.getDeleteObject()) && proto.visualization.DeleteObject.toObject(includeInstance, f),
+    deleteObjects: (f = msg.getDeleteObjects()) && proto.visualization.DeleteObjects.toObject(includeInstance, f),
+    clearWindow: (f = msg.getClearWindow()) && proto.visualization.ClearWindow.toObject(includeInstance, f),
     setGridVisible: (f = msg.getSetGridVisible()) && proto.visualization.SetGridVisible.toObject(includeInstance, f),
     setAxesVisible: (f = msg.getSetAxesVisible()) && proto.visualization.SetAxesVisible.toObject(includeInstance, f),
     setTitle: (f = msg.getSetTitle()) && proto.visualization.SetTitle.toObject(includeInstance, f),
     setLegend: (f = msg.getSetLegend()) && proto.visualization.SetLegend.toObject(includeInstance, f),
     setAxisProperties: (f = msg.getSetAxisProperties()) && proto.visualization.Set2DAxisProperties.toObject(includeInstance, f),
     createWindow: (f = msg.getCreateWindow()) && proto.visualization.CreateWindow.toObject(includeInstance, f),
-    deleteWindow: (f = msg.getDeleteWindow()) && proto.visualization.DeleteWindow.toObject(includeInstance, f)
+    deleteWindow: (f = msg.getDeleteWindow()) && proto.visualization.DeleteWindow.toObject(includeInstance, f),
+    defineMaterial: (f = msg.getDefineMaterial()) && proto.visualization.DefineMaterial.toObject(includeInstance, f),
+    deleteMaterials: (f = msg.getDeleteMaterials()) && proto.visualization.DeleteMaterials.toObject(includeInstance, f)
   };
 
   if (includeInstance) {
@@ -7850,6 +12461,16 @@ proto.visualization.Command2D.deserializeBinaryFromReader = function(msg, reader
       reader.readMessage(value,proto.visualization.DeleteObject.deserializeBinaryFromReader);
       msg.setDeleteObject(value);
       break;
+    case 5:
+      var value = new proto.visualization.DeleteObjects;
+      reader.readMessage(value,proto.visualization.DeleteObjects.deserializeBinaryFromReader);
+      msg.setDeleteObjects(value);
+      break;
+    case 6:
+      var value = new proto.visualization.ClearWindow;
+      reader.readMessage(value,proto.visualization.ClearWindow.deserializeBinaryFromReader);
+      msg.setClearWindow(value);
+      break;
     case 10:
       var value = new proto.visualization.SetGridVisible;
       reader.readMessage(value,proto.visualization.SetGridVisible.deserializeBinaryFromReader);
@@ -7885,6 +12506,16 @@ proto.visualization.Command2D.deserializeBinaryFromReader = function(msg, reader
       reader.readMessage(value,proto.visualization.DeleteWindow.deserializeBinaryFromReader);
       msg.setDeleteWindow(value);
       break;
+    case 19:
+      var value = new proto.visualization.DefineMaterial;
+      reader.readMessage(value,proto.visualization.DefineMaterial.deserializeBinaryFromReader);
+      msg.setDefineMaterial(value);
+      break;
+    case 20:
+      var value = new proto.visualization.DeleteMaterials;
+      reader.readMessage(value,proto.visualization.DeleteMaterials.deserializeBinaryFromReader);
+      msg.setDeleteMaterials(value);
+      break;
     default:
       reader.skipField();
       break;
@@ -7946,6 +12577,22 @@ proto.visualization.Command2D.serializeBinaryToWriter = function(message, writer
       proto.visualization.DeleteObject.serializeBinaryToWriter
     );
   }
+  f = message.getDeleteObjects();
+  if (f != null) {
+    writer.writeMessage(
+      5,
+      f,
+      proto.visualization.DeleteObjects.serializeBinaryToWriter
+    );
+  }
+  f = message.getClearWindow();
+  if (f != null) {
+    writer.writeMessage(
+      6,
+      f,
+      proto.visualization.ClearWindow.serializeBinaryToWriter
+    );
+  }
   f = message.getSetGridVisible();
   if (f != null) {
     writer.writeMessage(
@@ -8002,6 +12649,22 @@ proto.visualization.Command2D.serializeBinaryToWriter = function(message, writer
       proto.visualization.DeleteWindow.serializeBinaryToWriter
     );
   }
+  f = message.getDefineMaterial();
+  if (f != null) {
+    writer.writeMessage(
+      19,
+      f,
+      proto.visualization.DefineMaterial.serializeBinaryToWriter
+    );
+  }
+  f = message.getDeleteMaterials();
+  if (f != null) {
+    writer.writeMessage(
+      20,
+      f,
+      proto.visualization.DeleteMaterials.serializeBinaryToWriter
+    );
+  }
 };
 
 
@@ -8125,6 +12788,66 @@ proto.visualization.Command2D.prototype.hasDeleteObject = function() {
 };
 
 
+/**
+ * optional DeleteObjects delete_objects = 5;
+ * @return {?proto.visualization.DeleteObjects}
+ */
+proto.visualization.Command2D.prototype.getDeleteObjects = function() {
+  return /** @type{?proto.visualization.DeleteObjects} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.DeleteObjects, 5));
+};
+
+
+/** @param {?proto.visualization.DeleteObjects|undefined} value */
+proto.visualization.Command2D.prototype.setDeleteObjects = function(value) {
+  jspb.Message.setOneofWrapperField(this, 5, proto.visualization.Command2D.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Command2D.prototype.clearDeleteObjects = function() {
+  this.setDeleteObjects(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Command2D.prototype.hasDeleteObjects = function() {
+  return jspb.Message.getField(this, 5) != null;
+};
+
+
+/**
+ * optional ClearWindow clear_window = 6;
+ * @return {?proto.visualization.ClearWindow}
+ */
+proto.visualization.Command2D.prototype.getClearWindow = function() {
+  return /** @type{?proto.visualization.ClearWindow} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.ClearWindow, 6));
+};
+
+
+/** @param {?proto.visualization.ClearWindow|undefined} value */
+proto.visualization.Command2D.prototype.setClearWindow = function(value) {
+  jspb.Message.setOneofWrapperField(this, 6, proto.visualization.Command2D.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Command2D.prototype.clearClearWindow = function() {
+  this.setClearWindow(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Command2D.prototype.hasClearWindow = function() {
+  return jspb.Message.getField(this, 6) != null;
+};
+
+
 /**
  * optional SetGridVisible set_grid_visible = 10;
  * @return {?proto.visualization.SetGridVisible}
@@ -8335,6 +13058,66 @@ proto.visualization.Command2D.prototype.hasDeleteWindow = function() {
 };
 
 
+/**
+ * optional DefineMaterial define_material = 19;
+ * @return {?proto.visualization.DefineMaterial}
+ */
+proto.visualization.Command2D.prototype.getDefineMaterial = function() {
+  return /** @type{?proto.visualization.DefineMaterial} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.DefineMaterial, 19));
+};
+
+
+/** @param {?proto.visualization.DefineMaterial|undefined} value */
+proto.visualization.Command2D.prototype.setDefineMaterial = function(value) {
+  jspb.Message.setOneofWrapperField(this, 19, proto.visualization.Command2D.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Command2D.prototype.clearDefineMaterial = function() {
+  this.setDefineMaterial(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Command2D.prototype.hasDefineMaterial = function() {
+  return jspb.Message.getField(this, 19) != null;
+};
+
+
+/**
+ * optional DeleteMaterials delete_materials = 20;
+ * @return {?proto.visualization.DeleteMaterials}
+ */
+proto.visualization.Command2D.prototype.getDeleteMaterials = function() {
+  return /** @type{?proto.visualization.DeleteMaterials} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.DeleteMaterials, 20));
+};
+
+
+/** @param {?proto.visualization.DeleteMaterials|undefined} value */
+proto.visualization.Command2D.prototype.setDeleteMaterials = function(value) {
+  jspb.Message.setOneofWrapperField(this, 20, proto.visualization.Command2D.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Command2D.prototype.clearDeleteMaterials = function() {
+  this.setDeleteMaterials(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Command2D.prototype.hasDeleteMaterials = function() {
+  return jspb.Message.getField(this, 20) != null;
+};
+
+
 
 /**
  * Generated by JsPbCodeGenerator.
@@ -8361,7 +13144,7 @@ if (goog.DEBUG && !COMPILED) {
  * @private {!Array<!Array<number>>}
  * @const
  */
-proto.visualization.Command3D.oneofGroups_ = [[1,2,3,4,10,11,12,13,15,16]];
+proto.visualization.Command3D.oneofGroups_ = [[1,2,3,4,5,6,10,11,12,13,15,16,17,18,19,20]];
 
 /**
  * @enum {number}
@@ -8372,12 +13155,18 @@ proto.visualization.Command3D.CommandTypeCase = {
   UPDATE_OBJECT_GEOMETRY: 2,
   UPDATE_OBJECT_PROPERTIES: 3,
   DELETE_OBJECT: 4,
+  DELETE_OBJECTS: 5,
+  CLEAR_WINDOW: 6,
   SET_GRID_VISIBLE: 10,
   SET_AXES_VISIBLE: 11,
   SET_TITLE: 12,
   SET_LEGEND: 13,
   CREATE_WINDOW: 15,
-  DELETE_WINDOW: 16
+  DELETE_WINDOW: 16,
+  DEFINE_MESH: 17,
+  DELETE_MESHES: 18,
+  DEFINE_MATERIAL: 19,
+  DELETE_MATERIALS: 20
 };
 
 /**
@@ -8420,12 +13209,18 @@ proto.visualization.Command3D.toObject = function(includeInstance, msg) {
     updateObjectGeometry: (f = msg.getUpdateObjectGeometry()) && proto.visualization.Update3DObjectGeometry.toObject(includeInstance, f),
     updateObjectProperties: (f = msg.getUpdateObjectProperties()) && proto.visualization.UpdateObjectProperties.toObject(includeInstance, f),
     deleteObject: (f = msg.getDeleteObject()) && proto.visualization.DeleteObject.toObject(includeInstance, f),
+    deleteObjects: (f = msg.getDeleteObjects()) && proto.visualization.DeleteObjects.toObject(includeInstance, f),
+    clearWindow: (f = msg.getClearWindow()) && proto.visualization.ClearWindow.toObject(includeInstance, f),
     setGridVisible: (f = msg.getSetGridVisible()) && proto.visualization.SetGridVisible.toObject(includeInstance, f),
     setAxesVisible: (f = msg.getSetAxesVisible()) && proto.visualization.SetAxesVisible.toObject(includeInstance, f),
     setTitle: (f = msg.getSetTitle()) && proto.visualization.SetTitle.toObject(includeInstance, f),
     setLegend: (f = msg.getSetLegend()) && proto.visualization.SetLegend.toObject(includeInstance, f),
     createWindow: (f = msg.getCreateWindow()) && proto.visualization.CreateWindow.toObject(includeInstance, f),
-    deleteWindow: (f = msg.getDeleteWindow()) && proto.visualization.DeleteWindow.toObject(includeInstance, f)
+    deleteWindow: (f = msg.getDeleteWindow()) && proto.visualization.DeleteWindow.toObject(includeInstance, f),
+    defineMesh: (f = msg.getDefineMesh()) && proto.visualization.DefineMesh.toObject(includeInstance, f),
+    deleteMeshes: (f = msg.getDeleteMeshes()) && proto.visualization.DeleteMeshes.toObject(includeInstance, f),
+    defineMaterial: (f = msg.getDefineMaterial()) && proto.visualization.DefineMaterial.toObject(includeInstance, f),
+    deleteMaterials: (f = msg.getDeleteMaterials()) && proto.visualization.DeleteMaterials.toObject(includeInstance, f)
   };
 
   if (includeInstance) {
@@ -8482,6 +13277,16 @@ proto.visualization.Command3D.deserializeBinaryFromReader = function(msg, reader
       reader.readMessage(value,proto.visualization.DeleteObject.deserializeBinaryFromReader);
       msg.setDeleteObject(value);
       break;
+    case 5:
+      var value = new proto.visualization.DeleteObjects;
+      reader.readMessage(value,proto.visualization.DeleteObjects.deserializeBinaryFromReader);
+      msg.setDeleteObjects(value);
+      break;
+    case 6:
+      var value = new proto.visualization.ClearWindow;
+      reader.readMessage(value,proto.visualization.ClearWindow.deserializeBinaryFromReader);
+      msg.setClearWindow(value);
+      break;
     case 10:
       var value = new proto.visualization.SetGridVisible;
       reader.readMessage(value,proto.visualization.SetGridVisible.deserializeBinaryFromReader);
@@ -8512,6 +13317,26 @@ proto.visualization.Command3D.deserializeBinaryFromReader = function(msg, reader
       reader.readMessage(value,proto.visualization.DeleteWindow.deserializeBinaryFromReader);
       msg.setDeleteWindow(value);
       break;
+    case 17:
+      var value = new proto.visualization.DefineMesh;
+      reader.readMessage(value,proto.visualization.DefineMesh.deserializeBinaryFromReader);
+      msg.setDefineMesh(value);
+      break;
+    case 18:
+      var value = new proto.visualization.DeleteMeshes;
+      reader.readMessage(value,proto.visualization.DeleteMeshes.deserializeBinaryFromReader);
+      msg.setDeleteMeshes(value);
+      break;
+    case 19:
+      var value = new proto.visualization.DefineMaterial;
+      reader.readMessage(value,proto.visualization.DefineMaterial.deserializeBinaryFromReader);
+      msg.setDefineMaterial(value);
+      break;
+    case 20:
+      var value = new proto.visualization.DeleteMaterials;
+      reader.readMessage(value,proto.visualization.DeleteMaterials.deserializeBinaryFromReader);
+      msg.setDeleteMaterials(value);
+      break;
     default:
       reader.skipField();
       break;
@@ -8573,6 +13398,22 @@ proto.visualization.Command3D.serializeBinaryToWriter = function(message, writer
       proto.visualization.DeleteObject.serializeBinaryToWriter
     );
   }
+  f = message.getDeleteObjects();
+  if (f != null) {
+    writer.writeMessage(
+      5,
+      f,
+      proto.visualization.DeleteObjects.serializeBinaryToWriter
+    );
+  }
+  f = message.getClearWindow();
+  if (f != null) {
+    writer.writeMessage(
+      6,
+      f,
+      proto.visualization.ClearWindow.serializeBinaryToWriter
+    );
+  }
   f = message.getSetGridVisible();
   if (f != null) {
     writer.writeMessage(
@@ -8621,6 +13462,38 @@ proto.visualization.Command3D.serializeBinaryToWriter = function(message, writer
       proto.visualization.DeleteWindow.serializeBinaryToWriter
     );
   }
+  f = message.getDefineMesh();
+  if (f != null) {
+    writer.writeMessage(
+      17,
+      f,
+      proto.visualization.DefineMesh.serializeBinaryToWriter
+    );
+  }
+  f = message.getDeleteMeshes();
+  if (f != null) {
+    writer.writeMessage(
+      18,
+      f,
+      proto.visualization.DeleteMeshes.serializeBinaryToWriter
+    );
+  }
+  f = message.getDefineMaterial();
+  if (f != null) {
+    writer.writeMessage(
+      19,
+      f,
+      proto.visualization.DefineMaterial.serializeBinaryToWriter
+    );
+  }
+  f = message.getDeleteMaterials();
+  if (f != null) {
+    writer.writeMessage(
+      20,
+      f,
+      proto.visualization.DeleteMaterials.serializeBinaryToWriter
+    );
+  }
 };
 
 
@@ -8739,8 +13612,68 @@ proto.visualization.Command3D.prototype.clearDeleteObject = function() {
  * Returns whether this field is set.
  * @return {!boolean}
  */
-proto.visualization.Command3D.prototype.hasDeleteObject = function() {
-  return jspb.Message.getField(this, 4) != null;
+proto.visualization.Command3D.prototype.hasDeleteObject = function() {
+  return jspb.Message.getField(this, 4) != null;
+};
+
+
+/**
+ * optional DeleteObjects delete_objects = 5;
+ * @return {?proto.visualization.DeleteObjects}
+ */
+proto.visualization.Command3D.prototype.getDeleteObjects = function() {
+  return /** @type{?proto.visualization.DeleteObjects} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.DeleteObjects, 5));
+};
+
+
+/** @param {?proto.visualization.DeleteObjects|undefined} value */
+proto.visualization.Command3D.prototype.setDeleteObjects = function(value) {
+  jspb.Message.setOneofWrapperField(this, 5, proto.visualization.Command3D.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Command3D.prototype.clearDeleteObjects = function() {
+  this.setDeleteObjects(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Command3D.prototype.hasDeleteObjects = function() {
+  return jspb.Message.getField(this, 5) != null;
+};
+
+
+/**
+ * optional ClearWindow clear_window = 6;
+ * @return {?proto.visualization.ClearWindow}
+ */
+proto.visualization.Command3D.prototype.getClearWindow = function() {
+  return /** @type{?proto.visualization.ClearWindow} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.ClearWindow, 6));
+};
+
+
+/** @param {?proto.visualization.ClearWindow|undefined} value */
+proto.visualization.Command3D.prototype.setClearWindow = function(value) {
+  jspb.Message.setOneofWrapperField(this, 6, proto.visualization.Command3D.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Command3D.prototype.clearClearWindow = function() {
+  this.setClearWindow(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Command3D.prototype.hasClearWindow = function() {
+  return jspb.Message.getField(this, 6) != null;
 };
 
 
@@ -8924,6 +13857,126 @@ proto.visualization.Command3D.prototype.hasDeleteWindow = function() {
 };
 
 
+/**
+ * optional DefineMesh define_mesh = 17;
+ * @return {?proto.visualization.DefineMesh}
+ */
+proto.visualization.Command3D.prototype.getDefineMesh = function() {
+  return /** @type{?proto.visualization.DefineMesh} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.DefineMesh, 17));
+};
+
+
+/** @param {?proto.visualization.DefineMesh|undefined} value */
+proto.visualization.Command3D.prototype.setDefineMesh = function(value) {
+  jspb.Message.setOneofWrapperField(this, 17, proto.visualization.Command3D.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Command3D.prototype.clearDefineMesh = function() {
+  this.setDefineMesh(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Command3D.prototype.hasDefineMesh = function() {
+  return jspb.Message.getField(this, 17) != null;
+};
+
+
+/**
+ * optional DeleteMeshes delete_meshes = 18;
+ * @return {?proto.visualization.DeleteMeshes}
+ */
+proto.visualization.Command3D.prototype.getDeleteMeshes = function() {
+  return /** @type{?proto.visualization.DeleteMeshes} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.DeleteMeshes, 18));
+};
+
+
+/** @param {?proto.visualization.DeleteMeshes|undefined} value */
+proto.visualization.Command3D.prototype.setDeleteMeshes = function(value) {
+  jspb.Message.setOneofWrapperField(this, 18, proto.visualization.Command3D.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Command3D.prototype.clearDeleteMeshes = function() {
+  this.setDeleteMeshes(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Command3D.prototype.hasDeleteMeshes = function() {
+  return jspb.Message.getField(this, 18) != null;
+};
+
+
+/**
+ * optional DefineMaterial define_material = 19;
+ * @return {?proto.visualization.DefineMaterial}
+ */
+proto.visualization.Command3D.prototype.getDefineMaterial = function() {
+  return /** @type{?proto.visualization.DefineMaterial} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.DefineMaterial, 19));
+};
+
+
+/** @param {?proto.visualization.DefineMaterial|undefined} value */
+proto.visualization.Command3D.prototype.setDefineMaterial = function(value) {
+  jspb.Message.setOneofWrapperField(this, 19, proto.visualization.Command3D.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Command3D.prototype.clearDefineMaterial = function() {
+  this.setDefineMaterial(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Command3D.prototype.hasDefineMaterial = function() {
+  return jspb.Message.getField(this, 19) != null;
+};
+
+
+/**
+ * optional DeleteMaterials delete_materials = 20;
+ * @return {?proto.visualization.DeleteMaterials}
+ */
+proto.visualization.Command3D.prototype.getDeleteMaterials = function() {
+  return /** @type{?proto.visualization.DeleteMaterials} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.DeleteMaterials, 20));
+};
+
+
+/** @param {?proto.visualization.DeleteMaterials|undefined} value */
+proto.visualization.Command3D.prototype.setDeleteMaterials = function(value) {
+  jspb.Message.setOneofWrapperField(this, 20, proto.visualization.Command3D.oneofGroups_[0], value);
+};
+
+
+proto.visualization.Command3D.prototype.clearDeleteMaterials = function() {
+  this.setDeleteMaterials(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.Command3D.prototype.hasDeleteMaterials = function() {
+  return jspb.Message.getField(this, 20) != null;
+};
+
+
 
 /**
  * Generated by JsPbCodeGenerator.
@@ -9369,6 +14422,175 @@ proto.visualization.Scene3DUpdate.prototype.clearCommandsList = function() {
 
 
 
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.visualization.FrameCommit = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+};
+goog.inherits(proto.visualization.FrameCommit, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.visualization.FrameCommit.displayName = 'proto.visualization.FrameCommit';
+}
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.visualization.FrameCommit.prototype.toObject = function(opt_includeInstance) {
+  return proto.visualization.FrameCommit.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.visualization.FrameCommit} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.FrameCommit.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    frameId: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    simTime: +jspb.Message.getFieldWithDefault(msg, 2, 0.0)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.visualization.FrameCommit}
+ */
+proto.visualization.FrameCommit.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.visualization.FrameCommit;
+  return proto.visualization.FrameCommit.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.visualization.FrameCommit} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.visualization.FrameCommit}
+ */
+proto.visualization.FrameCommit.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readUint64());
+      msg.setFrameId(value);
+      break;
+    case 2:
+      var value = /** @type {number} */ (reader.readDouble());
+      msg.setSimTime(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.visualization.FrameCommit.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.visualization.FrameCommit.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.visualization.FrameCommit} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.visualization.FrameCommit.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getFrameId();
+  if (f !== 0) {
+    writer.writeUint64(
+      1,
+      f
+    );
+  }
+  f = message.getSimTime();
+  if (f !== 0.0) {
+    writer.writeDouble(
+      2,
+      f
+    );
+  }
+};
+
+
+/**
+ * optional uint64 frame_id = 1;
+ * @return {number}
+ */
+proto.visualization.FrameCommit.prototype.getFrameId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/** @param {number} value */
+proto.visualization.FrameCommit.prototype.setFrameId = function(value) {
+  jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+/**
+ * optional double sim_time = 2;
+ * @return {number}
+ */
+proto.visualization.FrameCommit.prototype.getSimTime = function() {
+  return /** @type {number} */ (+jspb.Message.getFieldWithDefault(this, 2, 0.0));
+};
+
+
+/** @param {number} value */
+proto.visualization.FrameCommit.prototype.setSimTime = function(value) {
+  jspb.Message.setProto3FloatField(this, 2, value);
+};
+
+
+
 /**
  * Generated by JsPbCodeGenerator.
  * @param {Array=} opt_data Optional initial data array, typically from a
@@ -9394,7 +14616,7 @@ if (goog.DEBUG && !COMPILED) {
  * @private {!Array<!Array<number>>}
  * @const
  */
-proto.visualization.VisMessage.oneofGroups_ = [[1,2]];
+proto.visualization.VisMessage.oneofGroups_ = [[1,2,4]];
 
 /**
  * @enum {number}
@@ -9402,7 +14624,8 @@ proto.visualization.VisMessage.oneofGroups_ = [[1,2]];
 proto.visualization.VisMessage.MessageDataCase = {
   MESSAGE_DATA_NOT_SET: 0,
   SCENE_2D_UPDATE: 1,
-  SCENE_3D_UPDATE: 2
+  SCENE_3D_UPDATE: 2,
+  FRAME_COMMIT: 4
 };
 
 /**
@@ -9442,7 +14665,9 @@ proto.visualization.VisMessage.prototype.toObject = function(opt_includeInstance
 proto.visualization.VisMessage.toObject = function(includeInstance, msg) {
   var f, obj = {
     scene2dUpdate: (f = msg.getScene2dUpdate()) && proto.visualization.Scene2DUpdate.toObject(includeInstance, f),
-    scene3dUpdate: (f = msg.getScene3dUpdate()) && proto.visualization.Scene3DUpdate.toObject(includeInstance, f)
+    scene3dUpdate: (f = msg.getScene3dUpdate()) && proto.visualization.Scene3DUpdate.toObject(includeInstance, f),
+    frameCommit: (f = msg.getFrameCommit()) && proto.visualization.FrameCommit.toObject(includeInstance, f),
+    frameId: jspb.Message.getFieldWithDefault(msg, 3, 0)
   };
 
   if (includeInstance) {
@@ -9489,6 +14714,15 @@ proto.visualization.VisMessage.deserializeBinaryFromReader = function(msg, reade
       reader.readMessage(value,proto.visualization.Scene3DUpdate.deserializeBinaryFromReader);
       msg.setScene3dUpdate(value);
       break;
+    case 4:
+      var value = new proto.visualization.FrameCommit;
+      reader.readMessage(value,proto.visualization.FrameCommit.deserializeBinaryFromReader);
+      msg.setFrameCommit(value);
+      break;
+    case 3:
+      var value = /** @type {number} */ (reader.readUint64());
+      msg.setFrameId(value);
+      break;
     default:
       reader.skipField();
       break;
@@ -9534,6 +14768,21 @@ proto.visualization.VisMessage.serializeBinaryToWriter = function(message, write
       proto.visualization.Scene3DUpdate.serializeBinaryToWriter
     );
   }
+  f = message.getFrameCommit();
+  if (f != null) {
+    writer.writeMessage(
+      4,
+      f,
+      proto.visualization.FrameCommit.serializeBinaryToWriter
+    );
+  }
+  f = message.getFrameId();
+  if (f !== 0) {
+    writer.writeUint64(
+      3,
+      f
+    );
+  }
 };
 
 
@@ -9597,3 +14846,57 @@ proto.visualization.VisMessage.prototype.hasScene3dUpdate = function() {
 };
 
 
+/**
+ * optional FrameCommit frame_commit = 4;
+ * @return {?proto.visualization.FrameCommit}
+ */
+proto.visualization.VisMessage.prototype.getFrameCommit = function() {
+  return /** @type{?proto.visualization.FrameCommit} */ (
+    jspb.Message.getWrapperField(this, proto.visualization.FrameCommit, 4));
+};
+
+
+/** @param {?proto.visualization.FrameCommit|undefined} value */
+proto.visualization.VisMessage.prototype.setFrameCommit = function(value) {
+  jspb.Message.setOneofWrapperField(this, 4, proto.visualization.VisMessage.oneofGroups_[0], value);
+};
+
+
+proto.visualization.VisMessage.prototype.clearFrameCommit = function() {
+  this.setFrameCommit(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {!boolean}
+ */
+proto.visualization.VisMessage.prototype.hasFrameCommit = function() {
+  return jspb.Message.getField(this, 4) != null;
+};
+
+
+/**
+ * optional uint64 frame_id = 3;
+ * @return {number}
+ */
+proto.visualization.VisMessage.prototype.getFrameId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 3, 0));
+};
+
+
+/** @param {number} value */
+proto.visualization.VisMessage.prototype.setFrameId = function(value) {
+  jspb.Message.setProto3IntField(this, 3, value);
+};
+
+
+/**
+ * @enum {number}
+ */
+proto.visualization.ObjectLayer = {
+  LAYER_DYNAMIC: 0,
+  LAYER_STATIC: 1
+};
+
+
@@ -10,6 +10,167 @@ import { LineMaterial } from './lib/LineMaterial.js';
 
 const proto = window.proto;
 
+/**
+ * 把小端 float32 顶点数组（bytes 字段）视作 Float32Array。
+ * 解码得到的 Uint8Array 是消息缓冲区的子视图，偏移按 4 字节对齐时不拷贝，否则复制一次
+ */
+function toFloat32Array(bytes) {
+    if (bytes.byteOffset % 4 === 0) {
+        return new Float32Array(bytes.buffer, bytes.byteOffset, bytes.byteLength >> 2);
+    }
+    return new Float32Array(bytes.slice().buffer);
+}
+
+/**
+ * 读取 Line2D / Polygon / AppendPoints 的二维顶点（x/y 交错）。窗口开启量化时
+ * 顶点以定点差分 dxy 发送：逐点累加后按 origin + q * step 还原
+ * @param {proto.visualization.Quantization} quantization 窗口的量化参数，未开启为 null
+ */
+function readXy(geom, quantization) {
+    const dxy = geom.getDxyList();
+    if (!quantization || dxy.length === 0) {
+        return toFloat32Array(geom.getXy_asU8());
+    }
+    const step = quantization.getStep();
+    const origin = quantization.getOrigin();
+    const ox = origin ? origin.getX() : 0;
+    const oy = origin ? origin.getY() : 0;
+    const xy = new Float32Array(dxy.length & ~1);
+    let qx = 0;
+    let qy = 0;
+    for (let i = 0; i < xy.length; i += 2) {
+        qx += dxy[i];
+        qy += dxy[i + 1];
+        xy[i] = ox + qx * step;
+        xy[i + 1] = oy + qy * step;
+    }
+    return xy;
+}
+
+/**
+ * x/y 交错的二维顶点展开为 LineGeometry 需要的 x/y/z（z 取 0），非法值置 0。
+ * close 为 true 时在末尾补上首点以闭合；label 非空时对非法值打印警告
+ */
+function xyToPositions(xy, close = false, label = null) {
+    const count = xy.length >> 1;
+    const total = (close && count > 0) ? count + 1 : count;
+    const positions = new Float32Array(total * 3);
+    let sanitized = 0;
+    for (let i = 0; i < count; i++) {
+        let x = xy[2 * i];
+        let y = xy[2 * i + 1];
+        if (!Number.isFinite(x)) { x = 0; sanitized++; }
+        if (!Number.isFinite(y)) { y = 0; sanitized++; }
+        positions[3 * i] = x;
+        positions[3 * i + 1] = y;
+    }
+    if (total > count) {
+        positions[3 * count] = positions[0];
+        positions[3 * count + 1] = positions[1];
+    }
+    if (label && sanitized > 0) {
+        console.warn(`[DEBUG ${label}] Sanitized ${sanitized} NaN/invalid coordinates`);
+    }
+    return positions;
+}
+
+/**
+ * 增量追加：保留已有顶点（x/y/z 交错）的前 start 个点，其后接上 tail。
+ * 同一段重复收到时结果不变；起点超出已有点数说明中间缺了数据，只能直接接上
+ */
+function appendPositions(kept, start, tail) {
+    const existing = kept || new Float32Array(0);
+    const keep = Math.min(start, existing.length / 3) * 3;
+    if (keep < start * 3) {
+        console.warn(`⚠️ 追加起点 ${start} 超出已有点数 ${existing.length / 3}`);
+    }
+    const positions = new Float32Array(keep + tail.length);
+    positions.set(existing.subarray(0, keep));
+    positions.set(tail, keep);
+    return positions;
+}
+
+/**
+ * 可部分更新的几何类型。键为几何 oneof 的 case（即字段号，Add/Update 命令中一致），
+ * 值为访问器名及各字段的 [字段号, 访问器名]；field_mask 第 i 位对应字段号 i
+ */
+const PARTIAL_GEOMETRY = {
+    4: { name: 'Pose2d', fields: [[1, 'Position'], [2, 'Theta']] },
+    5: { name: 'Circle', fields: [[1, 'Center'], [2, 'Radius']] },
+    6: { name: 'Box2d', fields: [[1, 'Center'], [2, 'Width'], [3, 'LengthFront'], [4, 'LengthRear']] },
+    11: { name: 'Pose3d', fields: [[1, 'Position'], [2, 'Quaternion']] },
+    12: { name: 'Ball', fields: [[1, 'Center'], [2, 'Radius']] },
+    13: { name: 'Box3d', fields: [[1, 'Center'], [2, 'XLength'], [3, 'YLength'], [4, 'ZLength']] },
+    21: { name: 'TriangleMesh3d', fields: [[1, 'MeshId'], [2, 'Pose']] },
+};
+
+/**
+ * 实例数组（InstanceArray）按 oneof 的字段号区分种类，值为每个实例的 float 数
+ */
+const INSTANCE_ARRAYS = {
+    18: { kind: 'box', stride: 10 },
+    19: { kind: 'circle', stride: 3 },
+    20: { kind: 'pose', stride: 3 },
+};
+const CIRCLE_SEGMENTS = 32;
+
+/**
+ * 栅格图层的着色器：格子值按 range 归一化后作为材质颜色的不透明度，
+ * 低于下限的格子不画
+ */
+const GRID_VERTEX_SHADER = `
+varying vec2 vUv;
+void main() {
+    vUv = uv;
+    gl_Position = projectionMatrix * modelViewMatrix * vec4(position, 1.0);
+}`;
+const GRID_FRAGMENT_SHADER = `
+uniform sampler2D map;
+uniform vec3 color;
+uniform float alpha;
+uniform vec2 range;
+varying vec2 vUv;
+void main() {
+    float value = texture2D(map, vUv).r;
+    float t = clamp((value - range.x) / max(range.y - range.x, 1e-6), 0.0, 1.0);
+    if (t <= 0.0) discard;
+    gl_FragColor = vec4(color, alpha * t);
+}`;
+
+/**
+ * 记下图元的完整几何，供之后的部分更新在其上合并
+ * @param {proto.visualization.Add2DObject|proto.visualization.Add3DObject} cmd
+ */
+function rememberGeometry(obj, cmd) {
+    const spec = PARTIAL_GEOMETRY[cmd.getGeometryDataCase()];
+    if (spec) obj.userData.geometry = cmd['get' + spec.name]();
+}
+
+/**
+ * 部分更新：把 field_mask 中的字段合并进记下的完整几何，再放回 cmd，
+ * 此后 cmd 与完整更新无异。完整更新则直接记下其几何。返回 field_mask
+ */
+function mergePartialGeometry(obj, cmd) {
+    const spec = PARTIAL_GEOMETRY[cmd.getGeometryDataCase()];
+    if (!spec) return 0;
+    const patch = cmd['get' + spec.name]();
+    const mask = cmd.getFieldMask();
+    if (mask === 0) {
+        obj.userData.geometry = patch;
+        return 0;
+    }
+    const full = obj.userData.geometry;
+    if (!full) {
+        console.warn(`⚠️ 图元 ${cmd.getId()} 收到部分更新，但没有完整几何可合并`);
+        return mask;
+    }
+    for (const [number, field] of spec.fields) {
+        if (mask & (1 << number)) full['set' + field](patch['get' + field]());
+    }
+    cmd['set' + spec.name](full);
+    return mask;
+}
+
 /**
  * Manages the overall application state, creating and managing multiple
  * 2D and 3D windows based on messages from the backend.
@@ -37,6 +198,24 @@ class AppManager {
         document.body.appendChild(this.windowContainer);
     }
 
+    // 显示最近提交的帧的仿真时间，收到第一个帧提交时才创建
+    setSimTime(simTime) {
+        if (!this.simTimeLabel) {
+            this.simTimeLabel = document.createElement('div');
+            this.simTimeLabel.id = 'sim-time';
+            this.simTimeLabel.style.cssText = `
+                position: fixed;
+                top: 4px;
+                right: 12px;
+                font: 12px monospace;
+                color: #555;
+                pointer-events: none;
+            `;
+            document.body.appendChild(this.simTimeLabel);
+        }
+        this.simTimeLabel.textContent = `t = ${simTime.toFixed(3)} s`;
+    }
+
     handleUpdate(sceneUpdate, updateType) {
         const windowId = sceneUpdate.getWindowId();
         const windowName = sceneUpdate.getWindowName();
@@ -97,6 +276,8 @@ class AppManager {
             2: 'UPDATE_OBJECT_GEOMETRY',
             3: 'UPDATE_OBJECT_PROPERTIES',
             4: 'DELETE_OBJECT',
+            5: 'DELETE_OBJECTS',
+            6: 'CLEAR_WINDOW',
             10: 'SET_GRID_VISIBLE',
             11: 'SET_AXES_VISIBLE',
             12: 'SET_TITLE',
@@ -203,7 +384,10 @@ class BasePlotter {
         this.container = container;
         this.windowId = windowId;
         this.sceneObjects = new Map();
+        this.staticObjectIds = new Set(); // 静态图层中的图元id，用于按图层清空
+        this.materials = new Map(); // material_id -> Material，见 DefineMaterial
         this.factory = new ObjectFactory(this);
+        this.quantization = null; // 窗口的坐标量化参数，见 CreateWindow.quantization
         window.addEventListener('resize', this.onWindowResize, false);
         this.highlightedObjectId = null; // 跟踪当前高亮的对象ID
         this.highlightInterval = null;   // 跟踪闪烁的定时器
@@ -214,6 +398,13 @@ class BasePlotter {
         // 定义用于存储动态计算的高亮色
         this.dynamicHighlightColor = null;
     }
+    /**
+     * 记录窗口创建时下发的量化参数，之后该窗口的二维顶点按此还原
+     * @param {proto.visualization.CreateWindow} cmd
+     */
+    setQuantization(cmd) {
+        this.quantization = cmd.hasQuantization() ? cmd.getQuantization() : null;
+    }
     /**
      * 根据物体的原始颜色计算一个高对比度的高亮色
      * @param {THREE.Color} originalColor 
@@ -243,6 +434,49 @@ class BasePlotter {
             highlightLightness
         );
     }
+    /**
+     * @param {proto.visualization.DefineMaterial} define
+     */
+    defineMaterial(define) {
+        this.materials.set(define.getMaterialId(), define.getMaterial());
+    }
+    /**
+     * 已建好的图元各自持有材质，这里只从材质表中移除
+     * @param {proto.visualization.DeleteMaterials} cmd
+     */
+    deleteMaterials(cmd) {
+        cmd.getMaterialIdsList().forEach(materialId => this.materials.delete(materialId));
+    }
+    /**
+     * AddObject 只带 material_id 时换上窗口材质表中的材质，之后照常按 getMaterial() 读取。
+     * 同一材质的图元共用这一个 Material 消息
+     */
+    resolveMaterial(cmd) {
+        const materialId = cmd.getMaterialId();
+        if (!materialId) return;
+        const material = this.materials.get(materialId);
+        if (material) {
+            cmd.setMaterial(material);
+        } else {
+            console.warn(`⚠️ 图元 ${cmd.getId()} 引用了未定义的材质 ${materialId}`);
+        }
+    }
+    /**
+     * 只换材质：就地修改已有材质的参数，几何不动。图例只在涉及图例的图元上刷新
+     * @param {proto.visualization.UpdateObjectProperties} cmd
+     */
+    updateProperties(cmd) {
+        const id = cmd.getId();
+        const obj = this.sceneObjects.get(id);
+        if (!obj) return;
+        this.resolveMaterial(cmd);
+        const material = cmd.getMaterial();
+        if (!material) return;
+        this.factory.restyle(obj, material);
+        // 闪烁中的图元恢复时应回到新材质
+        if (this.highlightedObjectId === id) this.saveOriginalMaterial(obj);
+        if (material.getLegend() || this.legendElements.has(id)) this.updateLegend(id, cmd);
+    }
     /**
      * 保存对象的原始材质颜色和渲染顺序
      */
@@ -361,12 +595,86 @@ class BasePlotter {
         if (this.sceneObjects.has(objectId)) {
             const obj = this.sceneObjects.get(objectId);
             this.scene.remove(obj);
-            if (obj.geometry) obj.geometry.dispose();
-            if (obj.material) {
-                const materials = Array.isArray(obj.material) ? obj.material : [obj.material];
-                materials.forEach(m => m.dispose());
+            this.releaseObject(objectId, obj);
+        }
+    }
+
+    /**
+     * 释放图元资源并从索引中移除（不处理场景树）
+     */
+    releaseObject(objectId, obj) {
+        if (obj.userData.grid && obj.userData.grid.texture) {
+            obj.userData.grid.texture.dispose();
+        }
+        if (obj.userData.instances) {
+            // 实例数组的网格都挂在 Group 下
+            obj.traverse(child => {
+                if (child.geometry) child.geometry.dispose();
+                if (child.material) child.material.dispose();
+            });
+        }
+        // 三角网格实例的几何由窗口共用，随 DeleteMeshes 释放
+        if (obj.geometry && obj.userData.meshId === undefined) obj.geometry.dispose();
+        if (obj.material) {
+            const materials = Array.isArray(obj.material) ? obj.material : [obj.material];
+            materials.forEach(m => m.dispose());
+        }
+        this.sceneObjects.delete(objectId);
+        this.staticObjectIds.delete(objectId);
+    }
+
+    /**
+     * 批量删除图元及其图例。场景子节点一次性过滤，
+     * 避免逐个 scene.remove 时 indexOf + splice 带来的 O(n²) 开销
+     */
+    removeObjects(objectIds) {
+        const removed = new Set();
+        for (const objectId of objectIds) {
+            if (objectId === this.highlightedObjectId) {
+                this.clearHighlight();
+                this.highlightedObjectId = null;
             }
-            this.sceneObjects.delete(objectId);
+            const obj = this.sceneObjects.get(objectId);
+            if (obj) {
+                removed.add(obj);
+                this.releaseObject(objectId, obj);
+            }
+            this.updateLegend(objectId, null);
+        }
+        if (removed.size === 0) return;
+
+        this.scene.children = this.scene.children.filter(child => !removed.has(child));
+        removed.forEach(obj => {
+            obj.parent = null;
+            obj.dispatchEvent({ type: 'removed' });
+        });
+    }
+
+    /**
+     * 按图层清空窗口中的图元
+     */
+    clearObjects(scope) {
+        const Scope = proto.visualization.ClearWindow.Scope;
+        const objectIds = [];
+        this.sceneObjects.forEach((obj, objectId) => {
+            const isStatic = this.staticObjectIds.has(objectId);
+            if (scope === Scope.ALL ||
+                (scope === Scope.STATIC && isStatic) ||
+                (scope === Scope.DYNAMIC && !isStatic)) {
+                objectIds.push(objectId);
+            }
+        });
+        this.removeObjects(objectIds);
+    }
+
+    /**
+     * 记录新添加图元所在的图层
+     */
+    setObjectLayer(objectId, layer) {
+        if (layer === proto.visualization.ObjectLayer.LAYER_STATIC) {
+            this.staticObjectIds.add(objectId);
+        } else {
+            this.staticObjectIds.delete(objectId);
         }
     }
 
@@ -512,6 +820,8 @@ class Plotter3D extends BasePlotter {
 
         // 图例元素管理
         this.legendElements = new Map();
+        // mesh_id -> 三角网格实例共用的 BufferGeometry，见 DefineMesh
+        this.meshes = new Map();
 
         // console.log(`📐 3D容器尺寸:`, {
         //     container: this.canvasContainer.clientWidth,
@@ -586,11 +896,14 @@ class Plotter3D extends BasePlotter {
         switch (commandType) {
             case proto.visualization.Command3D.CommandTypeCase.ADD_OBJECT: {
                 const cmd = command.getAddObject();
+                this.resolveMaterial(cmd);
                 const obj = this.factory.create3D(cmd);
                 if (obj) {
                     if (this.sceneObjects.has(cmd.getId())) this.removeObject(cmd.getId());
-                    obj.name = cmd.getId();
+                    obj.name = String(cmd.getId());
                     this.sceneObjects.set(cmd.getId(), obj);
+                    this.setObjectLayer(cmd.getId(), cmd.getLayer());
+                    rememberGeometry(obj, cmd);
                     this.scene.add(obj);
                     // 添加图例
                     this.updateLegend(cmd.getId(), cmd);
@@ -604,11 +917,20 @@ class Plotter3D extends BasePlotter {
                 }
                 break;
             }
+            case proto.visualization.Command3D.CommandTypeCase.UPDATE_OBJECT_PROPERTIES:
+                this.updateProperties(command.getUpdateObjectProperties());
+                break;
             case proto.visualization.Command3D.CommandTypeCase.DELETE_OBJECT:
                 const id_to_delete_3d = command.getDeleteObject().getId();
                 this.removeObject(id_to_delete_3d);
                 this.updateLegend(id_to_delete_3d, null);
                 break;
+            case proto.visualization.Command3D.CommandTypeCase.DELETE_OBJECTS:
+                this.removeObjects(command.getDeleteObjects().getIdsList());
+                break;
+            case proto.visualization.Command3D.CommandTypeCase.CLEAR_WINDOW:
+                this.clearObjects(command.getClearWindow().getScope());
+                break;
             case proto.visualization.Command3D.CommandTypeCase.SET_GRID_VISIBLE:
                 this.gridHelper.visible = command.getSetGridVisible().getVisible();
                 break;
@@ -624,17 +946,54 @@ class Plotter3D extends BasePlotter {
                 // 处理图例设置命令（如果需要）
                 break;
             case proto.visualization.Command3D.CommandTypeCase.CREATE_WINDOW:
-                // 窗口创建命令已经在AppManager中处理，这里可以记录日志
+                // 窗口创建命令已经在AppManager中处理，这里只记下量化参数
+                this.setQuantization(command.getCreateWindow());
                 // console.log("✅ 3D窗口创建命令已处理:", this.windowId);
                 break;
             case proto.visualization.Command3D.CommandTypeCase.DELETE_WINDOW:
                 // 删除窗口命令在AppManager级别处理，这里可以记录日志
                 // console.log("🔄 3D窗口收到删除命令，准备销毁:", this.windowId);
                 break;
+            case proto.visualization.Command3D.CommandTypeCase.DEFINE_MATERIAL:
+                this.defineMaterial(command.getDefineMaterial());
+                break;
+            case proto.visualization.Command3D.CommandTypeCase.DELETE_MATERIALS:
+                this.deleteMaterials(command.getDeleteMaterials());
+                break;
+            case proto.visualization.Command3D.CommandTypeCase.DEFINE_MESH:
+                this.defineMesh(command.getDefineMesh());
+                break;
+            case proto.visualization.Command3D.CommandTypeCase.DELETE_MESHES:
+                command.getDeleteMeshes().getMeshIdsList().forEach(meshId => {
+                    const geometry = this.meshes.get(meshId);
+                    if (geometry) geometry.dispose();
+                    this.meshes.delete(meshId);
+                });
+                break;
             default:
                 console.warn("⚠️ 未知的3D命令类型:", commandType);
         }
     }
+    /**
+     * 建立窗口内共用的三角网格几何，引用它的实例只各自带位姿和材质
+     * @param {proto.visualization.DefineMesh} define
+     */
+    defineMesh(define) {
+        const meshId = define.getMeshId();
+        // mesh_id 不会复用，重复定义（如重连）时内容相同
+        if (this.meshes.has(meshId)) return;
+        // 都复制一份，视图会让整个消息缓冲区无法回收
+        const positions = toFloat32Array(define.getXyz_asU8()).slice();
+        const indices = new Uint32Array(define.getIndices_asU8().slice().buffer);
+        const geometry = new THREE.BufferGeometry();
+        geometry.setAttribute('position', new THREE.BufferAttribute(positions, 3));
+        const vertexCount = positions.length / 3;
+        geometry.setIndex(new THREE.BufferAttribute(
+            vertexCount <= 65536 ? Uint16Array.from(indices) : indices, 1));
+        geometry.computeVertexNormals();
+        geometry.computeBoundingSphere();
+        this.meshes.set(meshId, geometry);
+    }
     /**
          * 更新3D窗口图例
          */
@@ -732,6 +1091,10 @@ class Plotter3D extends BasePlotter {
             this.axesHelper = null;
         }
 
+        // 清理共用的网格几何；引用它们的图元随后由父类释放，不会再碰这些几何
+        this.meshes.forEach(geometry => geometry.dispose());
+        this.meshes.clear();
+
         // 清理灯光
         const lights = [];
         this.scene.traverse(child => {
@@ -1767,7 +2130,10 @@ class Plotter2D extends BasePlotter {
 
         this.sceneObjects.forEach((obj) => {
             try {
-                const objBBox = new THREE.Box3().setFromObject(obj);
+                // 实例数组的几何只是单个实例，按实例算好的包围盒另存
+                const objBBox = obj.userData.instances
+                    ? obj.userData.instances.bounds.clone()
+                    : new THREE.Box3().setFromObject(obj);
 
                 // --- 修复开始：检查 NaN/Infinity ---
                 // 仅在包围盒有效时才合并
@@ -1902,11 +2268,14 @@ class Plotter2D extends BasePlotter {
         switch (commandType) {
             case proto.visualization.Command2D.CommandTypeCase.ADD_OBJECT: {
                 const cmd = command.getAddObject();
+                this.resolveMaterial(cmd);
                 const obj = this.factory.create2D(cmd);
                 if (obj) {
                     if (this.sceneObjects.has(cmd.getId())) this.removeObject(cmd.getId());
-                    obj.name = cmd.getId();
+                    obj.name = String(cmd.getId());
                     this.sceneObjects.set(cmd.getId(), obj);
+                    this.setObjectLayer(cmd.getId(), cmd.getLayer());
+                    rememberGeometry(obj, cmd);
                     this.scene.add(obj);
                     this.updateLegend(cmd.getId(), cmd);
                 }
@@ -1919,11 +2288,20 @@ class Plotter2D extends BasePlotter {
                 }
                 break;
             }
+            case proto.visualization.Command2D.CommandTypeCase.UPDATE_OBJECT_PROPERTIES:
+                this.updateProperties(command.getUpdateObjectProperties());
+                break;
             case proto.visualization.Command2D.CommandTypeCase.DELETE_OBJECT:
                 const id_to_delete = command.getDeleteObject().getId();
                 this.removeObject(id_to_delete);
                 this.updateLegend(id_to_delete, null);
                 break;
+            case proto.visualization.Command2D.CommandTypeCase.DELETE_OBJECTS:
+                this.removeObjects(command.getDeleteObjects().getIdsList());
+                break;
+            case proto.visualization.Command2D.CommandTypeCase.CLEAR_WINDOW:
+                this.clearObjects(command.getClearWindow().getScope());
+                break;
             case proto.visualization.Command2D.CommandTypeCase.SET_GRID_VISIBLE:
                 this.dynamicGrid.gridLines.visible = command.getSetGridVisible().getVisible();
                 break;
@@ -1961,13 +2339,20 @@ class Plotter2D extends BasePlotter {
                 }
                 break;
             case proto.visualization.Command2D.CommandTypeCase.CREATE_WINDOW:
-                // 窗口创建命令已经在AppManager中处理，这里可以记录日志
+                // 窗口创建命令已经在AppManager中处理，这里只记下量化参数
+                this.setQuantization(command.getCreateWindow());
                 // console.log("✅ 2D窗口创建命令已处理:", this.windowId);
                 break;
             case proto.visualization.Command2D.CommandTypeCase.DELETE_WINDOW:
                 // 删除窗口命令在AppManager级别处理，这里可以记录日志
                 // console.log("🔄 2D窗口收到删除命令，准备销毁:", this.windowId);
                 break;
+            case proto.visualization.Command2D.CommandTypeCase.DEFINE_MATERIAL:
+                this.defineMaterial(command.getDefineMaterial());
+                break;
+            case proto.visualization.Command2D.CommandTypeCase.DELETE_MATERIALS:
+                this.deleteMaterials(command.getDeleteMaterials());
+                break;
             default:
                 console.warn("⚠️ 未知的2D命令类型:", commandType);
         }
@@ -2339,25 +2724,66 @@ class ObjectFactory {
             }
             case proto.visualization.Add3DObject.GeometryDataCase.LINE_3D: {
                 const geom = cmd.getLine3d();
-                const points = geom.getPointsList().map(p => {
-                    const pos = p.getPosition(); // proto.visualization.Vec3
-                    return new THREE.Vector3(pos.getX(), pos.getY(), pos.getZ());
-                });
+                // x/y/z 交错，正好是 LineGeometry 需要的格式
+                const positions = toFloat32Array(geom.getXyz_asU8());
 
                 // 复用 createLineMaterial 辅助函数
                 const material = this.createLineMaterial(mat);
 
                 // 使用 LineGeometry
-                const positions = [];
-                points.forEach(p => positions.push(p.x, p.y, p.z));
                 const geometry = new LineGeometry();
                 geometry.setPositions(positions);
 
                 // 创建 Line2 对象
                 obj = new Line2(geometry, material);
                 obj.computeLineDistances(); // 支持虚线
+                // 记下顶点供增量追加使用；复制一份，视图会让整个消息缓冲区无法回收
+                obj.userData.positions = positions.slice();
 
-                // console.log(`🚀 创建3D线 (Line3D)，点数: ${points.length}`);
+                // console.log(`🚀 创建3D线 (Line3D)，点数: ${positions.length / 3}`);
+                break;
+            }
+
+            case proto.visualization.Add3DObject.GeometryDataCase.BOX_3D_ARRAY:
+            case proto.visualization.Add3DObject.GeometryDataCase.CIRCLE_ARRAY:
+            case proto.visualization.Add3DObject.GeometryDataCase.POSE_2D_ARRAY: {
+                obj = this.createInstanceArray(data, mat);
+                this.writeInstanceArray(obj, cmd);
+                break;
+            }
+            case proto.visualization.Add3DObject.GeometryDataCase.OCCUPANCY_GRID: {
+                obj = this.createGrid(mat);
+                this.writeGrid(obj, cmd.getOccupancyGrid());
+                break;
+            }
+            case proto.visualization.Add3DObject.GeometryDataCase.TRIANGLE_MESH_3D: {
+                const geom = cmd.getTriangleMesh3d();
+                const color = mat.getColor();
+                const alpha = (typeof color.getA === 'function') ? color.getA() : 1.0;
+                const material = new THREE.MeshStandardMaterial({
+                    color: new THREE.Color(color.getR(), color.getG(), color.getB()),
+                    roughness: 0.5,
+                    // 网格的绕序由用户决定，两面都画
+                    side: THREE.DoubleSide,
+                    transparent: alpha < 1.0,
+                    opacity: alpha
+                });
+                obj = new THREE.Mesh(undefined, material);
+                this.setSharedMesh(obj, geom.getMeshId());
+                this.updatePose(obj, geom.getPose());
+                break;
+            }
+            case proto.visualization.Add3DObject.GeometryDataCase.POINT_CLOUD_3D: {
+                const cloud = cmd.getPointCloud3d();
+                const color = mat.getColor();
+                const material = new THREE.PointsMaterial({
+                    color: new THREE.Color(color.getR(), color.getG(), color.getB()),
+                    // 点云点数多，默认画小一些
+                    size: mat.getPointSize() || 2,
+                    sizeAttenuation: false
+                });
+                obj = new THREE.Points(new THREE.BufferGeometry(), material);
+                this.writePointCloud(obj, cloud);
                 break;
             }
 
@@ -2381,22 +2807,20 @@ class ObjectFactory {
             }
             case proto.visualization.Add3DObject.GeometryDataCase.LINE_2D: {
                 const geom = cmd.getLine2d();
-                const points = geom.getPointsList().map(p =>
-                    new THREE.Vector3(p.getPosition().getX(), p.getPosition().getY(), 0));
+                const positions = xyToPositions(readXy(geom, this.plotter.quantization));
 
                 const material = this.createLineMaterial(mat);
                 material.depthTest = false; // 禁用深度测试
-                const positions = [];
-                points.forEach(p => positions.push(p.x, p.y, p.z));
                 const geometry = new LineGeometry();
                 geometry.setPositions(positions);
 
                 obj = new Line2(geometry, material);
                 obj.computeLineDistances(); // 用于虚线
+                obj.userData.positions = positions;
 
                 obj.renderOrder = 998; // 设置高渲染顺序
 
-                // console.log(`📏 创建3D窗口中的2D线，点数: ${points.length}`);
+                // console.log(`📏 创建3D窗口中的2D线，点数: ${positions.length / 3}`);
                 break;
             }
             case proto.visualization.Add3DObject.GeometryDataCase.POSE_2D: {
@@ -2514,22 +2938,16 @@ class ObjectFactory {
             }
             case proto.visualization.Add3DObject.GeometryDataCase.POLYGON: {
                 const geom = cmd.getPolygon();
-                const vertices = geom.getVerticesList().map(p =>
-                    new THREE.Vector3(p.getPosition().getX(), p.getPosition().getY(), 0));
-
                 const material = this.createLineMaterial(mat);
-                if (vertices.length > 0) {
-                    vertices.push(vertices[0].clone()); // 闭合 Line2
-                }
-                const positions = [];
-                vertices.forEach(p => positions.push(p.x, p.y, p.z));
+                // 末尾补上首点，闭合 Line2
+                const positions = xyToPositions(readXy(geom, this.plotter.quantization), true);
                 const geometry = new LineGeometry();
                 geometry.setPositions(positions);
 
                 obj = new Line2(geometry, material); // LineLoop 替换为 Line2
                 obj.computeLineDistances();
                 obj.renderOrder = 994;
-                // console.log(`🔺 创建多边形，顶点数: ${vertices.length}`);
+                // console.log(`🔺 创建多边形，顶点数: ${positions.length / 3}`);
                 break;
             }
             default: {
@@ -2540,6 +2958,7 @@ class ObjectFactory {
     }
 
     update3D(obj, cmd) {
+        mergePartialGeometry(obj, cmd);
         const data = cmd.getGeometryDataCase();
         switch (data) {
             case proto.visualization.Update3DObjectGeometry.GeometryDataCase.POINT_3D: {
@@ -2553,12 +2972,25 @@ class ObjectFactory {
                 break;
             }
             case proto.visualization.Update3DObjectGeometry.GeometryDataCase.BALL: {
-                const pos = cmd.getBall().getCenter().getPosition();
+                const geom = cmd.getBall();
+                const pos = geom.getCenter().getPosition();
                 obj.position.set(pos.getX(), pos.getY(), pos.getZ());
+                // 只有半径变化时才重建球体，只动圆心的更新不碰几何
+                if (obj.geometry.parameters.radius !== geom.getRadius()) {
+                    obj.geometry.dispose();
+                    obj.geometry = new THREE.SphereGeometry(geom.getRadius(), 32, 16);
+                }
                 break;
             }
             case proto.visualization.Update3DObjectGeometry.GeometryDataCase.BOX_3D: {
-                this.updatePose(obj, cmd.getBox3d().getCenter());
+                const geom = cmd.getBox3d();
+                this.updatePose(obj, geom.getCenter());
+                const size = obj.geometry.parameters;
+                if (size.width !== geom.getXLength() || size.height !== geom.getYLength() ||
+                    size.depth !== geom.getZLength()) {
+                    obj.geometry.dispose();
+                    obj.geometry = new THREE.BoxGeometry(geom.getXLength(), geom.getYLength(), geom.getZLength());
+                }
                 break;
             }
             // 添加2D图元更新
@@ -2573,12 +3005,9 @@ class ObjectFactory {
             }
             case proto.visualization.Update3DObjectGeometry.GeometryDataCase.LINE_2D: {
                 const geom = cmd.getLine2d();
-                const points = geom.getPointsList().map(p =>
-                    new THREE.Vector3(p.getPosition().getX(), p.getPosition().getY(), 0));
 
                 // 创建新的几何体
-                const positions = [];
-                points.forEach(p => positions.push(p.x, p.y, p.z));
+                const positions = xyToPositions(readXy(geom, this.plotter.quantization));
                 const newGeometry = new LineGeometry();
                 newGeometry.setPositions(positions);
 
@@ -2586,8 +3015,46 @@ class ObjectFactory {
                 obj.geometry.dispose();
                 obj.geometry = newGeometry;
                 obj.computeLineDistances();
+                obj.userData.positions = positions;
 
-                // console.log(`📏 更新2D线，新点数: ${points.length}`);
+                // console.log(`📏 更新2D线，新点数: ${positions.length / 3}`);
+                break;
+            }
+            case proto.visualization.Update3DObjectGeometry.GeometryDataCase.LINE_3D: {
+                const positions = toFloat32Array(cmd.getLine3d().getXyz_asU8()).slice();
+                const newGeometry = new LineGeometry();
+                newGeometry.setPositions(positions);
+
+                obj.geometry.dispose();
+                obj.geometry = newGeometry;
+                obj.computeLineDistances();
+                obj.userData.positions = positions;
+                break;
+            }
+            case proto.visualization.Update3DObjectGeometry.GeometryDataCase.POINT_CLOUD_3D: {
+                this.writePointCloud(obj, cmd.getPointCloud3d());
+                break;
+            }
+            case proto.visualization.Update3DObjectGeometry.GeometryDataCase.OCCUPANCY_GRID: {
+                this.writeGrid(obj, cmd.getOccupancyGrid());
+                break;
+            }
+            case proto.visualization.Update3DObjectGeometry.GeometryDataCase.TRIANGLE_MESH_3D: {
+                const geom = cmd.getTriangleMesh3d();
+                this.updatePose(obj, geom.getPose());
+                if (geom.getMeshId() !== obj.userData.meshId) {
+                    this.setSharedMesh(obj, geom.getMeshId());
+                }
+                break;
+            }
+            case proto.visualization.Update3DObjectGeometry.GeometryDataCase.BOX_3D_ARRAY:
+            case proto.visualization.Update3DObjectGeometry.GeometryDataCase.CIRCLE_ARRAY:
+            case proto.visualization.Update3DObjectGeometry.GeometryDataCase.POSE_2D_ARRAY: {
+                this.writeInstanceArray(obj, cmd);
+                break;
+            }
+            case proto.visualization.Update3DObjectGeometry.GeometryDataCase.APPEND_POINTS: {
+                this.appendLinePoints(obj, cmd.getAppendPoints());
                 break;
             }
             case proto.visualization.Update3DObjectGeometry.GeometryDataCase.POSE_2D: {
@@ -2681,14 +3148,8 @@ class ObjectFactory {
             }
             case proto.visualization.Update3DObjectGeometry.GeometryDataCase.POLYGON: {
                 const geom = cmd.getPolygon();
-                const vertices = geom.getVerticesList().map(p =>
-                    new THREE.Vector3(p.getPosition().getX(), p.getPosition().getY(), 0));
-
-                if (vertices.length > 0) {
-                    vertices.push(vertices[0].clone()); // 闭合
-                }
-                const positions = [];
-                vertices.forEach(p => positions.push(p.x, p.y, p.z));
+                // 末尾补上首点以闭合
+                const positions = xyToPositions(readXy(geom, this.plotter.quantization), true);
                 const newGeometry = new LineGeometry();
                 newGeometry.setPositions(positions);
 
@@ -2697,7 +3158,7 @@ class ObjectFactory {
                 obj.geometry = newGeometry;
                 obj.computeLineDistances();
 
-                // console.log(`🔺 更新多边形，新顶点数: ${vertices.length}`);
+                // console.log(`🔺 更新多边形，新顶点数: ${positions.length / 3}`);
                 break;
             }
         }
@@ -2705,6 +3166,17 @@ class ObjectFactory {
 
     // --- 2D Methods ---
     create2D(cmd) {
+        const dataCase = cmd.getGeometryDataCase();
+        if (INSTANCE_ARRAYS[dataCase]) {
+            const array = this.createInstanceArray(dataCase, cmd.getMaterial());
+            this.writeInstanceArray(array, cmd);
+            return array;
+        }
+        if (dataCase === proto.visualization.Add2DObject.GeometryDataCase.OCCUPANCY_GRID) {
+            const grid = this.createGrid(cmd.getMaterial());
+            this.writeGrid(grid, cmd.getOccupancyGrid());
+            return grid;
+        }
         const obj = this.create2DPlaceholder(cmd);
         // 对于简单类型，直接在这里更新
         const data = cmd.getGeometryDataCase();
@@ -2747,6 +3219,7 @@ class ObjectFactory {
     }
 
     update2D(obj, cmd, material) {
+        const mask = mergePartialGeometry(obj, cmd);
         const mat = material || obj.material;
         const data = cmd.getGeometryDataCase();
         const objectId = cmd.getId ? cmd.getId() : 'N/A'; // 获取对象ID用于调试
@@ -2776,72 +3249,60 @@ class ObjectFactory {
                 obj.geometry.attributes.position.needsUpdate = true;
                 break;
             }
+            case proto.visualization.Update2DObjectGeometry.GeometryDataCase.CIRCLE_ARRAY:
+            case proto.visualization.Update2DObjectGeometry.GeometryDataCase.POSE_2D_ARRAY: {
+                this.writeInstanceArray(obj, cmd);
+                break;
+            }
+            case proto.visualization.Update2DObjectGeometry.GeometryDataCase.OCCUPANCY_GRID: {
+                this.writeGrid(obj, cmd.getOccupancyGrid());
+                break;
+            }
             case proto.visualization.Update2DObjectGeometry.GeometryDataCase.POSE_2D: {
                 this.update2DPose(obj, cmd.getPose2d());
                 break;
             }
             case proto.visualization.Update2DObjectGeometry.GeometryDataCase.LINE_2D: {
                 const geom = cmd.getLine2d();
-                let points = []; // Initialize points array
-
-                if (geom && typeof geom.getPointsList === 'function') {
-                    // --- 修正：在 map 回调中加入 index 参数 ---
-                    points = geom.getPointsList().map((p, index) => {
-                        const pos = p.getPosition();
-                        if (!pos) {
-                            console.error(`[DEBUG ${objectId}/LINE_2D] Point ${index} has no position data!`);
-                            return new THREE.Vector3(0, 0, 0);
-                        }
-                        const x = pos.getX();
-                        const y = pos.getY();
-                        const safeX = (typeof x === 'number' && isFinite(x)) ? x : 0;
-                        const safeY = (typeof y === 'number' && isFinite(y)) ? y : 0;
-                        if (safeX !== x || safeY !== y) {
-                            console.warn(`[DEBUG ${objectId}/LINE_2D] Sanitized NaN/invalid data at index ${index}: raw=(${x}, ${y}), safe=(${safeX}, ${safeY})`);
-                        }
-                        return new THREE.Vector3(safeX, safeY, 0);
-                    });
+                let positions = new Float32Array(0);
+
+                if (geom && typeof geom.getXy_asU8 === 'function') {
+                    positions = xyToPositions(readXy(geom, this.plotter.quantization), false, `${objectId}/LINE_2D`);
                 } else {
                     console.error(`[DEBUG ${objectId}/LINE_2D] Invalid geometry data!`);
                 }
 
-                if (points.length === 0) {
+                if (positions.length === 0) {
                     obj.geometry.setPositions([]);
+                    obj.userData.positions = positions;
                     // obj.geometry.dispose();
                     // obj.geometry = new LineGeometry();
                     // obj.geometry.boundingBox = new THREE.Box3();
                     break;
                 }
-                const positions = [];
-                points.forEach(p => positions.push(p.x, p.y, p.z));
                 obj.geometry.dispose();
                 obj.geometry = new LineGeometry();
                 obj.geometry.setPositions(positions);
                 obj.geometry.computeBoundingBox();
                 obj.computeLineDistances();
+                obj.userData.positions = positions;
+                break;
+            }
+            case proto.visualization.Update2DObjectGeometry.GeometryDataCase.APPEND_POINTS: {
+                this.appendLinePoints(obj, cmd.getAppendPoints());
                 break;
             }
             case proto.visualization.Update2DObjectGeometry.GeometryDataCase.POLYGON: {
                 const geom = cmd.getPolygon();
-                let vertices = []; // Initialize vertices array
-
-                if (geom && typeof geom.getVerticesList === 'function') {
-                    // --- 修正：在 map 回调中加入 index 参数 ---
-                    vertices = geom.getVerticesList().map((p, index) => {
-                        const pos = p.getPosition();
-                        if (!pos) {
-                            console.error(`[DEBUG ${objectId}/POLYGON] Vertex ${index} has no position data!`);
-                            return new THREE.Vector2(0, 0);
-                        }
-                        const x = pos.getX();
-                        const y = pos.getY();
-                        const safeX = (typeof x === 'number' && isFinite(x)) ? x : 0;
-                        const safeY = (typeof y === 'number' && isFinite(y)) ? y : 0;
-                        if (safeX !== x || safeY !== y) {
-                            console.warn(`[DEBUG ${objectId}/POLYGON] Sanitized NaN/invalid data at vertex ${index}: raw=(${x}, ${y}), safe=(${safeX}, ${safeY})`);
-                        }
-                        return new THREE.Vector2(safeX, safeY);
-                    });
+                // 闭合后的 x/y/z 顶点，最后一个点是首点的重复
+                let positions = new Float32Array(0);
+                let vertices = []; // 填充用的 Vector2 顶点
+
+                if (geom && typeof geom.getXy_asU8 === 'function') {
+                    positions = xyToPositions(readXy(geom, this.plotter.quantization), true, `${objectId}/POLYGON`);
+                    for (let i = 0; i + 3 < positions.length; i += 3) {
+                        vertices.push(new THREE.Vector2(positions[i], positions[i + 1]));
+                    }
                 } else {
                     console.error(`[DEBUG ${objectId}/POLYGON] Invalid geometry data!`);
                 }
@@ -2879,19 +3340,8 @@ class ObjectFactory {
                     }
                 }
 
-                // 2. 更新边线几何体
+                // 2. 更新边线几何体（positions 已在末尾补上首点，Line2 不会自动闭合）
                 if (lineMesh) {
-                    const points = vertices.map(v => new THREE.Vector3(v.x, v.y, 0));
-                    // 1. Line2 不会自动闭合，必须手动添加第一个点到末尾
-                    if (points.length > 0) {
-                        points.push(points[0].clone());
-                    }
-
-                    // 2. 转换为扁平数组
-                    const positions = [];
-                    points.forEach(p => positions.push(p.x, p.y, p.z));
-
-                    // 3. 设置 LineGeometry
                     lineMesh.geometry.dispose();
                     lineMesh.geometry = new LineGeometry();
                     lineMesh.geometry.setPositions(positions);
@@ -2936,6 +3386,14 @@ class ObjectFactory {
                 const fillMesh = obj.getObjectByName("shape_fill");
                 const lineMesh = obj.getObjectByName("shape_line");
 
+                // 部分更新只改了圆心（Circle.center 字段号为 1）时平移已有几何，不必重建
+                if (mask === 1 << 1 && lineMesh && lineMesh.userData.center) {
+                    const built = lineMesh.userData.center;
+                    lineMesh.position.set(safeX - built.x, safeY - built.y, 0);
+                    if (fillMesh) fillMesh.position.set(safeX, safeY, -0.01);
+                    break;
+                }
+
                 // 1. 更新填充几何体
                 if (fillMesh) {
                     fillMesh.geometry.dispose();
@@ -2966,6 +3424,9 @@ class ObjectFactory {
                     lineMesh.geometry.setPositions(positions);
                     lineMesh.geometry.computeBoundingBox(); // 计算包围盒
                     lineMesh.computeLineDistances();
+                    // 顶点已按圆心生成，记下圆心供之后只平移
+                    lineMesh.position.set(0, 0, 0);
+                    lineMesh.userData.center = { x: safeX, y: safeY };
 
                     if (mat && !fillMesh) {
                         this.applyMaterialLogic2D(fillMesh, lineMesh, mat);
@@ -3078,160 +3539,586 @@ class ObjectFactory {
                     if (child.material) child.material.dispose();
                 }
 
-                const poses = geom.getPosesList();
+                this.addTrajectoryPoses(obj, geom.getPosesList(), 0, mat, objectId);
 
-                // 安全地获取颜色 - 修正这部分
-                let fillColor, lineColor;
-                let lineProtoColor = null; // 用于存储线条的 proto 颜色对象
-                let opacity;
-                // 1. 获取填充颜色 (Fill Color) 和 透明度 (Opacity)
-                if (mat && mat.hasFillColor && mat.hasFillColor()) {
-                    // 1.1 如果提供了 fill_color，使用它
-                    const fillColorObj = mat.getFillColor();
-                    fillColor = new THREE.Color(fillColorObj.getR(), fillColorObj.getG(), fillColorObj.getB());
+                break;
+            }
+            case proto.visualization.Update2DObjectGeometry.GeometryDataCase.APPEND_POSES: {
+                const append = cmd.getAppendPoses();
+                // 每个位姿对应填充和边线两个子对象，保留前 start 个位姿
+                const keep = Math.min(append.getStart(), obj.children.length / 2) * 2;
+                while (obj.children.length > keep) {
+                    const child = obj.children[obj.children.length - 1];
+                    obj.remove(child);
+                    if (child.geometry) child.geometry.dispose();
+                    if (child.material) child.material.dispose();
+                }
+                this.addTrajectoryPoses(obj, append.getPosesList(), keep / 2, mat, objectId);
+                break;
+            }
+        }
+        // 只在有 material 的对象上检查最终状态
+        // if (obj.material) {
+        //     console.log(`🔍 最终材质状态 - 颜色:`, obj.material.color, `透明度:`, obj.material.opacity, `是否透明:`, obj.material.transparent);
+        // } else {
+        //     console.log(`🔍 最终状态 - obj没有material属性`);
+        // }
+    }
 
-                    // 并且使用 fill_color 的 Alpha 通道
-                    opacity = (typeof fillColorObj.getA === 'function') ? fillColorObj.getA() : 1.0;
+    // --- Helper Methods ---
+    /**
+     * 折线的增量追加：obj 为 Line2，已有顶点记录在 obj.userData.positions
+     * @param {proto.visualization.AppendPoints} append
+     */
+    appendLinePoints(obj, append) {
+        const tail = append.hasXyz()
+            ? toFloat32Array(append.getXyz_asU8())
+            : xyToPositions(readXy(append, this.plotter.quantization));
+        const positions = appendPositions(obj.userData.positions, append.getStart(), tail);
+        obj.geometry.dispose();
+        obj.geometry = new LineGeometry();
+        obj.geometry.setPositions(positions);
+        obj.geometry.computeBoundingBox();
+        obj.computeLineDistances();
+        obj.userData.positions = positions;
+    }
 
-                } else if (mat && mat.getColor) {
-                    // 1.2 如果没有 fill_color，回退到 line_color 作为填充
-                    const colorObj = mat.getColor();
-                    fillColor = new THREE.Color(colorObj.getR(), colorObj.getG(), colorObj.getB());
+    /**
+     * 把一块点云写入 THREE.Points 的缓冲区。一帧分成若干块依次到达：start 为 0
+     * 的块开始新的一帧，其余块写在 start 偏移处。缓冲区按整帧点数 total 分配，
+     * 只在容量不足时重建，每块只上传新写入的那一段
+     * @param {THREE.Points} obj
+     * @param {proto.visualization.PointCloud3D} cloud
+     */
+    writePointCloud(obj, cloud) {
+        const xyz = toFloat32Array(cloud.getXyz_asU8());
+        const intensity = cloud.getIntensity_asU8();
+        const rgb = cloud.getRgb_asU8();
+        const hasColor = intensity.length > 0 || rgb.length > 0;
+        const start = cloud.getStart();
+        const count = xyz.length / 3;
+        const total = Math.max(cloud.getTotal(), start + count);
+        const geometry = obj.geometry;
+
+        let position = geometry.getAttribute('position');
+        let colorAttr = geometry.getAttribute('color');
+        if (!position || position.count < total || hasColor !== !!colorAttr) {
+            // 容量不足或着色方式变了：换成新的缓冲区，保留已写入的前 start 个点
+            const newPosition = new THREE.BufferAttribute(new Float32Array(total * 3), 3);
+            newPosition.setUsage(THREE.DynamicDrawUsage);
+            if (position && start > 0) newPosition.array.set(position.array.subarray(0, start * 3));
+            geometry.setAttribute('position', newPosition);
+            position = newPosition;
+            if (hasColor) {
+                const newColor = new THREE.BufferAttribute(new Float32Array(total * 3), 3);
+                newColor.setUsage(THREE.DynamicDrawUsage);
+                if (colorAttr && start > 0) newColor.array.set(colorAttr.array.subarray(0, start * 3));
+                geometry.setAttribute('color', newColor);
+                colorAttr = newColor;
+            } else if (colorAttr) {
+                geometry.deleteAttribute('color');
+                colorAttr = null;
+            }
+            obj.material.vertexColors = hasColor;
+            // 逐点着色时顶点颜色与材质颜色相乘，改为白色
+            if (hasColor) obj.material.color.set(0xffffff);
+            obj.material.needsUpdate = true;
+        }
 
-                    // 并且使用默认的 0.3 透明度 (与 Polygon/Box 逻辑一致)
-                    opacity = 0.3;
-                } else {
-                    // 1.3 紧急默认值
-                    fillColor = new THREE.Color(0x00ff00); // 默认颜色
-                    opacity = 0.3; // 默认透明度
+        position.array.set(xyz, start * 3);
+        this.markUpdateRange(position, start * 3, count * 3);
+        if (colorAttr) {
+            const colors = colorAttr.array;
+            if (rgb.length > 0) {
+                for (let i = 0, o = start * 3; i < count * 3; ++i, ++o) {
+                    colors[o] = rgb[i] / 255;
                 }
-
-                // 2. 获取线条颜色 (Line Color)
-                if (mat && mat.getColor) {
-                    lineProtoColor = mat.getColor();
-                    lineColor = new THREE.Color(lineProtoColor.getR(), lineProtoColor.getG(), lineProtoColor.getB());
-                } else {
-                    lineColor = new THREE.Color(0x006600); // 默认线条颜色
+            } else {
+                // 强度按 [0, 1] 映射为蓝 → 红的色带
+                const values = toFloat32Array(intensity);
+                const c = new THREE.Color();
+                for (let i = 0; i < count; ++i) {
+                    const v = Math.min(Math.max(values[i], 0), 1);
+                    c.setHSL((1 - v) * 0.66, 1, 0.5);
+                    colors[(start + i) * 3] = c.r;
+                    colors[(start + i) * 3 + 1] = c.g;
+                    colors[(start + i) * 3 + 2] = c.b;
                 }
+            }
+            this.markUpdateRange(colorAttr, start * 3, count * 3);
+        }
 
-                // 3. 获取线宽
-                const lineWidth = (mat && mat.getLineWidth) ? mat.getLineWidth() : 1;
-
-                // console.log(`🎨 TRAJECTORY颜色 - 填充: ${fillColor.getHexString()}, 线条: ${lineColor.getHexString()}`);
-
-                poses.forEach((pose, index) => {
-                    let safeX = 0, safeY = 0, safeTheta = 0, safeW = 0.1, safeLf = 0.1, safeLr = 0.1;
-                    let rawX, rawY, rawTheta, rawW, rawLf, rawLr;
-
-                    if (pose && pose.getCenter()) {
-                        const center = pose.getCenter();
-                        const centerPos = center.getPosition();
-                        if (centerPos) {
-                            rawX = centerPos.getX();
-                            rawY = centerPos.getY();
-                            safeX = (typeof rawX === 'number' && isFinite(rawX)) ? rawX : 0;
-                            safeY = (typeof rawY === 'number' && isFinite(rawY)) ? rawY : 0;
-                        } else {
-                            // centerPos 为 null 或 undefined
-                            rawX = undefined;
-                            rawY = undefined;
-                            safeX = 0;
-                            safeY = 0;
-                        }
-                        rawTheta = center.getTheta();
-                        safeTheta = (typeof rawTheta === 'number' && isFinite(rawTheta)) ? rawTheta : 0;
-
-                        rawW = pose.getWidth ? pose.getWidth() : 0.1;
-                        rawLf = pose.getLengthFront ? pose.getLengthFront() : 0.1;
-                        rawLr = pose.getLengthRear ? pose.getLengthRear() : 0.1;
-                        safeW = (typeof rawW === 'number' && isFinite(rawW) && rawW > 0) ? rawW : 0.1;
-                        safeLf = (typeof rawLf === 'number' && isFinite(rawLf) && rawLf > 0) ? rawLf : 0.1;
-                        safeLr = (typeof rawLr === 'number' && isFinite(rawLr) && rawLr > 0) ? rawLr : 0.1;
-                    } else {
-                        rawX = rawY = rawTheta = rawW = rawLf = rawLr = undefined;
-                        console.error(`[DEBUG ${objectId}/TRAJECTORY_2D @ index ${index}] Invalid pose data!`);
-                    }
+        geometry.setDrawRange(0, start + count);
+        // 包围球用于视锥剔除；只在一帧写完时重算，避免每块都遍历全部点
+        if (start + count >= total) geometry.computeBoundingSphere();
+    }
 
-                    if (safeX !== rawX || safeY !== rawY || safeTheta !== rawTheta || safeW !== rawW || safeLf !== rawLf || safeLr !== rawLr) {
-                        console.warn(`[DEBUG ${objectId}/TRAJECTORY_2D @ index ${index}] Sanitized NaN/invalid data:`);
-                        console.warn(`  raw= (x: ${rawX}, y: ${rawY}, th: ${rawTheta}, w: ${rawW}, lf: ${rawLf}, lr: ${rawLr})`);
-                        console.warn(`  safe= (x: ${safeX}, y: ${safeY}, th: ${safeTheta}, w: ${safeW}, lf: ${safeLf}, lr: ${safeLr})`);
-                    }
+    /**
+     * 扩大属性的待上传区间。同一渲染帧内可能先后写入多段，
+     * 上传后 three.js 会把 updateRange.count 复位为 -1
+     */
+    markUpdateRange(attribute, offset, count) {
+        const range = attribute.updateRange;
+        if (range.count < 0) {
+            range.offset = offset;
+            range.count = count;
+        } else {
+            const end = Math.max(range.offset + range.count, offset + count);
+            range.offset = Math.min(range.offset, offset);
+            range.count = end - range.offset;
+        }
+        attribute.needsUpdate = true;
+    }
 
-                    const localCorners = [
-                        new THREE.Vector2(-safeLr, safeW / 2),
-                        new THREE.Vector2(safeLf, safeW / 2),
-                        new THREE.Vector2(safeLf, -safeW / 2),
-                        new THREE.Vector2(-safeLr, -safeW / 2)
-                    ];
-
-                    const worldCorners = localCorners.map(corner => {
-                        const rotated = new THREE.Vector2(
-                            corner.x * Math.cos(safeTheta) - corner.y * Math.sin(safeTheta),
-                            corner.x * Math.sin(safeTheta) + corner.y * Math.cos(safeTheta)
-                        );
-                        return new THREE.Vector3(
-                            rotated.x + safeX,
-                            rotated.y + safeY,
-                            0
-                        );
-                    });
-
-                    // 创建填充的矩形
-                    const shape = new THREE.Shape(worldCorners.map(v => new THREE.Vector2(v.x, v.y)));
-                    const fillGeometry = new THREE.ShapeGeometry(shape);
-                    const fillMesh = new THREE.Mesh(fillGeometry, new THREE.MeshBasicMaterial({
-                        color: fillColor,
-                        transparent: true,
-                        opacity: opacity, // <--- 现在使用动态获取的 opacity
-                        side: THREE.DoubleSide
-                    }));
-                    fillMesh.position.z = -0.01;
-                    fillMesh.name = `trajectory_fill_${index}`;
-
-                    // --- (创建 Line2 和 LineMaterial 的逻辑不变) ---
-                    const closedCorners = [...worldCorners, worldCorners[0]];
-                    const positions = [];
-                    closedCorners.forEach(p => positions.push(p.x, p.y, p.z));
-                    const lineGeometry = new LineGeometry();
-                    lineGeometry.setPositions(positions);
-                    lineGeometry.computeBoundingBox(); // 计算包围盒
+    /**
+     * 创建栅格图层：单位正方形按栅格范围缩放，格子存在一张单通道纹理中，
+     * 纹理在 writeGrid 中按尺寸建立
+     * @param {proto.visualization.Material} mat
+     */
+    createGrid(mat) {
+        const color = mat.getColor();
+        const alpha = (typeof color.getA === 'function') ? color.getA() : 1.0;
+        const material = new THREE.ShaderMaterial({
+            uniforms: {
+                map: { value: null },
+                color: { value: new THREE.Color(color.getR(), color.getG(), color.getB()) },
+                alpha: { value: alpha },
+                range: { value: new THREE.Vector2(0, 1) },
+            },
+            vertexShader: GRID_VERTEX_SHADER,
+            fragmentShader: GRID_FRAGMENT_SHADER,
+            transparent: true,
+            depthWrite: false,
+            side: THREE.DoubleSide,
+        });
+        // 高亮按 material.color 改色，指向 uniform 即可生效
+        material.color = material.uniforms.color.value;
+        const obj = new THREE.Mesh(new THREE.PlaneGeometry(1, 1), material);
+        obj.renderOrder = -1; // 画在其他图元之下
+        obj.userData.grid = { width: 0, height: 0, isFloat: false, texture: null };
+        return obj;
+    }
 
-                    const resolution = new THREE.Vector2(
-                        this.plotter.coordinateSystem.canvasWidth,
-                        this.plotter.coordinateSystem.canvasHeight
-                    );
+    /**
+     * 写入栅格：partial 为 false 时按头部重建纹理（尺寸不变则复用）并整体上传；
+     * 否则把各瓦片写进 CPU 端数据，再用 texSubImage2D 只上传这些区域
+     * @param {THREE.Mesh} obj createGrid 的返回值
+     * @param {proto.visualization.OccupancyGrid} grid
+     */
+    writeGrid(obj, grid) {
+        const state = obj.userData.grid;
+        const width = grid.getWidth();
+        const height = grid.getHeight();
+        const isFloat = grid.getCellType() === proto.visualization.OccupancyGrid.CellType.FLOAT32;
+        if (!state.texture || width !== state.width || height !== state.height || isFloat !== state.isFloat) {
+            if (state.texture) state.texture.dispose();
+            const data = isFloat ? new Float32Array(width * height) : new Uint8Array(width * height);
+            state.texture = new THREE.DataTexture(data, width, height, THREE.RedFormat,
+                isFloat ? THREE.FloatType : THREE.UnsignedByteType);
+            state.texture.magFilter = THREE.NearestFilter;
+            state.texture.minFilter = THREE.NearestFilter;
+            state.texture.unpackAlignment = 1;
+            state.texture.needsUpdate = true;
+            Object.assign(state, { width, height, isFloat });
+            obj.material.uniforms.map.value = state.texture;
+        }
+
+        const resolution = grid.getResolution();
+        const origin = grid.getOrigin();
+        obj.scale.set(width * resolution, height * resolution, 1);
+        obj.position.set(origin.getX() + width * resolution / 2,
+            origin.getY() + height * resolution / 2, obj.position.z);
+        // UINT8 纹理采样得到的是 值/255
+        const scale = isFloat ? 1 : 1 / 255;
+        obj.material.uniforms.range.value.set(grid.getValueMin() * scale, grid.getValueMax() * scale);
+
+        const texture = state.texture;
+        const data = texture.image.data;
+        const renderer = grid.getPartial() ? this.plotter.renderer : null;
+        for (const tile of grid.getTilesList()) {
+            const x = tile.getX(), y = tile.getY();
+            const w = tile.getWidth(), h = tile.getHeight();
+            const bytes = tile.getCells_asU8();
+            const cells = isFloat ? toFloat32Array(bytes) : bytes;
+            if (cells.length < w * h) continue;
+            for (let row = 0; row < h; ++row) {
+                data.set(cells.subarray(row * w, (row + 1) * w), (y + row) * width + x);
+            }
+            if (renderer) {
+                const source = new THREE.DataTexture(cells, w, h, texture.format, texture.type);
+                renderer.copyTextureToTexture(new THREE.Vector2(x, y), source, texture);
+            }
+        }
+        // 整体写入，或没有渲染器可供局部上传时，下一帧整张上传
+        if (!renderer) texture.needsUpdate = true;
+    }
 
-                    const lineMat = new LineMaterial({
-                        color: lineColor.getHex(),
-                        linewidth: lineWidth,
-                        resolution: resolution,
-                        transparent: true,
-                        opacity: (lineProtoColor && typeof lineProtoColor.getA === 'function') ? lineProtoColor.getA() : 1.0
-                    });
+    /**
+     * 创建实例数组的空 Group，网格在 writeInstanceArray 中按容量建立。
+     * 同一数组的全部实例共用一份几何和材质，各用一个 InstancedMesh 绘制
+     * @param {number} dataCase Add/Update 命令中 geometry_data 的字段号
+     * @param {proto.visualization.Material} mat
+     */
+    createInstanceArray(dataCase, mat) {
+        const obj = new THREE.Group();
+        obj.userData.instances = {
+            ...INSTANCE_ARRAYS[dataCase],
+            material: mat,
+            values: new Float32Array(0),
+            total: 0,
+            capacity: 0,
+            bounds: new THREE.Box3(),
+        };
+        return obj;
+    }
 
-                    const lineMesh = new Line2(lineGeometry, lineMat);
-                    lineMesh.computeLineDistances();
-                    lineMesh.position.z = 0.02;
-                    lineMesh.name = `trajectory_line_${index}`;
-                    // --- (结束) ---
+    /**
+     * 把命令中的实例数组写入 Group：整个数组或按 starts/counts 的几段
+     * @param {THREE.Group} obj createInstanceArray 的返回值
+     * @param {proto.visualization.Add3DObject|proto.visualization.Update3DObjectGeometry|
+     *         proto.visualization.Add2DObject|proto.visualization.Update2DObjectGeometry} cmd
+     */
+    writeInstanceArray(obj, cmd) {
+        const state = obj.userData.instances;
+        const array = state.kind === 'box' ? cmd.getBox3dArray()
+            : state.kind === 'circle' ? cmd.getCircleArray() : cmd.getPose2dArray();
+        const stride = state.stride;
+        const values = toFloat32Array(array.getValues_asU8());
+        const total = array.getTotal();
+        let starts = array.getStartsList();
+        let counts = array.getCountsList();
+        if (starts.length === 0) {
+            starts = [0];
+            counts = [total];
+        }
 
-                    obj.add(fillMesh);
-                    obj.add(lineMesh);
-                });
+        let rebuilt = false;
+        if (total > state.capacity) {
+            // 容量按倍数增长，重建网格后全部实例重写一遍
+            const capacity = Math.max(total, state.capacity * 2, 16);
+            const grown = new Float32Array(capacity * stride);
+            grown.set(state.values.subarray(0, state.total * stride));
+            state.values = grown;
+            state.capacity = capacity;
+            this.buildInstanceMeshes(obj);
+            rebuilt = true;
+        }
 
-                break;
+        let offset = 0;
+        for (let i = 0; i < starts.length; ++i) {
+            const n = counts[i] * stride;
+            state.values.set(values.subarray(offset, offset + n), starts[i] * stride);
+            offset += n;
+            if (!rebuilt) this.updateInstances(obj, starts[i], counts[i]);
+        }
+        state.total = total;
+        if (rebuilt) this.updateInstances(obj, 0, total);
+        this.setInstanceCount(obj, total);
+        this.computeInstanceBounds(obj);
+    }
+
+    /**
+     * 按当前容量重建实例网格：box 为长方体，circle 为填充圆加边线，pose 为箭头
+     */
+    buildInstanceMeshes(obj) {
+        const state = obj.userData.instances;
+        const mat = state.material;
+        for (const child of [...obj.children]) {
+            obj.remove(child);
+            child.geometry.dispose();
+            child.material.dispose();
+        }
+        const color = mat.getColor();
+        const rgb = new THREE.Color(color.getR(), color.getG(), color.getB());
+        const capacity = state.capacity;
+
+        if (state.kind === 'box') {
+            const alpha = (typeof color.getA === 'function') ? color.getA() : 1.0;
+            const material = new THREE.MeshStandardMaterial({
+                color: rgb, roughness: 0.5, transparent: true, opacity: alpha, depthWrite: false
+            });
+            this.addInstancedMesh(obj, new THREE.BoxGeometry(1, 1, 1), material, capacity, 'instances');
+        } else if (state.kind === 'circle') {
+            // 填充颜色沿用 applyMaterialLogic2D 的规则：有 fill_color 用它，否则线色半透明
+            const hasFill = mat.hasFillColor && mat.hasFillColor();
+            const fill = hasFill ? mat.getFillColor() : color;
+            const fillMaterial = new THREE.MeshBasicMaterial({
+                color: new THREE.Color(fill.getR(), fill.getG(), fill.getB()),
+                side: THREE.DoubleSide,
+                transparent: true,
+                opacity: hasFill && typeof fill.getA === 'function' ? fill.getA() : 0.3,
+            });
+            const fillMesh = this.addInstancedMesh(obj, new THREE.CircleGeometry(1, CIRCLE_SEGMENTS),
+                fillMaterial, capacity, 'shape_fill');
+            fillMesh.position.z = -0.01;
+            fillMesh.visible = mat.getFilled();
+            // 边线不能实例化，所有圆的线段合并在一个 LineSegments 中，宽度固定为 1 像素
+            const geometry = new THREE.BufferGeometry();
+            const position = new THREE.BufferAttribute(new Float32Array(capacity * CIRCLE_SEGMENTS * 6), 3);
+            position.setUsage(THREE.DynamicDrawUsage);
+            geometry.setAttribute('position', position);
+            const outline = new THREE.LineSegments(geometry, new THREE.LineBasicMaterial({ color: rgb }));
+            outline.name = 'shape_line';
+            outline.frustumCulled = false;
+            obj.add(outline);
+        } else {
+            // 与单个 Pose2D 的 ArrowHelper 同尺寸（长 0.25）的平面箭头，沿 +x
+            const shape = new THREE.Shape();
+            shape.moveTo(0, -0.01);
+            shape.lineTo(0.15, -0.01);
+            shape.lineTo(0.15, -0.04);
+            shape.lineTo(0.25, 0);
+            shape.lineTo(0.15, 0.04);
+            shape.lineTo(0.15, 0.01);
+            shape.lineTo(0, 0.01);
+            const material = new THREE.MeshBasicMaterial({ color: rgb, side: THREE.DoubleSide });
+            this.addInstancedMesh(obj, new THREE.ShapeGeometry(shape), material, capacity, 'instances');
+        }
+    }
+
+    addInstancedMesh(obj, geometry, material, capacity, name) {
+        const mesh = new THREE.InstancedMesh(geometry, material, capacity);
+        mesh.instanceMatrix.setUsage(THREE.DynamicDrawUsage);
+        mesh.count = 0;
+        mesh.name = name;
+        // 包围球只按单个实例算，不能用来做视锥剔除
+        mesh.frustumCulled = false;
+        obj.add(mesh);
+        return mesh;
+    }
+
+    /**
+     * 由 values 重算 [start, start + count) 的实例矩阵（和圆的边线顶点）
+     */
+    updateInstances(obj, start, count) {
+        if (count <= 0) return;
+        const state = obj.userData.instances;
+        const v = state.values;
+        const stride = state.stride;
+        const m = new THREE.Matrix4();
+        const p = new THREE.Vector3();
+        const q = new THREE.Quaternion();
+        const scale = new THREE.Vector3();
+        const zAxis = new THREE.Vector3(0, 0, 1);
+        const mesh = obj.getObjectByName(state.kind === 'circle' ? 'shape_fill' : 'instances');
+        for (let i = start; i < start + count; ++i) {
+            const o = i * stride;
+            if (state.kind === 'box') {
+                p.set(v[o], v[o + 1], v[o + 2]);
+                q.set(v[o + 4], v[o + 5], v[o + 6], v[o + 3]);
+                scale.set(v[o + 7], v[o + 8], v[o + 9]);
+            } else if (state.kind === 'circle') {
+                p.set(v[o], v[o + 1], 0);
+                q.identity();
+                scale.set(v[o + 2], v[o + 2], 1);
+            } else {
+                p.set(v[o], v[o + 1], 0);
+                q.setFromAxisAngle(zAxis, v[o + 2]);
+                scale.set(1, 1, 1);
             }
+            mesh.setMatrixAt(i, m.compose(p, q, scale));
+        }
+        this.markUpdateRange(mesh.instanceMatrix, start * 16, count * 16);
+
+        if (state.kind === 'circle') {
+            const position = obj.getObjectByName('shape_line').geometry.getAttribute('position');
+            const out = position.array;
+            for (let i = start; i < start + count; ++i) {
+                const cx = v[i * 3], cy = v[i * 3 + 1], r = v[i * 3 + 2];
+                let k = i * CIRCLE_SEGMENTS * 6;
+                for (let s = 0; s < CIRCLE_SEGMENTS; ++s) {
+                    const a0 = (s / CIRCLE_SEGMENTS) * 2 * Math.PI;
+                    const a1 = ((s + 1) / CIRCLE_SEGMENTS) * 2 * Math.PI;
+                    out[k++] = cx + r * Math.cos(a0); out[k++] = cy + r * Math.sin(a0); out[k++] = 0;
+                    out[k++] = cx + r * Math.cos(a1); out[k++] = cy + r * Math.sin(a1); out[k++] = 0;
+                }
+            }
+            this.markUpdateRange(position, start * CIRCLE_SEGMENTS * 6, count * CIRCLE_SEGMENTS * 6);
         }
-        // 只在有 material 的对象上检查最终状态
-        // if (obj.material) {
-        //     console.log(`🔍 最终材质状态 - 颜色:`, obj.material.color, `透明度:`, obj.material.opacity, `是否透明:`, obj.material.transparent);
-        // } else {
-        //     console.log(`🔍 最终状态 - obj没有material属性`);
-        // }
     }
 
-    // --- Helper Methods ---
+    setInstanceCount(obj, total) {
+        for (const child of obj.children) {
+            if (child.isInstancedMesh) child.count = total;
+            else child.geometry.setDrawRange(0, total * CIRCLE_SEGMENTS * 2);
+        }
+    }
+
+    /**
+     * 按各实例的位置和尺寸估算包围盒，供 2D 窗口适应视图
+     */
+    computeInstanceBounds(obj) {
+        const state = obj.userData.instances;
+        const v = state.values;
+        const bounds = state.bounds.makeEmpty();
+        const p = new THREE.Vector3();
+        for (let i = 0; i < state.total; ++i) {
+            const o = i * state.stride;
+            if (state.kind === 'box') {
+                // 旋转后的长方体不超过以对角线为直径的球
+                const r = 0.5 * Math.hypot(v[o + 7], v[o + 8], v[o + 9]);
+                bounds.expandByPoint(p.set(v[o] - r, v[o + 1] - r, v[o + 2] - r));
+                bounds.expandByPoint(p.set(v[o] + r, v[o + 1] + r, v[o + 2] + r));
+            } else {
+                const r = state.kind === 'circle' ? v[o + 2] : 0.25;
+                bounds.expandByPoint(p.set(v[o] - r, v[o + 1] - r, 0));
+                bounds.expandByPoint(p.set(v[o] + r, v[o + 1] + r, 0));
+            }
+        }
+    }
+
+    /**
+     * 为轨迹 Group 逐个添加位姿的填充和边线，子对象名按 firstIndex 起编号。
+     * 材质只在创建时传入，记在 obj.userData.material 上供后续更新和追加沿用
+     * @param {THREE.Group} obj
+     * @param {Array<proto.visualization.Box2D>} poses
+     */
+    addTrajectoryPoses(obj, poses, firstIndex, material, objectId) {
+        const mat = material || obj.userData.material;
+        if (material) obj.userData.material = material;
+
+        // 安全地获取颜色 - 修正这部分
+        let fillColor, lineColor;
+        let lineProtoColor = null; // 用于存储线条的 proto 颜色对象
+        let opacity;
+        // 1. 获取填充颜色 (Fill Color) 和 透明度 (Opacity)
+        if (mat && mat.hasFillColor && mat.hasFillColor()) {
+            // 1.1 如果提供了 fill_color，使用它
+            const fillColorObj = mat.getFillColor();
+            fillColor = new THREE.Color(fillColorObj.getR(), fillColorObj.getG(), fillColorObj.getB());
+
+            // 并且使用 fill_color 的 Alpha 通道
+            opacity = (typeof fillColorObj.getA === 'function') ? fillColorObj.getA() : 1.0;
+
+        } else if (mat && mat.getColor) {
+            // 1.2 如果没有 fill_color，回退到 line_color 作为填充
+            const colorObj = mat.getColor();
+            fillColor = new THREE.Color(colorObj.getR(), colorObj.getG(), colorObj.getB());
+
+            // 并且使用默认的 0.3 透明度 (与 Polygon/Box 逻辑一致)
+            opacity = 0.3;
+        } else {
+            // 1.3 紧急默认值
+            fillColor = new THREE.Color(0x00ff00); // 默认颜色
+            opacity = 0.3; // 默认透明度
+        }
+
+        // 2. 获取线条颜色 (Line Color)
+        if (mat && mat.getColor) {
+            lineProtoColor = mat.getColor();
+            lineColor = new THREE.Color(lineProtoColor.getR(), lineProtoColor.getG(), lineProtoColor.getB());
+        } else {
+            lineColor = new THREE.Color(0x006600); // 默认线条颜色
+        }
+
+        // 3. 获取线宽
+        const lineWidth = (mat && mat.getLineWidth) ? mat.getLineWidth() : 1;
+
+        // console.log(`🎨 TRAJECTORY颜色 - 填充: ${fillColor.getHexString()}, 线条: ${lineColor.getHexString()}`);
+
+        poses.forEach((pose, i) => {
+            const index = firstIndex + i;
+            let safeX = 0, safeY = 0, safeTheta = 0, safeW = 0.1, safeLf = 0.1, safeLr = 0.1;
+            let rawX, rawY, rawTheta, rawW, rawLf, rawLr;
+
+            if (pose && pose.getCenter()) {
+                const center = pose.getCenter();
+                const centerPos = center.getPosition();
+                if (centerPos) {
+                    rawX = centerPos.getX();
+                    rawY = centerPos.getY();
+                    safeX = (typeof rawX === 'number' && isFinite(rawX)) ? rawX : 0;
+                    safeY = (typeof rawY === 'number' && isFinite(rawY)) ? rawY : 0;
+                } else {
+                    // centerPos 为 null 或 undefined
+                    rawX = undefined;
+                    rawY = undefined;
+                    safeX = 0;
+                    safeY = 0;
+                }
+                rawTheta = center.getTheta();
+                safeTheta = (typeof rawTheta === 'number' && isFinite(rawTheta)) ? rawTheta : 0;
+
+                rawW = pose.getWidth ? pose.getWidth() : 0.1;
+                rawLf = pose.getLengthFront ? pose.getLengthFront() : 0.1;
+                rawLr = pose.getLengthRear ? pose.getLengthRear() : 0.1;
+                safeW = (typeof rawW === 'number' && isFinite(rawW) && rawW > 0) ? rawW : 0.1;
+                safeLf = (typeof rawLf === 'number' && isFinite(rawLf) && rawLf > 0) ? rawLf : 0.1;
+                safeLr = (typeof rawLr === 'number' && isFinite(rawLr) && rawLr > 0) ? rawLr : 0.1;
+            } else {
+                rawX = rawY = rawTheta = rawW = rawLf = rawLr = undefined;
+                console.error(`[DEBUG ${objectId}/TRAJECTORY_2D @ index ${index}] Invalid pose data!`);
+            }
+
+            if (safeX !== rawX || safeY !== rawY || safeTheta !== rawTheta || safeW !== rawW || safeLf !== rawLf || safeLr !== rawLr) {
+                console.warn(`[DEBUG ${objectId}/TRAJECTORY_2D @ index ${index}] Sanitized NaN/invalid data:`);
+                console.warn(`  raw= (x: ${rawX}, y: ${rawY}, th: ${rawTheta}, w: ${rawW}, lf: ${rawLf}, lr: ${rawLr})`);
+                console.warn(`  safe= (x: ${safeX}, y: ${safeY}, th: ${safeTheta}, w: ${safeW}, lf: ${safeLf}, lr: ${safeLr})`);
+            }
+
+            const localCorners = [
+                new THREE.Vector2(-safeLr, safeW / 2),
+                new THREE.Vector2(safeLf, safeW / 2),
+                new THREE.Vector2(safeLf, -safeW / 2),
+                new THREE.Vector2(-safeLr, -safeW / 2)
+            ];
+
+            const worldCorners = localCorners.map(corner => {
+                const rotated = new THREE.Vector2(
+                    corner.x * Math.cos(safeTheta) - corner.y * Math.sin(safeTheta),
+                    corner.x * Math.sin(safeTheta) + corner.y * Math.cos(safeTheta)
+                );
+                return new THREE.Vector3(
+                    rotated.x + safeX,
+                    rotated.y + safeY,
+                    0
+                );
+            });
+
+            // 创建填充的矩形
+            const shape = new THREE.Shape(worldCorners.map(v => new THREE.Vector2(v.x, v.y)));
+            const fillGeometry = new THREE.ShapeGeometry(shape);
+            const fillMesh = new THREE.Mesh(fillGeometry, new THREE.MeshBasicMaterial({
+                color: fillColor,
+                transparent: true,
+                opacity: opacity, // <--- 现在使用动态获取的 opacity
+                side: THREE.DoubleSide
+            }));
+            fillMesh.position.z = -0.01;
+            fillMesh.name = `trajectory_fill_${index}`;
+
+            // --- (创建 Line2 和 LineMaterial 的逻辑不变) ---
+            const closedCorners = [...worldCorners, worldCorners[0]];
+            const positions = [];
+            closedCorners.forEach(p => positions.push(p.x, p.y, p.z));
+            const lineGeometry = new LineGeometry();
+            lineGeometry.setPositions(positions);
+            lineGeometry.computeBoundingBox(); // 计算包围盒
+
+            const resolution = new THREE.Vector2(
+                this.plotter.coordinateSystem.canvasWidth,
+                this.plotter.coordinateSystem.canvasHeight
+            );
+
+            const lineMat = new LineMaterial({
+                color: lineColor.getHex(),
+                linewidth: lineWidth,
+                resolution: resolution,
+                transparent: true,
+                opacity: (lineProtoColor && typeof lineProtoColor.getA === 'function') ? lineProtoColor.getA() : 1.0
+            });
+
+            const lineMesh = new Line2(lineGeometry, lineMat);
+            lineMesh.computeLineDistances();
+            lineMesh.position.z = 0.02;
+            lineMesh.name = `trajectory_line_${index}`;
+            // --- (结束) ---
+
+            obj.add(fillMesh);
+            obj.add(lineMesh);
+        });
+    }
+
     createBasicPointsMaterial(mat) {
         const color = mat.getColor();
         return new THREE.PointsMaterial({
@@ -3478,6 +4365,21 @@ class ObjectFactory {
         return updateCmd;
     }
 
+    /**
+     * 让三角网格实例改用窗口中 mesh_id 对应的共用几何。网格未定义时保留原几何
+     */
+    setSharedMesh(obj, meshId) {
+        const geometry = this.plotter.meshes.get(meshId);
+        if (!geometry) {
+            console.warn(`⚠️ 三角网格引用了未定义的网格 ${meshId}`);
+            return;
+        }
+        // 此前用的是 Mesh 自带的空几何，由这里释放；共用几何由窗口管理
+        if (obj.userData.meshId === undefined) obj.geometry.dispose();
+        obj.geometry = geometry;
+        obj.userData.meshId = meshId;
+    }
+
     updatePose(obj, poseProto) {
         const pos = poseProto.getPosition().getPosition();
         const quat = poseProto.getQuaternion();
@@ -3491,6 +4393,56 @@ class ObjectFactory {
         obj.position.set(pos.getX(), pos.getY(), 0);
         obj.rotation.z = angle;
     }
+    /**
+     * 就地改用新材质：只改颜色、透明度、线宽、线型和点的大小与形状，
+     * 不重建几何和材质对象。之后的轨迹追加、实例数组扩容按新材质创建
+     * @param {THREE.Object3D} obj
+     * @param {proto.visualization.Material} mat
+     */
+    restyle(obj, mat) {
+        const color = mat.getColor();
+        const alpha = (typeof color.getA === 'function') ? color.getA() : 1.0;
+        // 填充色的规则同 applyMaterialLogic2D
+        const hasFill = mat.hasFillColor && mat.hasFillColor();
+        const fill = hasFill ? mat.getFillColor() : color;
+        const fillAlpha = hasFill && typeof fill.getA === 'function' ? fill.getA() : 0.3;
+        if (obj.userData.material) obj.userData.material = mat;
+        if (obj.userData.instances) obj.userData.instances.material = mat;
+        if (obj.userData.grid) {
+            obj.material.uniforms.color.value.setRGB(color.getR(), color.getG(), color.getB());
+            obj.material.uniforms.alpha.value = alpha;
+            return;
+        }
+        obj.traverse(child => {
+            const material = child.material;
+            // AxesHelper 用顶点色，不随材质变化
+            if (!material || Array.isArray(material) || material.vertexColors) return;
+            if (child.name === 'shape_fill' || child.name.startsWith('trajectory_fill_')) {
+                material.color.setRGB(fill.getR(), fill.getG(), fill.getB());
+                material.opacity = fillAlpha;
+                material.transparent = true;
+                if (child.name === 'shape_fill') child.visible = mat.getFilled();
+                return;
+            }
+            material.color.setRGB(color.getR(), color.getG(), color.getB());
+            if (material.isLineMaterial) {
+                material.linewidth = mat.getLineWidth() || 1;
+                material.opacity = alpha;
+                material.dashed = mat.getLineStyle() === proto.visualization.Material.LineStyle.DASHED;
+                if (material.dashed) {
+                    material.dashSize = 0.1;
+                    material.gapSize = 0.05;
+                }
+            } else if (material.isPointsMaterial) {
+                if (mat.getPointSize()) material.size = mat.getPointSize();
+                // 点云不用贴图，只有带形状贴图的点换形状
+                if (material.map) material.map = PointTextureFactory.getTexture(mat.getPointShape());
+            } else if (material.isMeshStandardMaterial) {
+                material.opacity = alpha;
+                if (alpha < 1.0) material.transparent = true;
+            }
+        });
+    }
     // *** 新增: 辅助函数，用于应用材质逻辑 ***
     /**
      * @param {THREE.Mesh} fillMesh (shape_fill)
@@ -3554,6 +4506,7 @@ class ConnectionManager {
         this.ws = new WebSocket(url);
         this.ws.binaryType = "arraybuffer";
         this.appManager = appManager;
+        this.pendingFrame = [];  // 等待 FrameCommit 的消息
 
         this.ws.onopen = () => console.log("WebSocket connected to ws://localhost:9002");
         this.ws.onmessage = this.handleMessage;
@@ -3575,6 +4528,32 @@ class ConnectionManager {
         const messageType = visMessage.getMessageDataCase();
         // console.log("📋 消息类型:", messageType);
 
+        if (messageType === proto.visualization.VisMessage.MessageDataCase.FRAME_COMMIT) {
+            this.commitFrame(visMessage.getFrameCommit());
+            return;
+        }
+        // 帧内的消息先暂存，提交时在同一个事件中全部应用，中间不会渲染出半帧。
+        // 暂存期间到达的帧外消息（如重放）排在其后，保持先后顺序
+        if (visMessage.getFrameId() !== 0 || this.pendingFrame.length > 0) {
+            this.pendingFrame.push(visMessage);
+            return;
+        }
+        this.dispatch(visMessage);
+    }
+
+    commitFrame(commit) {
+        const messages = this.pendingFrame;
+        this.pendingFrame = [];
+        for (const visMessage of messages) {
+            this.dispatch(visMessage);
+        }
+        if (commit.getFrameId() !== 0) {
+            this.appManager.setSimTime(commit.getSimTime());
+        }
+    }
+
+    dispatch(visMessage) {
+        const messageType = visMessage.getMessageDataCase();
         if (messageType === proto.visualization.VisMessage.MessageDataCase.SCENE_3D_UPDATE) {
             const sceneUpdate = visMessage.getScene3dUpdate();
             // console.log("🎮 3D更新 - 窗口ID:", sceneUpdate.getWindowId(),